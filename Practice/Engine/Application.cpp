@@ -1,12 +1,14 @@
 #include "Application.h"
 #include "IRenderer.h"
 #include "D3D12Renderer.h"
+#include "NullRenderer.h"
 #include "Time.h"
 #include "RenderCamera.h"
 #include "Input.h"
 #include "DebugDraw.h"
 #include "ObjImporter_Minimal.h"
 #include <DirectXMath.h>
+#include <chrono>
 #include <stdexcept>
 #include <Windows.h>
 #if defined(_DEBUG)
@@ -34,22 +36,65 @@ void Application::Initialize(HINSTANCE hInstance)
     d3d->SetMeshManager(&m_meshManager);
     d3d->SetTextureManager(&m_textureManager);
 
-	// 4) RenderSystem ʱȭ
-    m_audioSystem.Initialize();
+	// 4)  â ũ 
+    m_lastW = m_window.GetWidth();
+    m_lastH = m_window.GetHeight();
+
+    // 5)  (ù Scene ε)
+    InitializeSystems(std::make_unique<PlayScene>());
+}
+
+void Application::InitializeHeadless(uint32_t width, uint32_t height, std::unique_ptr<Scene> scene)
+{
+    // â : ũ , Է  
+    m_headless = true;
+    m_lastW = std::max(width, 1u);
+    m_lastH = std::max(height, 1u);
+
+    Time::Initialize();
 
-	// 5) Importer 
+    auto nullRenderer = std::make_unique<NullRenderer>();
+    nullRenderer->Initialize(nullptr, m_lastW, m_lastH);
+    nullRenderer->SetMeshManager(&m_meshManager);
+    nullRenderer->SetTextureQuery([this](TextureHandle h)
+        {
+            if (!m_textureManager.IsValid(h))
+                return NullRenderer::TextureKind::Missing;
+            return m_textureManager.IsCubemap(h) ? NullRenderer::TextureKind::Cubemap : NullRenderer::TextureKind::Texture2D;
+        });
+    m_renderer = std::move(nullRenderer);
+
+    InitializeSystems(scene ? std::move(scene) : std::make_unique<PlayScene>());
+}
+
+void Application::InitializeSystems(std::unique_ptr<Scene> firstScene)
+{
+    //  ø ޽ bounds
+    m_renderSystem.SetMeshManager(&m_meshManager);
+    m_frameLoop.SetRenderer(m_renderer.get());
+    m_frameLoop.SetViewSize(m_lastW, m_lastH);
+
+	//  (帮 ġ   AudioSystem::Update ƹ͵  )
+    if (!m_headless)
+        m_audioSystem.Initialize();
+
+    // Ŀ Ǯ (physics island/narrowphase, transform  , RenderItem , command list ȭ ȭ)
+    m_jobs.Initialize();
+    m_physics.SetJobSystem(&m_jobs);
+    m_world.SetJobSystem(&m_jobs);
+    m_renderSystem.SetJobSystem(&m_jobs);
+    if (!m_headless)
+        static_cast<D3D12Renderer*>(m_renderer.get())->SetJobSystem(&m_jobs);
+
+	// Importer 
     m_registry.Register(std::make_unique<ObjImporter_Minimal>());
 
-	// 6) Ʈ/ؽƮ  ʱȭ
+	// Ʈ/ؽƮ  ʱȭ
     
-    // 7) ù Scene ε
-    m_sceneManager.Load(std::make_unique<PlayScene>());
-
-	// 8)  â ũ 
-    m_lastW = m_window.GetWidth();
-    m_lastH = m_window.GetHeight();
+    // ù Scene ε
+    m_sceneManager.Load(std::move(firstScene));
 
-	// 9)  · 
+	//  · 
     m_running = true;
 }
 
@@ -78,6 +123,65 @@ void Application::Run()
     }
 }
 
+FrameBenchResult Application::RunHeadless(uint32_t frames, double dt)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    FrameBenchResult r{};
+    r.width = m_lastW;
+    r.height = m_lastH;
+    r.dt = dt;
+
+    auto* nullRenderer = m_headless ? static_cast<NullRenderer*>(m_renderer.get()) : nullptr;
+    if (!nullRenderer || !m_running)
+        return r;
+
+    nullRenderer->ResetStats();
+
+    // Run   (Resize/޽ ó/Sleep ), dt ǽð  
+    for (uint32_t f = 0; f < frames && m_running; ++f)
+    {
+        const auto t0 = Clock::now();
+        BeginFrame();
+        m_dt = dt;
+
+        const auto t1 = Clock::now();
+        UpdateScene(m_dt);
+        const auto t2 = Clock::now();
+        TickFixed(m_dt);
+        const auto t3 = Clock::now();
+        UpdateTransforms();
+        const auto t4 = Clock::now();
+        UpdateSystems();
+        const auto t5 = Clock::now();
+        m_frameLoop.BuildLights();
+        const auto t6 = Clock::now();
+        SubmitFrame();
+        const auto t7 = Clock::now();
+        EndFrame();
+        const auto t8 = Clock::now();
+
+        r.scene.Add(ms(t1, t2));
+        r.fixed.Add(ms(t2, t3));
+        r.transforms.Add(ms(t3, t4));
+        r.systems.Add(ms(t4, t5));
+        r.lights.Add(ms(t5, t6));
+        r.render.Add(ms(t6, t7));
+        r.endFrame.Add(ms(t7, t8));
+        r.frame.Add(ms(t0, t8));
+
+        r.fixedSteps += m_fixedSteps;
+        ++r.frames;
+    }
+
+    r.entities = m_renderSystem.GetCullStats().entities;
+    r.lastFrame = nullRenderer->GetLastFrameStats();
+    r.total = nullRenderer->GetTotalStats();
+    r.errors = nullRenderer->GetErrors();
+    return r;
+}
+
 void Application::Shutdown()
 {
     // Scene 
@@ -86,7 +190,16 @@ void Application::Shutdown()
 	//  ý 
     m_audioSystem.Shutdown();
 
+    // Ŀ 
+    m_physics.SetJobSystem(nullptr);
+    m_world.SetJobSystem(nullptr);
+    m_renderSystem.SetJobSystem(nullptr);
+    if (m_renderer && !m_headless)
+        static_cast<D3D12Renderer*>(m_renderer.get())->SetJobSystem(nullptr);
+    m_jobs.Shutdown();
+
 	//  
+    m_frameLoop.SetRenderer(nullptr);
     if (m_renderer)
     {
         m_renderer->Shutdown();
@@ -97,111 +210,6 @@ void Application::Shutdown()
     m_running = false;
 }
 
-RenderCamera Application::BuildRenderCamera() const
-{
-    using namespace DirectX;
-
-    RenderCamera out{};
-
-    // 1) Ȱ ī޶ ã (å: ù CameraComponent  ƼƼ)
-    EntityId camEnt = m_world.FindActiveCamera();
-    if (!m_world.IsAlive(camEnt) || !m_world.HasTransform(camEnt) || !m_world.HasCamera(camEnt))
-    {
-        // : ӽ ī޶
-        XMMATRIX V = XMMatrixLookAtLH(
-            XMVectorSet(0.f, 0.f, -6.f, 1.f),
-            XMVectorSet(0.f, 0.8f, 0.f, 1.f),
-            XMVectorSet(0.f, 1.f, 0.f, 0.f));
-
-        float aspect = float(m_window.GetWidth()) / float(m_window.GetHeight());
-        XMMATRIX P = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), aspect, 0.1f, 1000.f);
-
-        XMStoreFloat4x4(&out.view, V);
-        XMStoreFloat4x4(&out.proj, P);
-        out.positionWS = DirectX::XMFLOAT3(0.f, 0.f, -6.f);
-        return out;
-    }
-
-    const auto& camT = m_world.GetTransform(camEnt);
-    const auto& camC = m_world.GetCamera(camEnt);
-
-    // 2) camera pos/rot LookToLH   (  )
-    XMFLOAT3 p = camT.position;
-    XMFLOAT4 q = camT.rotation;
-    out.positionWS = p;
-
-    XMVECTOR pos = XMVectorSet(p.x, p.y, p.z, 1.0f);
-    XMVECTOR quat = XMVectorSet(q.x, q.y, q.z, q.w);
-
-    //  "ī޶ ⺻ " +Z (LH)
-    XMVECTOR fwd = XMVector3Rotate(XMVectorSet(0, 0, 1, 0), quat);
-    XMVECTOR up = XMVector3Rotate(XMVectorSet(0, 1, 0, 0), quat);
-
-    XMMATRIX V = XMMatrixLookToLH(pos, fwd, up);
-
-    // 3) Projection 
-    float aspect = float(m_window.GetWidth()) / float(m_window.GetHeight());
-    float fovY = camC.FovYRadians();
-    XMMATRIX P = XMMatrixPerspectiveFovLH(fovY, aspect, camC.nearZ, camC.farZ);
-
-	// view/proj 
-    XMStoreFloat4x4(&out.view, V);
-    XMStoreFloat4x4(&out.proj, P);
-    return out;
-}
-
-
-
-FrameLights Application::BuildFrameLights(const RenderCamera& cam) const
-{
-    using namespace DirectX;
-
-    FrameLights out{};
-    out.cameraPosWS = cam.positionWS;
-
-    const auto& ents = m_world.GetLightEntities();
-    const auto& dense = m_world.GetLightsDense();
-
-    const uint32_t n = (uint32_t)std::min<size_t>(ents.size(), dense.size());
-
-    for (uint32_t i = 0; i < n && out.numLights < MaxLightsPerFrame; ++i)
-    {
-        const EntityId e = ents[i];
-        const LightComponent& lc = dense[i];
-        if (!lc.enabled) continue;
-        if (!m_world.HasTransform(e)) continue;
-
-        const auto& tr = m_world.GetTransform(e);
-
-        FrameLight& L = out.lights[out.numLights++];
-        L.type = (uint32_t)lc.type;
-
-        // Color/intensity
-        L.color = lc.color;
-        L.intensity = lc.intensity;
-
-        // World-space position (translation of world matrix)
-        const XMFLOAT3 posWS = XMFLOAT3(tr.world._41, tr.world._42, tr.world._43);
-        L.positionWS = posWS;
-        L.range = lc.range;
-
-        // World-space direction: transform +Z by world matrix
-        XMMATRIX W = XMLoadFloat4x4(&tr.world);
-        XMVECTOR dir = XMVector3TransformNormal(XMVectorSet(0, 0, 1, 0), W);
-        dir = XMVector3Normalize(dir);
-        XMFLOAT3 dirWS;
-        XMStoreFloat3(&dirWS, dir);
-        L.directionWS = dirWS;
-
-        // Spot cone (cos of half angles)
-        const float innerCos = cosf(lc.innerAngleRad * 0.5f);
-        const float outerCos = cosf(lc.outerAngleRad * 0.5f);
-		L.innerCos = innerCos;
-		L.outerCos = outerCos;
-    }
-
-    return out;
-}
 void Application::Resize()
 {
     //   (WM_SIZE width/height ŵ)
@@ -210,6 +218,7 @@ void Application::Resize()
     if ((w != m_lastW || h != m_lastH) && w != 0 && h != 0)
     {
         m_renderer->Resize(w, h);
+        m_frameLoop.SetViewSize(w, h);
         m_lastW = w;
         m_lastH = h;
     }
@@ -222,7 +231,7 @@ void Application::BeginFrame()
     m_dt = Time::DeltaTime();
 
     // world  
-    m_world.BeginFrame();
+    m_frameLoop.BeginFrame();
 
     // DebugDraw 
     DebugDraw::BeginFrame();
@@ -230,8 +239,9 @@ void Application::BeginFrame()
     // Per-frame text overlay list
     m_textItems.clear();
 
-    // Input 
-    m_input.Update();
+    // Input  (帮  Ű带       Է)
+    if (!m_headless)
+        m_input.Update();
 }
 
 void Application::UpdateScene(const double dt)
@@ -245,6 +255,7 @@ void Application::TickFixed(const double dtIn)
     double dt = dtIn;
     if (dt > m_maxAccum) dt = m_maxAccum;
     m_accum += dt;
+    m_fixedSteps = 0;
 
     while (m_accum >= m_fixedDt)
     {
@@ -255,37 +266,39 @@ void Application::TickFixed(const double dtIn)
         m_physics.Step(m_world, (float)m_fixedDt);
 
         m_accum -= m_fixedDt;
+        ++m_fixedSteps;
     }
 }
 
 void Application::UpdateTransforms()
 {
     //  
-    m_world.UpdateTransforms();
+    m_frameLoop.UpdateTransforms();
 }
 
 void Application::UpdateSystems()
 {
 	//  ý Ʈ
     m_audioSystem.Update(m_world, m_soundManager);
-    // ο Ʈ 
-    m_renderSystem.Build(m_world, m_renderItems);
+    // ο Ʈ  (ī޶   ø)
+    m_frameLoop.BuildRenderItems();
     // UI render queue
-    m_uiHud.Build(m_world, m_window.GetWidth(), m_window.GetHeight(), m_uiItems);
+    m_uiHud.Build(m_world, GetViewWidth(), GetViewHeight(), m_uiItems);
 }
 
 void Application::RenderFrame()
 {
-    // ο Ʈ 
-    RenderCamera cam{};
-    cam = BuildRenderCamera();
+    m_frameLoop.BuildLights();
+    SubmitFrame();
+}
 
+void Application::SubmitFrame()
+{
+    // ο Ʈ  (ī޶ UpdateSystems ø  Ͱ )
 	// ī̹ڽ
     TextureHandle sky = m_sceneManager.GetSkybox();
 
-    m_frameLights = BuildFrameLights(cam);
-
-    m_renderer->Render(m_renderItems, cam, m_frameLights, sky, m_uiItems, m_textItems);
+    m_frameLoop.Submit(sky, m_uiItems, m_textItems);
 }
 
 void Application::EndFrame()
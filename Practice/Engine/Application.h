@@ -14,6 +14,7 @@
 #include "AssetPipeline.h"
 #include "Input.h"
 #include "PhysicsSystem.h"
+#include "JobSystem.h"
 #include "SoundManager.h"
 #include "AudioSystem.h"
 #include "UIHudSystem.h"
@@ -21,6 +22,8 @@
 #include "UITextDraw.h"
 #include "FrameLights.h"
 #include "ScriptSystem.h"
+#include "FrameBench.h"
+#include "FrameLoop.h"
 
 class Application
 {
@@ -38,9 +41,13 @@ private:
     uint32_t m_lastW = 0;
     uint32_t m_lastH = 0;
 
+    // â/GPU  NullRenderer   (ũ m_lastW/m_lastH , Է/ )
+    bool m_headless = false;
+    uint32_t m_fixedSteps = 0;               // ̹  TickFixed  
+
     std::unique_ptr<IRenderer> m_renderer;
     RenderSystem m_renderSystem;
-    std::vector<RenderItem> m_renderItems;
+    FrameLoop m_frameLoop;                   // World  RenderSystem::Build  lights  Render (ī޶/RenderItem/FrameLights )
 
 	MeshManager m_meshManager;
 	TextureManager m_textureManager;
@@ -54,33 +61,41 @@ private:
 
     SceneManager m_sceneManager;
 
+    JobSystem m_jobs;
     PhysicsSystem m_physics;
 
     std::vector<UIDrawItem> m_uiItems;
     UIHudSystem m_uiHud;
 
-	FrameLights m_frameLights;
-
 
 public:
-    Application() : m_pipeline(m_registry, m_meshManager), m_sceneManager(m_world, m_pipeline, m_meshManager, m_textureManager, m_soundManager, m_audioSystem, m_input, m_physics, m_textItems, m_scriptSystem) { }
+    Application() : m_frameLoop(m_world, m_renderSystem), m_pipeline(m_registry, m_meshManager), m_sceneManager(m_world, m_pipeline, m_meshManager, m_textureManager, m_soundManager, m_audioSystem, m_input, m_physics, m_textItems, m_scriptSystem) { }
 
     ~Application();
 
     void Initialize(HINSTANCE hInstance);
     void Run();
     void Shutdown();
-	RenderCamera BuildRenderCamera() const;
+
+    // â/GPU   (NullRenderer). scene nullptr̸ Initialize  ù Scene
+    void InitializeHeadless(uint32_t width, uint32_t height, std::unique_ptr<Scene> scene = nullptr);
+    //  dt frames  ܰ躰 CPU ð +   (InitializeHeadless )
+    FrameBenchResult RunHeadless(uint32_t frames, double dt = 1.0 / 60.0);
 
 private:
+    //     ʱȭ (Ŵ , Ŀ, importer, ù Scene)
+    void InitializeSystems(std::unique_ptr<Scene> firstScene);
+
+    uint32_t GetViewWidth() const { return m_headless ? m_lastW : m_window.GetWidth(); }
+    uint32_t GetViewHeight() const { return m_headless ? m_lastH : m_window.GetHeight(); }
+
     void Resize();
     void BeginFrame();                       // input, time
 	void UpdateScene(const double dt);       // Scene.OnUpdate
     void TickFixed(const double dt);
 	void UpdateTransforms();                 // World.UpdateTransforms
 	void UpdateSystems();                    // RenderSystem.Build  
-	void RenderFrame();                      // Renderer.Render
+	void RenderFrame();                      // FrameLoop.BuildLights + SubmitFrame
+    void SubmitFrame();                      // Renderer.Render
     void EndFrame();                         // FlushDestroy
-
-    FrameLights BuildFrameLights(const RenderCamera& cam) const;
 };
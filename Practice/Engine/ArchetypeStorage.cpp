@@ -0,0 +1,240 @@
+﻿#include "ArchetypeStorage.h"
+#include <cassert>
+
+void ArchetypeStorage::Clear()
+{
+    m_archetypes.clear();
+    m_archetypeOfMask.clear();
+    m_locations.clear();
+    m_entityCount = 0;
+}
+
+uint32_t ArchetypeStorage::GetChunkCount() const
+{
+    uint32_t n = 0;
+    for (const Archetype& a : m_archetypes)
+        n += (uint32_t)a.chunks.size();
+    return n;
+}
+
+const ArchetypeStorage::Location* ArchetypeStorage::FindLocation(EntityId e) const
+{
+    if (!e.IsValid() || e.index >= m_locations.size())
+        return nullptr;
+
+    const Location& loc = m_locations[e.index];
+    if (loc.archetype == InvalidIndex)
+        return nullptr;
+
+    // 같은 index의 옛 엔티티(파괴됨)로 들어온 알림은 무시
+    const Archetype& a = m_archetypes[loc.archetype];
+    if (a.Entities(a.chunks[loc.chunk])[loc.row] != e)
+        return nullptr;
+
+    return &loc;
+}
+
+ComponentMask ArchetypeStorage::GetMask(EntityId e) const
+{
+    const Location* loc = FindLocation(e);
+    return loc ? m_archetypes[loc->archetype].mask : 0;
+}
+
+uint32_t ArchetypeStorage::FindOrCreateArchetype(ComponentMask mask)
+{
+    auto it = m_archetypeOfMask.find(mask);
+    if (it != m_archetypeOfMask.end())
+        return it->second;
+
+    Archetype a{};
+    a.mask = mask;
+
+    // 행 하나 크기 = EntityId + 컴포넌트마다 uint32 slot
+    uint32_t columns = 0;
+    for (uint32_t t = 0; t < TypeCount; ++t)
+    {
+        if (mask & (1u << t))
+            ++columns;
+    }
+    const uint32_t rowBytes = (uint32_t)sizeof(EntityId) + columns * (uint32_t)sizeof(uint32_t);
+    a.capacity = ChunkBytes / rowBytes;
+
+    uint32_t offset = a.capacity * (uint32_t)sizeof(EntityId);
+    for (uint32_t t = 0; t < TypeCount; ++t)
+    {
+        if (mask & (1u << t))
+        {
+            a.columnOffset[t] = offset;
+            offset += a.capacity * (uint32_t)sizeof(uint32_t);
+        }
+        else
+        {
+            a.columnOffset[t] = InvalidIndex;
+        }
+
+        a.addEdge[t] = InvalidIndex;
+        a.removeEdge[t] = InvalidIndex;
+    }
+    assert(offset <= ChunkBytes);
+
+    const uint32_t index = (uint32_t)m_archetypes.size();
+    m_archetypes.push_back(std::move(a));
+    m_archetypeOfMask.emplace(mask, index);
+    return index;
+}
+
+void ArchetypeStorage::AppendRow(Archetype& a, uint32_t& outChunk, uint32_t& outRow)
+{
+    if (a.chunks.empty() || a.chunks.back().count == a.capacity)
+    {
+        Chunk c{};
+        c.data.reset(new uint8_t[ChunkBytes]); // 0 초기화 불필요 (count까지만 읽음)
+        a.chunks.push_back(std::move(c));
+    }
+
+    outChunk = (uint32_t)a.chunks.size() - 1;
+    outRow = a.chunks.back().count++;
+}
+
+void ArchetypeStorage::EraseRow(uint32_t archetype, uint32_t chunk, uint32_t row)
+{
+    Archetype& a = m_archetypes[archetype];
+
+    const uint32_t lastChunk = (uint32_t)a.chunks.size() - 1;
+    Chunk& last = a.chunks[lastChunk];
+    const uint32_t lastRow = last.count - 1;
+
+    if (chunk != lastChunk || row != lastRow)
+    {
+        Chunk& dst = a.chunks[chunk];
+
+        const EntityId moved = a.Entities(last)[lastRow];
+        a.Entities(dst)[row] = moved;
+        for (uint32_t t = 0; t < TypeCount; ++t)
+        {
+            if (a.columnOffset[t] != InvalidIndex)
+                a.Slots(dst, t)[row] = a.Slots(last, t)[lastRow];
+        }
+
+        Location& ml = m_locations[moved.index];
+        ml.chunk = chunk;
+        ml.row = row;
+    }
+
+    --last.count;
+    if (last.count == 0)
+        a.chunks.pop_back();
+}
+
+uint32_t ArchetypeStorage::NeighborArchetype(uint32_t from, ComponentType t, bool add)
+{
+    const uint32_t ti = (uint32_t)t;
+    const uint32_t cached = add ? m_archetypes[from].addEdge[ti] : m_archetypes[from].removeEdge[ti];
+    if (cached != InvalidIndex)
+        return cached;
+
+    const ComponentMask mask = add ? (m_archetypes[from].mask | ComponentBit(t)) : (m_archetypes[from].mask & ~ComponentBit(t));
+    if (mask == 0)
+        return InvalidIndex;
+
+    const uint32_t to = FindOrCreateArchetype(mask); // push_back 가능 → 참조는 이후에
+    if (add) m_archetypes[from].addEdge[ti] = to;
+    else     m_archetypes[from].removeEdge[ti] = to;
+    return to;
+}
+
+void ArchetypeStorage::MoveEntity(EntityId e, uint32_t dstIndex)
+{
+    if (m_locations.size() <= e.index)
+        m_locations.resize(e.index + 1);
+
+    // 현재 위치 (없으면 mask 0 취급)
+    const Location* cur = FindLocation(e);
+    const Location old = cur ? *cur : Location{};
+
+    if (dstIndex != InvalidIndex)
+    {
+        Archetype& dst = m_archetypes[dstIndex];
+
+        uint32_t chunk = 0, row = 0;
+        AppendRow(dst, chunk, row);
+        Chunk& dc = dst.chunks[chunk];
+
+        dst.Entities(dc)[row] = e;
+        for (uint32_t t = 0; t < TypeCount; ++t)
+        {
+            if (dst.columnOffset[t] == InvalidIndex)
+                continue;
+
+            uint32_t slot = InvalidIndex;
+            if (old.archetype != InvalidIndex)
+            {
+                const Archetype& src = m_archetypes[old.archetype];
+                if (src.columnOffset[t] != InvalidIndex)
+                    slot = src.Slots(src.chunks[old.chunk], t)[old.row];
+            }
+            dst.Slots(dc, t)[row] = slot;
+        }
+
+        if (old.archetype != InvalidIndex)
+            EraseRow(old.archetype, old.chunk, old.row);
+        else
+            ++m_entityCount;
+
+        m_locations[e.index] = Location{ dstIndex, chunk, row };
+    }
+    else
+    {
+        if (old.archetype != InvalidIndex)
+        {
+            EraseRow(old.archetype, old.chunk, old.row);
+            --m_entityCount;
+        }
+        m_locations[e.index] = Location{};
+    }
+}
+
+void ArchetypeStorage::OnAdd(EntityId e, ComponentType t, uint32_t slot)
+{
+    const Location* loc = FindLocation(e);
+    if (!loc)
+    {
+        MoveEntity(e, FindOrCreateArchetype(ComponentBit(t)));
+    }
+    else if ((m_archetypes[loc->archetype].mask & ComponentBit(t)) == 0)
+    {
+        MoveEntity(e, NeighborArchetype(loc->archetype, t, true));
+    }
+
+    OnSlotMoved(e, t, slot);
+}
+
+void ArchetypeStorage::OnRemove(EntityId e, ComponentType t)
+{
+    const Location* loc = FindLocation(e);
+    if (!loc)
+        return;
+
+    if (m_archetypes[loc->archetype].mask & ComponentBit(t))
+        MoveEntity(e, NeighborArchetype(loc->archetype, t, false));
+}
+
+void ArchetypeStorage::OnSlotMoved(EntityId e, ComponentType t, uint32_t newSlot)
+{
+    const Location* loc = FindLocation(e);
+    if (!loc)
+        return;
+
+    Archetype& a = m_archetypes[loc->archetype];
+    const uint32_t ti = (uint32_t)t;
+    if (a.columnOffset[ti] == InvalidIndex)
+        return;
+
+    a.Slots(a.chunks[loc->chunk], ti)[loc->row] = newSlot;
+}
+
+void ArchetypeStorage::RemoveEntity(EntityId e)
+{
+    if (FindLocation(e))
+        MoveEntity(e, InvalidIndex);
+}
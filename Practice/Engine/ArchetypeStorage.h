@@ -0,0 +1,141 @@
+﻿#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "EntityId.h"
+
+// World가 가진 컴포넌트 종류 (비트 하나씩)
+enum class ComponentType : uint8_t
+{
+    Transform,
+    Mesh,
+    Material,
+    Camera,
+    RigidBody,
+    Collider,
+    AudioSource,
+    Light,
+    UIElement,
+    Script,
+    Count
+};
+
+using ComponentMask = uint32_t;
+
+constexpr ComponentMask ComponentBit(ComponentType t) { return 1u << (uint32_t)t; }
+
+// Archetype(컴포넌트 시그니처) 기준 엔티티 저장소
+// - 시그니처가 같은 엔티티를 16KB chunk에 빽빽하게 저장
+//   chunk 레이아웃: [EntityId x capacity][컴포넌트 A slot x capacity][컴포넌트 B slot x capacity]...
+// - slot = World dense 배열 인덱스. 컴포넌트 데이터는 World dense 배열에 그대로 있으므로
+//   GetXxx 참조/transform 깊이 정렬은 영향 없고, 쿼리는 매칭 chunk만 선형으로 돌면서 sparse 조회/Has 검사 없이 접근
+// - World가 Add/Remove/dense 이동 때마다 OnAdd/OnRemove/OnSlotMoved로 알려줌
+class ArchetypeStorage
+{
+public:
+    static constexpr uint32_t ChunkBytes = 16 * 1024;
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+    static constexpr uint32_t TypeCount = (uint32_t)ComponentType::Count;
+
+    struct ChunkView
+    {
+        const EntityId* entities = nullptr;
+        const uint32_t* slots[TypeCount] = {};  // 이 archetype에 없는 컴포넌트는 nullptr
+        uint32_t count = 0;
+    };
+
+    void Clear();
+
+    // 컴포넌트 추가(이미 있으면 slot만 갱신) / 제거 → archetype 이동
+    void OnAdd(EntityId e, ComponentType t, uint32_t slot);
+    void OnRemove(EntityId e, ComponentType t);
+
+    // World dense 배열 swap-remove/재정렬로 slot이 바뀐 경우
+    void OnSlotMoved(EntityId e, ComponentType t, uint32_t newSlot);
+
+    // 엔티티 파괴: 남은 컴포넌트와 관계없이 archetype에서 제거
+    void RemoveEntity(EntityId e);
+
+    ComponentMask GetMask(EntityId e) const;
+
+    // required 비트를 모두 가진 archetype의 chunk마다 fn(const ChunkView&)
+    // (순회 중 OnAdd/OnRemove 금지 - 행이 옮겨짐)
+    template<class Fn>
+    void ForEachChunk(ComponentMask required, Fn&& fn) const
+    {
+        for (const Archetype& a : m_archetypes)
+        {
+            if ((a.mask & required) != required)
+                continue;
+
+            for (const Chunk& c : a.chunks)
+            {
+                if (c.count == 0)
+                    continue;
+
+                ChunkView v{};
+                v.entities = a.Entities(c);
+                for (uint32_t t = 0; t < TypeCount; ++t)
+                    v.slots[t] = (a.columnOffset[t] != InvalidIndex) ? a.Slots(c, t) : nullptr;
+                v.count = c.count;
+                fn(v);
+            }
+        }
+    }
+
+    uint32_t GetArchetypeCount() const { return (uint32_t)m_archetypes.size(); }
+    uint32_t GetChunkCount() const;
+    uint32_t GetEntityCount() const { return m_entityCount; }
+
+private:
+    struct Chunk
+    {
+        std::unique_ptr<uint8_t[]> data;
+        uint32_t count = 0;
+    };
+
+    struct Archetype
+    {
+        ComponentMask mask = 0;
+        uint32_t capacity = 0;                  // chunk 하나당 엔티티 수
+        uint32_t columnOffset[TypeCount];       // chunk 안 slot column 시작 바이트 (없으면 InvalidIndex)
+        std::vector<Chunk> chunks;              // 마지막 chunk만 덜 찰 수 있음
+
+        // 컴포넌트 하나 추가/제거 시 갈 archetype 캐시 (해시 조회 생략)
+        uint32_t addEdge[TypeCount];
+        uint32_t removeEdge[TypeCount];
+
+        EntityId* Entities(const Chunk& c) const { return reinterpret_cast<EntityId*>(c.data.get()); }
+        uint32_t* Slots(const Chunk& c, uint32_t t) const { return reinterpret_cast<uint32_t*>(c.data.get() + columnOffset[t]); }
+    };
+
+    struct Location
+    {
+        uint32_t archetype = InvalidIndex;
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+    };
+
+    uint32_t FindOrCreateArchetype(ComponentMask mask);
+
+    // 현재 archetype에서 t 하나 추가/제거한 archetype (캐시된 edge 우선). mask 0이면 InvalidIndex
+    uint32_t NeighborArchetype(uint32_t from, ComponentType t, bool add);
+
+    // archetype 끝에 빈 행 하나 확보 → (chunk, row)
+    void AppendRow(Archetype& a, uint32_t& outChunk, uint32_t& outRow);
+
+    // 행 삭제: 마지막 행을 빈자리로 옮기고 그 엔티티 location 갱신
+    void EraseRow(uint32_t archetype, uint32_t chunk, uint32_t row);
+
+    // e를 dst archetype으로 옮김 (공통 컴포넌트 slot 복사). dst == InvalidIndex면 제거만
+    void MoveEntity(EntityId e, uint32_t dst);
+
+    const Location* FindLocation(EntityId e) const;
+
+private:
+    std::vector<Archetype> m_archetypes;
+    std::unordered_map<ComponentMask, uint32_t> m_archetypeOfMask;
+    std::vector<Location> m_locations;          // [entity.index]
+    uint32_t m_entityCount = 0;
+};
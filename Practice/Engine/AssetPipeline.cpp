@@ -1,6 +1,10 @@
 #include "AssetPipeline.h"
 #include <DirectXMath.h>
+#include <algorithm>
 #include "ImportTypes.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "MeshletBuilder.h"
 
 Result<ModelAsset> AssetPipeline::ImportModel(
     const std::string& path,
@@ -14,7 +18,7 @@ Result<ModelAsset> AssetPipeline::ImportModel(
     if (!imported.IsOk())
         return Result<ModelAsset>::Fail(imported.error->message);
 
-    const ImportedModel& model = imported.value;
+    ImportedModel& model = imported.value;
     if (model.meshes.empty())
         return Result<ModelAsset>::Fail("Imported model has no meshes: " + path);
 
@@ -22,8 +26,36 @@ Result<ModelAsset> AssetPipeline::ImportModel(
     out.sourcePath = model.sourcePath.empty() ? path : model.sourcePath;
     out.meshes.reserve(model.meshes.size());
 
-    for (const auto& mesh : model.meshes)
+    for (auto& mesh : model.meshes)
     {
+        // GPU ε  ﰢ/  ȭ (submesh  )
+        if (importOpt.optimizeMesh)
+            OptimizeImportedMesh(mesh, importOpt.optimizeOverdraw);
+
+        const uint32_t baseIndexCount = (uint32_t)mesh.indices.size();
+
+        // LOD ε   Ƿ indices ڿ ̰ submesh  
+        std::vector<std::vector<MeshLodLevel>> lods;
+        if (importOpt.lodCount > 1)
+            lods = GenerateImportedMeshLods(mesh, std::min(importOpt.lodCount, MeshMaxLods),
+                importOpt.lodReduction, importOpt.lodMaxError);
+
+        auto toChain = [&](size_t submesh)
+            {
+                MeshLodChain chain{};
+                if (submesh >= lods.size())
+                    return chain;
+
+                for (const MeshLodLevel& l : lods[submesh])
+                    chain.levels[chain.count++] = MeshLodRange{ l.startIndex, l.indexCount };
+                return chain;
+            };
+
+        // LOD0  meshlet  (cluster ø LOD0 , LOD  ° ׸)
+        std::vector<Meshlet> meshlets;
+        if (importOpt.buildMeshlets)
+            meshlets = BuildImportedMeshMeshlets(mesh, baseIndexCount);
+
         // ImportedMesh -> MeshCPUData ȯ
         MeshCPUData cpu{};
         cpu.positions.reserve(mesh.vertices.size());
@@ -37,13 +69,10 @@ Result<ModelAsset> AssetPipeline::ImportModel(
             cpu.normals.push_back({ v.normal.x, v.normal.y, v.normal.z });
         }
 
-        cpu.indices.reserve(mesh.indices.size());
-        for (uint32_t idx : mesh.indices)
-        {
-            if (idx > 0xFFFFu)
-                return Result<ModelAsset>::Fail("Mesh has index > 65535 (uint16 overflow). Need 32-bit index support.");
-            cpu.indices.push_back((uint16_t)idx);
-        }
+        // ε  mesh: 65535 Ѵ ε  32bit
+        cpu.SetIndices(mesh.indices);
+        cpu.vertexFormat = importOpt.compactVertices ? MeshVertexFormat::Compact : MeshVertexFormat::Float32;
+        cpu.meshlets = std::move(meshlets);
 
         MeshHandle h = m_meshManager.Create(cpu);
 
@@ -77,6 +106,7 @@ Result<ModelAsset> AssetPipeline::ImportModel(
                 asm2.indexCount = sm.indexCount;
                 asm2.materialIndex = sm.materialIndex;
                 asm2.name = sm.name;
+                asm2.lods = toChain(am.submeshes.size());
                 am.submeshes.push_back(std::move(asm2));
             }
         }
@@ -85,9 +115,10 @@ Result<ModelAsset> AssetPipeline::ImportModel(
             // submesh   ü 1 submesh 
             ModelAssetSubmesh one{};
             one.startIndex = 0;
-            one.indexCount = (uint32_t)cpu.indices.size();
+            one.indexCount = baseIndexCount;
             one.materialIndex = 0;
             one.name = "Submesh0";
+            one.lods = toChain(0);
             am.submeshes.push_back(one);
         }
         am.name = mesh.name.empty() ? "Mesh" : mesh.name;
@@ -115,7 +146,9 @@ Result<EntityId> AssetPipeline::InstantiateModel(
         // mesh ü ƴ϶ submesh draw ״´
         for (const auto& sm : m.submeshes)
         {
-            world.AddMesh(root, MeshComponent{ m.mesh, sm.startIndex, sm.indexCount, sm.materialIndex });
+            MeshComponent mc{ m.mesh, sm.startIndex, sm.indexCount, sm.materialIndex };
+            mc.draws.back().lods = sm.lods;
+            world.AddMesh(root, mc);
         }
     }
 
@@ -344,7 +344,8 @@ void AudioSystem::Update(World& world, SoundManager& sounds)
                 break;
 
             const AudioPlayDesc d = MakeDescFromComponent(src);
-            ExecutePlay(src.clip, d, cmd.entity, sounds);
+            const uint32_t instId = ExecutePlay(src.clip, d, cmd.entity, sounds);
+            world.GetAudioSource(cmd.entity).playingInstanceId = instId;
         } break;
 
         case AudioCommandType::StopInstance:
@@ -398,4 +399,11 @@ void AudioSystem::Update(World& world, SoundManager& sounds)
 
     // 4) stop ó     
     m_impl->CollectFinishedVoices();
+
+    // 5) AudioSource   ȭ: / νϽ Ű 0
+    world.ForEach<AudioSourceComponent>([&](EntityId, AudioSourceComponent& src)
+        {
+            if (src.playingInstanceId != 0 && !m_impl->FindInstance(src.playingInstanceId))
+                src.playingInstanceId = 0;
+        });
 }
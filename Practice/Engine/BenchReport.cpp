@@ -0,0 +1,76 @@
+﻿#include "BenchReport.h"
+#include "JobSystem.h"
+#include <cstdio>
+
+BenchReport RunBenchReport(JobSystem* jobs)
+{
+    BenchReport r{};
+    r.threads = jobs ? jobs->GetThreadCount() : 1;
+
+    r.transform = RunTransformBench(jobs, 100000, 4);
+    r.storage[0] = RunStorageBench(100000, false);
+    r.storage[1] = RunStorageBench(100000, true);
+    r.staticCull = RunStaticCullBench(100000);
+    r.renderBuild = RunRenderBuildBench(jobs, 25000, 2);
+    r.sort10k = RunSortKeyBench(10000);
+    r.sort100k = RunSortKeyBench(100000);
+    r.renderScene = RunRenderSceneBench(100000, 1000);
+    r.lightCluster = RunLightClusterBench(4096);
+    r.occlusion = RunOcclusionBench(20000);
+    return r;
+}
+
+std::string FormatBenchReport(const BenchReport& r)
+{
+    char line[512];
+    std::string out;
+
+    std::snprintf(line, sizeof(line), "threads %u\n", r.threads);
+    out += line;
+
+    const TransformBenchResult& tb = r.transform;
+    std::snprintf(line, sizeof(line), "[transform] nodes %u  depth %u  rebuild %.3f ms  serial %.3f ms  parallel %.3f ms  clean %.3f ms\n",
+        tb.nodeCount, tb.depthCount, tb.rebuildMs, tb.serialMs, tb.parallelMs, tb.cleanMs);
+    out += line;
+
+    const StorageBenchResult& sp = r.storage[0];
+    const StorageBenchResult& ar = r.storage[1];
+    std::snprintf(line, sizeof(line), "[storage] %u entities  add %.2f / %.2f ms  iterate %.3f / %.3f ms  remove %.2f / %.2f ms  (sparse / archetype)\n",
+        sp.entities, sp.addMs, ar.addMs, sp.iterateMs, ar.iterateMs, sp.removeMs, ar.removeMs);
+    out += line;
+
+    const StaticCullBenchResult& sc = r.staticCull;
+    std::snprintf(line, sizeof(line), "[static cull] static %u  visible %u  linear %.3f ms  bvh build %.3f ms  bvh %.3f ms (nodes %u)  1%% moved %.3f ms\n",
+        sc.instances, sc.visible, sc.linearMs, sc.bvhBuildMs, sc.bvhMs, sc.bvhNodesVisited, sc.refitMs);
+    out += line;
+
+    const RenderBuildBenchResult& rb = r.renderBuild;
+    std::snprintf(line, sizeof(line), "[render build] draws %u (visible %u)  serial %.3f ms  parallel %.3f ms (first %.3f)  threads %u  chunks %u  %s\n",
+        rb.drawsTotal, rb.drawsVisible, rb.serialMs, rb.parallelMs, rb.parallelFirstMs, rb.threads, rb.chunks, rb.sameResult ? "match" : "MISMATCH");
+    out += line;
+
+    std::snprintf(line, sizeof(line), "[sort keys] 10k std %.3f ms radix %.3f ms | 100k std %.3f ms radix %.3f ms  passes %u  %s\n",
+        r.sort10k.stdSortMs, r.sort10k.radixMs, r.sort100k.stdSortMs, r.sort100k.radixMs, r.sort100k.radixPasses,
+        (r.sort10k.sameOrder && r.sort100k.sameOrder) ? "match" : "MISMATCH");
+    out += line;
+
+    const RenderSceneBenchResult& sb = r.renderScene;
+    std::snprintf(line, sizeof(line), "[render scene] scene %u (visible %u)  static: rebuild %.3f ms retained %.3f ms | %u moved: rebuild %.3f ms retained %.3f ms (first %.3f)  %s\n",
+        sb.entities, sb.drawsVisible, sb.immediateMs, sb.retainedMs, sb.movedPerFrame, sb.immediateMovingMs, sb.retainedMovingMs, sb.rebuildMs,
+        sb.sameResult ? "match" : "MISMATCH");
+    out += line;
+
+    const LightClusterBenchResult& lb = r.lightCluster;
+    std::snprintf(line, sizeof(line), "[light cluster] lights %u (binned %u)  cluster build %.3f ms  brute %.3f ms | indices %u  per cluster avg %.1f max %u  %s\n",
+        lb.lights, lb.binnedLights, lb.buildMs, lb.bruteForceMs, lb.indices, lb.avgPerOccupiedCluster, lb.maxPerCluster,
+        lb.sameResult ? "match" : "MISMATCH");
+    out += line;
+
+    const OcclusionBenchResult& ob = r.occlusion;
+    std::snprintf(line, sizeof(line), "[occlusion] entities %u  occluders %u (%u tris) | draws frustum %u -> occluded %u | %.3f ms vs %.3f ms  %s\n",
+        ob.entities, ob.occluders, ob.triangles, ob.drawsFrustum, ob.drawsOccluded, ob.frustumOnlyMs, ob.occlusionMs,
+        ob.subset ? "subset" : "NOT SUBSET");
+    out += line;
+
+    return out;
+}
@@ -0,0 +1,34 @@
+﻿#pragma once
+#include <string>
+#include "TransformBench.h"
+#include "StorageBench.h"
+#include "StaticCullBench.h"
+#include "RenderBuildBench.h"
+#include "SortKeyBench.h"
+#include "RenderSceneBench.h"
+#include "LightClusterBench.h"
+#include "OcclusionBench.h"
+
+class JobSystem;
+
+// 헤드리스 엔진 벤치 모음 (창/렌더러 없이 World / RenderSystem / 컬링 모듈만)
+// - 실행: Engine.exe --bench  → Bench.txt
+// - 각 벤치는 자기 World/MeshManager를 만들어 돌리므로 실행 중인 Scene과 무관
+struct BenchReport
+{
+    uint32_t threads = 1;
+
+    TransformBenchResult transform{};           // 100k 노드 계층
+    StorageBenchResult storage[2]{};            // [0] sparse set, [1] archetype (100k)
+    StaticCullBenchResult staticCull{};         // 100k static 인스턴스
+    RenderBuildBenchResult renderBuild{};       // 25k 엔티티 x 2 draw
+    SortKeyBenchResult sort10k{};
+    SortKeyBenchResult sort100k{};
+    RenderSceneBenchResult renderScene{};       // 100k static, 1000 이동
+    LightClusterBenchResult lightCluster{};     // 4096 light
+    OcclusionBenchResult occlusion{};           // 20000 prop
+};
+
+BenchReport RunBenchReport(JobSystem* jobs);
+
+std::string FormatBenchReport(const BenchReport& report);
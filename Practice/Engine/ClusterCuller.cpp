@@ -0,0 +1,132 @@
+﻿#include "ClusterCuller.h"
+#include "MeshManager.h"
+#include <algorithm>
+
+using namespace DirectX;
+
+void ClusterCuller::Cull(const MeshManager& meshes, const Frustum& frustum, const XMFLOAT3& eye, std::vector<RenderItem>& items)
+{
+    constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    m_stats = ClusterCullStats{};
+    m_out.clear();
+    m_out.reserve(items.size());
+
+    const XMVECTOR eyeV = XMLoadFloat3(&eye);
+
+    // 같은 mesh item이 이어지는 경우가 많아서 마지막 조회 결과 재사용
+    uint32_t lastMesh = InvalidIndex;
+    const std::vector<Meshlet>* meshlets = nullptr;
+    uint32_t meshIndexCount = 0;
+
+    for (const RenderItem& it : items)
+    {
+        if (it.mesh.id != lastMesh)
+        {
+            lastMesh = it.mesh.id;
+            meshlets = meshes.GetMeshlets(it.mesh);
+            meshIndexCount = meshlets ? meshes.Get(it.mesh).GetIndexCount() : 0;
+        }
+
+        if (!meshlets || it.startIndex >= meshIndexCount)
+        {
+            m_out.push_back(it);
+            continue;
+        }
+
+        // item 범위 [start, end)를 빈틈없이 덮는 meshlet [first, last)
+        const uint32_t start = it.startIndex;
+        const uint32_t end = it.indexCount ? start + it.indexCount : meshIndexCount;
+
+        const auto first = std::lower_bound(meshlets->begin(), meshlets->end(), start,
+            [](const Meshlet& m, uint32_t s) { return m.startIndex < s; });
+        auto last = first;
+        uint32_t cursor = start;
+        while (last != meshlets->end() && last->startIndex == cursor && cursor < end)
+        {
+            cursor += last->triangleCount * 3;
+            ++last;
+        }
+
+        if (cursor != end || (uint32_t)(last - first) < m_minMeshlets)
+        {
+            m_out.push_back(it);
+            continue;
+        }
+
+        // world (row-vector): 중심 = c * W, 반지름 * 최대 축 scale
+        // cone 축은 W(3x3)로 돌림 → 비균등 scale / 거울 변환이면 법선이 맞지 않으므로 backface 생략
+        const XMMATRIX W = XMLoadFloat4x4(&it.world);
+        const float s0 = XMVectorGetX(XMVector3Length(W.r[0]));
+        const float s1 = XMVectorGetX(XMVector3Length(W.r[1]));
+        const float s2 = XMVectorGetX(XMVector3Length(W.r[2]));
+        const float maxScale = std::max(s0, std::max(s1, s2));
+        const float minScale = std::min(s0, std::min(s1, s2));
+        const bool backface = m_backface
+            && (maxScale - minScale) <= maxScale * 0.01f
+            && XMVectorGetX(XMMatrixDeterminant(W)) > 0.0f;
+
+        ++m_stats.items;
+        m_stats.trianglesIn += (end - start) / 3;
+
+        uint32_t runStart = InvalidIndex;
+        uint32_t runEnd = 0;
+        auto flush = [&]()
+            {
+                if (runStart == InvalidIndex)
+                    return;
+
+                RenderItem r = it;
+                r.startIndex = runStart;
+                r.indexCount = runEnd - runStart;
+                m_out.push_back(r);
+
+                ++m_stats.rangesEmitted;
+                m_stats.trianglesOut += r.indexCount / 3;
+                runStart = InvalidIndex;
+            };
+
+        for (auto m = first; m != last; ++m)
+        {
+            ++m_stats.clusters;
+
+            const XMVECTOR c = XMVector3Transform(XMLoadFloat3(&m->center), W);
+            const float r = m->radius * maxScale;
+
+            MeshBounds sphereBox{};
+            XMStoreFloat3(&sphereBox.center, c);
+            sphereBox.extents = { r, r, r };
+
+            bool visible = frustum.IntersectsAABB(sphereBox);
+            if (!visible)
+            {
+                ++m_stats.frustumCulled;
+            }
+            else if (backface && m->coneCutoff < 1.0f)
+            {
+                // 눈 → 중심 방향이 cone 안쪽 깊숙이면 모든 삼각형이 뒷면 (sphere 반지름만큼 여유)
+                const XMVECTOR axis = XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&m->coneAxis), W));
+                const XMVECTOR v = XMVectorSubtract(c, eyeV);
+                const float dist = XMVectorGetX(XMVector3Length(v));
+                if (XMVectorGetX(XMVector3Dot(v, axis)) >= m->coneCutoff * dist + r)
+                {
+                    visible = false;
+                    ++m_stats.backfaceCulled;
+                }
+            }
+
+            if (!visible)
+            {
+                flush();
+                continue;
+            }
+
+            if (runStart == InvalidIndex)
+                runStart = m->startIndex;
+            runEnd = m->startIndex + m->triangleCount * 3;
+        }
+        flush();
+    }
+
+    items.swap(m_out);
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+#include "RenderItem.h"
+#include "RenderBounds.h"
+#include "Meshlet.h"
+
+class MeshManager;
+
+// 마지막 Cull 기준
+struct ClusterCullStats
+{
+    uint32_t items = 0;             // meshlet 단위로 검사한 RenderItem 수
+    uint32_t clusters = 0;          // 검사한 meshlet 수
+    uint32_t frustumCulled = 0;
+    uint32_t backfaceCulled = 0;
+    uint32_t rangesEmitted = 0;     // 보이는 연속 구간 수 (= 대신 만든 RenderItem 수)
+    uint32_t trianglesIn = 0;       // 대상 item의 원래 삼각형 수
+    uint32_t trianglesOut = 0;      // 그중 실제로 그리는 삼각형 수
+};
+
+// CPU cluster 컬링: meshlet이 있는 큰 mesh의 RenderItem을 보이는 meshlet 구간들로 바꿈
+// - meshlet sphere로 프러스텀, 법선 cone으로 backface 검사 (둘 다 world 변환 후)
+// - 인덱스가 이어진 보이는 meshlet은 한 구간 → item 수 = 보이는 덩어리 수
+// - item 범위가 meshlet으로 정확히 덮이지 않으면 (LOD 구간 등) 그대로 통과
+// - D3D 의존 없음: MeshManager의 CPU meshlet만 읽음
+class ClusterCuller
+{
+public:
+    static constexpr uint32_t DefaultMinMeshlets = 8; // meshlet이 이보다 적은 item은 쪼개지 않음 (draw만 늘어남)
+
+    void SetMinMeshlets(uint32_t n) { m_minMeshlets = n; }
+    uint32_t GetMinMeshlets() const { return m_minMeshlets; }
+
+    // 끄면 프러스텀만 (양면 재질 등)
+    void SetBackfaceCullingEnabled(bool enabled) { m_backface = enabled; }
+    bool IsBackfaceCullingEnabled() const { return m_backface; }
+
+    // items in/out: 다 안 보이는 item은 빠지고, 쪼갠 item은 그 자리에 구간 수만큼 (나머지 순서 유지)
+    void Cull(const MeshManager& meshes, const Frustum& frustum, const DirectX::XMFLOAT3& eye, std::vector<RenderItem>& items);
+
+    const ClusterCullStats& GetStats() const { return m_stats; }
+
+private:
+    uint32_t m_minMeshlets = DefaultMinMeshlets;
+    bool m_backface = true;
+    std::vector<RenderItem> m_out;      // 결과 scratch (items와 swap → 용량 유지)
+    ClusterCullStats m_stats{};
+};
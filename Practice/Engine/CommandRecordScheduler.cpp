@@ -0,0 +1,46 @@
+﻿#include "CommandRecordScheduler.h"
+#include "JobSystem.h"
+#include <algorithm>
+
+void CommandRecordScheduler::Plan(uint32_t drawCount, uint32_t maxChunks, uint32_t minDrawsPerChunk)
+{
+    m_chunks.clear();
+    if (drawCount == 0)
+        return;
+
+    minDrawsPerChunk = std::max(minDrawsPerChunk, 1u);
+    const uint32_t byMin = std::max(drawCount / minDrawsPerChunk, 1u);
+    const uint32_t chunkCount = std::clamp(std::min(maxChunks, byMin), 1u, drawCount);
+
+    // 앞쪽 청크가 1개씩 더 가짐 (크기 차이 최대 1)
+    const uint32_t base = drawCount / chunkCount;
+    const uint32_t extra = drawCount % chunkCount;
+
+    m_chunks.resize(chunkCount);
+    uint32_t first = 0;
+    for (uint32_t c = 0; c < chunkCount; ++c)
+    {
+        const uint32_t count = base + (c < extra ? 1u : 0u);
+        m_chunks[c] = { first, count };
+        first += count;
+    }
+}
+
+void CommandRecordScheduler::Record(JobSystem* jobs, ICommandRecordBackend& backend) const
+{
+    const uint32_t chunkCount = (uint32_t)m_chunks.size();
+
+    if (!jobs || jobs->GetWorkerCount() == 0 || chunkCount <= 1)
+    {
+        for (uint32_t c = 0; c < chunkCount; ++c)
+            backend.RecordChunk(c, m_chunks[c].first, m_chunks[c].count);
+        return;
+    }
+
+    // grain 1: 청크 하나 = 작업 하나 → 한 청크를 두 스레드가 나눠 녹화하는 일 없음
+    jobs->ParallelFor(chunkCount, 1, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t c = begin; c < end; ++c)
+                backend.RecordChunk(c, m_chunks[c].first, m_chunks[c].count);
+        });
+}
@@ -0,0 +1,42 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+
+// 정렬된 draw(batch) 목록을 여러 command list에 나눠 병렬 녹화하는 스케줄링
+// - Plan: draw 수 / 스레드 수로 청크 개수와 연속 구간 결정
+//   (청크 순서대로 제출하면 원래 draw 순서 그대로)
+// - Record: 청크마다 backend.RecordChunk 호출, 청크 하나는 한 스레드만 녹화
+// - 실제 녹화는 ICommandRecordBackend 몫 (D3D12 = 청크별 command list, 테스트 = null backend)
+struct RecordChunk
+{
+    uint32_t first = 0;
+    uint32_t count = 0;
+};
+
+class ICommandRecordBackend
+{
+public:
+    virtual ~ICommandRecordBackend() = default;
+
+    // 워커 스레드에서 호출될 수 있음. chunkIndex 전용 리소스(command list 등)에만 기록
+    virtual void RecordChunk(uint32_t chunkIndex, uint32_t first, uint32_t count) = 0;
+};
+
+class CommandRecordScheduler
+{
+public:
+    // drawCount를 최대 maxChunks개로 균등 분할 (청크당 최소 minDrawsPerChunk개)
+    // 조건이 안 되면 청크 1개 = 전부 순차
+    void Plan(uint32_t drawCount, uint32_t maxChunks, uint32_t minDrawsPerChunk);
+
+    // jobs가 없거나 청크 1개면 호출 스레드에서 순차 실행
+    void Record(JobSystem* jobs, ICommandRecordBackend& backend) const;
+
+    const std::vector<RecordChunk>& GetChunks() const { return m_chunks; }
+    uint32_t GetChunkCount() const { return (uint32_t)m_chunks.size(); }
+
+private:
+    std::vector<RecordChunk> m_chunks;
+};
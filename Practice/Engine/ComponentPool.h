@@ -0,0 +1,279 @@
+﻿#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "EntityId.h"
+
+// 컴포넌트 하나당 sparse set
+// - sparse: entity.index -> dense index. 1024개 단위 page로 나눠 필요한 page만 할당
+//   (엔티티 index가 커져도 거대한 resize 없음)
+// - dense: 컴포넌트/엔티티 배열. 제거는 swap-and-pop
+// - Lock 중 제거는 지연: 자리에 Invalid 엔티티를 남겨 두고(순회 인덱스 유지) Unlock 때 한꺼번에 swap-and-pop
+// - dense 위치가 바뀔 때마다 onMoved(엔티티, 새 dense index) 호출 (World의 archetype 인덱스 갱신용)
+template<class T>
+class ComponentPool
+{
+public:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+    static constexpr uint32_t PageBits = 10;
+    static constexpr uint32_t PageSize = 1u << PageBits;
+
+    using MovedFn = void (*)(void* user, EntityId moved, uint32_t newDense);
+
+    void SetMovedCallback(MovedFn fn, void* user) { m_onMoved = fn; m_onMovedUser = user; }
+
+    uint32_t DenseIndexOf(EntityId e) const
+    {
+        const uint32_t page = e.index >> PageBits;
+        if (!e.IsValid() || page >= m_pages.size() || !m_pages[page])
+            return InvalidIndex;
+
+        const uint32_t di = m_pages[page][e.index & (PageSize - 1)];
+        if (di == InvalidIndex || m_entities[di] != e)
+            return InvalidIndex;
+        return di;
+    }
+
+    bool Has(EntityId e) const { return DenseIndexOf(e) != InvalidIndex; }
+
+    T& Get(EntityId e)
+    {
+        const uint32_t di = DenseIndexOf(e);
+        assert(di != InvalidIndex);
+        return m_data[di];
+    }
+
+    const T& Get(EntityId e) const
+    {
+        const uint32_t di = DenseIndexOf(e);
+        assert(di != InvalidIndex);
+        return m_data[di];
+    }
+
+    T* TryGet(EntityId e)
+    {
+        const uint32_t di = DenseIndexOf(e);
+        return (di != InvalidIndex) ? &m_data[di] : nullptr;
+    }
+
+    const T* TryGet(EntityId e) const
+    {
+        const uint32_t di = DenseIndexOf(e);
+        return (di != InvalidIndex) ? &m_data[di] : nullptr;
+    }
+
+    // 없을 때만 추가 (있으면 기존 것 반환). outAdded로 새로 추가됐는지 알려줌
+    template<class... Args>
+    T& Emplace(EntityId e, bool* outAdded, Args&&... args)
+    {
+        const uint32_t existing = DenseIndexOf(e);
+        if (existing != InvalidIndex)
+        {
+            if (outAdded) *outAdded = false;
+            return m_data[existing];
+        }
+
+        const uint32_t di = (uint32_t)m_data.size();
+        SparseSlot(e.index) = di;
+        m_entities.push_back(e);
+        m_data.emplace_back(std::forward<Args>(args)...);
+
+        if (outAdded) *outAdded = true;
+        return m_data.back();
+    }
+
+    // 제거. Lock 중이면 지연(Has는 즉시 false)
+    bool Remove(EntityId e)
+    {
+        const uint32_t di = DenseIndexOf(e);
+        if (di == InvalidIndex)
+            return false;
+
+        SparseSlot(e.index) = InvalidIndex;
+
+        if (m_lockDepth > 0)
+        {
+            m_entities[di] = EntityId::Invalid(); // 순회 쪽은 Invalid면 건너뜀
+            m_pendingRemove.push_back(di);
+            return true;
+        }
+
+        SwapAndPop(di);
+        return true;
+    }
+
+    // 순회 보호: Lock ~ Unlock 사이 제거는 dense 위치를 바꾸지 않음 (중첩 가능)
+    // - 읽기 전용(const)으로 순회하는 pool도 다른 경로(World)로 제거될 수 있으므로 const에서도 잠금
+    void Lock() const { ++m_lockDepth; }
+    void Unlock() const
+    {
+        assert(m_lockDepth > 0);
+        if (--m_lockDepth > 0 || m_pendingRemove.empty())
+            return;
+
+        // 지연 제거는 non-const Remove로만 쌓임 → 실제 객체는 const가 아님
+        const_cast<ComponentPool*>(this)->FlushPendingRemoves();
+    }
+    bool IsLocked() const { return m_lockDepth > 0; }
+
+    // dense 순서 재배치: 새 dense[k] = 기존 dense[order[k]] (order는 0..size-1 순열)
+    void Reorder(const std::vector<uint32_t>& order)
+    {
+        assert(m_lockDepth == 0 && order.size() == m_data.size());
+
+        std::vector<T> data;
+        std::vector<EntityId> entities;
+        data.reserve(order.size());
+        entities.reserve(order.size());
+
+        for (uint32_t k = 0; k < (uint32_t)order.size(); ++k)
+        {
+            data.push_back(std::move(m_data[order[k]]));
+            entities.push_back(m_entities[order[k]]);
+            SparseSlot(entities.back().index) = k;
+        }
+
+        m_data.swap(data);
+        m_entities.swap(entities);
+
+        if (m_onMoved)
+        {
+            for (uint32_t k = 0; k < (uint32_t)m_entities.size(); ++k)
+                m_onMoved(m_onMovedUser, m_entities[k], k);
+        }
+    }
+
+    void Clear()
+    {
+        m_pages.clear();
+        m_entities.clear();
+        m_data.clear();
+        m_pendingRemove.clear();
+    }
+
+    uint32_t Size() const { return (uint32_t)m_data.size(); }
+    bool Empty() const { return m_data.empty(); }
+
+    // dense 직접 접근 (Lock 중에는 Invalid 엔티티 자리가 섞여 있을 수 있음)
+    const std::vector<EntityId>& Entities() const { return m_entities; }
+    std::vector<T>& Data() { return m_data; }
+    const std::vector<T>& Data() const { return m_data; }
+
+private:
+    uint32_t& SparseSlot(uint32_t entityIndex)
+    {
+        const uint32_t page = entityIndex >> PageBits;
+        if (page >= m_pages.size())
+            m_pages.resize(page + 1);
+
+        if (!m_pages[page])
+        {
+            m_pages[page].reset(new uint32_t[PageSize]);
+            std::fill_n(m_pages[page].get(), PageSize, InvalidIndex);
+        }
+
+        return m_pages[page][entityIndex & (PageSize - 1)];
+    }
+
+    void FlushPendingRemoves()
+    {
+        // 뒤에서부터 지워야 아직 안 지운 자리가 옮겨지지 않음
+        std::sort(m_pendingRemove.begin(), m_pendingRemove.end(), [](uint32_t a, uint32_t b) { return a > b; });
+        for (uint32_t di : m_pendingRemove)
+            SwapAndPop(di);
+        m_pendingRemove.clear();
+    }
+
+    void SwapAndPop(uint32_t di)
+    {
+        const uint32_t last = (uint32_t)m_data.size() - 1;
+        if (di != last)
+        {
+            m_data[di] = std::move(m_data[last]);
+            m_entities[di] = m_entities[last];
+
+            const EntityId moved = m_entities[di];
+            if (moved.IsValid()) // 지연 제거 중인 자리일 수도 있음
+            {
+                SparseSlot(moved.index) = di;
+                if (m_onMoved) m_onMoved(m_onMovedUser, moved, di);
+            }
+        }
+
+        m_data.pop_back();
+        m_entities.pop_back();
+    }
+
+private:
+    std::vector<std::unique_ptr<uint32_t[]>> m_pages;
+    std::vector<EntityId> m_entities;
+    std::vector<T> m_data;
+
+    mutable uint32_t m_lockDepth = 0;       // 순회 상태 (const 순회도 잠금)
+    std::vector<uint32_t> m_pendingRemove;
+
+    MovedFn m_onMoved = nullptr;
+    void* m_onMovedUser = nullptr;
+};
+
+// 여러 pool 교집합 순회: 가장 작은 pool의 dense 배열을 돌면서 나머지는 sparse 조회
+// - View<const A, B>처럼 const를 붙이면 그 pool은 읽기 전용 (값만 못 바꿀 뿐 Lock은 똑같이 함
+//   → 가장 작은 pool이 const여도 fn 안에서 World로 제거하면 Unlock까지 dense 위치 유지)
+// - 순회 중 제거 OK (Lock으로 지연), 추가 OK (순회 시작 시점 이후 추가분은 방문 보장 안 함)
+template<class... Ts>
+class View
+{
+    template<class T>
+    using PoolOf = std::conditional_t<std::is_const_v<T>, const ComponentPool<std::remove_const_t<T>>, ComponentPool<T>>;
+
+public:
+    explicit View(PoolOf<Ts>&... pools) : m_pools(&pools...) {}
+
+    // fn(EntityId, Ts&...)
+    template<class Fn>
+    void Each(Fn&& fn) const
+    {
+        const std::vector<EntityId>* smallest = nullptr;
+        ((smallest = (!smallest || std::get<PoolOf<Ts>*>(m_pools)->Size() < smallest->size())
+            ? &std::get<PoolOf<Ts>*>(m_pools)->Entities() : smallest), ...);
+
+        (LockPool<Ts>(), ...);
+
+        const std::vector<EntityId>& ents = *smallest;
+        const size_t n = ents.size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const EntityId e = ents[i];
+            if (!e.IsValid())
+                continue; // 지연 제거된 자리
+
+            const std::tuple<Ts*...> comps{ std::get<PoolOf<Ts>*>(m_pools)->TryGet(e)... };
+            if (!(std::get<Ts*>(comps) && ...))
+                continue;
+
+            fn(e, *std::get<Ts*>(comps)...);
+        }
+
+        (UnlockPool<Ts>(), ...);
+    }
+
+    // 교집합 크기 상한 (가장 작은 pool 크기)
+    uint32_t SizeHint() const
+    {
+        uint32_t n = 0xFFFFFFFFu;
+        ((n = std::min(n, std::get<PoolOf<Ts>*>(m_pools)->Size())), ...);
+        return n;
+    }
+
+private:
+    template<class T> void LockPool() const { std::get<PoolOf<T>*>(m_pools)->Lock(); }
+    template<class T> void UnlockPool() const { std::get<PoolOf<T>*>(m_pools)->Unlock(); }
+
+private:
+    std::tuple<PoolOf<Ts>*...> m_pools;
+};
@@ -0,0 +1,435 @@
+﻿#include "ContactSolverSoA.h"
+#include "ColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+// Helpers (lane별 3D 벡터 연산: x/y/z 성분을 각각 XMVECTOR로 들고 다님)
+static inline XMVECTOR Dot3(FXMVECTOR ax, FXMVECTOR ay, FXMVECTOR az, GXMVECTOR bx, HXMVECTOR by, HXMVECTOR bz)
+{
+    // 스칼라 solver와 같은 순서로 (a.x*b.x + a.y*b.y) + a.z*b.z
+    return XMVectorAdd(XMVectorAdd(XMVectorMultiply(ax, bx), XMVectorMultiply(ay, by)), XMVectorMultiply(az, bz));
+}
+
+static inline XMVECTOR LoadLanes(const std::vector<float>& src, const uint32_t (&idx)[4])
+{
+    return XMVectorSet(src[idx[0]], src[idx[1]], src[idx[2]], src[idx[3]]);
+}
+
+static inline void StoreLanes(std::vector<float>& dst, const uint32_t (&idx)[4], FXMVECTOR v)
+{
+    XMFLOAT4A f;
+    XMStoreFloat4A(&f, v);
+    dst[idx[0]] = f.x;
+    dst[idx[1]] = f.y;
+    dst[idx[2]] = f.z;
+    dst[idx[3]] = f.w;
+}
+
+static inline void OrthoTangent(const XMFLOAT3& n, XMFLOAT3& outT)
+{
+    // PhysicsSystem의 OrthoTangentFromNormal과 동일
+    XMFLOAT3 a = (std::fabs(n.y) < 0.9f) ? XMFLOAT3{ 0,1,0 } : XMFLOAT3{ 1,0,0 };
+    XMFLOAT3 t{ a.y * n.z - a.z * n.y, a.z * n.x - a.x * n.z, a.x * n.y - a.y * n.x };
+    float l2 = t.x * t.x + t.y * t.y + t.z * t.z;
+    if (l2 < 1e-12f) { outT = { 1,0,0 }; return; }
+    float inv = 1.0f / std::sqrt(l2);
+    outT = { t.x * inv, t.y * inv, t.z * inv };
+}
+
+void ContactSolverSoA::Solve(World& world, std::tuple<EntityId, EntityId, Contact>* contacts, size_t count, int iterations, float dt)
+{
+    m_stats = {};
+
+    Gather(world, contacts, count);
+    BuildBatches(contacts);
+
+    for (int it = 0; it < iterations; ++it)
+        for (Batch& b : m_batches)
+            SolveBatch(b, dt);
+
+    Scatter(world, contacts);
+}
+
+uint32_t ContactSolverSoA::BodySlot(World& world, EntityId e)
+{
+    if (!world.HasRigidBody(e))
+        return 0;
+
+    const auto& rb = world.GetRigidBody(e);
+    if (rb.type != BodyType::Dynamic)
+        return 0;
+
+    if (e.index >= m_slotOfEntity.size())
+        m_slotOfEntity.resize(size_t(e.index) + 1, 0);
+
+    uint32_t& slot = m_slotOfEntity[e.index];
+    if (slot != 0)
+        return slot;
+
+    slot = (uint32_t)m_bodyEntity.size();
+    m_touchedEntities.push_back(e.index);
+
+    m_bodyEntity.push_back(e);
+    m_vx.push_back(rb.velocity.x);
+    m_vy.push_back(rb.velocity.y);
+    m_vz.push_back(rb.velocity.z);
+    m_invMass.push_back(rb.invMass);
+    m_dpx.push_back(0.0f);
+    m_dpy.push_back(0.0f);
+    m_dpz.push_back(0.0f);
+    m_wake.push_back(0);
+    m_colorMask.push_back(0);
+    return slot;
+}
+
+void ContactSolverSoA::Gather(World& world, const std::tuple<EntityId, EntityId, Contact>* contacts, size_t count)
+{
+    // 이전 Step의 entity->slot 매핑 초기화(건드린 것만)
+    for (uint32_t idx : m_touchedEntities)
+        m_slotOfEntity[idx] = 0;
+    m_touchedEntities.clear();
+
+    m_bodyEntity.clear();
+    m_vx.clear(); m_vy.clear(); m_vz.clear();
+    m_invMass.clear();
+    m_dpx.clear(); m_dpy.clear(); m_dpz.clear();
+    m_wake.clear();
+    m_colorMask.clear();
+
+    // slot 0: 더미
+    m_bodyEntity.push_back(EntityId::Invalid());
+    m_vx.push_back(0.0f); m_vy.push_back(0.0f); m_vz.push_back(0.0f);
+    m_invMass.push_back(0.0f);
+    m_dpx.push_back(0.0f); m_dpy.push_back(0.0f); m_dpz.push_back(0.0f);
+    m_wake.push_back(0);
+    m_colorMask.push_back(0);
+
+    m_items.clear();
+    m_items.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const EntityId a = std::get<0>(contacts[i]);
+        const EntityId b = std::get<1>(contacts[i]);
+
+        const auto& ca = world.GetCollider(a);
+        const auto& cb = world.GetCollider(b);
+
+        // trigger는 밀어내지 않음(이벤트만)
+        if (ca.isTrigger || cb.isTrigger)
+            continue;
+
+        const uint32_t sa = BodySlot(world, a);
+        const uint32_t sb = BodySlot(world, b);
+
+        // 스칼라 solver의 invMassSum <= 0 스킵과 동일
+        if (m_invMass[sa] + m_invMass[sb] <= 0.0f)
+            continue;
+
+        m_items.push_back({ (int32_t)i, sa, sb,
+            std::min(ca.material.restitution, cb.material.restitution),
+            std::max(ca.material.friction, cb.material.friction) });
+    }
+
+    m_stats.bodyCount = (uint32_t)m_bodyEntity.size() - 1;
+    m_stats.contactCount = (uint32_t)m_items.size();
+}
+
+void ContactSolverSoA::BuildBatches(const std::tuple<EntityId, EntityId, Contact>* contacts)
+{
+    for (auto& c : m_colors)
+        c.clear();
+
+    std::vector<uint32_t> overflow;
+
+    // greedy 컬러링: 두 body가 아직 안 쓴 가장 작은 색 (더미 slot 0은 공유해도 무방)
+    for (uint32_t i = 0; i < (uint32_t)m_items.size(); ++i)
+    {
+        const Item& it = m_items[i];
+        uint64_t used = 0;
+        if (it.a != 0) used |= m_colorMask[it.a];
+        if (it.b != 0) used |= m_colorMask[it.b];
+
+        if (used == ~0ull)
+        {
+            overflow.push_back(i);
+            continue;
+        }
+
+        uint32_t color = 0;
+        while (used & (1ull << color))
+            ++color;
+
+        if (it.a != 0) m_colorMask[it.a] |= (1ull << color);
+        if (it.b != 0) m_colorMask[it.b] |= (1ull << color);
+
+        if (color >= m_colors.size())
+            m_colors.resize(size_t(color) + 1);
+        m_colors[color].push_back(i);
+    }
+
+    m_batches.clear();
+
+    auto emitBatch = [&](const uint32_t* items, uint32_t count)
+        {
+            float nx[4] = { 1,1,1,1 }, ny[4] = {}, nz[4] = {};
+            float tx[4] = { 0,0,0,0 }, ty[4] = { 1,1,1,1 }, tz[4] = {};
+            float pen[4] = {}, imA[4] = {}, imB[4] = {}, imSum[4] = { 1,1,1,1 };
+            float rest[4] = {}, fric[4] = {}, accN[4] = {}, accT[4] = {};
+
+            Batch b{};
+            for (uint32_t l = 0; l < Lanes; ++l)
+            {
+                b.bodyA[l] = 0;
+                b.bodyB[l] = 0;
+                b.contact[l] = -1;
+            }
+
+            for (uint32_t l = 0; l < count; ++l)
+            {
+                const Item& it = m_items[items[l]];
+                const auto& tup = contacts[it.contact];
+                const Contact& c = std::get<2>(tup);
+
+                b.bodyA[l] = it.a;
+                b.bodyB[l] = it.b;
+                b.contact[l] = it.contact;
+
+                nx[l] = c.normal.x; ny[l] = c.normal.y; nz[l] = c.normal.z;
+
+                XMFLOAT3 t{};
+                OrthoTangent(c.normal, t);
+                tx[l] = t.x; ty[l] = t.y; tz[l] = t.z;
+
+                pen[l] = c.penetration;
+                imA[l] = m_invMass[it.a];
+                imB[l] = m_invMass[it.b];
+                imSum[l] = imA[l] + imB[l];
+                rest[l] = it.restitution;
+                fric[l] = it.friction;
+                accN[l] = c.normalImpulseSum;
+                accT[l] = c.tangentImpulseSum;
+            }
+
+            b.nx = XMVectorSet(nx[0], nx[1], nx[2], nx[3]);
+            b.ny = XMVectorSet(ny[0], ny[1], ny[2], ny[3]);
+            b.nz = XMVectorSet(nz[0], nz[1], nz[2], nz[3]);
+            b.tx = XMVectorSet(tx[0], tx[1], tx[2], tx[3]);
+            b.ty = XMVectorSet(ty[0], ty[1], ty[2], ty[3]);
+            b.tz = XMVectorSet(tz[0], tz[1], tz[2], tz[3]);
+            b.penetration = XMVectorSet(pen[0], pen[1], pen[2], pen[3]);
+            b.invMassA = XMVectorSet(imA[0], imA[1], imA[2], imA[3]);
+            b.invMassB = XMVectorSet(imB[0], imB[1], imB[2], imB[3]);
+            b.invMassSum = XMVectorSet(imSum[0], imSum[1], imSum[2], imSum[3]);
+            b.normalImpulse = XMVectorSet(accN[0], accN[1], accN[2], accN[3]);
+            b.tangentImpulse = XMVectorSet(accT[0], accT[1], accT[2], accT[3]);
+            b.restitution = XMVectorSet(rest[0], rest[1], rest[2], rest[3]);
+            b.friction = XMVectorSet(fric[0], fric[1], fric[2], fric[3]);
+
+            m_batches.push_back(b);
+        };
+
+    for (const auto& color : m_colors)
+    {
+        if (color.empty())
+            continue;
+
+        ++m_stats.colorCount;
+        for (size_t i = 0; i < color.size(); i += Lanes)
+        {
+            const uint32_t n = (uint32_t)std::min<size_t>(Lanes, color.size() - i);
+            emitBatch(&color[i], n);
+        }
+    }
+
+    // 색이 모자란 contact는 하나씩(다른 lane은 패딩)
+    for (uint32_t i : overflow)
+        emitBatch(&i, 1);
+
+    m_stats.batchCount = (uint32_t)m_batches.size();
+    m_stats.overflowContacts = (uint32_t)overflow.size();
+}
+
+void ContactSolverSoA::SolveBatch(Batch& b, float dt)
+{
+    const XMVECTOR zero = XMVectorZero();
+
+    // --- body 속도 로드 ---
+    XMVECTOR vAx = LoadLanes(m_vx, b.bodyA), vAy = LoadLanes(m_vy, b.bodyA), vAz = LoadLanes(m_vz, b.bodyA);
+    XMVECTOR vBx = LoadLanes(m_vx, b.bodyB), vBy = LoadLanes(m_vy, b.bodyB), vBz = LoadLanes(m_vz, b.bodyB);
+
+    // 상대속도
+    XMVECTOR rx = XMVectorSubtract(vBx, vAx);
+    XMVECTOR ry = XMVectorSubtract(vBy, vAy);
+    XMVECTOR rz = XMVectorSubtract(vBz, vAz);
+    XMVECTOR vn = Dot3(rx, ry, rz, b.nx, b.ny, b.nz);
+
+    // --- bias (관통 제거용 속도항) ---
+    const XMVECTOR pen = XMVectorMax(zero, XMVectorSubtract(b.penetration, XMVectorReplicate(SolverTuning::Slop)));
+    XMVECTOR bias = zero;
+    if (dt > 0.0f)
+        bias = XMVectorMultiply(XMVectorReplicate(SolverTuning::Beta), XMVectorDivide(pen, XMVectorReplicate(dt)));
+    bias = XMVectorMin(bias, XMVectorReplicate(SolverTuning::MaxBias));
+
+    // --- restitution(빠른 충돌에만) ---
+    const XMVECTOR fast = XMVectorLess(vn, XMVectorReplicate(-SolverTuning::BounceThreshold));
+    const XMVECTOR bounceVel = XMVectorSelect(zero, XMVectorNegate(XMVectorMultiply(b.restitution, vn)), fast);
+
+    // --- positional correction (누적만, 위치는 Scatter에서) ---
+    {
+        const XMVECTOR hasPen = XMVectorGreater(pen, zero);
+        XMVECTOR corrMag = XMVectorMultiply(XMVectorDivide(pen, b.invMassSum), XMVectorReplicate(SolverTuning::Percent));
+        corrMag = XMVectorMin(corrMag, XMVectorReplicate(SolverTuning::MaxCorrection));
+        corrMag = XMVectorSelect(zero, corrMag, hasPen);
+
+        const XMVECTOR cx = XMVectorMultiply(b.nx, corrMag);
+        const XMVECTOR cy = XMVectorMultiply(b.ny, corrMag);
+        const XMVECTOR cz = XMVectorMultiply(b.nz, corrMag);
+
+        StoreLanes(m_dpx, b.bodyA, XMVectorSubtract(LoadLanes(m_dpx, b.bodyA), XMVectorMultiply(cx, b.invMassA)));
+        StoreLanes(m_dpy, b.bodyA, XMVectorSubtract(LoadLanes(m_dpy, b.bodyA), XMVectorMultiply(cy, b.invMassA)));
+        StoreLanes(m_dpz, b.bodyA, XMVectorSubtract(LoadLanes(m_dpz, b.bodyA), XMVectorMultiply(cz, b.invMassA)));
+        StoreLanes(m_dpx, b.bodyB, XMVectorAdd(LoadLanes(m_dpx, b.bodyB), XMVectorMultiply(cx, b.invMassB)));
+        StoreLanes(m_dpy, b.bodyB, XMVectorAdd(LoadLanes(m_dpy, b.bodyB), XMVectorMultiply(cy, b.invMassB)));
+        StoreLanes(m_dpz, b.bodyB, XMVectorAdd(LoadLanes(m_dpz, b.bodyB), XMVectorMultiply(cz, b.invMassB)));
+    }
+
+    // ============================
+    // (1) Normal impulse
+    // ============================
+    const XMVECTOR lambdaN = XMVectorDivide(XMVectorNegate(XMVectorAdd(XMVectorAdd(vn, bias), bounceVel)), b.invMassSum);
+
+    const XMVECTOR oldN = b.normalImpulse;
+    b.normalImpulse = XMVectorMax(zero, XMVectorAdd(oldN, lambdaN));
+    const XMVECTOR dN = XMVectorSubtract(b.normalImpulse, oldN);
+
+    XMVECTOR wake = XMVectorGreater(lambdaN, XMVectorReplicate(SolverTuning::WakeImpulse));
+
+    {
+        const XMVECTOR px = XMVectorMultiply(b.nx, dN);
+        const XMVECTOR py = XMVectorMultiply(b.ny, dN);
+        const XMVECTOR pz = XMVectorMultiply(b.nz, dN);
+        vAx = XMVectorSubtract(vAx, XMVectorMultiply(px, b.invMassA));
+        vAy = XMVectorSubtract(vAy, XMVectorMultiply(py, b.invMassA));
+        vAz = XMVectorSubtract(vAz, XMVectorMultiply(pz, b.invMassA));
+        vBx = XMVectorAdd(vBx, XMVectorMultiply(px, b.invMassB));
+        vBy = XMVectorAdd(vBy, XMVectorMultiply(py, b.invMassB));
+        vBz = XMVectorAdd(vBz, XMVectorMultiply(pz, b.invMassB));
+    }
+
+    // ============================
+    // (2) Friction impulse (tangent)
+    // ============================
+    rx = XMVectorSubtract(vBx, vAx);
+    ry = XMVectorSubtract(vBy, vAy);
+    rz = XMVectorSubtract(vBz, vAz);
+    vn = Dot3(rx, ry, rz, b.nx, b.ny, b.nz);
+
+    XMVECTOR tx = XMVectorSubtract(rx, XMVectorMultiply(b.nx, vn));
+    XMVECTOR ty = XMVectorSubtract(ry, XMVectorMultiply(b.ny, vn));
+    XMVECTOR tz = XMVectorSubtract(rz, XMVectorMultiply(b.nz, vn));
+
+    // |t|가 너무 작으면 직교 tangent, 아니면 정규화(NormalizeSafe와 같은 1e-6 기준)
+    {
+        const XMVECTOR t2 = Dot3(tx, ty, tz, tx, ty, tz);
+        const XMVECTOR len = XMVectorSqrt(t2);
+        const XMVECTOR useOrtho = XMVectorOrInt(
+            XMVectorLess(t2, XMVectorReplicate(1e-12f)),
+            XMVectorLessOrEqual(len, XMVectorReplicate(1e-6f)));
+        const XMVECTOR safeLen = XMVectorSelect(len, XMVectorReplicate(1.0f), useOrtho);
+
+        tx = XMVectorSelect(XMVectorDivide(tx, safeLen), b.tx, useOrtho);
+        ty = XMVectorSelect(XMVectorDivide(ty, safeLen), b.ty, useOrtho);
+        tz = XMVectorSelect(XMVectorDivide(tz, safeLen), b.tz, useOrtho);
+    }
+
+    const XMVECTOR vt = Dot3(rx, ry, rz, tx, ty, tz);
+
+    // |vt|가 아주 작으면 마찰 누적 리셋 후 스킵
+    const XMVECTOR still = XMVectorLess(XMVectorAbs(vt), XMVectorReplicate(1e-6f));
+
+    const XMVECTOR lambdaT = XMVectorDivide(XMVectorNegate(vt), b.invMassSum);
+
+    // 쿨롱 마찰: |λt| <= mu * λn
+    const XMVECTOR maxF = XMVectorMultiply(b.friction, b.normalImpulse);
+
+    const XMVECTOR oldT = b.tangentImpulse;
+    const XMVECTOR newT = XMVectorMax(XMVectorNegate(maxF), XMVectorMin(XMVectorAdd(oldT, lambdaT), maxF));
+    b.tangentImpulse = XMVectorSelect(newT, zero, still);
+    const XMVECTOR dT = XMVectorSelect(XMVectorSubtract(newT, oldT), zero, still);
+
+    wake = XMVectorOrInt(wake, XMVectorAndCInt(
+        XMVectorGreater(XMVectorAbs(lambdaT), XMVectorReplicate(SolverTuning::WakeImpulse)), still));
+
+    {
+        const XMVECTOR px = XMVectorMultiply(tx, dT);
+        const XMVECTOR py = XMVectorMultiply(ty, dT);
+        const XMVECTOR pz = XMVectorMultiply(tz, dT);
+        vAx = XMVectorSubtract(vAx, XMVectorMultiply(px, b.invMassA));
+        vAy = XMVectorSubtract(vAy, XMVectorMultiply(py, b.invMassA));
+        vAz = XMVectorSubtract(vAz, XMVectorMultiply(pz, b.invMassA));
+        vBx = XMVectorAdd(vBx, XMVectorMultiply(px, b.invMassB));
+        vBy = XMVectorAdd(vBy, XMVectorMultiply(py, b.invMassB));
+        vBz = XMVectorAdd(vBz, XMVectorMultiply(pz, b.invMassB));
+    }
+
+    // --- 속도 저장 (같은 색 안에서는 dynamic body가 겹치지 않음. 더미 slot 0은 항상 0이 써짐) ---
+    StoreLanes(m_vx, b.bodyA, vAx); StoreLanes(m_vy, b.bodyA, vAy); StoreLanes(m_vz, b.bodyA, vAz);
+    StoreLanes(m_vx, b.bodyB, vBx); StoreLanes(m_vy, b.bodyB, vBy); StoreLanes(m_vz, b.bodyB, vBz);
+
+    uint32_t wakeBits[4];
+    XMStoreInt4(wakeBits, wake);
+    for (uint32_t l = 0; l < Lanes; ++l)
+    {
+        if (wakeBits[l])
+        {
+            m_wake[b.bodyA[l]] = 1;
+            m_wake[b.bodyB[l]] = 1;
+        }
+    }
+}
+
+void ContactSolverSoA::Scatter(World& world, std::tuple<EntityId, EntityId, Contact>* contacts)
+{
+    // contact 누적 임펄스(다음 프레임 warm start용)
+    for (const Batch& b : m_batches)
+    {
+        XMFLOAT4A n, t;
+        XMStoreFloat4A(&n, b.normalImpulse);
+        XMStoreFloat4A(&t, b.tangentImpulse);
+        const float ns[4] = { n.x, n.y, n.z, n.w };
+        const float ts[4] = { t.x, t.y, t.z, t.w };
+
+        for (uint32_t l = 0; l < Lanes; ++l)
+        {
+            if (b.contact[l] < 0) continue;
+            Contact& c = std::get<2>(contacts[b.contact[l]]);
+            c.normalImpulseSum = ns[l];
+            c.tangentImpulseSum = ts[l];
+        }
+    }
+
+    // bodies (slot 0 = 더미 제외)
+    for (uint32_t s = 1; s < (uint32_t)m_bodyEntity.size(); ++s)
+    {
+        const EntityId e = m_bodyEntity[s];
+        auto& rb = world.GetRigidBody(e);
+        rb.velocity = { m_vx[s], m_vy[s], m_vz[s] };
+
+        if (m_dpx[s] != 0.0f || m_dpy[s] != 0.0f || m_dpz[s] != 0.0f)
+        {
+            XMFLOAT3 p = world.GetLocalPosition(e);
+            p = { p.x + m_dpx[s], p.y + m_dpy[s], p.z + m_dpz[s] };
+            world.SetLocalPosition(e, p);
+        }
+
+        if (m_wake[s])
+        {
+            rb.isAwake = true;
+            rb.sleepTimer = 0.0f;
+        }
+    }
+}
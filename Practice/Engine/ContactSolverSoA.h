@@ -0,0 +1,81 @@
+﻿#pragma once
+#include "World.h"
+#include "PhysicsTypes.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+// Sequential Impulses solver - SoA + 4-lane SIMD(XMVECTOR) 버전
+// - Step마다 한 번 body/contact를 연속 배열로 gather → 반복 중에는 World 조회 없음 → 끝나고 scatter
+// - contact는 그래프 컬러링: 같은 색 안에서는 dynamic body를 공유하지 않으므로 4개씩 묶어 동시에 풀어도
+//   순차 처리와 결과가 같음(색 사이 순서만 스칼라 solver와 다름)
+// - 식/상수는 PhysicsSystem::Solve(스칼라)와 동일(SolverTuning)
+class ContactSolverSoA
+{
+public:
+    struct Stats
+    {
+        uint32_t bodyCount = 0;         // gather된 dynamic body 수
+        uint32_t contactCount = 0;      // 실제로 푼 contact 수(트리거/질량 0 제외)
+        uint32_t colorCount = 0;
+        uint32_t batchCount = 0;        // 4-lane 배치 수
+        uint32_t overflowContacts = 0;  // 색이 모자라 단독 배치로 간 contact 수
+    };
+
+    void Solve(World& world, std::tuple<EntityId, EntityId, Contact>* contacts, size_t count, int iterations, float dt);
+
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    static constexpr uint32_t Lanes = 4;
+    static constexpr uint32_t MaxColors = 64; // body별 사용 색을 uint64 비트로 관리
+
+    // 4개 contact 묶음 (AoSoA). lane 하나 = contact 하나
+    struct alignas(16) Batch
+    {
+        DirectX::XMVECTOR nx, ny, nz;
+        DirectX::XMVECTOR tx, ty, tz;           // 직교 tangent(상대속도 tangent가 0일 때 대체값)
+        DirectX::XMVECTOR penetration;
+        DirectX::XMVECTOR invMassA, invMassB, invMassSum;
+        DirectX::XMVECTOR restitution, friction;
+        DirectX::XMVECTOR normalImpulse, tangentImpulse;
+
+        uint32_t bodyA[Lanes];                  // body slot (0 = static/패딩용 더미)
+        uint32_t bodyB[Lanes];
+        int32_t contact[Lanes];                 // 원본 contacts 인덱스 (-1 = 패딩)
+    };
+
+    void Gather(World& world, const std::tuple<EntityId, EntityId, Contact>* contacts, size_t count);
+    void BuildBatches(const std::tuple<EntityId, EntityId, Contact>* contacts);
+    void SolveBatch(Batch& b, float dt);
+    void Scatter(World& world, std::tuple<EntityId, EntityId, Contact>* contacts);
+
+    uint32_t BodySlot(World& world, EntityId e);
+
+private:
+    Stats m_stats{};
+
+    // bodies (SoA). slot 0은 static/패딩용 더미(invMass 0, 속도 0)
+    std::vector<EntityId> m_bodyEntity;
+    std::vector<float> m_vx, m_vy, m_vz;
+    std::vector<float> m_invMass;
+    std::vector<float> m_dpx, m_dpy, m_dpz;     // 누적 위치 보정(반복 끝나고 한 번에 적용)
+    std::vector<uint8_t> m_wake;
+    std::vector<uint64_t> m_colorMask;
+
+    std::vector<uint32_t> m_slotOfEntity;       // entity.index -> slot (0 = 없음)
+    std::vector<uint32_t> m_touchedEntities;
+
+    // contacts
+    struct Item
+    {
+        int32_t contact;
+        uint32_t a, b;
+        float restitution;  // min(a, b)
+        float friction;     // max(a, b)
+    };
+    std::vector<Item> m_items;
+    std::vector<std::vector<uint32_t>> m_colors; // 색별 m_items 인덱스
+    std::vector<Batch> m_batches;
+};
@@ -10,6 +10,8 @@
 #include "TextureHandle.h"
 #include "TextureCpuData.h"
 #include "FrameLights.h"
+#include "JobSystem.h"
+#include "VertexQuantize.h"
 
 #pragma comment(lib, "d3d12.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -27,6 +29,24 @@ void D3D12Renderer::ThrowIfFailed(HRESULT hr)
     if (FAILED(hr)) throw std::runtime_error("D3D12 call failed.");
 }
 
+// geometry 메가버퍼 정점 포맷 (input layout: POSITION / NORMAL / TEXCOORD)
+struct VertexPNU
+{
+    XMFLOAT3 pos;
+    XMFLOAT3 nrm;
+    XMFLOAT2 uv;
+};
+
+// opaque 패스의 bindless SRV 테이블(힙 전체, 끝 없는 범위)은 resource binding tier 2 이상에서만 만들 수 있음
+// (tier 1은 stage당 SRV 128개 한도 → 고정 크기 테이블로 낮춰도 MaxSrvDescriptors를 못 담음)
+static bool SupportsBindlessSrv(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options{};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))))
+        return false;
+    return options.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2;
+}
+
 static D3D12_RESOURCE_DESC MakeBufferDesc(UINT64 byteSize)
 {
     D3D12_RESOURCE_DESC d{};
@@ -44,12 +64,16 @@ static D3D12_RESOURCE_DESC MakeBufferDesc(UINT64 byteSize)
     return d;
 }
 
-void D3D12Renderer::Initialize(HWND hwnd, uint32_t width, uint32_t height)
+void D3D12Renderer::Initialize(void* nativeWindow, uint32_t width, uint32_t height)
 {
+    HWND hwnd = static_cast<HWND>(nativeWindow);
     m_hwnd = hwnd;
     m_width = width;
     m_height = height;
 
+    // 텍스처는 인스턴스별 bindless 인덱스 → 텍스처가 달라도 같은 (mesh, submesh)면 한 draw
+    m_instanceBatcher.SetBindlessTextures(true);
+
     CreateDeviceAndSwapChain(hwnd);
     CreateCommandObjects();
     CreateDescriptorHeaps();
@@ -59,12 +83,11 @@ void D3D12Renderer::Initialize(HWND hwnd, uint32_t width, uint32_t height)
     CreatePipeline();
     CreateSkyboxPipeline();
     CreateSkyboxMesh();
-    CreateConstantBuffer();
+    CreateUploadRing();
+    CreateGeometryBuffers();
 	CreateUIPipeline();
 
     CreateDebugLinePipeline();
-    CreateDebugVertexBuffer();
-	CreateUIVertexBuffer();
 
     // fence
     ThrowIfFailed(m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)));
@@ -75,17 +98,16 @@ void D3D12Renderer::Initialize(HWND hwnd, uint32_t width, uint32_t height)
 
     m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 
-    // 초기 커맨드 리스트 녹화 (기본 텍스처 업로드 포함)
-    ThrowIfFailed(m_commandAllocators[0]->Reset());
-    ThrowIfFailed(m_commandList->Reset(m_commandAllocators[0].Get(), nullptr));
+    // 처음 본 mesh/texture 비동기 업로드 (완료되면 캐시에 resident 표시)
+    m_uploadScheduler.Initialize(MaxUploadsPerSubmit, MaxUploadBytesPerSubmit, MaxUploadBytesPerFrame,
+        [this](const UploadRequest& request, uint64_t /*fenceValue*/)
+        {
+            OnUploadComplete(request);
+        });
 
-    // slot 0 기본 텍스처 생성 (checkerboard)
+    // slot 0 기본 텍스처 생성 (checkerboard, copy queue 완료까지 대기)
     CreateDefaultTexture_Checkerboard();
 
-    ThrowIfFailed(m_commandList->Close());
-    ID3D12CommandList* lists[] = { m_commandList.Get() };
-    m_commandQueue->ExecuteCommandLists(1, lists);
-
     // viewport/scissor
     m_viewport = { 0.0f, 0.0f, (float)width, (float)height, 0.0f, 1.0f };
     m_scissor = { 0, 0, (LONG)width, (LONG)height };
@@ -94,40 +116,34 @@ void D3D12Renderer::Initialize(HWND hwnd, uint32_t width, uint32_t height)
 
     // Init DirectWrite/Direct2D overlay
     CreateTextOverlay();
-
-    // 초기화에서 만든 텍스처 upload는 fence 완료됐으니 정리 가능
-    for (auto& [id, t] : m_gpuTextures)
-        t.upload.Reset();
 }
 
 void D3D12Renderer::Shutdown()
 {
     WaitForGPU();
 
+    // 진행 중인 copy도 끝까지 (대기열에 남은 요청은 버림)
+    WaitUploadFence(m_copyFenceValue);
+    m_uploadScheduler.Clear();
+
     m_pendingMeshReleases.clear();
     m_gpuMeshes.clear();
 
-    m_pendingTextureReleases.clear();
-    m_pendingTextureUploadReleases.clear();
-    m_gpuTextures.clear();
-
-    if (m_cbMapped)
+    m_pendingGeometryReleases.clear();
+    for (GeometryBuffer& g : m_geometry)
     {
-        m_cb->Unmap(0, nullptr);
-        m_cbMapped = nullptr;
+        g.resource.Reset();
+        g.allocator.Clear();
     }
 
-    if (m_debugVBMapped)
-    {
-        m_debugVB->Unmap(0, nullptr);
-        m_debugVBMapped = nullptr;
-    }
+    m_pendingTextureReleases.clear();
+    m_gpuTextures.clear();
 
-    if (m_uiVBMapped)
-    {
-        m_uiVB->Unmap(0, nullptr);
-        m_uiVBMapped = nullptr;
-	}
+    // 업로드/staging page Unmap + 해제 (GPU는 위에서 대기 완료)
+    m_upload.Shutdown();
+    m_uploadPages.clear();
+    m_staging.Shutdown();
+    m_stagingPages.clear();
 
     if (m_fenceEvent)
     {
@@ -199,10 +215,20 @@ void D3D12Renderer::Resize(uint32_t width, uint32_t height)
 void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCamera& cam, const FrameLights& lights, TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text)
 {
     ProcessPendingMeshReleases();
-    ProcessPendingTextureUploadReleases();
+    ProcessPendingGeometryReleases();
     ProcessPendingTextureReleases();
 
-    m_texturesCreatedThisFrame.clear();
+    m_geometryUploadsThisFrame = 0;
+    m_copyAllocatorReset = false;
+
+    // 끝난 프레임이 쓰던 업로드 page / 반납된 SRV slot 회수
+    m_upload.BeginFrame(m_fence->GetCompletedValue());
+    m_srvAllocator.Reclaim(m_fence->GetCompletedValue());
+
+    // 끝난 copy 제출: staging page 회수 + 캐시에 resident 표시 (이번 프레임부터 그림)
+    const uint64_t copyCompleted = m_copyFence->GetCompletedValue();
+    m_staging.BeginFrame(copyCompleted);
+    m_uploadScheduler.BeginFrame(copyCompleted);
 
     // Reset allocator/list
     ThrowIfFailed(m_commandAllocators[m_frameIndex]->Reset());
@@ -238,57 +264,52 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
     m_commandList->SetGraphicsRootSignature(m_rootSignature.Get());
     m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    // SRV heap
+    // SRV heap (opaque 텍스처는 힙 전체를 bindless 테이블로 한 번만)
     ID3D12DescriptorHeap* heaps[] = { m_srvHeap.Get() };
     m_commandList->SetDescriptorHeaps(1, heaps);
+    m_commandList->SetGraphicsRootDescriptorTable(8, m_srvHeap->GetGPUDescriptorHandleForHeapStart());
 
     // View/Proj
     XMMATRIX V = XMLoadFloat4x4(&cam.view);
     XMMATRIX P = XMLoadFloat4x4(&cam.proj);
 
-    // -------- Per-frame CB upload (camera + lights)
+    // -------- Per-frame CB upload (camera + light cluster 조회 상수)
     {
+        UploadLightClusters(lights, cam);
+
         FrameCB fcb{};
         fcb.view = cam.view;
         fcb.proj = cam.proj;
         fcb.cameraPos_numLights = DirectX::XMFLOAT4(
             lights.cameraPosWS.x, lights.cameraPosWS.y, lights.cameraPosWS.z,
-            (float)lights.numLights);
-        std::memcpy(fcb.lights, lights.lights, sizeof(fcb.lights));
-
-        const uint32_t frameSlot = m_frameIndex;
-        std::memcpy(m_frameCBMapped + frameSlot * m_frameCBStride, &fcb, sizeof(FrameCB));
-
-        const D3D12_GPU_VIRTUAL_ADDRESS fcbAddr =
-            m_frameCB->GetGPUVirtualAddress() + (UINT64)frameSlot * (UINT64)m_frameCBStride;
-
-        m_commandList->SetGraphicsRootConstantBufferView(1, fcbAddr);
+            (float)lights.lights.size());
+        fcb.clusterScale = DirectX::XMFLOAT4(
+            (float)LightClusterX / std::max(m_viewport.Width, 1.0f),
+            (float)LightClusterY / std::max(m_viewport.Height, 1.0f),
+            m_lightClusterer.GetSliceScale(), m_lightClusterer.GetSliceBias());
+        fcb.clusterDims[0] = LightClusterX;
+        fcb.clusterDims[1] = LightClusterY;
+        fcb.clusterDims[2] = LightClusterZ;
+        fcb.clusterDims[3] = m_lightClusterer.GetGlobalLightCount();
+
+        m_frameCBAddress = UploadConstants(&fcb, sizeof(FrameCB));
+        m_commandList->SetGraphicsRootConstantBufferView(1, m_frameCBAddress);
     }
 
-    const uint32_t maxOpaque = MaxDrawsPerFrame - 1; // 마지막 1개는 skybox용
-    const uint32_t drawCount = std::min<uint32_t>((uint32_t)items.size(), maxOpaque);
-    const uint32_t frameBase = m_frameIndex * MaxDrawsPerFrame;
-    const uint32_t skySlot = frameBase + MaxDrawsPerFrame - 1;
-
-    // Skybox (if set)
-    if (skybox.IsValid())
+    // Skybox (if set, 아직 복사 중이면 이번 프레임은 생략)
+    const uint32_t skySrvIndex = skybox.IsValid() ? GetResidentSrvIndex(skybox, DescriptorAllocator::InvalidSlot) : DescriptorAllocator::InvalidSlot;
+    if (skySrvIndex != DescriptorAllocator::InvalidSlot)
     {
         // PSO 전환
         m_commandList->SetPipelineState(m_skyPso.Get());
         m_commandList->SetGraphicsRootSignature(m_rootSignature.Get());
 
         // FrameCB is root parameter [1]
-        {
-            const D3D12_GPU_VIRTUAL_ADDRESS fcbAddr =
-                m_frameCB->GetGPUVirtualAddress() + (UINT64)m_frameIndex * (UINT64)m_frameCBStride;
-            m_commandList->SetGraphicsRootConstantBufferView(1, fcbAddr);
-        }
+        m_commandList->SetGraphicsRootConstantBufferView(1, m_frameCBAddress);
 
         // SRV (cubemap)
-        const uint32_t srvIndex = GetOrCreateSrvIndex(skybox);
-
         D3D12_GPU_DESCRIPTOR_HANDLE gh = m_srvHeap->GetGPUDescriptorHandleForHeapStart();
-        gh.ptr += (SIZE_T)srvIndex * m_srvDescriptorSize;
+        gh.ptr += (SIZE_T)skySrvIndex * m_srvDescriptorSize;
         m_commandList->SetGraphicsRootDescriptorTable(2, gh);
 
         // view translation 제거한 viewProj
@@ -304,11 +325,7 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
         DirectX::XMStoreFloat4x4(&cb.world, DirectX::XMMatrixIdentity());
         cb.color = XMFLOAT4(1, 1, 1, 1);
 
-        std::memcpy(m_cbMapped + skySlot * m_cbStride, &cb, sizeof(DrawCB));
-        D3D12_GPU_VIRTUAL_ADDRESS cbAddr =
-            m_cb->GetGPUVirtualAddress() + (UINT64)skySlot * (UINT64)m_cbStride;
-
-        m_commandList->SetGraphicsRootConstantBufferView(0, cbAddr);
+        m_commandList->SetGraphicsRootConstantBufferView(0, UploadConstants(&cb, sizeof(DrawCB)));
 
         // IA
         m_commandList->IASetVertexBuffers(0, 1, &m_skyVBView);
@@ -321,102 +338,118 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
         m_commandList->SetPipelineState(m_pso.Get());
     }
 
-    struct DrawKey
-    {
-        uint32_t itemIndex = 0;
-        uint32_t srvIndex = 0;
-        uint32_t meshId = 0;
-        uint64_t key = 0;
-    };
+    // -------- Opaque: 같은 (texture, mesh, submesh) 묶음 → instanced draw 1번
+    const uint32_t itemCount = (uint32_t)items.size();
+    m_itemSrvIndices.resize(itemCount);
+    m_itemPipelines.resize(itemCount);
 
-    std::vector<DrawKey> order;
-    order.resize(drawCount);
+    static constexpr uint8_t NotResident = 0xFF;
 
-    for (uint32_t i = 0; i < drawCount; ++i)
+    uint32_t lastMeshId = 0xFFFFFFFFu;
+    const MeshGPUData* lastMesh = nullptr;
+    bool allResident = true;
+    for (uint32_t i = 0; i < itemCount; ++i)
     {
-        const RenderItem& it = items[i];
+        // TextureHandle -> srvIndex 를 renderer가 해결 (TextureHandle이 없거나 아직 복사 중이면 0(기본))
+        m_itemSrvIndices[i] = GetResidentSrvIndex(items[i].albedo);
 
-        // TextureHandle -> srvIndex 를 renderer가 해결
-        uint32_t srvIndex = 0;
-        srvIndex = GetOrCreateSrvIndex(it.albedo); // TextureHandle이 없으면 0(기본)
+        // 정점 포맷/인덱스 크기 → 정렬 키 pipeline 필드 (같은 layout끼리 모여 PSO/IA 전환 최소화)
+        // (연속 item은 같은 mesh인 경우가 많아 직전 결과 재사용)
+        if (items[i].mesh.id != lastMeshId)
+        {
+            lastMesh = FindResidentMesh(items[i].mesh.id);
+            lastMeshId = items[i].mesh.id;
+        }
 
-        order[i].itemIndex = i;
-        order[i].srvIndex = srvIndex;
-        order[i].meshId = it.mesh.id;
-        order[i].key = (uint64_t(srvIndex) << 32) | uint64_t(it.mesh.id);
+        if (!lastMesh)
+        {
+            m_itemPipelines[i] = NotResident;
+            allResident = false;
+            continue;
+        }
+        m_itemPipelines[i] = (uint8_t)lastMesh->layout;
     }
 
-    std::sort(order.begin(), order.end(),
-        [&](const DrawKey& a, const DrawKey& b) { return a.key < b.key; });
-
-    // (2) Cached state
-    uint32_t lastSrvIndex = 0xFFFFFFFFu;
-    uint32_t lastMeshId = 0xFFFFFFFFu;
-
-    D3D12_GPU_DESCRIPTOR_HANDLE srvBase = m_srvHeap->GetGPUDescriptorHandleForHeapStart();
-
-    for (uint32_t k = 0; k < drawCount; ++k)
+    // mesh가 아직 복사 중인 item은 이번 프레임 생략 (기다리지 않고 한두 프레임 늦게 나타남)
+    const std::vector<RenderItem>* drawItems = &items;
+    if (!allResident)
     {
-        const RenderItem& it = items[order[k].itemIndex];
-        const uint32_t srvIndex = order[k].srvIndex;
-
-        // (A) SRV 바뀔 때만 DescriptorTable 세팅
-        if (srvIndex != lastSrvIndex)
+        m_residentItems.clear();
+        for (uint32_t i = 0; i < itemCount; ++i)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE h = srvBase;
-            h.ptr += (UINT64)srvIndex * (UINT64)m_srvDescriptorSize;
-            m_commandList->SetGraphicsRootDescriptorTable(2, h);
-            lastSrvIndex = srvIndex;
-        }
+            if (m_itemPipelines[i] == NotResident)
+                continue;
 
-        // (B) Mesh 바뀔 때만 IA 설정
-        if (it.mesh.id != lastMeshId)
-        {
-            MeshGPUData& mesh = GetOrCreateGPUMesh(it.mesh.id);
-            m_commandList->IASetVertexBuffers(0, 1, &mesh.vbView);
-            m_commandList->IASetIndexBuffer(&mesh.ibView);
-            lastMeshId = it.mesh.id;
+            const uint32_t k = (uint32_t)m_residentItems.size();
+            m_itemSrvIndices[k] = m_itemSrvIndices[i];
+            m_itemPipelines[k] = m_itemPipelines[i];
+            m_residentItems.push_back(items[i]);
         }
+        m_itemSrvIndices.resize(m_residentItems.size());
+        m_itemPipelines.resize(m_residentItems.size());
+        drawItems = &m_residentItems;
+    }
 
-        // (C) Per-draw CB
-        XMMATRIX W = XMLoadFloat4x4(&it.world);
-        XMMATRIX MVP = W * V * P;
+    m_instanceBatcher.Build(*drawItems, m_itemSrvIndices, m_itemPipelines, cam.view, (uint32_t)drawItems->size());
 
-        DrawCB cb{};
-        XMStoreFloat4x4(&cb.mvp, MVP);
-        XMStoreFloat4x4(&cb.world, W);
-        cb.color = it.color;
+    const std::vector<InstanceData>& instances = m_instanceBatcher.GetInstances();
+    const std::vector<InstanceBatch>& batches = m_instanceBatcher.GetBatches();
 
-        const uint32_t slot = frameBase + k;
-        std::memcpy(m_cbMapped + slot * m_cbStride, &cb, sizeof(DrawCB));
+    m_instanceAddress = 0;
+    if (!batches.empty())
+    {
+        // 인스턴스 전체를 한 번에 복사
+        const UploadAllocation a = AllocateUpload(instances.size() * sizeof(InstanceData), 256);
+        std::memcpy(a.cpu, instances.data(), instances.size() * sizeof(InstanceData));
 
-        D3D12_GPU_VIRTUAL_ADDRESS cbAddr =
-            m_cb->GetGPUVirtualAddress() + (UINT64)slot * (UINT64)m_cbStride;
+        m_instanceAddress = a.gpu;
+        m_commandList->SetGraphicsRootShaderResourceView(3, m_instanceAddress);
+    }
+    BindLightClusters(m_commandList.Get());
 
-        m_commandList->SetGraphicsRootConstantBufferView(0, cbAddr);
+    // mesh GPU 데이터는 여기서 미리 확보 (batch mesh는 전부 resident, 워커는 map 조회 금지)
+    const uint32_t batchCount = (uint32_t)batches.size();
+    m_batchMeshes.resize(batchCount);
+    for (uint32_t i = 0; i < batchCount; ++i)
+        m_batchMeshes[i] = FindResidentMesh(batches[i].meshId);
 
-        // Draw
-        MeshGPUData& mesh = GetOrCreateGPUMesh(it.mesh.id);
+    // 이번 프레임에 처음 본 mesh/texture 업로드를 예산만큼 copy queue에 제출
+    // (direct 제출은 copy fence를 안 기다림 → 완료 확인된 뒤의 프레임부터 그림)
+    m_uploadScheduler.Pump(*this);
 
-        // count 결정: it.indexCount==0이면 mesh 전체
-        const uint32_t count = (it.indexCount != 0) ? it.indexCount : mesh.indexCount;
-        const uint32_t start = it.startIndex;
+    // batch가 충분히 많을 때만 청크별 command list로 병렬 녹화
+    const uint32_t threads = m_jobs ? m_jobs->GetThreadCount() : 1u;
+    m_recordScheduler.Plan(batchCount, std::min(threads, MaxRecordChunks), RecordMinBatchesPerChunk);
 
-        // Draw
-        m_commandList->DrawIndexedInstanced(count, 1, start, 0, 0);
+    const bool parallelRecord = m_recordScheduler.GetChunkCount() > 1;
+    if (!parallelRecord)
+    {
+        RecordOpaqueBatches(m_commandList.Get(), 0, batchCount);
+    }
+    else
+    {
+        // head(clear/sky/텍스처 업로드) 마감 → 청크 녹화
+        ThrowIfFailed(m_commandList->Close());
+        m_recordScheduler.Record(m_jobs, *this);
+
+        // tail(debug/UI)은 별도 list. 아래 코드가 그대로 m_commandList에 기록하도록 잠깐 바꿔 끼움 (제출 후 원복)
+        m_commandList.Swap(m_tailCommandList);
+        ThrowIfFailed(m_tailAllocators[m_frameIndex]->Reset());
+        ThrowIfFailed(m_commandList->Reset(m_tailAllocators[m_frameIndex].Get(), m_pso.Get()));
+        BeginPassList(m_commandList.Get());
     }
 
 #if defined(_DEBUG)
     // --- Debug Lines ---
     {
         const auto& lines = DebugDraw::GetLines();
-        if (!lines.empty() && drawCount < MaxDrawsPerFrame)
+        if (!lines.empty())
         {
-            const uint32_t lineCount = std::min<uint32_t>((uint32_t)lines.size(), MaxDebugLinesPerFrame);
+            const uint32_t lineCount = (uint32_t)lines.size();
             const uint32_t vertexCount = lineCount * 2;
 
-            const uint32_t baseVertex = m_frameIndex * MaxDebugVerticesPerFrame;
-            DebugVertex* dst = reinterpret_cast<DebugVertex*>(m_debugVBMapped) + baseVertex;
+            const UploadAllocation a = AllocateUpload((uint64_t)vertexCount * sizeof(DebugVertex), 16);
+            DebugVertex* dst = reinterpret_cast<DebugVertex*>(a.cpu);
 
             for (uint32_t i = 0; i < lineCount; ++i)
             {
@@ -430,9 +463,9 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
             m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_LINELIST);
 
             D3D12_VERTEX_BUFFER_VIEW vbv{};
-            vbv.BufferLocation = m_debugVB->GetGPUVirtualAddress() + (UINT64)baseVertex * (UINT64)m_debugVBStride;
-            vbv.SizeInBytes = vertexCount * m_debugVBStride;
-            vbv.StrideInBytes = m_debugVBStride;
+            vbv.BufferLocation = a.gpu;
+            vbv.SizeInBytes = vertexCount * (uint32_t)sizeof(DebugVertex);
+            vbv.StrideInBytes = (uint32_t)sizeof(DebugVertex);
             m_commandList->IASetVertexBuffers(0, 1, &vbv);
 
             XMMATRIX VP = V * P;
@@ -442,13 +475,7 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
             DirectX::XMStoreFloat4x4(&cb.world, DirectX::XMMatrixIdentity());
             cb.color = { 1,1,1,1 };
 
-            const uint32_t debugSlot = frameBase + drawCount;
-            std::memcpy(m_cbMapped + debugSlot * m_cbStride, &cb, sizeof(DrawCB));
-
-            D3D12_GPU_VIRTUAL_ADDRESS cbAddr =
-                m_cb->GetGPUVirtualAddress() + (UINT64)debugSlot * (UINT64)m_cbStride;
-
-            m_commandList->SetGraphicsRootConstantBufferView(0, cbAddr);
+            m_commandList->SetGraphicsRootConstantBufferView(0, UploadConstants(&cb, sizeof(DrawCB)));
 
             m_commandList->DrawInstanced(vertexCount, 1, 0, 0);
 
@@ -478,21 +505,150 @@ void D3D12Renderer::Render(const std::vector<RenderItem>& items, const RenderCam
     // 이 프레임 커맨드 제출에 해당하는 fence 값(업로드 release 기준)
     const uint64_t submitFenceValue = m_fenceValues[m_frameIndex];
 
-    ID3D12CommandList* lists[] = { m_commandList.Get() };
-    m_commandQueue->ExecuteCommandLists(1, lists);
+    if (!parallelRecord)
+    {
+        ID3D12CommandList* lists[] = { m_commandList.Get() };
+        m_commandQueue->ExecuteCommandLists(1, lists);
+    }
+    else
+    {
+        // head → 청크들 → tail 순서로 한 번에 제출 (청크 순서 = 정렬된 batch 순서)
+        ID3D12CommandList* lists[MaxRecordChunks + 2] = {};
+        uint32_t listCount = 0;
+
+        lists[listCount++] = m_tailCommandList.Get(); // 바꿔 끼운 상태라 head가 여기 있음
+        for (uint32_t c = 0; c < m_recordScheduler.GetChunkCount(); ++c)
+            lists[listCount++] = m_recordLists[c].Get();
+        lists[listCount++] = m_commandList.Get();
+
+        m_commandQueue->ExecuteCommandLists(listCount, lists);
+
+        m_commandList.Swap(m_tailCommandList);
+    }
+
+    // 이번 프레임 업로드 page는 이 fence가 끝나야 재사용
+    m_upload.EndFrame(submitFenceValue);
 
     // (Direct2D overlay will transition to PRESENT if 'text' is not empty)
     DrawTextOverlay(text);
 
     ThrowIfFailed(m_swapChain->Present(1, 0));
 
-    // 이번 프레임에서 새로 만든 텍스처들의 upload는 fence 완료 후 release 예약
-    for (uint32_t texId : m_texturesCreatedThisFrame)
+    MoveToNextFrame();
+}
+
+void D3D12Renderer::BeginPassList(ID3D12GraphicsCommandList* cl)
+{
+    D3D12_CPU_DESCRIPTOR_HANDLE rtv = m_rtvHeap->GetCPUDescriptorHandleForHeapStart();
+    rtv.ptr += (SIZE_T)m_frameIndex * m_rtvDescriptorSize;
+
+    D3D12_CPU_DESCRIPTOR_HANDLE dsv = m_dsvHeap->GetCPUDescriptorHandleForHeapStart();
+
+    cl->OMSetRenderTargets(1, &rtv, FALSE, &dsv);
+    cl->RSSetViewports(1, &m_viewport);
+    cl->RSSetScissorRects(1, &m_scissor);
+
+    cl->SetGraphicsRootSignature(m_rootSignature.Get());
+    cl->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    ID3D12DescriptorHeap* heaps[] = { m_srvHeap.Get() };
+    cl->SetDescriptorHeaps(1, heaps);
+    cl->SetGraphicsRootDescriptorTable(8, m_srvHeap->GetGPUDescriptorHandleForHeapStart());
+
+    cl->SetGraphicsRootConstantBufferView(1, m_frameCBAddress);
+    if (m_instanceAddress != 0)
+        cl->SetGraphicsRootShaderResourceView(3, m_instanceAddress);
+    BindLightClusters(cl);
+}
+
+void D3D12Renderer::UploadLightClusters(const FrameLights& lights, const RenderCamera& cam)
+{
+    const uint32_t lightCount = (uint32_t)std::min<size_t>(lights.lights.size(), MaxLightsPerFrame);
+    m_lightClusterer.Build(lights.lights.data(), lightCount, cam);
+
+    const std::vector<LightClusterRange>& clusters = m_lightClusterer.GetClusters();
+    const std::vector<uint32_t>& indices = m_lightClusterer.GetLightIndices();
+
+    // 셰이더는 count만큼만 읽지만 root SRV 주소는 항상 유효하게 (최소 1원소)
+    auto upload = [this](const void* src, size_t bytes, size_t minBytes)
+        {
+            const UploadAllocation a = AllocateUpload(std::max(bytes, minBytes), 256);
+            if (bytes > 0)
+                std::memcpy(a.cpu, src, bytes);
+            return a.gpu;
+        };
+
+    m_lightsAddress = upload(lights.lights.data(), lightCount * sizeof(FrameLight), sizeof(FrameLight));
+    m_lightClustersAddress = upload(clusters.data(), clusters.size() * sizeof(LightClusterRange), sizeof(LightClusterRange));
+    m_lightIndicesAddress = upload(indices.data(), indices.size() * sizeof(uint32_t), sizeof(uint32_t));
+}
+
+void D3D12Renderer::BindLightClusters(ID3D12GraphicsCommandList* cl) const
+{
+    cl->SetGraphicsRootShaderResourceView(5, m_lightsAddress);
+    cl->SetGraphicsRootShaderResourceView(6, m_lightClustersAddress);
+    cl->SetGraphicsRootShaderResourceView(7, m_lightIndicesAddress);
+}
+
+void D3D12Renderer::RecordOpaqueBatches(ID3D12GraphicsCommandList* cl, uint32_t first, uint32_t count)
+{
+    const std::vector<InstanceBatch>& batches = m_instanceBatcher.GetBatches();
+
+    // Cached state (list마다 따로). 텍스처는 인스턴스마다 bindless 인덱스 → 여기서 바꿀 것 없음
+    uint32_t lastLayout = 0xFFFFFFFFu;
+    uint32_t lastDequantMeshId = 0xFFFFFFFFu;
+
+    for (uint32_t i = first; i < first + count; ++i)
     {
-        m_pendingTextureUploadReleases.push_back(PendingTextureUploadRelease{ texId, submitFenceValue });
+        const InstanceBatch& b = batches[i];
+        const MeshGPUData& mesh = *m_batchMeshes[i];
+
+        // (B) layout(정점 포맷/인덱스 크기) 바뀔 때만 PSO + IA
+        //     같은 layout의 mesh는 전부 한 메가버퍼 → mesh 전환은 draw 인자(base vertex/first index)만 바뀜
+        if (mesh.layout != lastLayout)
+        {
+            const bool compact = (mesh.layout & GeometryLayout::CompactVertices) != 0;
+            const bool index32 = (mesh.layout & GeometryLayout::Index32) != 0;
+
+            cl->SetPipelineState(compact ? m_psoCompact.Get() : m_pso.Get());
+            cl->IASetVertexBuffers(0, 1, &m_geometryVBViews[compact ? 1 : 0]);
+            cl->IASetIndexBuffer(&m_geometryIBViews[index32 ? 1 : 0]);
+            lastLayout = mesh.layout;
+        }
+
+        // (C) batch 시작 인스턴스 (SV_InstanceID는 StartInstanceLocation을 안 더해줌 → root constant로 전달)
+        cl->SetGraphicsRoot32BitConstant(4, b.firstInstance, 0);
+
+        // (D) Compact 위치 역양자화 상수 (InstanceCB posOffset/posScale, mesh 바뀔 때만)
+        if ((mesh.layout & GeometryLayout::CompactVertices) && b.meshId != lastDequantMeshId)
+        {
+            const float dq[6] = { mesh.posOffset.x, mesh.posOffset.y, mesh.posOffset.z,
+                mesh.posScale.x, mesh.posScale.y, mesh.posScale.z };
+            cl->SetGraphicsRoot32BitConstants(4, 6, dq, 1);
+            lastDequantMeshId = b.meshId;
+        }
+
+        // count 결정: indexCount==0이면 mesh 전체
+        const uint32_t indexCount = (b.indexCount != 0) ? b.indexCount : mesh.indexCount;
+
+        // Draw
+        cl->DrawIndexedInstanced(indexCount, b.instanceCount, mesh.firstIndex + b.startIndex, (INT)mesh.baseVertex, 0);
     }
+}
 
-    MoveToNextFrame();
+void D3D12Renderer::RecordChunk(uint32_t chunkIndex, uint32_t first, uint32_t count)
+{
+    // 워커 스레드: 이 청크 전용 allocator/list만 건드림
+    ID3D12CommandAllocator* alloc = m_recordAllocators[m_frameIndex][chunkIndex].Get();
+    ID3D12GraphicsCommandList* cl = m_recordLists[chunkIndex].Get();
+
+    ThrowIfFailed(alloc->Reset());
+    ThrowIfFailed(cl->Reset(alloc, m_pso.Get()));
+
+    BeginPassList(cl);
+    RecordOpaqueBatches(cl, first, count);
+
+    ThrowIfFailed(cl->Close());
 }
 
 void D3D12Renderer::RenderUI(const std::vector<UIDrawItem>& ui)
@@ -500,16 +656,12 @@ void D3D12Renderer::RenderUI(const std::vector<UIDrawItem>& ui)
     if (ui.empty())
         return;
 
-    // 안전 상한
-    const uint32_t quadCount = std::min<uint32_t>((uint32_t)ui.size(), MaxUIQuadsPerFrame);
-    if (quadCount == 0)
-        return;
-
+    const uint32_t quadCount = (uint32_t)ui.size();
     const uint32_t vertexCount = quadCount * 6;
 
     // ---- (1) UIDrawItem -> UIVertex(6개)로 확장해서 업로드 VB에 쓰기 ----
-    const uint32_t baseVertex = m_frameIndex * MaxUIVertsPerFrame;
-    UIVertex* dst = reinterpret_cast<UIVertex*>(m_uiVBMapped) + baseVertex;
+    const UploadAllocation vbMem = AllocateUpload((uint64_t)vertexCount * sizeof(UIVertex), 16);
+    UIVertex* dst = reinterpret_cast<UIVertex*>(vbMem.cpu);
 
     auto PxToNdcX = [&](float px) -> float
         {
@@ -548,7 +700,15 @@ void D3D12Renderer::RenderUI(const std::vector<UIDrawItem>& ui)
         const float u1 = it.u1;
         const float v1 = it.v1;
 
-        const DirectX::XMFLOAT4 c = it.color;
+        // TextureHandle -> SRV index (없으면 0 = default). 아직 복사 중이면 이번 프레임은 투명하게
+        uint32_t srv = GetResidentSrvIndex(it.tex, DescriptorAllocator::InvalidSlot);
+        DirectX::XMFLOAT4 c = it.color;
+        if (srv == DescriptorAllocator::InvalidSlot)
+        {
+            srv = 0;
+            c.w = 0.0f;
+        }
+        srvIndexPerQuad[i] = srv;
 
         // quad -> 2 triangles (lt, rt, lb,  rt, rb, lb)
         const uint32_t v = i * 6;
@@ -560,9 +720,6 @@ void D3D12Renderer::RenderUI(const std::vector<UIDrawItem>& ui)
         dst[v + 3] = { { r, t }, { u1, v0 }, c };
         dst[v + 4] = { { r, b }, { u1, v1 }, c };
         dst[v + 5] = { { l, b }, { u0, v1 }, c };
-
-        // TextureHandle -> SRV index (없으면 0 = default)
-        srvIndexPerQuad[i] = GetOrCreateSrvIndex(it.tex);
     }
 
     // ---- (2) 파이프라인 세팅 ----
@@ -571,33 +728,24 @@ void D3D12Renderer::RenderUI(const std::vector<UIDrawItem>& ui)
     m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // Root[1] FrameCB (안전: UI만 단독 호출되는 경우 대비)
-    {
-        const D3D12_GPU_VIRTUAL_ADDRESS fcbAddr =
-            m_frameCB->GetGPUVirtualAddress() + (UINT64)m_frameIndex * (UINT64)m_frameCBStride;
-        m_commandList->SetGraphicsRootConstantBufferView(1, fcbAddr);
-    }
+    if (m_frameCBAddress != 0)
+        m_commandList->SetGraphicsRootConstantBufferView(1, m_frameCBAddress);
 
     // Root[0] DrawCB (UI에서는 사용하지 않지만, 바인딩 값은 유효하게 유지)
     {
-        const uint32_t frameBase = m_frameIndex * MaxDrawsPerFrame;
-        const uint32_t slot = frameBase + MaxDrawsPerFrame - 1;
-
         DrawCB cb{};
         DirectX::XMStoreFloat4x4(&cb.mvp, DirectX::XMMatrixIdentity());
         DirectX::XMStoreFloat4x4(&cb.world, DirectX::XMMatrixIdentity());
         cb.color = DirectX::XMFLOAT4(1,1,1,1);
 
-        std::memcpy(m_cbMapped + slot * m_cbStride, &cb, sizeof(DrawCB));
-        const D3D12_GPU_VIRTUAL_ADDRESS cbAddr =
-            m_cb->GetGPUVirtualAddress() + (UINT64)slot * (UINT64)m_cbStride;
-        m_commandList->SetGraphicsRootConstantBufferView(0, cbAddr);
+        m_commandList->SetGraphicsRootConstantBufferView(0, UploadConstants(&cb, sizeof(DrawCB)));
     }
 
-    // UI VB view (프레임 슬라이스)
+    // UI VB view (이번 프레임 업로드 구간)
     D3D12_VERTEX_BUFFER_VIEW vbv{};
-    vbv.BufferLocation = m_uiVB->GetGPUVirtualAddress() + (UINT64)baseVertex * (UINT64)m_uiVBStride;
-    vbv.SizeInBytes = vertexCount * m_uiVBStride;
-    vbv.StrideInBytes = m_uiVBStride;
+    vbv.BufferLocation = vbMem.gpu;
+    vbv.SizeInBytes = vertexCount * (uint32_t)sizeof(UIVertex);
+    vbv.StrideInBytes = (uint32_t)sizeof(UIVertex);
     m_commandList->IASetVertexBuffers(0, 1, &vbv);
 
     // SRV heap이 이미 Render()에서 SetDescriptorHeaps 되어있겠지만,
@@ -676,7 +824,11 @@ void D3D12Renderer::CreateDeviceAndSwapChain(HWND hwnd)
         adapter->GetDesc1(&desc);
         if (desc.Flags & DXGI_ADAPTER_FLAG_SOFTWARE) continue;
         if (SUCCEEDED(D3D12CreateDevice(adapter.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&m_device))))
-            break;
+        {
+            if (SupportsBindlessSrv(m_device.Get()))
+                break;
+            m_device.Reset(); // tier 1 → 다음 adapter (없으면 WARP)
+        }
     }
 
     if (!m_device)
@@ -684,6 +836,8 @@ void D3D12Renderer::CreateDeviceAndSwapChain(HWND hwnd)
         ComPtr<IDXGIAdapter> warp;
         ThrowIfFailed(m_factory->EnumWarpAdapter(IID_PPV_ARGS(&warp)));
         ThrowIfFailed(D3D12CreateDevice(warp.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&m_device)));
+        if (!SupportsBindlessSrv(m_device.Get()))
+            throw std::runtime_error("D3D12: resource binding tier 2 is required (bindless SRV table).");
     }
 
     // Command queue
@@ -718,6 +872,38 @@ void D3D12Renderer::CreateCommandObjects()
         0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_commandAllocators[0].Get(), nullptr, IID_PPV_ARGS(&m_commandList)));
 
     ThrowIfFailed(m_commandList->Close());
+
+    // 병렬 녹화용: 청크 list + tail list (allocator는 프레임별)
+    for (uint32_t c = 0; c < MaxRecordChunks; ++c)
+    {
+        for (uint32_t i = 0; i < FrameCount; ++i)
+            ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_recordAllocators[i][c])));
+
+        ThrowIfFailed(m_device->CreateCommandList(
+            0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_recordAllocators[0][c].Get(), nullptr, IID_PPV_ARGS(&m_recordLists[c])));
+        ThrowIfFailed(m_recordLists[c]->Close());
+    }
+
+    for (uint32_t i = 0; i < FrameCount; ++i)
+        ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_tailAllocators[i])));
+
+    ThrowIfFailed(m_device->CreateCommandList(
+        0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_tailAllocators[0].Get(), nullptr, IID_PPV_ARGS(&m_tailCommandList)));
+    ThrowIfFailed(m_tailCommandList->Close());
+
+    // mesh 업로드용 copy queue
+    D3D12_COMMAND_QUEUE_DESC q{};
+    q.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    ThrowIfFailed(m_device->CreateCommandQueue(&q, IID_PPV_ARGS(&m_copyQueue)));
+
+    for (uint32_t i = 0; i < FrameCount; ++i)
+        ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&m_copyAllocators[i])));
+
+    ThrowIfFailed(m_device->CreateCommandList(
+        0, D3D12_COMMAND_LIST_TYPE_COPY, m_copyAllocators[0].Get(), nullptr, IID_PPV_ARGS(&m_copyList)));
+    ThrowIfFailed(m_copyList->Close());
+
+    ThrowIfFailed(m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_copyFence)));
 }
 
 void D3D12Renderer::CreateDescriptorHeaps()
@@ -740,12 +926,12 @@ void D3D12Renderer::CreateDescriptorHeaps()
     // SRV heap (shader-visible)
     D3D12_DESCRIPTOR_HEAP_DESC sh{};
     sh.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-    sh.NumDescriptors = 256;
+    sh.NumDescriptors = MaxSrvDescriptors;
     sh.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
     ThrowIfFailed(m_device->CreateDescriptorHeap(&sh, IID_PPV_ARGS(&m_srvHeap)));
     m_srvDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-    m_nextSrvIndex = 0; // slot0은 기본 텍스처가 쓸 예정
+    m_srvAllocator.Initialize(MaxSrvDescriptors, 1); // slot0은 기본 텍스처
 }
 
 void D3D12Renderer::CreateRenderTargets()
@@ -803,8 +989,14 @@ void D3D12Renderer::CreatePipeline()
     // [0] CBV(b0) : DrawCB
     // [1] CBV(b1) : FrameCB
     // [2] DescriptorTable(SRV t0) 1개
+    // [3] SRV(t1) : StructuredBuffer<InstanceData> (opaque 인스턴싱)
+    // [4] 32bit constants(b2) : instanceBase (batch 시작 인스턴스) + Compact 위치 역양자화 offset/scale
+    // [5] SRV(t2) : StructuredBuffer<Light> (FrameLight 배열)
+    // [6] SRV(t3) : StructuredBuffer<uint2> cluster {offset, count}
+    // [7] SRV(t4) : StructuredBuffer<uint> light index 목록 (앞쪽 = 전역 directional)
+    // [8] DescriptorTable(SRV t0, space1, 끝 없음) : SRV 힙 전체 = bindless 텍스처 배열 (opaque)
     // StaticSampler(s0)
-    D3D12_ROOT_PARAMETER rp[3]{};
+    D3D12_ROOT_PARAMETER rp[9]{};
 
     rp[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
     rp[0].Descriptor.ShaderRegister = 0;
@@ -825,6 +1017,34 @@ void D3D12Renderer::CreatePipeline()
     rp[2].DescriptorTable.pDescriptorRanges = &range;
     rp[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
+    rp[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+    rp[3].Descriptor.ShaderRegister = 1;
+    rp[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+    rp[4].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+    rp[4].Constants.ShaderRegister = 2;
+    rp[4].Constants.Num32BitValues = 7;
+    rp[4].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+    for (uint32_t i = 5; i < 8; ++i)
+    {
+        rp[i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+        rp[i].Descriptor.ShaderRegister = i - 3; // t2, t3, t4
+        rp[i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+    }
+
+    D3D12_DESCRIPTOR_RANGE bindlessRange{};
+    bindlessRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+    bindlessRange.NumDescriptors = UINT_MAX;    // 끝 없음 (셰이더 Texture2D gTextures[]). tier 2 이상은 CreateDeviceAndSwapChain에서 확인
+    bindlessRange.BaseShaderRegister = 0;
+    bindlessRange.RegisterSpace = 1;
+    bindlessRange.OffsetInDescriptorsFromTableStart = 0;
+
+    rp[8].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    rp[8].DescriptorTable.NumDescriptorRanges = 1;
+    rp[8].DescriptorTable.pDescriptorRanges = &bindlessRange;
+    rp[8].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
     D3D12_STATIC_SAMPLER_DESC ss{};
     ss.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
     ss.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
@@ -853,26 +1073,55 @@ void D3D12Renderer::CreatePipeline()
         IID_PPV_ARGS(&m_rootSignature)));
 
     const char* vsCode = R"(
-    cbuffer DrawCB : register(b0)
+    cbuffer FrameCB : register(b1)
+    {
+        row_major float4x4 view;
+        row_major float4x4 proj;
+        float4 cameraPos_numLights; // xyz=cameraPos, w=numLights
+    };
+
+    // InstanceBatcher.h InstanceData와 같은 레이아웃
+    struct InstanceData
     {
-        row_major float4x4 mvp;
         row_major float4x4 world;
         float4 color;
+        uint textureIndex;
+        uint3 _pad;
     };
 
-    cbuffer FrameCB : register(b1)
+    StructuredBuffer<InstanceData> gInstances : register(t1);
+
+    cbuffer InstanceCB : register(b2)
     {
-        row_major float4x4 view;
-        row_major float4x4 proj;
-        float4 cameraPos_numLights; // xyz=cameraPos, w=numLights
+        uint instanceBase;
+        float3 posOffset;   // COMPACT_VERTEX 전용: pos = posOffset + unorm * posScale
+        float3 posScale;
     };
 
+    #ifdef COMPACT_VERTEX
+    // VertexQuantize.h CompactVertex와 같은 레이아웃
+    struct VSIn
+    {
+        float4 pos : POSITION;  // R16G16B16A16_UNORM
+        float2 nrm : NORMAL;    // R16G16_SNORM, 8면체
+        float2 uv  : TEXCOORD0; // R16G16_FLOAT
+    };
+
+    float3 DecodeOctahedral(float2 e)
+    {
+        float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+        float t = saturate(-n.z);
+        n.xy += (n.xy >= 0.0) ? -t : t;
+        return normalize(n);
+    }
+    #else
     struct VSIn
     {
         float3 pos : POSITION;
         float3 nrm : NORMAL;
         float2 uv  : TEXCOORD0;
     };
+    #endif
 
     struct VSOut
     {
@@ -880,29 +1129,36 @@ void D3D12Renderer::CreatePipeline()
         float2 uv        : TEXCOORD0;
         float3 worldPos  : TEXCOORD1;
         float3 worldNrm  : TEXCOORD2;
+        nointerpolation float4 color : COLOR0;
+        nointerpolation uint texIndex : TEXCOORD3;
     };
 
-    VSOut main(VSIn i)
+    VSOut main(VSIn i, uint iid : SV_InstanceID)
     {
+        InstanceData inst = gInstances[instanceBase + iid];
+
+    #ifdef COMPACT_VERTEX
+        float3 localPos = posOffset + i.pos.xyz * posScale;
+        float3 localNrm = DecodeOctahedral(i.nrm);
+    #else
+        float3 localPos = i.pos;
+        float3 localNrm = i.nrm;
+    #endif
+
         VSOut o;
-        float4 wp = mul(float4(i.pos, 1.0), world);
+        float4 wp = mul(float4(localPos, 1.0), inst.world);
         o.worldPos = wp.xyz;
         // normal: use upper-left 3x3 of world, good enough for now
-        o.worldNrm = normalize(mul(i.nrm, (float3x3)world));
-        o.pos = mul(float4(i.pos, 1.0), mvp);
+        o.worldNrm = normalize(mul(localNrm, (float3x3)inst.world));
+        o.pos = mul(mul(wp, view), proj);
         o.uv = i.uv;
+        o.color = inst.color;
+        o.texIndex = inst.textureIndex;
         return o;
     }
     )";
 
     const char* psCode = R"(
-    cbuffer DrawCB : register(b0)
-    {
-        row_major float4x4 mvp;
-        row_major float4x4 world;
-        float4 color;
-    };
-
     struct Light
     {
         uint type; // 0=Directional,1=Point,2=Spot
@@ -922,10 +1178,16 @@ void D3D12Renderer::CreatePipeline()
         row_major float4x4 view;
         row_major float4x4 proj;
         float4 cameraPos_numLights; // xyz=cameraPos, w=numLights
-        Light lights[32];
+        float4 clusterScale;        // x = X/width, y = Y/height, z = sliceScale, w = sliceBias
+        uint4  clusterDims;         // xyz = 격자, w = 전역(directional) light 수
     };
 
-    Texture2D    gTex  : register(t0);
+    StructuredBuffer<Light> gLights       : register(t2);
+    StructuredBuffer<uint2> gClusters     : register(t3); // x = offset, y = count
+    StructuredBuffer<uint>  gLightIndices : register(t4);
+
+    // SRV 힙 전체 (slot = InstanceData::textureIndex, 0 = 기본 텍스처)
+    Texture2D    gTextures[] : register(t0, space1);
     SamplerState gSamp : register(s0);
 
     struct PSIn
@@ -934,11 +1196,13 @@ void D3D12Renderer::CreatePipeline()
         float2 uv        : TEXCOORD0;
         float3 worldPos  : TEXCOORD1;
         float3 worldNrm  : TEXCOORD2;
+        nointerpolation float4 color : COLOR0;
+        nointerpolation uint texIndex : TEXCOORD3;
     };
 
     float3 EvalLight(uint idx, float3 P, float3 N)
     {
-        Light L = lights[idx];
+        Light L = gLights[idx];
         float3 result = 0;
 
         if (L.type == 0)
@@ -972,19 +1236,31 @@ void D3D12Renderer::CreatePipeline()
 
     float4 main(PSIn i) : SV_TARGET
     {
-        float4 albedo = gTex.Sample(gSamp, i.uv) * color;
+        // 한 draw 안에서도 인스턴스마다 텍스처가 다를 수 있음 → NonUniformResourceIndex
+        float4 albedo = gTextures[NonUniformResourceIndex(i.texIndex)].Sample(gSamp, i.uv) * i.color;
         float3 N = normalize(i.worldNrm);
         float3 P = i.worldPos;
 
         float ambient = 0.12; // simple constant ambient
         float3 lit = albedo.rgb * ambient;
 
-        uint n = (uint)cameraPos_numLights.w;
-        n = min(n, 32u);
+        // 전역(directional)
         [loop]
-        for (uint li = 0; li < n; ++li)
+        for (uint gi = 0; gi < clusterDims.w; ++gi)
         {
-            lit += albedo.rgb * EvalLight(li, P, N);
+            lit += albedo.rgb * EvalLight(gLightIndices[gi], P, N);
+        }
+
+        // 이 픽셀의 cluster (SV_Position.w = view 깊이)
+        uint3 c;
+        c.xy = min((uint2)(i.pos.xy * clusterScale.xy), clusterDims.xy - 1);
+        c.z = (uint)clamp(log(max(i.pos.w, 1e-6)) * clusterScale.z + clusterScale.w, 0.0, (float)(clusterDims.z - 1));
+        uint2 cr = gClusters[c.x + clusterDims.x * (c.y + clusterDims.y * c.z)];
+
+        [loop]
+        for (uint li = 0; li < cr.y; ++li)
+        {
+            lit += albedo.rgb * EvalLight(gLightIndices[cr.x + li], P, N);
         }
 
         return float4(lit, albedo.a);
@@ -997,14 +1273,25 @@ void D3D12Renderer::CreatePipeline()
 #endif
 
     ComPtr<ID3DBlob> vs, ps, e;
-    hr = D3DCompile(vsCode, std::strlen(vsCode), nullptr, nullptr, nullptr, "main", "vs_5_0", flags, 0, &vs, &e);
+    hr = D3DCompile(vsCode, std::strlen(vsCode), nullptr, nullptr, nullptr, "main", "vs_5_1", flags, 0, &vs, &e);
     if (FAILED(hr))
     {
         if (e) OutputDebugStringA((const char*)e->GetBufferPointer());
         ThrowIfFailed(hr);
     }
     e.Reset();
-    hr = D3DCompile(psCode, std::strlen(psCode), nullptr, nullptr, nullptr, "main", "ps_5_0", flags, 0, &ps, &e);
+    hr = D3DCompile(psCode, std::strlen(psCode), nullptr, nullptr, nullptr, "main", "ps_5_1", flags, 0, &ps, &e);
+    if (FAILED(hr))
+    {
+        if (e) OutputDebugStringA((const char*)e->GetBufferPointer());
+        ThrowIfFailed(hr);
+    }
+
+    // Compact 정점용 VS (같은 소스, 입력 구조체/역양자화만 다름)
+    const D3D_SHADER_MACRO compactDefines[] = { { "COMPACT_VERTEX", "1" }, { nullptr, nullptr } };
+    ComPtr<ID3DBlob> vsCompact;
+    e.Reset();
+    hr = D3DCompile(vsCode, std::strlen(vsCode), nullptr, compactDefines, nullptr, "main", "vs_5_1", flags, 0, &vsCompact, &e);
     if (FAILED(hr))
     {
         if (e) OutputDebugStringA((const char*)e->GetBufferPointer());
@@ -1053,6 +1340,18 @@ void D3D12Renderer::CreatePipeline()
     pso.SampleDesc.Count = 1;
 
     ThrowIfFailed(m_device->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&m_pso)));
+
+    // Compact: VertexQuantize.h CompactVertex (16 byte)
+    D3D12_INPUT_ELEMENT_DESC ilCompact[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0,  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM,       0, 8,  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+    };
+
+    pso.VS = { vsCompact->GetBufferPointer(), vsCompact->GetBufferSize() };
+    pso.InputLayout = { ilCompact, _countof(ilCompact) };
+    ThrowIfFailed(m_device->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&m_psoCompact)));
 }
 
 void D3D12Renderer::CreateDebugLinePipeline()
@@ -1266,106 +1565,71 @@ void D3D12Renderer::CreateUIPipeline()
     ThrowIfFailed(m_device->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&m_psoUI)));
 }
 
-void D3D12Renderer::CreateDebugVertexBuffer()
+void D3D12Renderer::CreateUploadRing()
 {
-    m_debugVBStride = (uint32_t)sizeof(DebugVertex);
-    const uint64_t totalVerts = (uint64_t)MaxDebugVerticesPerFrame * (uint64_t)FrameCount;
-    const uint64_t totalSize = totalVerts * (uint64_t)m_debugVBStride;
-
-    D3D12_HEAP_PROPERTIES heap{};
-    heap.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-    D3D12_RESOURCE_DESC desc{};
-    desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    desc.Width = totalSize;
-    desc.Height = 1;
-    desc.DepthOrArraySize = 1;
-    desc.MipLevels = 1;
-    desc.SampleDesc.Count = 1;
-    desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &heap, D3D12_HEAP_FLAG_NONE, &desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_debugVB)));
+    // page = persist-mapped upload 버퍼 하나
+    // - m_upload: FrameCB/DrawCB/인스턴스/정점 공용 (frame fence)
+    // - m_staging: copy queue 원본 (mesh 정점/인덱스, 텍스처 픽셀, copy fence)
+    auto initRing = [this](UploadRing& ring, std::vector<ComPtr<ID3D12Resource>>& pages, uint64_t pageSize)
+        {
+            ring.Initialize(pageSize,
+                [this, &pages](uint32_t pageIndex, uint64_t size, UploadPage& out)
+                {
+                    D3D12_HEAP_PROPERTIES heap{};
+                    heap.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+                    D3D12_RESOURCE_DESC desc = MakeBufferDesc(size);
+
+                    ComPtr<ID3D12Resource> res;
+                    ThrowIfFailed(m_device->CreateCommittedResource(
+                        &heap, D3D12_HEAP_FLAG_NONE, &desc,
+                        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&res)));
+
+                    ThrowIfFailed(res->Map(0, nullptr, (void**)&out.cpu));
+                    out.gpu = res->GetGPUVirtualAddress();
+                    out.size = size;
+
+                    if (pages.size() <= pageIndex)
+                        pages.resize(pageIndex + 1);
+                    pages[pageIndex] = res;
+                    return true;
+                },
+                [&pages](uint32_t pageIndex)
+                {
+                    if (pageIndex < pages.size() && pages[pageIndex])
+                    {
+                        pages[pageIndex]->Unmap(0, nullptr);
+                        pages[pageIndex].Reset();
+                    }
+                });
+        };
 
-    ThrowIfFailed(m_debugVB->Map(0, nullptr, (void**)&m_debugVBMapped));
+    initRing(m_upload, m_uploadPages, UploadPageSize);
+    initRing(m_staging, m_stagingPages, StagingPageSize);
 }
 
-void D3D12Renderer::CreateUIVertexBuffer()
+UploadAllocation D3D12Renderer::AllocateUpload(uint64_t size, uint64_t alignment)
 {
-    m_uiVBStride = (uint32_t)sizeof(UIVertex);
-
-    // FrameCount * MaxUIVertsPerFrame 만큼 큰 Upload VB 하나 만들어서
-    // 프레임마다 "자기 구간"에만 써서 레이스를 피한다.
-    const uint64_t totalVerts = (uint64_t)MaxUIVertsPerFrame * (uint64_t)FrameCount;
-    const uint64_t totalSize = totalVerts * (uint64_t)m_uiVBStride;
-
-    D3D12_HEAP_PROPERTIES heap{};
-    heap.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-    D3D12_RESOURCE_DESC desc{};
-    desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    desc.Width = totalSize;
-    desc.Height = 1;
-    desc.DepthOrArraySize = 1;
-    desc.MipLevels = 1;
-    desc.SampleDesc.Count = 1;
-    desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &heap, D3D12_HEAP_FLAG_NONE, &desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_uiVB)));
-
-    ThrowIfFailed(m_uiVB->Map(0, nullptr, (void**)&m_uiVBMapped));
+    const UploadAllocation a = m_upload.Allocate(size, alignment);
+    if (!a.cpu && size != 0)
+        throw std::runtime_error("Upload ring allocation failed.");
+    return a;
 }
 
-void D3D12Renderer::CreateConstantBuffer()
+UploadAllocation D3D12Renderer::AllocateStaging(uint64_t size, uint64_t alignment)
 {
-    // Per-frame CB (camera + lights)
-    m_frameCBStride = Align256((uint32_t)sizeof(FrameCB));
-    {
-        const uint64_t frameTotal = (uint64_t)m_frameCBStride * (uint64_t)FrameCount;
-
-        D3D12_HEAP_PROPERTIES heap{};
-        heap.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-        D3D12_RESOURCE_DESC desc{};
-        desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        desc.Width = frameTotal;
-        desc.Height = 1;
-        desc.DepthOrArraySize = 1;
-        desc.MipLevels = 1;
-        desc.SampleDesc.Count = 1;
-        desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-        ThrowIfFailed(m_device->CreateCommittedResource(
-            &heap, D3D12_HEAP_FLAG_NONE, &desc,
-            D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_frameCB)));
-
-        ThrowIfFailed(m_frameCB->Map(0, nullptr, (void**)&m_frameCBMapped));
-    }
-
-    m_cbStride = Align256((uint32_t)sizeof(DrawCB));
-    const uint64_t totalSize =
-        (uint64_t)m_cbStride * (uint64_t)MaxDrawsPerFrame * (uint64_t)FrameCount;
-
-    D3D12_HEAP_PROPERTIES heap{};
-    heap.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-    D3D12_RESOURCE_DESC desc{};
-    desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    desc.Width = totalSize;
-    desc.Height = 1;
-    desc.DepthOrArraySize = 1;
-    desc.MipLevels = 1;
-    desc.SampleDesc.Count = 1;
-    desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &heap, D3D12_HEAP_FLAG_NONE, &desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_cb)));
+    const UploadAllocation a = m_staging.Allocate(size, alignment);
+    if (!a.cpu && size != 0)
+        throw std::runtime_error("Staging ring allocation failed.");
+    return a;
+}
 
-    ThrowIfFailed(m_cb->Map(0, nullptr, (void**)&m_cbMapped));
+D3D12_GPU_VIRTUAL_ADDRESS D3D12Renderer::UploadConstants(const void* data, uint32_t size)
+{
+    // CBV 주소는 256 정렬
+    const UploadAllocation a = AllocateUpload(Align256(size), 256);
+    std::memcpy(a.cpu, data, size);
+    return a.gpu;
 }
 
 void D3D12Renderer::WaitForGPU()
@@ -1396,87 +1660,311 @@ void D3D12Renderer::MoveToNextFrame()
 // ---------------------------
 // Mesh cache
 // ---------------------------
-MeshGPUData& D3D12Renderer::GetOrCreateGPUMesh(uint32_t meshId)
+MeshGPUData* D3D12Renderer::FindResidentMesh(uint32_t meshId)
 {
     auto it = m_gpuMeshes.find(meshId);
     if (it != m_gpuMeshes.end())
-        return it->second;
+        return it->second.resident ? &it->second : nullptr;
 
     assert(m_meshManager && "MeshManager not set");
-    const MeshCPUData& cpu = m_meshManager->Get({ meshId });
-
-    MeshGPUData gpu{};
-    CreateGPUMeshFromCPU(cpu, gpu);
-
-    auto [iter, _] = m_gpuMeshes.emplace(meshId, std::move(gpu));
-    return iter->second;
+    if (!m_uploadScheduler.IsPending(UploadKind::Mesh, meshId))
+    {
+        // 예산 계산용 크기 (정점 포맷 + 인덱스 크기)
+        const MeshCPUData& cpu = m_meshManager->Get({ meshId });
+        const uint64_t vertexBytes = (cpu.vertexFormat == MeshVertexFormat::Compact) ? sizeof(CompactVertex) : sizeof(VertexPNU);
+        const uint64_t indexBytes = cpu.Uses32BitIndices() ? 4 : 2;
+        m_uploadScheduler.Request(UploadKind::Mesh, meshId, cpu.positions.size() * vertexBytes + (uint64_t)cpu.GetIndexCount() * indexBytes);
+    }
+    return nullptr;
 }
 
 void D3D12Renderer::CreateGPUMeshFromCPU(const MeshCPUData& cpu, MeshGPUData& out)
 {
-    struct VertexPNU
+    out.layout = 0;
+    if (cpu.vertexFormat == MeshVertexFormat::Compact)
+        out.layout |= GeometryLayout::CompactVertices;
+    if (cpu.Uses32BitIndices())
+        out.layout |= GeometryLayout::Index32;
+
+    out.vertexCount = (uint32_t)cpu.positions.size();
+    out.indexCount = cpu.GetIndexCount();
+    if (out.vertexCount == 0 || out.indexCount == 0)
+        return;
+
+    GeometryBuffer& vb = m_geometry[VertexKindOf(out.layout)];
+    GeometryBuffer& ib = m_geometry[IndexKindOf(out.layout)];
+
+    // 메가버퍼 구간 먼저 확보 (키우는 경로가 copy list를 비울 수 있으므로 복사 녹화 전에)
+    out.vbAlloc = AllocateGeometry(VertexKindOf(out.layout), out.vertexCount);
+    out.ibAlloc = AllocateGeometry(IndexKindOf(out.layout), out.indexCount);
+    out.baseVertex = out.vbAlloc.offset;
+    out.firstIndex = out.ibAlloc.offset;
+
+    const uint64_t vbSize = (uint64_t)out.vertexCount * vb.stride;
+    const uint64_t ibSize = (uint64_t)out.indexCount * ib.stride;
+
+    // staging ring에 바로 채움 (중간 vector 없음)
+    const UploadAllocation va = AllocateStaging(vbSize, 16);
+    if (out.layout & GeometryLayout::CompactVertices)
     {
-        XMFLOAT3 pos;
-        XMFLOAT3 nrm;
-        XMFLOAT2 uv;
-    };
+        const PositionDequant dq = QuantizeMeshVertices(cpu, reinterpret_cast<CompactVertex*>(va.cpu));
+        out.posOffset = dq.offset;
+        out.posScale = dq.scale;
+    }
+    else
+    {
+        VertexPNU* verts = reinterpret_cast<VertexPNU*>(va.cpu);
+        for (uint32_t i = 0; i < out.vertexCount; ++i)
+        {
+            verts[i].pos = cpu.positions[i];
+            verts[i].nrm = (i < cpu.normals.size()) ? cpu.normals[i] : XMFLOAT3{ 0,1,0 };
+            verts[i].uv  = (i < cpu.uvs.size()) ? cpu.uvs[i] : XMFLOAT2{ 0,0 };
+        }
+    }
+
+    const UploadAllocation ia = AllocateStaging(ibSize, 16);
+    const void* indexSrc = cpu.Uses32BitIndices() ? (const void*)cpu.indices32.data() : (const void*)cpu.indices.data();
+    std::memcpy(ia.cpu, indexSrc, (size_t)ibSize);
 
-    std::vector<VertexPNU> verts;
-    verts.resize(cpu.positions.size());
+    // copy queue: staging page → 메가버퍼 구간
+    ID3D12GraphicsCommandList* cl = GetCopyList();
+    cl->CopyBufferRegion(vb.resource.Get(), (uint64_t)out.baseVertex * vb.stride,
+        m_stagingPages[va.page].Get(), va.offset, vbSize);
+    cl->CopyBufferRegion(ib.resource.Get(), (uint64_t)out.firstIndex * ib.stride,
+        m_stagingPages[ia.page].Get(), ia.offset, ibSize);
 
-    for (size_t i = 0; i < verts.size(); ++i)
+    ++m_geometryUploadsThisFrame;
+}
+
+// ---------------------------
+// Geometry 메가버퍼
+// ---------------------------
+void D3D12Renderer::CreateGeometryBuffers()
+{
+    m_geometry[GeometryVB32].stride = sizeof(VertexPNU);
+    m_geometry[GeometryVBCompact].stride = sizeof(CompactVertex);
+    m_geometry[GeometryIB16].stride = sizeof(uint16_t);
+    m_geometry[GeometryIB32].stride = sizeof(uint32_t);
+
+    for (uint32_t k = 0; k < GeometryKindCount; ++k)
+        GrowGeometryBuffer((GeometryKind)k, GeometryInitialCapacity[k]);
+}
+
+TlsfAllocation D3D12Renderer::AllocateGeometry(GeometryKind kind, uint32_t count)
+{
+    GeometryBuffer& g = m_geometry[kind];
+
+    TlsfAllocation a = g.allocator.Allocate(count);
+    if (!a.IsValid())
     {
-        verts[i].pos = cpu.positions[i];
-        verts[i].nrm = (i < cpu.normals.size()) ? cpu.normals[i] : XMFLOAT3{ 0,1,0 };
-        verts[i].uv  = (i < cpu.uvs.size()) ? cpu.uvs[i] : XMFLOAT2{ 0,0 };
+        // 끝에 count 이상 덧붙이면 반드시 들어감
+        GrowGeometryBuffer(kind, g.allocator.GetCapacity() + count);
+        a = g.allocator.Allocate(count);
     }
 
-    const UINT vbSize = (UINT)(verts.size() * sizeof(VertexPNU));
-    const UINT ibSize = (UINT)(cpu.indices.size() * sizeof(uint16_t));
+    if (!a.IsValid())
+        throw std::runtime_error("Geometry buffer allocation failed.");
+    return a;
+}
+
+void D3D12Renderer::GrowGeometryBuffer(GeometryKind kind, uint32_t minCapacity)
+{
+    GeometryBuffer& g = m_geometry[kind];
 
-    out.indexCount = (uint32_t)cpu.indices.size();
+    // view의 SizeInBytes가 UINT라 바이트 기준 4GB 미만으로 제한
+    const uint64_t maxCapacity = 0xFFFFFFFFull / g.stride;
+    const uint32_t oldCapacity = g.allocator.GetCapacity();
+    const uint64_t newCapacity = std::min(std::max<uint64_t>((uint64_t)oldCapacity * 2, minCapacity), maxCapacity);
+    if (newCapacity < minCapacity)
+        throw std::runtime_error("Geometry buffer too large.");
 
     D3D12_HEAP_PROPERTIES heap{};
-    heap.Type = D3D12_HEAP_TYPE_UPLOAD;
+    heap.Type = D3D12_HEAP_TYPE_DEFAULT;
 
-    // VB
-    D3D12_RESOURCE_DESC vbDesc{};
-    vbDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    vbDesc.Width = vbSize;
-    vbDesc.Height = 1;
-    vbDesc.DepthOrArraySize = 1;
-    vbDesc.MipLevels = 1;
-    vbDesc.SampleDesc.Count = 1;
-    vbDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    D3D12_RESOURCE_DESC desc = MakeBufferDesc(newCapacity * g.stride);
 
+    ComPtr<ID3D12Resource> res;
     ThrowIfFailed(m_device->CreateCommittedResource(
-        &heap, D3D12_HEAP_FLAG_NONE, &vbDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&out.vb)));
+        &heap, D3D12_HEAP_FLAG_NONE, &desc,
+        D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&res)));
 
-    void* p = nullptr;
-    out.vb->Map(0, nullptr, &p);
-    std::memcpy(p, verts.data(), vbSize);
-    out.vb->Unmap(0, nullptr);
+    if (g.resource && oldCapacity > 0)
+    {
+        // 기존 내용 복사. 이번 프레임에 이미 녹화한 업로드(옛 버퍼에 쓰기)가 끝난 뒤여야 하고,
+        // 이후 새 버퍼에 쓰는 업로드와 겹치면 안 됨 → 앞뒤로 copy queue를 비움 (2배씩 커지므로 드문 경로)
+        SubmitCopies(true);
+        GetCopyList()->CopyBufferRegion(res.Get(), 0, g.resource.Get(), 0, (uint64_t)oldCapacity * g.stride);
+        SubmitCopies(true);
+
+        // 이전 프레임 draw가 아직 읽고 있을 수 있음 → frame fence 후 해제
+        m_pendingGeometryReleases.push_back(PendingGeometryRelease{ g.resource, m_fenceValues[m_frameIndex] });
+        ++m_geometryGrowths;
+    }
 
-    out.vbView.BufferLocation = out.vb->GetGPUVirtualAddress();
-    out.vbView.SizeInBytes = vbSize;
-    out.vbView.StrideInBytes = sizeof(VertexPNU);
+    g.resource = res;
+    g.allocator.Grow((uint32_t)newCapacity);
 
-    // IB
-    D3D12_RESOURCE_DESC ibDesc = vbDesc;
-    ibDesc.Width = ibSize;
+    UpdateGeometryViews();
+}
 
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &heap, D3D12_HEAP_FLAG_NONE, &ibDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&out.ib)));
+void D3D12Renderer::UpdateGeometryViews()
+{
+    // [0] = Float32 / 16bit, [1] = Compact / 32bit
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        const GeometryBuffer& vb = m_geometry[i ? GeometryVBCompact : GeometryVB32];
+        if (vb.resource)
+        {
+            m_geometryVBViews[i].BufferLocation = vb.resource->GetGPUVirtualAddress();
+            m_geometryVBViews[i].SizeInBytes = vb.allocator.GetCapacity() * vb.stride;
+            m_geometryVBViews[i].StrideInBytes = vb.stride;
+        }
 
-    out.ib->Map(0, nullptr, &p);
-    std::memcpy(p, cpu.indices.data(), ibSize);
-    out.ib->Unmap(0, nullptr);
+        const GeometryBuffer& ib = m_geometry[i ? GeometryIB32 : GeometryIB16];
+        if (ib.resource)
+        {
+            m_geometryIBViews[i].BufferLocation = ib.resource->GetGPUVirtualAddress();
+            m_geometryIBViews[i].SizeInBytes = ib.allocator.GetCapacity() * ib.stride;
+            m_geometryIBViews[i].Format = i ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
+        }
+    }
+}
 
-    out.ibView.BufferLocation = out.ib->GetGPUVirtualAddress();
-    out.ibView.SizeInBytes = ibSize;
-    out.ibView.Format = DXGI_FORMAT_R16_UINT;
+void D3D12Renderer::ProcessPendingGeometryReleases()
+{
+    if (!m_fence) return;
+
+    const uint64_t completed = m_fence->GetCompletedValue();
+
+    size_t write = 0;
+    for (size_t i = 0; i < m_pendingGeometryReleases.size(); ++i)
+    {
+        if (completed < m_pendingGeometryReleases[i].retireFenceValue)
+            m_pendingGeometryReleases[write++] = std::move(m_pendingGeometryReleases[i]);
+    }
+    m_pendingGeometryReleases.resize(write);
+}
+
+GeometryBufferStats D3D12Renderer::GetGeometryStats() const
+{
+    GeometryBufferStats s{};
+    s.vertices = m_geometry[GeometryVB32].allocator.GetStats();
+    s.compactVertices = m_geometry[GeometryVBCompact].allocator.GetStats();
+    s.indices16 = m_geometry[GeometryIB16].allocator.GetStats();
+    s.indices32 = m_geometry[GeometryIB32].allocator.GetStats();
+    s.uploadsThisFrame = m_geometryUploadsThisFrame;
+    s.growths = m_geometryGrowths;
+    return s;
+}
+
+ID3D12GraphicsCommandList* D3D12Renderer::GetCopyList()
+{
+    if (!m_copyListOpen)
+    {
+        // allocator는 프레임 첫 사용 때만 Reset (같은 프레임에 이미 제출한 list가 아직 실행 중일 수 있음)
+        // copy는 frame fence와 따로 끝나므로 이 allocator로 낸 마지막 제출을 확인 (큰 업로드가 2프레임 넘게 걸릴 때만 대기)
+        ID3D12CommandAllocator* alloc = m_copyAllocators[m_frameIndex].Get();
+        if (!m_copyAllocatorReset)
+        {
+            WaitUploadFence(m_copyAllocatorFence[m_frameIndex]);
+            ThrowIfFailed(alloc->Reset());
+            m_copyAllocatorReset = true;
+        }
+
+        ThrowIfFailed(m_copyList->Reset(alloc, nullptr));
+        m_copyListOpen = true;
+    }
+    return m_copyList.Get();
+}
+
+uint64_t D3D12Renderer::SubmitCopies(bool wait)
+{
+    if (m_copyListOpen)
+    {
+        ThrowIfFailed(m_copyList->Close());
+        m_copyListOpen = false;
+
+        ID3D12CommandList* lists[] = { m_copyList.Get() };
+        m_copyQueue->ExecuteCommandLists(1, lists);
+
+        const uint64_t value = ++m_copyFenceValue;
+        ThrowIfFailed(m_copyQueue->Signal(m_copyFence.Get(), value));
+        m_copyAllocatorFence[m_frameIndex] = value;
+    }
+
+    // 열린 list가 없어도 wait면 앞서 낸 copy까지 전부 대기 (copy queue는 순서대로 끝남)
+    if (wait)
+        WaitUploadFence(m_copyFenceValue);
+
+    return m_copyFenceValue;
+}
+
+bool D3D12Renderer::RecordUpload(const UploadRequest& request)
+{
+    // 요청 뒤 파괴된 에셋은 녹화할 것 없음 (완료 콜백도 캐시에서 못 찾고 끝)
+    if (request.kind == UploadKind::Mesh)
+    {
+        if (!m_meshManager || !m_meshManager->IsValid({ request.id }))
+            return true;
+
+        MeshGPUData gpu{};
+        CreateGPUMeshFromCPU(m_meshManager->Get({ request.id }), gpu);
+        m_gpuMeshes.emplace(request.id, std::move(gpu));
+        return true;
+    }
+
+    const TextureHandle h{ request.id };
+    if (!m_textureManager || !m_textureManager->IsValid(h))
+        return true;
+
+    TextureGPUData gpu{};
+    if (m_textureManager->IsCubemap(h))
+        CreateGPUCubeTextureFromCPU(m_textureManager->GetCube(h), gpu);
+    else
+        CreateGPUTextureFromCPU(m_textureManager->Get(h), gpu);
+
+    // 열린 copy list는 다음 Signal 값으로 끝남
+    gpu.uploadFence = m_copyFenceValue + 1;
+    m_gpuTextures.emplace(request.id, std::move(gpu));
+    return true;
+}
+
+uint64_t D3D12Renderer::SubmitUploads()
+{
+    // staging page는 이 제출이 끝나야 재사용
+    const uint64_t fence = SubmitCopies(false);
+    m_staging.EndFrame(fence);
+    return fence;
+}
+
+uint64_t D3D12Renderer::GetCompletedUploadFence() const
+{
+    return m_copyFence->GetCompletedValue();
+}
+
+void D3D12Renderer::WaitUploadFence(uint64_t fenceValue)
+{
+    if (m_copyFence->GetCompletedValue() >= fenceValue)
+        return;
+
+    ThrowIfFailed(m_copyFence->SetEventOnCompletion(fenceValue, m_fenceEvent));
+    WaitForSingleObject(m_fenceEvent, INFINITE);
+}
+
+void D3D12Renderer::OnUploadComplete(const UploadRequest& request)
+{
+    if (request.kind == UploadKind::Mesh)
+    {
+        auto it = m_gpuMeshes.find(request.id);
+        if (it != m_gpuMeshes.end())
+            it->second.resident = true;
+    }
+    else
+    {
+        auto it = m_gpuTextures.find(request.id);
+        if (it != m_gpuTextures.end())
+            it->second.resident = true;
+    }
 }
 
 void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, TextureGPUData& out)
@@ -1484,9 +1972,7 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
     if (cpu.width == 0 || cpu.height == 0)
         throw std::runtime_error("CreateGPUCubeTextureFromCPU: invalid cpu cubemap.");
 
-    const uint32_t srvIndex = m_nextSrvIndex++;
-    if (srvIndex >= 256)
-        throw std::runtime_error("SRV heap is full (>=256).");
+    const uint32_t srvIndex = AllocateSrvSlot();
 
     const DXGI_FORMAT fmt =
         (cpu.colorSpace == ImageColorSpace::SRGB)
@@ -1507,12 +1993,14 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
     D3D12_HEAP_PROPERTIES hpDefault{};
     hpDefault.Type = D3D12_HEAP_TYPE_DEFAULT;
 
+    // COMMON으로 생성: copy queue에서 COPY_DEST로, direct에서 PIXEL_SHADER_RESOURCE로 암시적 승격
+    // (copy queue 제출이 끝나면 COMMON으로 복귀 → 큐 사이 barrier 불필요)
     ThrowIfFailed(m_device->CreateCommittedResource(
         &hpDefault, D3D12_HEAP_FLAG_NONE, &td,
-        D3D12_RESOURCE_STATE_COPY_DEST,
+        D3D12_RESOURCE_STATE_COMMON,
         nullptr, IID_PPV_ARGS(&out.tex)));
 
-    // Upload buffer for 6 subresources
+    // 6 subresource footprint (staging 구간 기준 offset)
     std::array<D3D12_PLACED_SUBRESOURCE_FOOTPRINT, 6> fp{};
     std::array<UINT, 6> numRows{};
     std::array<UINT64, 6> rowSize{};
@@ -1521,33 +2009,14 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
     m_device->GetCopyableFootprints(&td, 0, 6, 0,
         fp.data(), numRows.data(), rowSize.data(), &totalBytes);
 
-    D3D12_RESOURCE_DESC bd{};
-    bd.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    bd.Width = totalBytes;
-    bd.Height = 1;
-    bd.DepthOrArraySize = 1;
-    bd.MipLevels = 1;
-    bd.SampleDesc.Count = 1;
-    bd.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-    D3D12_HEAP_PROPERTIES hpUpload{};
-    hpUpload.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &hpUpload, D3D12_HEAP_FLAG_NONE, &bd,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr, IID_PPV_ARGS(&out.upload)));
-
-    // Map and copy each face respecting RowPitch
-    uint8_t* dst = nullptr;
-    D3D12_RANGE r{ 0,0 };
-    ThrowIfFailed(out.upload->Map(0, &r, (void**)&dst));
+    const UploadAllocation staging = AllocateStaging(totalBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
 
+    // copy each face respecting RowPitch
     const uint32_t srcRowBytes = cpu.width * 4;
 
     for (int face = 0; face < 6; ++face)
     {
-        uint8_t* faceDst = dst + fp[face].Offset;
+        uint8_t* faceDst = staging.cpu + fp[face].Offset;
         const uint8_t* faceSrc = cpu.pixels[face].data();
 
         for (uint32_t y = 0; y < cpu.height; ++y)
@@ -1557,9 +2026,9 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
                 srcRowBytes);
         }
     }
-    out.upload->Unmap(0, nullptr);
 
     // CopyTextureRegion for each subresource(face)
+    ID3D12GraphicsCommandList* cl = GetCopyList();
     for (int face = 0; face < 6; ++face)
     {
         D3D12_TEXTURE_COPY_LOCATION dstLoc{};
@@ -1568,22 +2037,14 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
         dstLoc.SubresourceIndex = face;
 
         D3D12_TEXTURE_COPY_LOCATION srcLoc{};
-        srcLoc.pResource = out.upload.Get();
+        srcLoc.pResource = m_stagingPages[staging.page].Get();
         srcLoc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
         srcLoc.PlacedFootprint = fp[face];
+        srcLoc.PlacedFootprint.Offset += staging.offset;
 
-        m_commandList->CopyTextureRegion(&dstLoc, 0, 0, 0, &srcLoc, nullptr);
+        cl->CopyTextureRegion(&dstLoc, 0, 0, 0, &srcLoc, nullptr);
     }
 
-    // Transition to PIXEL_SHADER_RESOURCE
-    D3D12_RESOURCE_BARRIER b{};
-    b.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    b.Transition.pResource = out.tex.Get();
-    b.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
-    b.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-    b.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    m_commandList->ResourceBarrier(1, &b);
-
     // SRV as TEXTURECUBE
     D3D12_SHADER_RESOURCE_VIEW_DESC sd{};
     sd.Format = fmt;
@@ -1606,6 +2067,9 @@ void D3D12Renderer::CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, T
 
 void D3D12Renderer::RetireMesh(uint32_t meshId)
 {
+    // 복사 중인 구간은 copy queue가 순서대로 쓰므로 구간 재사용은 frame fence만 보면 됨
+    m_uploadScheduler.Cancel(UploadKind::Mesh, meshId);
+
     if (m_gpuMeshes.find(meshId) == m_gpuMeshes.end())
         return;
 
@@ -1625,7 +2089,15 @@ void D3D12Renderer::ProcessPendingMeshReleases()
         const auto& r = m_pendingMeshReleases[i];
         if (completed >= r.retireFenceValue)
         {
-            m_gpuMeshes.erase(r.meshId);
+            // 메가버퍼 구간 반환 (이 fence 이후로는 GPU가 안 읽음)
+            auto it = m_gpuMeshes.find(r.meshId);
+            if (it != m_gpuMeshes.end())
+            {
+                const MeshGPUData& mesh = it->second;
+                m_geometry[VertexKindOf(mesh.layout)].allocator.Free(mesh.vbAlloc);
+                m_geometry[IndexKindOf(mesh.layout)].allocator.Free(mesh.ibAlloc);
+                m_gpuMeshes.erase(it);
+            }
         }
         else
         {
@@ -1638,7 +2110,7 @@ void D3D12Renderer::ProcessPendingMeshReleases()
 // ---------------------------
 // Texture cache
 // ---------------------------
-uint32_t D3D12Renderer::GetOrCreateSrvIndex(const TextureHandle& h)
+uint32_t D3D12Renderer::GetResidentSrvIndex(const TextureHandle& h, uint32_t fallback)
 {
     // invalid -> default slot 0
     if (!h.IsValid())
@@ -1646,36 +2118,44 @@ uint32_t D3D12Renderer::GetOrCreateSrvIndex(const TextureHandle& h)
 
     auto it = m_gpuTextures.find(h.id);
     if (it != m_gpuTextures.end())
-        return it->second.srvIndex;
+        return it->second.resident ? it->second.srvIndex : fallback;
 
     assert(m_textureManager && "TextureManager not set");
-
-    TextureGPUData gpu{};
-    if (m_textureManager->IsCubemap(h))
-    {
-        const TextureCubeCpuData& cpu = m_textureManager->GetCube(h);
-        CreateGPUCubeTextureFromCPU(cpu, gpu);
-    }
-    else
+    if (!m_uploadScheduler.IsPending(UploadKind::Texture, h.id))
     {
-        const TextureCpuData& cpu = m_textureManager->Get(h);
-        CreateGPUTextureFromCPU(cpu, gpu);
+        // 예산 계산용 크기 (RGBA8)
+        uint64_t bytes = 0;
+        if (m_textureManager->IsCubemap(h))
+        {
+            const TextureCubeCpuData& cpu = m_textureManager->GetCube(h);
+            bytes = (uint64_t)cpu.width * cpu.height * 4 * 6;
+        }
+        else
+        {
+            const TextureCpuData& cpu = m_textureManager->Get(h);
+            bytes = (uint64_t)cpu.width * cpu.height * 4;
+        }
+        m_uploadScheduler.Request(UploadKind::Texture, h.id, bytes);
     }
+    return fallback;
+}
 
-    auto [iter, inserted] = m_gpuTextures.emplace(h.id, std::move(gpu));
-    m_texturesCreatedThisFrame.push_back(h.id);
-    return iter->second.srvIndex;
+uint32_t D3D12Renderer::AllocateSrvSlot()
+{
+    const uint32_t slot = m_srvAllocator.Allocate();
+    if (slot == DescriptorAllocator::InvalidSlot)
+        throw std::runtime_error("SRV heap is full (" + std::to_string(MaxSrvDescriptors) + " slots).");
+    return slot;
 }
 
-void D3D12Renderer::CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGPUData& out)
+void D3D12Renderer::CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGPUData& out, uint32_t srvIndex)
 {
     if (cpu.width == 0 || cpu.height == 0 || cpu.pixels.empty())
         throw std::runtime_error("CreateGPUTextureFromCPU: invalid cpu texture data.");
 
-    // SRV 슬롯 할당
-    const uint32_t srvIndex = m_nextSrvIndex++;
-    if (srvIndex >= 256)
-        throw std::runtime_error("SRV heap is full (>=256).");
+    // SRV 슬롯 할당 (지정 slot이 없으면)
+    if (srvIndex == DescriptorAllocator::InvalidSlot)
+        srvIndex = AllocateSrvSlot();
 
     const DXGI_FORMAT fmt =
         (cpu.colorSpace == ImageColorSpace::SRGB)
@@ -1696,80 +2176,49 @@ void D3D12Renderer::CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGP
     D3D12_HEAP_PROPERTIES hpDefault{};
     hpDefault.Type = D3D12_HEAP_TYPE_DEFAULT;
 
+    // COMMON으로 생성 (copy queue → COPY_DEST, direct → PIXEL_SHADER_RESOURCE 암시적 승격)
     ComPtr<ID3D12Resource> tex;
     ThrowIfFailed(m_device->CreateCommittedResource(
         &hpDefault,
         D3D12_HEAP_FLAG_NONE,
         &td,
-        D3D12_RESOURCE_STATE_COPY_DEST,
+        D3D12_RESOURCE_STATE_COMMON,
         nullptr,
         IID_PPV_ARGS(&tex)));
 
-    // Upload buffer
+    // staging footprint
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT fp{};
     UINT numRows = 0;
     UINT64 rowSizeInBytes = 0;
     UINT64 totalBytes = 0;
     m_device->GetCopyableFootprints(&td, 0, 1, 0, &fp, &numRows, &rowSizeInBytes, &totalBytes);
 
-    D3D12_RESOURCE_DESC bd{};
-    bd.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    bd.Width = totalBytes;
-    bd.Height = 1;
-    bd.DepthOrArraySize = 1;
-    bd.MipLevels = 1;
-    bd.SampleDesc.Count = 1;
-    bd.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-    D3D12_HEAP_PROPERTIES hpUpload{};
-    hpUpload.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-    ComPtr<ID3D12Resource> upload;
-    ThrowIfFailed(m_device->CreateCommittedResource(
-        &hpUpload,
-        D3D12_HEAP_FLAG_NONE,
-        &bd,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&upload)));
-
-    // Map + copy rowPitch
-    uint8_t* dst = nullptr;
-    D3D12_RANGE r{ 0,0 };
-    ThrowIfFailed(upload->Map(0, &r, (void**)&dst));
+    const UploadAllocation staging = AllocateStaging(totalBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
 
+    // copy rowPitch
     const uint8_t* src = cpu.pixels.data();
     const uint32_t srcRowBytes = cpu.width * 4;
 
     for (uint32_t y = 0; y < cpu.height; ++y)
     {
-        std::memcpy(dst + (size_t)y * fp.Footprint.RowPitch,
+        std::memcpy(staging.cpu + (size_t)y * fp.Footprint.RowPitch,
             src + (size_t)y * srcRowBytes,
             srcRowBytes);
     }
-    upload->Unmap(0, nullptr);
 
-    // CopyTextureRegion
+    // CopyTextureRegion (copy queue)
     D3D12_TEXTURE_COPY_LOCATION dstLoc{};
     dstLoc.pResource = tex.Get();
     dstLoc.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
     dstLoc.SubresourceIndex = 0;
 
     D3D12_TEXTURE_COPY_LOCATION srcLoc{};
-    srcLoc.pResource = upload.Get();
+    srcLoc.pResource = m_stagingPages[staging.page].Get();
     srcLoc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
     srcLoc.PlacedFootprint = fp;
+    srcLoc.PlacedFootprint.Offset += staging.offset;
 
-    m_commandList->CopyTextureRegion(&dstLoc, 0, 0, 0, &srcLoc, nullptr);
-
-    // barrier: COPY_DEST -> PIXEL_SHADER_RESOURCE
-    D3D12_RESOURCE_BARRIER b{};
-    b.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    b.Transition.pResource = tex.Get();
-    b.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    b.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
-    b.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-    m_commandList->ResourceBarrier(1, &b);
+    GetCopyList()->CopyTextureRegion(&dstLoc, 0, 0, 0, &srcLoc, nullptr);
 
     // SRV 생성
     D3D12_SHADER_RESOURCE_VIEW_DESC srv{};
@@ -1784,7 +2233,6 @@ void D3D12Renderer::CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGP
 
     // out
     out.tex = tex;
-    out.upload = upload;
     out.srvIndex = srvIndex;
     out.width = cpu.width;
     out.height = cpu.height;
@@ -1793,12 +2241,18 @@ void D3D12Renderer::CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGP
 
 void D3D12Renderer::RetireTexture(uint32_t texId)
 {
+    // 아직 대기열이면 빼고, 복사 중이면 완료 표시만 생략 (리소스는 아래 fence + uploadFence 뒤 해제)
+    m_uploadScheduler.Cancel(UploadKind::Texture, texId);
+
     auto it = m_gpuTextures.find(texId);
     if (it == m_gpuTextures.end())
         return;
 
     const uint64_t retireFence = m_fenceValues[m_frameIndex];
     m_pendingTextureReleases.push_back(PendingTextureRelease{ texId, retireFence });
+
+    // descriptor slot도 같은 fence 뒤에 재사용 (그 전엔 in-flight 프레임이 읽을 수 있음)
+    m_srvAllocator.Free(it->second.srvIndex, retireFence);
 }
 
 void D3D12Renderer::ProcessPendingTextureReleases()
@@ -1806,51 +2260,33 @@ void D3D12Renderer::ProcessPendingTextureReleases()
     if (!m_fence) return;
 
     const uint64_t completed = m_fence->GetCompletedValue();
+    const uint64_t copyCompleted = m_copyFence->GetCompletedValue();
 
     size_t write = 0;
     for (size_t i = 0; i < m_pendingTextureReleases.size(); ++i)
     {
         const auto& r = m_pendingTextureReleases[i];
-        if (completed >= r.retireFenceValue)
-        {
-            m_gpuTextures.erase(r.texId);
-        }
-        else
-        {
-            m_pendingTextureReleases[write++] = r;
-        }
-    }
-    m_pendingTextureReleases.resize(write);
-}
 
-void D3D12Renderer::ProcessPendingTextureUploadReleases()
-{
-    if (!m_fence) return;
-
-    const uint64_t completed = m_fence->GetCompletedValue();
+        // direct가 다 읽었고, 업로드 도중 파괴된 경우 copy queue도 다 썼어야 해제
+        auto it = m_gpuTextures.find(r.texId);
+        const bool copyDone = (it == m_gpuTextures.end()) || copyCompleted >= it->second.uploadFence;
 
-    size_t write = 0;
-    for (size_t i = 0; i < m_pendingTextureUploadReleases.size(); ++i)
-    {
-        const auto& r = m_pendingTextureUploadReleases[i];
-        if (completed >= r.retireFenceValue)
+        if (completed >= r.retireFenceValue && copyDone)
         {
-            auto it = m_gpuTextures.find(r.texId);
             if (it != m_gpuTextures.end())
-                it->second.upload.Reset();
+                m_gpuTextures.erase(it);
         }
         else
         {
-            m_pendingTextureUploadReleases[write++] = r;
+            m_pendingTextureReleases[write++] = r;
         }
     }
-    m_pendingTextureUploadReleases.resize(write);
+    m_pendingTextureReleases.resize(write);
 }
 
 void D3D12Renderer::CreateDefaultTexture_Checkerboard()
 {
-    // slot0 예약: 첫 텍스처 생성이 slot0을 먹도록
-    // (CreateDescriptorHeaps에서 m_nextSrvIndex=0)
+    // slot0 예약 (CreateDescriptorHeaps에서 m_srvAllocator reserved = 1)
     const uint32_t texW = 256, texH = 256;
     std::vector<uint8_t> rgba(texW * texH * 4);
 
@@ -1878,17 +2314,15 @@ void D3D12Renderer::CreateDefaultTexture_Checkerboard()
 
     // 기본 텍스처는 TextureHandle 없이도 slot0만 쓰면 되므로,
     // id=0 캐시에 넣어둔다.
+    // 다른 텍스처가 대신 쓰는 fallback이라 여기서는 copy 완료까지 대기
     TextureGPUData gpu{};
-    CreateGPUTextureFromCPU(cpu, gpu);
+    CreateGPUTextureFromCPU(cpu, gpu, 0);
 
-    // slot0인지 확인 (디버그)
-#if defined(_DEBUG)
-    assert(gpu.srvIndex == 0 && "Default texture must occupy SRV slot 0.");
-#endif
+    gpu.uploadFence = SubmitUploads();
+    WaitUploadFence(gpu.uploadFence);
+    gpu.resident = true;
 
     m_gpuTextures.emplace(0u, std::move(gpu));
-
-    m_nextSrvIndex = 1; // 이제부터는 slot1부터
 }
 
 void D3D12Renderer::CreateSkyboxPipeline()
@@ -13,9 +13,17 @@
 #include <DirectXMath.h>
 #include "IRenderer.h"
 #include "TextureCubeCpuData.h"
+#include "InstanceBatcher.h"
+#include "LightClusterer.h"
+#include "UploadRing.h"
+#include "CommandRecordScheduler.h"
+#include "TlsfAllocator.h"
+#include "DescriptorAllocator.h"
+#include "UploadScheduler.h"
 
 class MeshManager;
 struct MeshCPUData;
+class JobSystem;
 
 class TextureManager;
 struct TextureCpuData;
@@ -23,15 +31,43 @@ struct TextureHandle;
 
 // ---------------------------
 // GPU Mesh Data
+// - /ε  geometry ް  (mesh ҽ  )
+// - ε mesh   draw BaseVertexLocation = baseVertex
+// - layout =  /ε ũ   ްۡPSO ,  Ű pipeline ʵ(2bit)ε 
 // ---------------------------
+namespace GeometryLayout
+{
+    static constexpr uint32_t CompactVertices = 1u << 0;    // MeshVertexFormat::Compact (16 byte)
+    static constexpr uint32_t Index32 = 1u << 1;            // 32bit ε
+}
+
 struct MeshGPUData
 {
-    Microsoft::WRL::ComPtr<ID3D12Resource> vb;
-    Microsoft::WRL::ComPtr<ID3D12Resource> ib;
+    TlsfAllocation vbAlloc;     // : 
+    TlsfAllocation ibAlloc;     // : ε
 
-    D3D12_VERTEX_BUFFER_VIEW vbView{};
-    D3D12_INDEX_BUFFER_VIEW  ibView{};
+    uint32_t layout = 0;        // GeometryLayout Ʈ
+    uint32_t baseVertex = 0;
+    uint32_t firstIndex = 0;
+    uint32_t vertexCount = 0;
     uint32_t indexCount = 0;
+
+    // Compact ġ ȭ (pos = offset + unorm * scale)
+    DirectX::XMFLOAT3 posOffset{ 0, 0, 0 };
+    DirectX::XMFLOAT3 posScale{ 1, 1, 1 };
+
+    bool resident = false;      // copy queue  Ϸ (   mesh  item draw )
+};
+
+// geometry ް 뷮 ( ǥÿ)
+struct GeometryBufferStats
+{
+    TlsfStats vertices;         // Float32 
+    TlsfStats compactVertices;  // Compact 
+    TlsfStats indices16;
+    TlsfStats indices32;
+    uint32_t uploadsThisFrame = 0;  // ̹  copy queue ø mesh 
+    uint32_t growths = 0;           //   Ҵ Ƚ
 };
 
 struct PendingMeshRelease
@@ -46,9 +82,11 @@ struct PendingMeshRelease
 struct TextureGPUData
 {
     Microsoft::WRL::ComPtr<ID3D12Resource> tex;
-    Microsoft::WRL::ComPtr<ID3D12Resource> upload; // fence Ϸ  release
     uint32_t srvIndex = 0;
 
+    uint64_t uploadFence = 0;   // 簡  copy  fence (  tex  )
+    bool resident = false;      //  Ϸ (  ⺻ ؽó )
+
     uint32_t width = 0;
     uint32_t height = 0;
     DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
@@ -62,19 +100,13 @@ struct PendingTextureRelease
     uint64_t retireFenceValue = 0;
 };
 
-struct PendingTextureUploadRelease
-{
-    uint32_t texId = 0;              // TextureHandle.id
-    uint64_t retireFenceValue = 0;
-};
-
 // ---------------------------
 // Renderer
 // ---------------------------
-class D3D12Renderer final : public IRenderer
+class D3D12Renderer final : public IRenderer, private ICommandRecordBackend, private IUploadQueue
 {
 public:
-    void Initialize(HWND hwnd, uint32_t width, uint32_t height) override;
+    void Initialize(void* nativeWindow, uint32_t width, uint32_t height) override;
     void Resize(uint32_t width, uint32_t height) override;
     void Render(const std::vector<RenderItem>& items, const RenderCamera& cam, const FrameLights& lights, TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text) override;
     void RenderUI(const std::vector<UIDrawItem>& ui) override;
@@ -84,9 +116,30 @@ public:
     void SetMeshManager(MeshManager* mm);
     void SetTextureManager(TextureManager* tm);
 
+    // opaque batch  ȭ Ŀ Ǯ (nullptr̸  command list  ȭ)
+    void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
     // slot 0  ⺻ ؽó(SRV) ε
     uint32_t GetDefaultSrvIndex() const { return 0; }
 
+    // SRV  slot  (/fence / slot)
+    DescriptorAllocatorStats GetSrvStats() const { return m_srvAllocator.GetStats(); }
+
+    //  Render νϽ  (draw call  )
+    const InstanceBatchStats& GetInstancingStats() const { return m_instanceBatcher.GetStats(); }
+
+    //  Render light cluster  
+    const LightClusterStats& GetLightClusterStats() const { return m_lightClusterer.GetStats(); }
+
+    //  ε Ҵ  (page , ̹  뷮 )
+    const UploadRingStats& GetUploadStats() const { return m_upload.GetStats(); }
+
+    // geometry ް 
+    GeometryBufferStats GetGeometryStats() const;
+
+    // mesh/texture 񵿱 ε  (/ , ̹  ⷮ)
+    const UploadSchedulerStats& GetStreamingStats() const { return m_uploadScheduler.GetStats(); }
+
 private:
     static void ThrowIfFailed(HRESULT hr);
     static uint32_t Align256(uint32_t size) { return (size + 255u) & ~255u; }
@@ -103,9 +156,13 @@ private:
     void CreateDebugLinePipeline();
     void CreateUIPipeline();
 
-    void CreateConstantBuffer();
-    void CreateDebugVertexBuffer();
-    void CreateUIVertexBuffer();
+    void CreateUploadRing();
+
+    // ̹  ε ޸ ( fence Ϸ  ȿ)
+    UploadAllocation AllocateUpload(uint64_t size, uint64_t alignment);
+    // copy queue  ޸ (̹ copy  fence Ϸ  ȿ)
+    UploadAllocation AllocateStaging(uint64_t size, uint64_t alignment);
+    D3D12_GPU_VIRTUAL_ADDRESS UploadConstants(const void* data, uint32_t size);
 
     // ---- DirectWrite text overlay ----
     void CreateTextOverlay();
@@ -115,27 +172,69 @@ private:
     void WaitForGPU();
     void MoveToNextFrame();
 
+    // ---- Opaque ȭ (/ ) ----
+    // RT/viewport/root signature/FrameCB/νϽ ε ( Reset list)
+    void BeginPassList(ID3D12GraphicsCommandList* cl);
+    void RecordOpaqueBatches(ID3D12GraphicsCommandList* cl, uint32_t first, uint32_t count);
+
+    // ICommandRecordBackend: Ŀ 忡 ûũ ϳ ڱ command list ȭ
+    void RecordChunk(uint32_t chunkIndex, uint32_t first, uint32_t count) override;
+
 private:
     // ---- Mesh GPU cache ----
-    MeshGPUData& GetOrCreateGPUMesh(uint32_t meshId);
+    // 簡  mesh ȯ. ó  mesh ε ûϰ nullptr
+    MeshGPUData* FindResidentMesh(uint32_t meshId);
     void CreateGPUMeshFromCPU(const MeshCPUData& cpu, MeshGPUData& out);
     void CreateGPUCubeTextureFromCPU(const TextureCubeCpuData& cpu, TextureGPUData& out);
 
     void RetireMesh(uint32_t meshId);
     void ProcessPendingMeshReleases();
 
+    // ---- Geometry ް / copy queue ----
+    enum GeometryKind : uint32_t
+    {
+        GeometryVB32 = 0,       // Float32 
+        GeometryVBCompact,      // Compact 
+        GeometryIB16,
+        GeometryIB32,
+        GeometryKindCount,
+    };
+
+    void CreateGeometryBuffers();
+    // ڶ Ű  Ȯ (:  Ǵ ε)
+    TlsfAllocation AllocateGeometry(GeometryKind kind, uint32_t count);
+    void GrowGeometryBuffer(GeometryKind kind, uint32_t minCapacity);
+    void UpdateGeometryViews();
+    static GeometryKind VertexKindOf(uint32_t layout) { return (layout & GeometryLayout::CompactVertices) ? GeometryVBCompact : GeometryVB32; }
+    static GeometryKind IndexKindOf(uint32_t layout) { return (layout & GeometryLayout::Index32) ? GeometryIB32 : GeometryIB16; }
+    void ProcessPendingGeometryReleases();
+
+    // ̹  copy list (ó   Reset)
+    ID3D12GraphicsCommandList* GetCopyList();
+    // ȭ copy ,  copy fence  ȯ (wait CPU Ϸ )
+    // direct queue  ٸ    Ϸ(resident) ڿ о 
+    uint64_t SubmitCopies(bool wait);
+
+    // ---- 񵿱 ε (IUploadQueue: UploadScheduler ȣ) ----
+    bool RecordUpload(const UploadRequest& request) override;
+    uint64_t SubmitUploads() override;
+    uint64_t GetCompletedUploadFence() const override;
+    void WaitUploadFence(uint64_t fenceValue) override;
+    void OnUploadComplete(const UploadRequest& request);
+
 private:
     // ---- Texture GPU cache ----
-    // (1) TextureHandle -> srvIndex (ʿϸ εϰ )
-    uint32_t GetOrCreateSrvIndex(const TextureHandle& h);
+    // (1) TextureHandle -> srvIndex. invalid ڵ 0(⺻),   ̸ fallback (ó  ε û)
+    uint32_t GetResidentSrvIndex(const TextureHandle& h, uint32_t fallback = 0);
 
-    // (2) CPU ؽó -> GPU ؽó + SRV  (Ŀǵ帮Ʈ copy/transition )
-    void CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGPUData& out);
+    // (2) CPU ؽó -> GPU ؽó + SRV  (staging ä copy list  ,   )
+    //     srvIndex ָ  slot (⺻ ؽó =  slot 0), ƴϸ m_srvAllocator 
+    void CreateGPUTextureFromCPU(const TextureCpuData& cpu, TextureGPUData& out, uint32_t srvIndex = DescriptorAllocator::InvalidSlot);
+    uint32_t AllocateSrvSlot();
 
     // (3) TextureManager::Destroy ݹ   
     void RetireTexture(uint32_t texId);
     void ProcessPendingTextureReleases();
-    void ProcessPendingTextureUploadReleases();
 
     // ⺻ ؽó(slot0) 
     void CreateDefaultTexture_Checkerboard();
@@ -181,6 +280,7 @@ private:
     // Pipeline
     Microsoft::WRL::ComPtr<ID3D12RootSignature> m_rootSignature;
     Microsoft::WRL::ComPtr<ID3D12PipelineState> m_pso;
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> m_psoCompact;   // Compact  Է (VS ȭ)
 
     // Debug line pipeline
     Microsoft::WRL::ComPtr<ID3D12PipelineState> m_psoDebugLine;
@@ -190,12 +290,24 @@ private:
     uint64_t m_fenceValues[FrameCount] = {};
     HANDLE m_fenceEvent = nullptr;
 
+    // Copy queue (mesh/texture ε )
+    // - direct queue   (direct copy fence  ٸ)
+    // - allocator Ӻ, Reset   allocator   copy fence Ȯ
+    Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_copyQueue;
+    Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_copyAllocators[FrameCount];
+    Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_copyList;
+    Microsoft::WRL::ComPtr<ID3D12Fence> m_copyFence;
+    uint64_t m_copyFenceValue = 0;
+    uint64_t m_copyAllocatorFence[FrameCount] = {};
+    bool m_copyListOpen = false;
+    bool m_copyAllocatorReset = false;      // ̹ ӿ allocator Reset ߴ
+
     // Viewport / Scissor
     D3D12_VIEWPORT m_viewport{};
     D3D12_RECT     m_scissor{};
 
     // ---------------------------
-    // Constant Buffer (persist-mapped upload)
+    // Constant Buffer ( ε  Ҵ)
     // ---------------------------
     struct DrawCB
     {
@@ -211,21 +323,85 @@ private:
         DirectX::XMFLOAT4X4 view;
         DirectX::XMFLOAT4X4 proj;
         DirectX::XMFLOAT4 cameraPos_numLights; // xyz=cameraPos, w=numLights
-        // Packed lights (FrameLights.h)
-        FrameLight lights[MaxLightsPerFrame];
+        // Light cluster ȸ (LightClusterer.h Ģ)
+        DirectX::XMFLOAT4 clusterScale;        // x = X/width, y = Y/height, z = sliceScale, w = sliceBias
+        uint32_t clusterDims[4];               // xyz = , w = (directional) light 
     };
 
-    Microsoft::WRL::ComPtr<ID3D12Resource> m_frameCB;
-    uint8_t* m_frameCBMapped = nullptr;
-    uint32_t  m_frameCBStride = 0;
-    Microsoft::WRL::ComPtr<ID3D12Resource> m_cb;
-    uint8_t* m_cbMapped = nullptr;
-    uint32_t  m_cbStride = 0;
+    // ̹  FrameCB ּ (RenderUI ٽ ε)
+    D3D12_GPU_VIRTUAL_ADDRESS m_frameCBAddress = 0;
+
+    // ---------------------------
+    // Frame upload ring
+    // - DrawCB / FrameCB / νϽ / debugUI   ⼭  Ҵ
+    // - page ڶ UploadPageSize  þ, fence  page 
+    // ---------------------------
+    static constexpr uint64_t UploadPageSize = 2ull * 1024 * 1024;
 
-    static constexpr uint32_t MaxDrawsPerFrame = 2048;
+    UploadRing m_upload;
+    std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> m_uploadPages; // [page]
 
     // ---------------------------
-    // Debug VB (persist-mapped upload)
+    // Asset streaming (copy queue)
+    // - ó  mesh/texture UploadScheduler ⿭   길ŭ staging ä copy queue  
+    // - staging ring copy  ϳ ""  (EndFrame(copy fence) / BeginFrame(copy Ϸ))
+    // - Ϸ ݹ ĳ resident     texture = ⺻ ؽó, mesh = draw  (CPU/GPU  )
+    // ---------------------------
+    static constexpr uint64_t StagingPageSize = 4ull * 1024 * 1024;
+    static constexpr uint32_t MaxUploadsPerSubmit = 32;
+    static constexpr uint64_t MaxUploadBytesPerSubmit = 8ull * 1024 * 1024;
+    static constexpr uint64_t MaxUploadBytesPerFrame = 16ull * 1024 * 1024;
+
+    UploadRing m_staging;
+    std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> m_stagingPages; // [page]
+    UploadScheduler m_uploadScheduler;
+
+    // ---------------------------
+    // Instancing
+    // - opaque batch DrawIndexedInstanced 1, VS gInstances[instanceBase + SV_InstanceID] 
+    // - DrawCB skybox/debug/UI  
+    // ---------------------------
+    InstanceBatcher m_instanceBatcher;
+    std::vector<uint32_t> m_itemSrvIndices; // [item]  srvIndex (batcher Է)
+    std::vector<uint8_t> m_itemPipelines;   // [item]  mesh GeometryLayout (batcher Է)
+    std::vector<RenderItem> m_residentItems; // mesh    item   (׷ item ִ Ӹ)
+    D3D12_GPU_VIRTUAL_ADDRESS m_instanceAddress = 0;
+
+    // ---------------------------
+    // Clustered lighting
+    // - light 迭 / cluster {offset,count} / light index    ε ring ÷ root SRV(t2~t4) ε
+    // - PS SV_Position.xy + view ̷ cluster ã  ϸ 
+    // ---------------------------
+    LightClusterer m_lightClusterer;
+    D3D12_GPU_VIRTUAL_ADDRESS m_lightsAddress = 0;
+    D3D12_GPU_VIRTUAL_ADDRESS m_lightClustersAddress = 0;
+    D3D12_GPU_VIRTUAL_ADDRESS m_lightIndicesAddress = 0;
+
+    // ε  m_light*Address  ( ־  1 ÷ ּҰ ׻ ȿ)
+    void UploadLightClusters(const FrameLights& lights, const RenderCamera& cam);
+    void BindLightClusters(ID3D12GraphicsCommandList* cl) const;
+
+    // ---------------------------
+    // Parallel command recording
+    // - head(m_commandList: clear/sky)  ûũ list  tail(debug/UI)    
+    // - ûũ list/allocator ûũ , allocator Ӻ (GPU   allocator Reset  )
+    // - Ŀ ĳ map ǵ帮 ʵ mesh ̸ Ǯ m_batchMeshes 
+    // ---------------------------
+    static constexpr uint32_t MaxRecordChunks = 8;
+    static constexpr uint32_t RecordMinBatchesPerChunk = 128;
+
+    JobSystem* m_jobs = nullptr;
+    CommandRecordScheduler m_recordScheduler;
+    std::vector<MeshGPUData*> m_batchMeshes; // [batch]
+
+    Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_recordAllocators[FrameCount][MaxRecordChunks];
+    Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_recordLists[MaxRecordChunks];
+
+    Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_tailAllocators[FrameCount];
+    Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_tailCommandList;
+
+    // ---------------------------
+    // Debug VB ( ε  Ҵ)
     // ---------------------------
     struct DebugVertex
     {
@@ -233,12 +409,41 @@ private:
         DirectX::XMFLOAT4 color;
     };
 
-    Microsoft::WRL::ComPtr<ID3D12Resource> m_debugVB;
-    uint8_t* m_debugVBMapped = nullptr;
-    uint32_t  m_debugVBStride = 0;
+    // ---------------------------
+    // Geometry ް (DEFAULT heap,  mesh )
+    // -  TLSF  Ҵ, mesh ʹ staging ring  copy queue CopyBufferRegion
+    // -   : ۴ COMMON COPY_DEST / VBIB Ͻ °,   COMMON 
+    //   (۴ ׻ simultaneous access copy queue   direct д  ġ  )
+    // - ڶ 2     ,  ۴ frame fence  
+    // -   2 x ε ũ 2   4 (GeometryKind),  layout ȿ IA ״
+    // ---------------------------
+    static constexpr uint32_t GeometryInitialCapacity[GeometryKindCount] =
+    {
+        256u * 1024u,   // Float32  (8MB)
+        256u * 1024u,   // Compact  (4MB)
+        1024u * 1024u,  // 16bit ε (2MB)
+        256u * 1024u,   // 32bit ε (1MB, ū mesh  Ű)
+    };
 
-    static constexpr uint32_t MaxDebugLinesPerFrame = 16384;
-    static constexpr uint32_t MaxDebugVerticesPerFrame = MaxDebugLinesPerFrame * 2;
+    struct GeometryBuffer
+    {
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+        TlsfAllocator allocator;
+        uint32_t stride = 0;
+    };
+
+    struct PendingGeometryRelease
+    {
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+        uint64_t retireFenceValue = 0;
+    };
+
+    GeometryBuffer m_geometry[GeometryKindCount];
+    D3D12_VERTEX_BUFFER_VIEW m_geometryVBViews[2]{};   // [CompactVertices Ʈ]
+    D3D12_INDEX_BUFFER_VIEW  m_geometryIBViews[2]{};   // [Index32 Ʈ]
+    std::vector<PendingGeometryRelease> m_pendingGeometryReleases;
+    uint32_t m_geometryUploadsThisFrame = 0;
+    uint32_t m_geometryGrowths = 0;
 
     // ---------------------------
     // GPU caches
@@ -248,16 +453,14 @@ private:
 
     std::unordered_map<uint32_t, TextureGPUData> m_gpuTextures; // key = TextureHandle.id
     std::vector<PendingTextureRelease> m_pendingTextureReleases;
-    std::vector<PendingTextureUploadRelease> m_pendingTextureUploadReleases;
 
-    // SRV slot allocator (slot 0 is reserved for default texture)
-    uint32_t m_nextSrvIndex = 0;
-
-    // Ÿ ؽó  , "̹  Ŀǵ忡  ε ؽó" 
-    std::vector<uint32_t> m_texturesCreatedThisFrame;
+    // SRV slot Ҵ (slot 0 = ⺻ ؽó ). RetireTexture fence Բ ݳ    
+    // opaque ̴  ü bindless 迭(t0, space1)  InstanceData::textureIndex 
+    static constexpr uint32_t MaxSrvDescriptors = 4096;
+    DescriptorAllocator m_srvAllocator;
 
     // ---------------------------
-    // UI VB (persist-mapped upload)
+    // UI VB ( ε  Ҵ)
     // ---------------------------
     struct UIVertex
     {
@@ -266,13 +469,6 @@ private:
         DirectX::XMFLOAT4 color;
     };
 
-    Microsoft::WRL::ComPtr<ID3D12Resource> m_uiVB;
-    uint8_t* m_uiVBMapped = nullptr;
-    uint32_t m_uiVBStride = 0;
-
-    static constexpr uint32_t MaxUIQuadsPerFrame = 4096;
-    static constexpr uint32_t MaxUIVertsPerFrame = MaxUIQuadsPerFrame * 6;
-
     // UI pipeline
     Microsoft::WRL::ComPtr<ID3D12PipelineState> m_psoUI;
 
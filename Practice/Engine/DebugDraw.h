@@ -2,7 +2,12 @@
 #include <cstdio>
 #include <DirectXMath.h>
 #include <vector>
+#if defined(_WIN32)
 #include <Windows.h>
+#else
+// Windows (Tests ) LOG_ERROR stderrθ
+inline void OutputDebugStringA(const char*) {}
+#endif
 
 #ifndef LOG_ERROR
 #define LOG_ERROR(fmt, ...) do { \
@@ -0,0 +1,82 @@
+﻿#include "DescriptorAllocator.h"
+#include <algorithm>
+
+void DescriptorAllocator::Initialize(uint32_t capacity, uint32_t reserved)
+{
+    m_capacity = capacity;
+    m_reserved = std::min(reserved, capacity);
+    m_next = m_reserved;
+    m_used = 0;
+    m_failures = 0;
+
+    m_state.assign(capacity, SlotState::Unused);
+    m_free.clear();
+    m_retired.clear();
+}
+
+uint32_t DescriptorAllocator::Allocate()
+{
+    uint32_t slot = InvalidSlot;
+    if (!m_free.empty())
+    {
+        slot = m_free.back();
+        m_free.pop_back();
+    }
+    else if (m_next < m_capacity)
+    {
+        slot = m_next++;
+    }
+    else
+    {
+        ++m_failures;
+        return InvalidSlot;
+    }
+
+    m_state[slot] = SlotState::Used;
+    ++m_used;
+    return slot;
+}
+
+bool DescriptorAllocator::Free(uint32_t slot, uint64_t fenceValue)
+{
+    if (!IsAllocated(slot))
+        return false;
+
+    m_state[slot] = SlotState::Pending;
+    --m_used;
+    m_retired.push_back({ slot, fenceValue });
+    return true;
+}
+
+void DescriptorAllocator::Reclaim(uint64_t completedFence)
+{
+    // fence가 호출 순서와 어긋나도(다른 큐 fence 등) 끝난 것은 전부 회수 → 앞에서부터 보되 안 끝난 것은 남김
+    size_t write = 0;
+    for (size_t i = 0; i < m_retired.size(); ++i)
+    {
+        const Retired& r = m_retired[i];
+        if (r.fence <= completedFence)
+        {
+            m_state[r.slot] = SlotState::Free;
+            m_free.push_back(r.slot);
+        }
+        else
+        {
+            m_retired[write++] = r;
+        }
+    }
+    m_retired.resize(write);
+}
+
+DescriptorAllocatorStats DescriptorAllocator::GetStats() const
+{
+    DescriptorAllocatorStats s{};
+    s.capacity = m_capacity;
+    s.reserved = m_reserved;
+    s.used = m_used;
+    s.pending = (uint32_t)m_retired.size();
+    s.free = (uint32_t)m_free.size() + (m_capacity - m_next);
+    s.highWater = m_next;
+    s.failures = m_failures;
+    return s;
+}
@@ -0,0 +1,68 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+// descriptor 힙 slot 할당기
+// - slot [0, reserved)는 고정 용도 (기본 텍스처 등), 나머지 [reserved, capacity)를 나눠 줌
+// - Free(slot, fence): 바로 재사용하지 않고 fence가 끝날 때까지 대기 (GPU가 아직 그 descriptor를 읽을 수 있음)
+//   Reclaim(completed): fence가 끝난 slot만 free 리스트로 (FIFO)
+// - free 리스트는 LIFO (최근에 풀린 slot부터) → 쓰는 구간이 힙 앞쪽에 모여 있음
+// - 처음 쓰는 slot은 앞에서부터 순서대로 (reserved 다음부터)
+struct DescriptorAllocatorStats
+{
+    uint32_t capacity = 0;
+    uint32_t reserved = 0;
+    uint32_t used = 0;              // 나가 있는 slot (reserved 제외)
+    uint32_t pending = 0;           // 풀렸지만 fence 대기 중
+    uint32_t free = 0;              // 바로 줄 수 있는 slot (아직 안 쓴 구간 포함)
+    uint32_t highWater = 0;         // 한 번이라도 쓴 가장 높은 slot + 1
+    uint32_t failures = 0;          // 가득 차서 실패한 Allocate 수 (누적)
+};
+
+class DescriptorAllocator
+{
+public:
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+
+    void Initialize(uint32_t capacity, uint32_t reserved);
+
+    // 실패(빈 slot 없음)하면 InvalidSlot
+    uint32_t Allocate();
+
+    // fenceValue가 끝난 뒤에 재사용. reserved/범위 밖/이미 풀린 slot은 무시 (false)
+    bool Free(uint32_t slot, uint64_t fenceValue);
+
+    // completedFence 이하로 표시된 slot 재활용
+    void Reclaim(uint64_t completedFence);
+
+    bool IsAllocated(uint32_t slot) const { return slot < m_capacity && slot >= m_reserved && m_state[slot] == SlotState::Used; }
+
+    uint32_t GetCapacity() const { return m_capacity; }
+    DescriptorAllocatorStats GetStats() const;
+
+private:
+    enum class SlotState : uint8_t
+    {
+        Unused,     // 아직 안 나간 구간 (m_next 이상)
+        Used,
+        Pending,
+        Free,
+    };
+
+    struct Retired
+    {
+        uint32_t slot = 0;
+        uint64_t fence = 0;
+    };
+
+private:
+    uint32_t m_capacity = 0;
+    uint32_t m_reserved = 0;
+    uint32_t m_next = 0;                // 아직 안 쓴 구간 시작
+    uint32_t m_used = 0;
+    uint32_t m_failures = 0;
+
+    std::vector<SlotState> m_state;     // [slot]
+    std::vector<uint32_t> m_free;
+    std::vector<Retired> m_retired;     // Free 호출 순서 (fence는 보통 오름차순)
+};
@@ -0,0 +1,393 @@
+﻿#include "DynamicAABBTree.h"
+#include <algorithm>
+#include <cassert>
+
+// Helpers
+static inline AABB Union(const AABB& a, const AABB& b)
+{
+    AABB out;
+    out.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+    out.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+    return out;
+}
+
+// SAH 비용: 표면적의 절반(상수배는 비교에 무의미)
+static inline float HalfArea(const AABB& b)
+{
+    const float dx = b.max.x - b.min.x;
+    const float dy = b.max.y - b.min.y;
+    const float dz = b.max.z - b.min.z;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+static inline bool Contains(const AABB& outer, const AABB& inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z
+        && inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+static inline AABB Fatten(const AABB& b, float margin)
+{
+    AABB out;
+    out.min = { b.min.x - margin, b.min.y - margin, b.min.z - margin };
+    out.max = { b.max.x + margin, b.max.y + margin, b.max.z + margin };
+    return out;
+}
+
+DynamicAABBTree::DynamicAABBTree()
+{
+    m_nodes.reserve(64);
+}
+
+void DynamicAABBTree::Clear()
+{
+    m_nodes.clear();
+    m_root = NullNode;
+    m_freeList = NullNode;
+    m_proxyCount = 0;
+}
+
+int32_t DynamicAABBTree::AllocateNode()
+{
+    if (m_freeList == NullNode)
+    {
+        m_nodes.emplace_back();
+        return (int32_t)m_nodes.size() - 1;
+    }
+
+    const int32_t id = m_freeList;
+    m_freeList = m_nodes[id].parent; // free list next
+    m_nodes[id] = Node{};
+    return id;
+}
+
+void DynamicAABBTree::FreeNode(int32_t id)
+{
+    Node& n = m_nodes[id];
+    n.parent = m_freeList;
+    n.child1 = NullNode;
+    n.child2 = NullNode;
+    n.height = -1;
+    m_freeList = id;
+}
+
+int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, uint32_t userData)
+{
+    const int32_t id = AllocateNode();
+    Node& n = m_nodes[id];
+    n.aabb = Fatten(aabb, m_margin);
+    n.userData = userData;
+    n.height = 0;
+
+    InsertLeaf(id);
+    ++m_proxyCount;
+    return id;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+{
+#if defined(_DEBUG)
+    assert(proxyId >= 0 && proxyId < (int32_t)m_nodes.size());
+    assert(m_nodes[proxyId].IsLeaf() && m_nodes[proxyId].height == 0);
+#endif
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxyCount;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& aabb, const XMFLOAT3& displacement)
+{
+    Node& n = m_nodes[proxyId];
+    if (Contains(n.aabb, aabb))
+        return false;
+
+    RemoveLeaf(proxyId);
+
+    // 이동 방향으로 조금 더 늘려서(예측) 다음 스텝 재삽입 확률을 줄임
+    // 순간이동(한 축이라도 상한 초과)은 다음 스텝 이동을 예측할 근거가 아님 → 거대한 fat box로 pair가 폭증하지 않게 확장 없음
+    AABB fat = Fatten(aabb, m_margin);
+    const float limit = m_maxPredictedDisplacement;
+    const bool teleported = std::fabs(displacement.x) > limit || std::fabs(displacement.y) > limit || std::fabs(displacement.z) > limit;
+    if (!teleported)
+    {
+        const float k = 2.0f;
+        const XMFLOAT3 d{ displacement.x * k, displacement.y * k, displacement.z * k };
+        if (d.x < 0.0f) fat.min.x += d.x; else fat.max.x += d.x;
+        if (d.y < 0.0f) fat.min.y += d.y; else fat.max.y += d.y;
+        if (d.z < 0.0f) fat.min.z += d.z; else fat.max.z += d.z;
+    }
+
+    m_nodes[proxyId].aabb = fat;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+    if (m_root == NullNode)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    // 1) sibling 찾기: 표면적 증가 비용이 최소가 되는 방향으로 내려감
+    const AABB leafAABB = m_nodes[leaf].aabb;
+    int32_t index = m_root;
+    while (!m_nodes[index].IsLeaf())
+    {
+        const Node& n = m_nodes[index];
+        const int32_t c1 = n.child1;
+        const int32_t c2 = n.child2;
+
+        const float area = HalfArea(n.aabb);
+        const float combinedArea = HalfArea(Union(n.aabb, leafAABB));
+
+        // 여기서 새 부모를 만들 때 비용
+        const float cost = 2.0f * combinedArea;
+        // 아래로 내려갈 때 조상들이 부담하는 최소 비용
+        const float inheritance = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t c) -> float
+            {
+                const Node& cn = m_nodes[c];
+                const float newArea = HalfArea(Union(leafAABB, cn.aabb));
+                if (cn.IsLeaf())
+                    return newArea + inheritance;
+                return (newArea - HalfArea(cn.aabb)) + inheritance;
+            };
+
+        const float cost1 = childCost(c1);
+        const float cost2 = childCost(c2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = (cost1 < cost2) ? c1 : c2;
+    }
+
+    const int32_t sibling = index;
+
+    // 2) 새 부모 노드 생성
+    const int32_t oldParent = m_nodes[sibling].parent;
+    const int32_t newParent = AllocateNode();
+    {
+        Node& np = m_nodes[newParent];
+        np.parent = oldParent;
+        np.aabb = Union(leafAABB, m_nodes[sibling].aabb);
+        np.height = m_nodes[sibling].height + 1;
+        np.child1 = sibling;
+        np.child2 = leaf;
+    }
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != NullNode)
+    {
+        if (m_nodes[oldParent].child1 == sibling) m_nodes[oldParent].child1 = newParent;
+        else                                      m_nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    // 3) 위로 올라가며 AABB/높이 갱신 + 균형
+    index = m_nodes[leaf].parent;
+    while (index != NullNode)
+    {
+        index = Balance(index);
+
+        Node& n = m_nodes[index];
+        const Node& c1 = m_nodes[n.child1];
+        const Node& c2 = m_nodes[n.child2];
+        n.height = 1 + std::max(c1.height, c2.height);
+        n.aabb = Union(c1.aabb, c2.aabb);
+
+        index = n.parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = NullNode;
+        return;
+    }
+
+    const int32_t parent = m_nodes[leaf].parent;
+    const int32_t grandParent = m_nodes[parent].parent;
+    const int32_t sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != NullNode)
+    {
+        // parent 제거, sibling을 grandParent에 직접 연결
+        if (m_nodes[grandParent].child1 == parent) m_nodes[grandParent].child1 = sibling;
+        else                                       m_nodes[grandParent].child2 = sibling;
+        m_nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        int32_t index = grandParent;
+        while (index != NullNode)
+        {
+            index = Balance(index);
+
+            Node& n = m_nodes[index];
+            const Node& c1 = m_nodes[n.child1];
+            const Node& c2 = m_nodes[n.child2];
+            n.aabb = Union(c1.aabb, c2.aabb);
+            n.height = 1 + std::max(c1.height, c2.height);
+
+            index = n.parent;
+        }
+    }
+    else
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = NullNode;
+        FreeNode(parent);
+    }
+
+    m_nodes[leaf].parent = NullNode;
+}
+
+// a가 불균형(자식 높이 차 > 1)이면 회전. 회전 후 서브트리의 새 루트를 반환
+int32_t DynamicAABBTree::Balance(int32_t iA)
+{
+    Node& A = m_nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+        return iA;
+
+    const int32_t iB = A.child1;
+    const int32_t iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+
+    const int32_t balance = C.height - B.height;
+
+    // C를 위로 올림
+    if (balance > 1)
+    {
+        const int32_t iF = C.child1;
+        const int32_t iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != NullNode)
+        {
+            if (m_nodes[C.parent].child1 == iA) m_nodes[C.parent].child1 = iC;
+            else                                m_nodes[C.parent].child2 = iC;
+        }
+        else
+        {
+            m_root = iC;
+        }
+
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.aabb = Union(B.aabb, G.aabb);
+            C.aabb = Union(A.aabb, F.aabb);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.aabb = Union(B.aabb, F.aabb);
+            C.aabb = Union(A.aabb, G.aabb);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+        return iC;
+    }
+
+    // B를 위로 올림
+    if (balance < -1)
+    {
+        const int32_t iD = B.child1;
+        const int32_t iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != NullNode)
+        {
+            if (m_nodes[B.parent].child1 == iA) m_nodes[B.parent].child1 = iB;
+            else                                m_nodes[B.parent].child2 = iB;
+        }
+        else
+        {
+            m_root = iB;
+        }
+
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.aabb = Union(C.aabb, E.aabb);
+            B.aabb = Union(A.aabb, D.aabb);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.aabb = Union(C.aabb, D.aabb);
+            B.aabb = Union(A.aabb, E.aabb);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+bool DynamicAABBTree::Validate() const
+{
+    if (m_root == NullNode)
+        return m_proxyCount == 0;
+
+    return ValidateNode(m_root, NullNode) >= 0;
+}
+
+// 반환: 서브트리 높이 (구조가 깨졌으면 -1)
+int32_t DynamicAABBTree::ValidateNode(int32_t id, int32_t parent) const
+{
+    const Node& n = m_nodes[id];
+    if (n.parent != parent)
+        return -1;
+
+    if (n.IsLeaf())
+        return (n.height == 0) ? 0 : -1;
+
+    const int32_t h1 = ValidateNode(n.child1, id);
+    const int32_t h2 = ValidateNode(n.child2, id);
+    if (h1 < 0 || h2 < 0)
+        return -1;
+
+    if (n.height != 1 + std::max(h1, h2))
+        return -1;
+
+    if (!Contains(n.aabb, m_nodes[n.child1].aabb) || !Contains(n.aabb, m_nodes[n.child2].aabb))
+        return -1;
+
+    return n.height;
+}
@@ -0,0 +1,223 @@
+﻿#pragma once
+#include "PhysicsTypes.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Broadphase용 동적 AABB 트리 (fat AABB + 증분 갱신)
+// - leaf는 실제 AABB보다 margin만큼 크게(fat) 저장 → 조금 움직인 정도로는 트리를 건드리지 않음
+// - fat AABB를 벗어난 경우에만 remove + reinsert
+// - 삽입 시 표면적(SAH) 비용으로 sibling 선택, 회전(AVL 스타일)으로 높이 균형 유지
+class DynamicAABBTree
+{
+public:
+    static constexpr int32_t NullNode = -1;
+
+    DynamicAABBTree();
+
+    void SetMargin(float margin) { m_margin = margin; }
+    float GetMargin() const { return m_margin; }
+
+    // 예측 확장을 하는 한 축 이동량 상한. 이보다 크게 움직였으면 순간이동으로 보고 확장 없이 margin만
+    void SetMaxPredictedDisplacement(float d) { m_maxPredictedDisplacement = d; }
+    float GetMaxPredictedDisplacement() const { return m_maxPredictedDisplacement; }
+
+    // proxy 생성/삭제 (userData는 호출자가 해석: 보통 entity index)
+    int32_t CreateProxy(const AABB& aabb, uint32_t userData);
+    void DestroyProxy(int32_t proxyId);
+
+    // tight AABB가 fat AABB 안이면 false(트리 변경 없음), 벗어나면 재삽입 후 true
+    // displacement: 이번 스텝 이동량(예측 확장용, 0이거나 순간이동이면 margin만)
+    bool MoveProxy(int32_t proxyId, const AABB& aabb, const XMFLOAT3& displacement);
+
+    const AABB& GetFatAABB(int32_t proxyId) const { return m_nodes[proxyId].aabb; }
+    uint32_t GetUserData(int32_t proxyId) const { return m_nodes[proxyId].userData; }
+
+    void Clear();
+
+    // fat AABB와 겹치는 모든 leaf에 대해 cb(proxyId) 호출. cb가 false를 반환하면 중단
+    template<typename Fn>
+    void Query(const AABB& aabb, Fn&& cb) const;
+
+    // origin + t*dir (0 <= t <= maxT)와 겹치는 leaf마다 cb(proxyId, maxT) 호출 (가까운 자식부터 순회)
+    // cb 반환값: 계속할 maxT(더 가까운 hit이면 줄여서 반환 → 가지치기), 0 이하면 즉시 종료
+    template<typename Fn>
+    void RayCast(const XMFLOAT3& origin, const XMFLOAT3& dir, float maxT, Fn&& cb) const;
+
+    int32_t GetRoot() const { return m_root; }
+    int32_t GetProxyCount() const { return m_proxyCount; }
+    int32_t GetHeight() const { return (m_root == NullNode) ? 0 : m_nodes[m_root].height; }
+
+    // 디버그: 부모/자식 링크, 높이, AABB 포함관계 검사
+    bool Validate() const;
+
+    static bool Overlaps(const AABB& a, const AABB& b)
+    {
+        if (a.max.x < b.min.x || a.min.x > b.max.x) return false;
+        if (a.max.y < b.min.y || a.min.y > b.max.y) return false;
+        if (a.max.z < b.min.z || a.min.z > b.max.z) return false;
+        return true;
+    }
+
+    // slab 테스트. invDir은 0 성분 대신 큰 값(±1e30)을 넣어둔 역방향
+    static bool RayOverlaps(const XMFLOAT3& o, const XMFLOAT3& invDir, float maxT, const AABB& b, float& outEnter)
+    {
+        float t1 = (b.min.x - o.x) * invDir.x, t2 = (b.max.x - o.x) * invDir.x;
+        float tmin = (t1 < t2) ? t1 : t2;
+        float tmax = (t1 < t2) ? t2 : t1;
+
+        t1 = (b.min.y - o.y) * invDir.y; t2 = (b.max.y - o.y) * invDir.y;
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+
+        t1 = (b.min.z - o.z) * invDir.z; t2 = (b.max.z - o.z) * invDir.z;
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+
+        if (tmax < 0.0f || tmin > tmax || tmin > maxT)
+            return false;
+
+        outEnter = std::max(tmin, 0.0f);
+        return true;
+    }
+
+    static XMFLOAT3 SafeInverse(const XMFLOAT3& d)
+    {
+        auto inv = [](float v) { return (std::fabs(v) > 1e-12f) ? 1.0f / v : (v < 0.0f ? -1e30f : 1e30f); };
+        return { inv(d.x), inv(d.y), inv(d.z) };
+    }
+
+private:
+    // 순회용 스택: 대부분 배열로 충분(균형 트리 높이 ~ 2log2(n)), 넘치면 vector로
+    class NodeStack
+    {
+    public:
+        void Push(int32_t id)
+        {
+            if (m_count < LocalCap) m_local[m_count] = id;
+            else m_overflow.push_back(id);
+            ++m_count;
+        }
+        int32_t Pop()
+        {
+            --m_count;
+            if (m_count < LocalCap) return m_local[m_count];
+            const int32_t id = m_overflow.back();
+            m_overflow.pop_back();
+            return id;
+        }
+        bool Empty() const { return m_count == 0; }
+
+    private:
+        static constexpr int32_t LocalCap = 256;
+        int32_t m_local[LocalCap];
+        std::vector<int32_t> m_overflow;
+        int32_t m_count = 0;
+    };
+
+    struct Node
+    {
+        AABB aabb{};
+        int32_t parent = NullNode;  // free list일 때는 next로 사용
+        int32_t child1 = NullNode;
+        int32_t child2 = NullNode;
+        int32_t height = -1;        // leaf = 0, free = -1
+        uint32_t userData = 0;
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t id);
+
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t a);
+
+    int32_t ValidateNode(int32_t id, int32_t parent) const;
+
+private:
+    std::vector<Node> m_nodes;
+    int32_t m_root = NullNode;
+    int32_t m_freeList = NullNode;
+    int32_t m_proxyCount = 0;
+
+    float m_margin = 0.1f;
+    float m_maxPredictedDisplacement = 1.0f;    // → 예측 확장은 축마다 최대 2.0
+};
+
+template<typename Fn>
+void DynamicAABBTree::Query(const AABB& aabb, Fn&& cb) const
+{
+    if (m_root == NullNode)
+        return;
+
+    NodeStack stack;
+    stack.Push(m_root);
+    while (!stack.Empty())
+    {
+        const int32_t id = stack.Pop();
+        const Node& n = m_nodes[id];
+        if (!Overlaps(n.aabb, aabb))
+            continue;
+
+        if (n.IsLeaf())
+        {
+            if (!cb(id))
+                return;
+        }
+        else
+        {
+            stack.Push(n.child1);
+            stack.Push(n.child2);
+        }
+    }
+}
+
+template<typename Fn>
+void DynamicAABBTree::RayCast(const XMFLOAT3& origin, const XMFLOAT3& dir, float maxT, Fn&& cb) const
+{
+    if (m_root == NullNode)
+        return;
+
+    const XMFLOAT3 invDir = SafeInverse(dir);
+
+    float tEnter = 0.0f;
+    if (!RayOverlaps(origin, invDir, maxT, m_nodes[m_root].aabb, tEnter))
+        return;
+
+    NodeStack stack;
+    stack.Push(m_root);
+    while (!stack.Empty())
+    {
+        const int32_t id = stack.Pop();
+        const Node& n = m_nodes[id];
+
+        // push 이후 maxT가 줄었을 수 있으니 다시 확인
+        if (!RayOverlaps(origin, invDir, maxT, n.aabb, tEnter))
+            continue;
+
+        if (n.IsLeaf())
+        {
+            const float t = cb(id, maxT);
+            if (t <= 0.0f)
+                return;
+            maxT = std::min(maxT, t);
+            continue;
+        }
+
+        float t1 = 0.0f, t2 = 0.0f;
+        const bool hit1 = RayOverlaps(origin, invDir, maxT, m_nodes[n.child1].aabb, t1);
+        const bool hit2 = RayOverlaps(origin, invDir, maxT, m_nodes[n.child2].aabb, t2);
+
+        // 먼 쪽을 먼저 push → 가까운 쪽이 먼저 pop
+        if (hit1 && hit2)
+        {
+            if (t1 <= t2) { stack.Push(n.child2); stack.Push(n.child1); }
+            else          { stack.Push(n.child1); stack.Push(n.child2); }
+        }
+        else if (hit1) stack.Push(n.child1);
+        else if (hit2) stack.Push(n.child2);
+    }
+}
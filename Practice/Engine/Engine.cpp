@@ -1,11 +1,84 @@
 ﻿#include <Windows.h>
 #include "Application.h"
+#include "BenchReport.h"
+#include "ImportRegistry.h"
+#include "JobSystem.h"
+#include "MeshOptimizeReport.h"
+#include "ObjImporter_Minimal.h"
+#include "PhysicsBench.h"
+#include <cwchar>
+#include <fstream>
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     _In_opt_ HINSTANCE /*hPrevInstance*/,
-    _In_ LPWSTR /*lpCmdLine*/,
+    _In_ LPWSTR lpCmdLine,
     _In_ int /*nCmdShow*/)
 {
+    // --mesh-report: 창 없이 Assets/Model의 mesh 최적화 전후 ACMR/ATVR만 기록하고 종료
+    if (lpCmdLine && std::wcsstr(lpCmdLine, L"--mesh-report"))
+    {
+        ImportRegistry registry;
+        registry.Register(std::make_unique<ObjImporter_Minimal>());
+
+        const std::string text = FormatMeshOptimizeReport(RunMeshOptimizeReport(registry, "Assets/Model", ImportOptions{}));
+        std::ofstream("MeshOptimizeReport.txt") << text;
+        OutputDebugStringA(text.c_str());
+        return 0;
+    }
+
+    // --physics-bench [steps]: 창 없이 1k/5k/20k body 브로드페이즈(BruteForce vs DynamicTree) 처리량 +
+    //                           10k body 스레드 수별 Step 스케일링 +
+    //                           1k/5k/20k collider Raycast/Overlap 쿼리(선형 스캔 vs 트리) 기록하고 종료
+    if (lpCmdLine)
+    {
+        if (const wchar_t* arg = std::wcsstr(lpCmdLine, L"--physics-bench"))
+        {
+            uint32_t steps = (uint32_t)std::wcstoul(arg + std::wcslen(L"--physics-bench"), nullptr, 10);
+            if (steps == 0)
+                steps = 10;
+
+            const std::string text = FormatPhysicsBench(RunPhysicsBench({ 1000, 5000, 20000 }, steps)) + "\n" +
+                FormatPhysicsScalingBench(RunPhysicsScalingBench(10000, steps)) + "\n" +
+                FormatPhysicsQueryBench(RunPhysicsQueryBench({ 1000, 5000, 20000 }, 2000));
+            std::ofstream("PhysicsBench.txt") << text;
+            OutputDebugStringA(text.c_str());
+            return 0;
+        }
+    }
+
+    // --bench: 창 없이 transform / 저장소 / 컬링 / RenderItem / 정렬 / light / 오클루전 벤치를 한 번씩 돌려 기록하고 종료
+    if (lpCmdLine && std::wcsstr(lpCmdLine, L"--bench"))
+    {
+        JobSystem jobs;
+        jobs.Initialize();
+        const std::string text = FormatBenchReport(RunBenchReport(&jobs));
+        jobs.Shutdown();
+
+        std::ofstream("Bench.txt") << text;
+        OutputDebugStringA(text.c_str());
+        return 0;
+    }
+
+    // --frame-bench [frames]: 창/GPU 없이(NullRenderer) 첫 Scene을 고정 dt로 돌려 프레임 단계별 CPU 시간 기록하고 종료
+    if (lpCmdLine)
+    {
+        if (const wchar_t* arg = std::wcsstr(lpCmdLine, L"--frame-bench"))
+        {
+            uint32_t frames = (uint32_t)std::wcstoul(arg + std::wcslen(L"--frame-bench"), nullptr, 10);
+            if (frames == 0)
+                frames = 600;
+
+            Application app;
+            app.InitializeHeadless(1280, 720);
+            const std::string text = FormatFrameBench(app.RunHeadless(frames));
+            app.Shutdown();
+
+            std::ofstream("FrameBench.txt") << text;
+            OutputDebugStringA(text.c_str());
+            return 0;
+        }
+    }
+
     Application app;
     app.Initialize(hInstance);
     app.Run();
@@ -0,0 +1,45 @@
+#include "FrameBench.h"
+#include <algorithm>
+#include <cstdio>
+
+std::string FormatFrameBench(const FrameBenchResult& r)
+{
+    const double n = (double)std::max(r.frames, 1u);
+
+    char line[512];
+    std::snprintf(line, sizeof(line), "frames %u | %ux%u | dt %.4f s | fixed steps %u\n", r.frames, r.width, r.height, r.dt, r.fixedSteps);
+    std::string out = line;
+
+    out += "phase | avg ms | max ms\n";
+    auto phase = [&](const char* name, const FramePhaseTiming& t)
+        {
+            std::snprintf(line, sizeof(line), "%s | %.3f | %.3f\n", name, t.totalMs / n, t.maxMs);
+            out += line;
+        };
+    phase("frame", r.frame);
+    phase("scene", r.scene);
+    phase("fixed", r.fixed);
+    phase("transforms", r.transforms);
+    phase("systems", r.systems);
+    phase("lights", r.lights);
+    phase("render", r.render);
+    phase("endFrame", r.endFrame);
+
+    const NullRenderStats& s = r.lastFrame;
+    std::snprintf(line, sizeof(line), "last frame: entities %u | items %u | batches %u | instances %u | tris %llu | pipeline/texture/mesh changes %u/%u/%u\n",
+        r.entities, s.items, s.batches, s.instances, (unsigned long long)s.triangles, s.pipelineChanges, s.textureChanges, s.meshChanges);
+    out += line;
+    std::snprintf(line, sizeof(line), "last frame: lights %u (cluster indices %u) | skybox %u | ui %u | text %u (%u chars)\n",
+        s.lights, s.lightIndices, s.skyboxDraws, s.uiItems, s.textDraws, s.textChars);
+    out += line;
+
+    const NullRenderStats& t = r.total;
+    std::snprintf(line, sizeof(line), "avg per frame: items %.1f | batches %.1f | tris %.1f | validation errors %u\n",
+        t.items / n, t.batches / n, (double)t.triangles / n, t.errors);
+    out += line;
+
+    for (const std::string& err : r.errors)
+        out += "error: " + err + "\n";
+
+    return out;
+}
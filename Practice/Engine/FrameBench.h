@@ -0,0 +1,50 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "NullRenderer.h"
+
+// 헤드리스 프레임 벤치 결과 (창/GPU 없이 Application 프레임을 N번, 렌더러는 NullRenderer)
+// - 실행: Engine.exe --frame-bench [frames]  → FrameBench.txt
+// - dt는 고정 (실시간 아님) → 같은 scene이면 프레임마다 같은 일을 함
+// - World → 렌더 경로(transforms, RenderSystem::Build, lights, Render)는 FrameLoop. Scene/물리/오디오/UI만 Application 몫
+//   FrameLoop + NullRenderer는 플랫폼 의존이 없어서 Practice/Tests(FrameLoopTests)에서도 같은 경로를 돎
+struct FramePhaseTiming
+{
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+
+    void Add(double ms)
+    {
+        totalMs += ms;
+        maxMs = (ms > maxMs) ? ms : maxMs;
+    }
+};
+
+struct FrameBenchResult
+{
+    uint32_t frames = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    double dt = 0.0;
+
+    // Application::Run 순서
+    FramePhaseTiming frame;         // 아래 전부
+    FramePhaseTiming scene;         // UpdateScene
+    FramePhaseTiming fixed;         // TickFixed (FixedUpdate + 물리)
+    FramePhaseTiming transforms;    // UpdateTransforms
+    FramePhaseTiming systems;       // UpdateSystems (오디오, RenderSystem::Build, UI)
+    FramePhaseTiming lights;        // BuildFrameLights
+    FramePhaseTiming render;        // IRenderer::Render (NullRenderer 검증/배칭/light cluster)
+    FramePhaseTiming endFrame;      // EndFrame (지연 파괴)
+
+    uint32_t fixedSteps = 0;
+
+    uint32_t entities = 0;          // 마지막 프레임 RenderSystem (Transform + Mesh)
+
+    NullRenderStats lastFrame{};
+    NullRenderStats total{};
+    std::vector<std::string> errors;    // NullRenderer 검증 메시지 (앞쪽 일부)
+};
+
+std::string FormatFrameBench(const FrameBenchResult& result);
@@ -2,11 +2,13 @@
 
 #include <DirectXMath.h>
 #include <cstdint>
+#include <vector>
 
 // CPU-side light data passed from RenderSystem/Application to the renderer.
-// This is intentionally simple POD so it can be copied into GPU constant buffer easily.
+// Lights are uploaded as a StructuredBuffer and binned into view clusters (LightClusterer),
+// so each pixel only loops over the lights that can reach it.
 
-static constexpr uint32_t MaxLightsPerFrame = 32;
+static constexpr uint32_t MaxLightsPerFrame = 4096;
 
 struct FrameLight
 {
@@ -32,7 +34,6 @@ struct FrameLight
 struct FrameLights
 {
     DirectX::XMFLOAT3 cameraPosWS = { 0, 0, 0 };
-    uint32_t numLights = 0;
 
-    FrameLight lights[MaxLightsPerFrame]{};
+    std::vector<FrameLight> lights; // at most MaxLightsPerFrame
 };
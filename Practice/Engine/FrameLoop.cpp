@@ -0,0 +1,138 @@
+﻿#include "FrameLoop.h"
+#include "IRenderer.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+void FrameLoop::SetViewSize(uint32_t width, uint32_t height)
+{
+    m_width = std::max(width, 1u);
+    m_height = std::max(height, 1u);
+}
+
+void FrameLoop::BeginFrame()
+{
+    m_world.BeginFrame();
+}
+
+void FrameLoop::UpdateTransforms()
+{
+    m_world.UpdateTransforms();
+}
+
+void FrameLoop::BuildRenderItems()
+{
+    // 컬링과 렌더가 같은 카메라를 쓰도록 여기서 한 번만 만듦
+    m_camera = BuildRenderCamera(m_world, m_width, m_height);
+    m_renderSystem.Build(m_world, m_camera, m_renderItems);
+}
+
+void FrameLoop::BuildLights()
+{
+    BuildFrameLights(m_world, m_camera, m_frameLights);
+}
+
+void FrameLoop::Submit(TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text)
+{
+    if (m_renderer)
+        m_renderer->Render(m_renderItems, m_camera, m_frameLights, skybox, ui, text);
+}
+
+void FrameLoop::RunFrame()
+{
+    BeginFrame();
+    UpdateTransforms();
+    BuildRenderItems();
+    BuildLights();
+    Submit(TextureHandle{}, m_noUI, m_noText);
+}
+
+RenderCamera FrameLoop::BuildRenderCamera(const World& world, uint32_t width, uint32_t height)
+{
+    RenderCamera out{};
+    const float aspect = float(std::max(width, 1u)) / float(std::max(height, 1u));
+
+    // 1) 활성 카메라 찾기 (정책: 첫 CameraComponent 가진 엔티티)
+    EntityId camEnt = world.FindActiveCamera();
+    if (!world.IsAlive(camEnt) || !world.HasTransform(camEnt) || !world.HasCamera(camEnt))
+    {
+        // 폴백: 임시 카메라
+        XMMATRIX V = XMMatrixLookAtLH(
+            XMVectorSet(0.f, 0.f, -6.f, 1.f),
+            XMVectorSet(0.f, 0.8f, 0.f, 1.f),
+            XMVectorSet(0.f, 1.f, 0.f, 0.f));
+        XMMATRIX P = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.f), aspect, 0.1f, 1000.f);
+
+        XMStoreFloat4x4(&out.view, V);
+        XMStoreFloat4x4(&out.proj, P);
+        out.positionWS = XMFLOAT3(0.f, 0.f, -6.f);
+        return out;
+    }
+
+    const auto& camT = world.GetTransform(camEnt);
+    const auto& camC = world.GetCamera(camEnt);
+
+    // 2) camera pos/rot로 LookToLH 뷰 구성 (관례 꼬임 방지)
+    XMFLOAT3 p = camT.position;
+    XMFLOAT4 q = camT.rotation;
+    out.positionWS = p;
+
+    XMVECTOR pos = XMVectorSet(p.x, p.y, p.z, 1.0f);
+    XMVECTOR quat = XMVectorSet(q.x, q.y, q.z, q.w);
+
+    // 엔진의 "카메라 기본 전방"을 +Z로 가정(LH)
+    XMVECTOR fwd = XMVector3Rotate(XMVectorSet(0, 0, 1, 0), quat);
+    XMVECTOR up = XMVector3Rotate(XMVectorSet(0, 1, 0, 0), quat);
+
+    XMMATRIX V = XMMatrixLookToLH(pos, fwd, up);
+
+    // 3) Projection 만들기
+    XMMATRIX P = XMMatrixPerspectiveFovLH(camC.FovYRadians(), aspect, camC.nearZ, camC.farZ);
+
+    XMStoreFloat4x4(&out.view, V);
+    XMStoreFloat4x4(&out.proj, P);
+    return out;
+}
+
+void FrameLoop::BuildFrameLights(const World& world, const RenderCamera& cam, FrameLights& out)
+{
+    out.cameraPosWS = cam.positionWS;
+    out.lights.clear();
+
+    const auto& ents = world.GetLightEntities();
+    const auto& dense = world.GetLightsDense();
+
+    const uint32_t n = (uint32_t)std::min<size_t>(ents.size(), dense.size());
+
+    for (uint32_t i = 0; i < n && out.lights.size() < MaxLightsPerFrame; ++i)
+    {
+        const EntityId e = ents[i];
+        const LightComponent& lc = dense[i];
+        if (!lc.enabled) continue;
+        if (!world.HasTransform(e)) continue;
+
+        const auto& tr = world.GetTransform(e);
+
+        FrameLight& L = out.lights.emplace_back();
+        L.type = (uint32_t)lc.type;
+
+        // Color/intensity
+        L.color = lc.color;
+        L.intensity = lc.intensity;
+
+        // World-space position (translation of world matrix)
+        L.positionWS = XMFLOAT3(tr.world._41, tr.world._42, tr.world._43);
+        L.range = lc.range;
+
+        // World-space direction: transform +Z by world matrix
+        XMMATRIX W = XMLoadFloat4x4(&tr.world);
+        XMVECTOR dir = XMVector3Normalize(XMVector3TransformNormal(XMVectorSet(0, 0, 1, 0), W));
+        XMStoreFloat3(&L.directionWS, dir);
+
+        // Spot cone (cos of half angles)
+        L.innerCos = cosf(lc.innerAngleRad * 0.5f);
+        L.outerCos = cosf(lc.outerAngleRad * 0.5f);
+    }
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "World.h"
+#include "RenderSystem.h"
+#include "RenderItem.h"
+#include "RenderCamera.h"
+#include "FrameLights.h"
+#include "UIDrawItem.h"
+#include "UITextDraw.h"
+#include "TextureHandle.h"
+
+class IRenderer;
+
+// 한 프레임의 World → 렌더 경로: World::BeginFrame → UpdateTransforms → RenderSystem::Build → BuildFrameLights → IRenderer::Render
+// - Win32/오디오/Scene 의존 없음 → Application(창, 헤드리스)과 Practice/Tests가 같은 코드를 돎
+// - 단계별로 나눠 둠: Application은 사이사이 자기 단계(Scene, TickFixed, 오디오, UI)를 끼우고 단계별 시간을 잼
+// - RunFrame은 전부 한 번 (UI/skybox 없이), 테스트/벤치용
+class FrameLoop
+{
+public:
+    FrameLoop(World& world, RenderSystem& renderSystem) : m_world(world), m_renderSystem(renderSystem) {}
+
+    void SetRenderer(IRenderer* renderer) { m_renderer = renderer; }
+    IRenderer* GetRenderer() const { return m_renderer; }
+
+    // 투영 aspect용 (0이면 1로)
+    void SetViewSize(uint32_t width, uint32_t height);
+    uint32_t GetViewWidth() const { return m_width; }
+    uint32_t GetViewHeight() const { return m_height; }
+
+    void BeginFrame();          // World::BeginFrame
+    void UpdateTransforms();    // World::UpdateTransforms
+    void BuildRenderItems();    // 활성 카메라 → RenderSystem::Build (컬링)
+    void BuildLights();         // 켜진 Light → FrameLights (카메라는 BuildRenderItems 것)
+    void Submit(TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text);
+
+    void RunFrame();
+
+    const RenderCamera& GetCamera() const { return m_camera; }
+    const std::vector<RenderItem>& GetRenderItems() const { return m_renderItems; }
+    const FrameLights& GetFrameLights() const { return m_frameLights; }
+
+    // 첫 활성 CameraComponent (없으면 (0,0,-6)에서 보는 임시 카메라)
+    static RenderCamera BuildRenderCamera(const World& world, uint32_t width, uint32_t height);
+    // out.lights 용량은 프레임 간 재사용. MaxLightsPerFrame에서 자름
+    static void BuildFrameLights(const World& world, const RenderCamera& cam, FrameLights& out);
+
+private:
+    World& m_world;
+    RenderSystem& m_renderSystem;
+    IRenderer* m_renderer = nullptr;
+
+    uint32_t m_width = 1;
+    uint32_t m_height = 1;
+
+    RenderCamera m_camera{};
+    std::vector<RenderItem> m_renderItems;
+    FrameLights m_frameLights;
+
+    // RunFrame용 빈 UI 목록
+    std::vector<UIDrawItem> m_noUI;
+    std::vector<UITextDraw> m_noText;
+};
@@ -1,6 +1,5 @@
 #pragma once
 #include <cstdint>
-#include <Windows.h>
 #include <vector>
 
 #include "RenderItem.h"
@@ -14,7 +13,8 @@ class IRenderer
 public:
     virtual ~IRenderer() = default;
 
-    virtual void Initialize(HWND hwnd, uint32_t width, uint32_t height) = 0;
+    // nativeWindow: ÷ â ڵ (Win32 HWND). â  (NullRenderer) nullptr
+    virtual void Initialize(void* nativeWindow, uint32_t width, uint32_t height) = 0;
     virtual void Resize(uint32_t width, uint32_t height) = 0;
 
     //  (ο Ʈ ޱ)
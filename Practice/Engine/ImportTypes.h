@@ -93,4 +93,20 @@ struct ImportOptions
     bool generateTangentsIfMissing = false;
 
     float uniformScale = 1.0f;
+
+    // GPU  16byte ȭ  (MeshCPUData.h MeshVertexFormat::Compact)
+    bool compactVertices = true;
+
+    // import  vertex cache/fetch  ȭ (MeshOptimizer.h)
+    bool optimizeMesh = true;
+    // ȭ  overdraw  cluster ı (ACMR 5% Ѱ  ǳʶ)
+    bool optimizeOverdraw = true;
+
+    // QEM ܼȭ LOD (LOD0  , 1̸  . MeshMaxLods )
+    uint32_t lodCount = 4;
+    float lodReduction = 0.5f;      // ܰ踶 ﰢ 
+    float lodMaxError = 0.02f;      // mesh ũ    (  ܰ迡 )
+
+    // LOD0  meshlet(64/124ﰢ)  ġ + cluster ø bounds/cone (MeshletBuilder.h)
+    bool buildMeshlets = true;
 };
@@ -14,6 +14,18 @@ static int ToVK(Key k)
     case Key::E: return 'E';
 	case Key::R: return 'R';
 	case Key::G: return 'G';
+	case Key::B: return 'B';
+	case Key::N: return 'N';
+	case Key::M: return 'M';
+	case Key::J: return 'J';
+	case Key::H: return 'H';
+	case Key::K: return 'K';
+	case Key::V: return 'V';
+	case Key::L: return 'L';
+	case Key::O: return 'O';
+	case Key::P: return 'P';
+	case Key::C: return 'C';
+	case Key::F: return 'F';
     case Key::Up: return VK_UP;
     case Key::Down: return VK_DOWN;
     case Key::Left: return VK_LEFT;
@@ -5,6 +5,7 @@ enum class Key : uint8_t
 {
     W, A, S, D,
     Q, E, R, G,
+    B, N, M, J, H, K, V, L, O, P, C, F,
     Up, Down, Left, Right,
     Escape,
     Space,
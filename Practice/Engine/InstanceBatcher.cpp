@@ -0,0 +1,91 @@
+﻿#include "InstanceBatcher.h"
+#include "RenderSortKey.h"
+#include <algorithm>
+#include <cassert>
+
+void InstanceBatcher::Build(const std::vector<RenderItem>& items, const std::vector<uint32_t>& srvIndices,
+    const std::vector<uint8_t>& pipelines, const DirectX::XMFLOAT4X4& view, uint32_t maxInstances)
+{
+    assert(srvIndices.size() >= items.size());
+    assert(pipelines.empty() || pipelines.size() >= items.size());
+    const bool hasPipelines = !pipelines.empty();
+
+    m_keys.clear();
+    m_batches.clear();
+    m_instances.clear();
+    m_stats = InstanceBatchStats{};
+
+    const uint32_t itemCount = (uint32_t)items.size();
+    const uint32_t n = std::min(itemCount, maxInstances);
+    m_stats.items = itemCount;
+    m_stats.dropped = itemCount - n;
+    if (n == 0)
+        return;
+
+    // 1) 키 생성: 깊이 = world 원점(translation)의 view-space z
+    m_keys.resize(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        const RenderItem& it = items[i];
+        const float viewZ = it.world._41 * view._13 + it.world._42 * view._23 + it.world._43 * view._33 + view._43;
+
+        const uint32_t pipeline = hasPipelines ? pipelines[i] : 0u;
+        const uint32_t material = m_bindless ? 0u : srvIndices[i];
+        m_keys[i].key = RenderSortKey::Make(RenderPassKey::Opaque, pipeline, material,
+            it.mesh.id, it.startIndex, it.indexCount, viewZ);
+        m_keys[i].value = i;
+    }
+
+    // 2) 정렬 (안정 정렬 → 키가 같으면 입력 순서)
+    m_stats.radixPasses = RadixSort64(m_keys, m_sortScratch);
+
+    // 3) 실제 상태 (pipeline, srv(bindless면 제외), mesh, range)가 바로 앞 item과 같으면 같은 batch
+    //    (키 필드가 잘려 다른 상태가 섞여도 여기서 갈라지므로 결과는 항상 올바름)
+    m_instances.resize(n);
+    uint32_t prevItem = 0;
+    for (uint32_t k = 0; k < n; ++k)
+    {
+        const uint32_t itemIndex = m_keys[k].value;
+        const RenderItem& it = items[itemIndex];
+        const uint32_t srv = srvIndices[itemIndex];
+        const uint32_t pipeline = hasPipelines ? pipelines[itemIndex] : 0u;
+
+        bool newBatch = (k == 0);
+        if (!newBatch)
+        {
+            const RenderItem& prev = items[prevItem];
+            newBatch = (!m_bindless && srv != srvIndices[prevItem])
+                || pipeline != (hasPipelines ? pipelines[prevItem] : 0u)
+                || it.mesh.id != prev.mesh.id
+                || it.startIndex != prev.startIndex
+                || it.indexCount != prev.indexCount;
+        }
+        prevItem = itemIndex;
+
+        if (newBatch)
+        {
+            InstanceBatch b{};
+            b.meshId = it.mesh.id;
+            b.srvIndex = srv;
+            b.pipeline = pipeline;
+            b.startIndex = it.startIndex;
+            b.indexCount = it.indexCount;
+            b.firstInstance = k;
+            m_batches.push_back(b);
+        }
+
+        InstanceBatch& b = m_batches.back();
+        ++b.instanceCount;
+
+        InstanceData& inst = m_instances[k];
+        inst.world = it.world;
+        inst.color = it.color;
+        inst.textureIndex = srv;
+    }
+
+    for (const InstanceBatch& b : m_batches)
+        m_stats.largestBatch = std::max(m_stats.largestBatch, b.instanceCount);
+
+    m_stats.instances = n;
+    m_stats.batches = (uint32_t)m_batches.size();
+}
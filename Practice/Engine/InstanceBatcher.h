@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "RenderItem.h"
+#include "RadixSort.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+// GPU 인스턴싱용 CPU 쪽 배칭
+// - 64bit 정렬 키(RenderSortKey.h: pass/pipeline/material/mesh/submesh/depth)를 radix sort
+//   → (텍스처 슬롯, 메쉬, submesh)가 같은 RenderItem은 연속 구간, 구간 안은 앞에서 뒤로 (early-Z)
+// - 연속 구간 → draw 1번 + 인스턴스 N개
+// - 인스턴스 데이터는 batch 순서대로 한 배열에 연속 패킹 → 업로드 버퍼에 memcpy 한 번
+// - 텍스처 슬롯(srvIndex)은 백엔드가 TextureHandle에서 풀어서 넘김
+// - bindless(SetBindlessTextures)면 텍스처 슬롯은 인스턴스 데이터로만 가고 키/batch 판정에서 빠짐
+//   → 텍스처만 다른 같은 (mesh, submesh)는 한 batch
+// - pipeline = 백엔드가 정하는 item별 PSO/IA 변형 번호 (2bit, 키 상위라 같은 변형끼리 모임)
+struct InstanceData
+{
+    DirectX::XMFLOAT4X4 world;
+    DirectX::XMFLOAT4 color;
+    uint32_t textureIndex = 0;      // SRV 힙 slot (bindless 텍스처 배열 인덱스)
+    uint32_t _pad[3]{};
+};
+
+struct InstanceBatch
+{
+    uint32_t meshId = 0;
+    uint32_t srvIndex = 0;          // bindless면 첫 인스턴스 것 (batch 안에서 다를 수 있음)
+    uint32_t pipeline = 0;
+    uint32_t startIndex = 0;
+    uint32_t indexCount = 0;        // 0이면 "전체" (RenderItem 규약 그대로)
+    uint32_t firstInstance = 0;     // InstanceData 배열 기준 시작 위치
+    uint32_t instanceCount = 0;
+};
+
+struct InstanceBatchStats
+{
+    uint32_t items = 0;             // 입력 RenderItem 수
+    uint32_t instances = 0;         // 패킹된 인스턴스 수 (= 그려지는 item 수)
+    uint32_t batches = 0;           // draw call 수
+    uint32_t dropped = 0;           // maxInstances 초과로 버린 item 수
+    uint32_t largestBatch = 0;
+    uint32_t radixPasses = 0;       // 키가 다 같은 자릿수는 생략되므로 8 이하
+};
+
+class InstanceBatcher
+{
+public:
+    // items[i]의 텍스처 슬롯 = srvIndices[i], 파이프라인 변형 = pipelines[i] (비어 있으면 전부 0)
+    // view = 깊이 정렬용 카메라 view 행렬
+    // maxInstances를 넘는 뒤쪽 item은 버림 (기존 MaxDrawsPerFrame 자르기와 같은 방식)
+    void Build(const std::vector<RenderItem>& items, const std::vector<uint32_t>& srvIndices,
+        const std::vector<uint8_t>& pipelines, const DirectX::XMFLOAT4X4& view, uint32_t maxInstances);
+
+    // true면 텍스처가 달라도 batch를 안 나눔 (셰이더가 InstanceData::textureIndex로 텍스처를 고름)
+    void SetBindlessTextures(bool enabled) { m_bindless = enabled; }
+    bool IsBindlessTextures() const { return m_bindless; }
+
+    const std::vector<InstanceBatch>& GetBatches() const { return m_batches; }
+    const std::vector<InstanceData>& GetInstances() const { return m_instances; }
+    const InstanceBatchStats& GetStats() const { return m_stats; }
+
+private:
+    std::vector<SortEntry> m_keys;      // key = 정렬 키, value = item index
+    std::vector<SortEntry> m_sortScratch;
+    std::vector<InstanceBatch> m_batches;
+    std::vector<InstanceData> m_instances;
+    InstanceBatchStats m_stats{};
+    bool m_bindless = false;
+};
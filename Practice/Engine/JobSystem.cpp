@@ -0,0 +1,115 @@
+﻿#include "JobSystem.h"
+#include <algorithm>
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void JobSystem::Initialize(uint32_t workerCount)
+{
+    Shutdown();
+
+    if (workerCount == 0)
+    {
+        const uint32_t hw = std::thread::hardware_concurrency();
+        workerCount = (hw > 1) ? (hw - 1) : 0;
+    }
+
+    m_stop = false;
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i)
+        m_workers.emplace_back([this]() { WorkerMain(); });
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_workers)
+    {
+        if (t.joinable())
+            t.join();
+    }
+
+    m_workers.clear();
+    m_queue.clear();
+}
+
+void JobSystem::RunChunks(Batch& b)
+{
+    for (;;)
+    {
+        const uint32_t chunk = b.nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= b.chunkCount)
+            return;
+
+        const uint32_t begin = chunk * b.grain;
+        const uint32_t end = std::min(b.count, begin + b.grain);
+        (*b.fn)(begin, end);
+
+        b.doneChunks.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void JobSystem::WorkerMain()
+{
+    for (;;)
+    {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+            if (m_stop && m_queue.empty())
+                return;
+
+            batch = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // 이미 끝난 batch면 청크를 못 가져가고 바로 빠져나옴(fn은 건드리지 않음)
+        RunChunks(*batch);
+    }
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grain, const RangeFn& fn)
+{
+    if (count == 0)
+        return;
+
+    grain = std::max(1u, grain);
+    const uint32_t chunkCount = (count + grain - 1) / grain;
+
+    const uint32_t helpers = std::min({ GetWorkerCount(), m_maxActiveWorkers, chunkCount - 1 });
+    if (helpers == 0)
+    {
+        fn(0, count);
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->fn = &fn;
+    batch->count = count;
+    batch->grain = grain;
+    batch->chunkCount = chunkCount;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (uint32_t i = 0; i < helpers; ++i)
+            m_queue.push_back(batch);
+    }
+    if (helpers == 1) m_cv.notify_one();
+    else              m_cv.notify_all();
+
+    // 호출 스레드도 참여
+    RunChunks(*batch);
+
+    // 다른 스레드가 들고 간 청크가 끝날 때까지 대기
+    while (batch->doneChunks.load(std::memory_order_acquire) < chunkCount)
+        std::this_thread::yield();
+}
@@ -0,0 +1,66 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 간단한 워커 풀 (fork-join 전용)
+// - ParallelFor: [0, count)를 grain 단위 청크로 나눠 워커들이 atomic 카운터로 가져감
+// - 호출 스레드도 같이 일하고, 전부 끝날 때까지 블록 → 워커 안에서 다시 ParallelFor 해도 데드락 없음
+// - 워커 0개(Initialize 안 함)면 호출 스레드에서 순차 실행
+class JobSystem
+{
+public:
+    using RangeFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // workerCount = 0이면 (하드웨어 스레드 수 - 1)
+    void Initialize(uint32_t workerCount = 0);
+    void Shutdown();
+
+    uint32_t GetWorkerCount() const { return (uint32_t)m_workers.size(); }
+
+    // 호출 스레드 포함 동시에 돌 수 있는 최대 스레드 수
+    uint32_t GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    // fn(begin, end)를 청크마다 호출. 청크 순서/스레드 배정은 보장하지 않음
+    void ParallelFor(uint32_t count, uint32_t grain, const RangeFn& fn);
+
+    // 벤치마크/비교용: 이 값보다 많은 워커는 ParallelFor에 참여시키지 않음
+    void SetMaxActiveWorkers(uint32_t n) { m_maxActiveWorkers = n; }
+    uint32_t GetMaxActiveWorkers() const { return m_maxActiveWorkers; }
+
+private:
+    struct Batch
+    {
+        const RangeFn* fn = nullptr;
+        uint32_t count = 0;
+        uint32_t grain = 1;
+        uint32_t chunkCount = 0;
+        std::atomic<uint32_t> nextChunk{ 0 };
+        std::atomic<uint32_t> doneChunks{ 0 };
+    };
+
+    static void RunChunks(Batch& b);
+    void WorkerMain();
+
+private:
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::shared_ptr<Batch>> m_queue;
+    bool m_stop = false;
+
+    uint32_t m_maxActiveWorkers = ~0u;
+};
@@ -0,0 +1,95 @@
+﻿#include "LightClusterBench.h"
+#include "LightClusterer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace DirectX;
+
+LightClusterBenchResult RunLightClusterBench(uint32_t lightCount, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    LightClusterBenchResult r{};
+    lightCount = std::clamp(lightCount, 1u, MaxLightsPerFrame);
+    r.lights = lightCount;
+    runs = std::max(runs, 1u);
+
+    // 200 x 200 바닥 위 가로등/스폿 (반경 2~10), 0번은 태양
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+
+    std::vector<FrameLight> lights(lightCount);
+    lights[0].type = 0;
+    lights[0].directionWS = { 0.3f, -1.0f, 0.2f };
+    for (uint32_t i = 1; i < lightCount; ++i)
+    {
+        FrameLight& L = lights[i];
+        L.type = (i % 3 == 0) ? 2u : 1u;
+        L.positionWS = { u01(rng) * 200.0f - 100.0f, 1.0f + u01(rng) * 4.0f, u01(rng) * 200.0f - 100.0f };
+        L.range = 2.0f + u01(rng) * 8.0f;
+        L.directionWS = { 0.0f, -1.0f, 0.0f };
+        L.innerCos = std::cos(0.4f);
+        L.outerCos = std::cos(0.6f);
+    }
+
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMVectorSet(0, 20, -110, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f));
+
+    LightClusterer clusterer;
+    clusterer.Build(lights.data(), lightCount, cam); // 격자/용량 확보
+
+    auto t0 = Clock::now();
+    for (uint32_t run = 0; run < runs; ++run)
+        clusterer.Build(lights.data(), lightCount, cam);
+    r.buildMs = ms(t0, Clock::now()) / runs;
+
+    const LightClusterStats& st = clusterer.GetStats();
+    r.binnedLights = st.binnedLights;
+    r.indices = st.indices;
+    r.maxPerCluster = st.maxPerCluster;
+    r.avgPerOccupiedCluster = st.occupiedClusters ? (float)st.indices / (float)st.occupiedClusters : 0.0f;
+
+    // brute force: cluster마다 모든 light 구 검사 (light 번호 순이라 결과 목록과 바로 비교 가능)
+    const std::vector<LightClusterBounds>& bounds = clusterer.GetClusterBounds();
+    std::vector<XMFLOAT3> centers(lightCount);
+    std::vector<float> radii(lightCount, -1.0f);
+
+    std::vector<uint32_t> brute;
+    brute.reserve(st.indices);
+    std::vector<uint32_t> bruteOffsets(LightClusterCount + 1, 0);
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < lightCount; ++i)
+    {
+        if (!LightClusterer::ComputeLightSphere(lights[i], cam.view, centers[i], radii[i]))
+            radii[i] = -1.0f;
+    }
+    for (uint32_t ci = 0; ci < LightClusterCount; ++ci)
+    {
+        bruteOffsets[ci] = (uint32_t)brute.size();
+        for (uint32_t i = 0; i < lightCount; ++i)
+        {
+            if (radii[i] >= 0.0f && LightClusterer::SphereIntersects(bounds[ci], centers[i], radii[i]))
+                brute.push_back(i);
+        }
+    }
+    bruteOffsets[LightClusterCount] = (uint32_t)brute.size();
+    r.bruteForceMs = ms(t0, Clock::now());
+
+    const std::vector<LightClusterRange>& clusters = clusterer.GetClusters();
+    const std::vector<uint32_t>& indices = clusterer.GetLightIndices();
+
+    r.sameResult = brute.size() == st.indices;
+    for (uint32_t ci = 0; ci < LightClusterCount && r.sameResult; ++ci)
+    {
+        const LightClusterRange& c = clusters[ci];
+        r.sameResult = c.count == bruteOffsets[ci + 1] - bruteOffsets[ci]
+            && std::equal(indices.begin() + c.offset, indices.begin() + c.offset + c.count, brute.begin() + bruteOffsets[ci]);
+    }
+
+    return r;
+}
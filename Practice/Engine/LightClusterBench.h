@@ -0,0 +1,21 @@
+﻿#pragma once
+#include <cstdint>
+
+// LightClusterer 배정 하네스
+// - 카메라 앞 격자 도시 위에 lightCount개 점/스폿 광원 (directional 1개 포함) → Build 평균 시간
+// - 같은 결과를 모든 (light, cluster) 쌍 AABB 테스트로 만든 brute force와 비교
+// - 픽셀당 루프 길이: 예전 방식은 전부(lightCount), cluster 방식은 자기 cluster 목록 + 전역
+struct LightClusterBenchResult
+{
+    uint32_t lights = 0;
+    uint32_t binnedLights = 0;
+    uint32_t indices = 0;
+    uint32_t maxPerCluster = 0;
+    float avgPerOccupiedCluster = 0.0f;
+
+    double buildMs = 0.0;           // LightClusterer::Build 평균
+    double bruteForceMs = 0.0;      // light x cluster 전수 검사
+    bool sameResult = false;        // cluster별 목록이 brute force와 같은지
+};
+
+LightClusterBenchResult RunLightClusterBench(uint32_t lightCount, uint32_t runs = 8);
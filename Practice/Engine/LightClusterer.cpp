@@ -0,0 +1,236 @@
+﻿#include "LightClusterer.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+    uint32_t ClampTile(float t, uint32_t n)
+    {
+        if (!(t > 0.0f))
+            return 0;
+        return std::min((uint32_t)t, n - 1);
+    }
+}
+
+bool LightClusterer::ComputeLightSphere(const FrameLight& light, const XMFLOAT4X4& view, XMFLOAT3& centerVS, float& radius)
+{
+    if (light.type == 0 || !(light.range > 0.0f))
+        return false;
+
+    XMFLOAT3 c = light.positionWS;
+    radius = light.range;
+
+    // 스폿: cone(꼭짓점 = 위치, 높이 = range, 반각 cos = outerCos)을 감싸는 가장 작은 구
+    if (light.type == 2)
+    {
+        const float cosA = std::clamp(light.outerCos, -1.0f, 1.0f);
+        const float sinA = std::sqrt(std::max(0.0f, 1.0f - cosA * cosA));
+
+        // 넓은 cone(반각 45도 초과)은 밑면 원이 지름, 좁으면 꼭짓점과 밑면 테두리를 지나는 구
+        float along = 0.0f;
+        if (cosA < 0.70710678f)
+        {
+            if (cosA > 0.0f)
+            {
+                along = light.range * cosA;
+                radius = light.range * sinA;
+            }
+        }
+        else
+        {
+            along = light.range / (2.0f * cosA);
+            radius = along;
+        }
+
+        const XMFLOAT3& d = light.directionWS;
+        c = { c.x + d.x * along, c.y + d.y * along, c.z + d.z * along };
+    }
+
+    XMStoreFloat3(&centerVS, XMVector3TransformCoord(XMLoadFloat3(&c), XMLoadFloat4x4(&view)));
+    return true;
+}
+
+bool LightClusterer::SphereIntersects(const LightClusterBounds& b, const XMFLOAT3& c, float r)
+{
+    const float dx = std::max({ b.min.x - c.x, 0.0f, c.x - b.max.x });
+    const float dy = std::max({ b.min.y - c.y, 0.0f, c.y - b.max.y });
+    const float dz = std::max({ b.min.z - c.z, 0.0f, c.z - b.max.z });
+    return dx * dx + dy * dy + dz * dz <= r * r;
+}
+
+void LightClusterer::RebuildGrid(float projX, float projY, float nearZ, float farZ)
+{
+    m_projX = projX;
+    m_projY = projY;
+    m_nearZ = nearZ;
+    m_farZ = farZ;
+
+    const float logRatio = std::log(farZ / nearZ);
+    m_sliceScale = (float)LightClusterZ / logRatio;
+    m_sliceBias = -(float)LightClusterZ * std::log(nearZ) / logRatio;
+
+    m_bounds.resize(LightClusterCount);
+    for (uint32_t z = 0; z < LightClusterZ; ++z)
+    {
+        const float z0 = nearZ * std::pow(farZ / nearZ, (float)z / LightClusterZ);
+        const float z1 = nearZ * std::pow(farZ / nearZ, (float)(z + 1) / LightClusterZ);
+
+        for (uint32_t y = 0; y < LightClusterY; ++y)
+        {
+            // 타일 y 0 = 화면 위쪽
+            const float ndcTop = 1.0f - 2.0f * (float)y / LightClusterY;
+            const float ndcBottom = 1.0f - 2.0f * (float)(y + 1) / LightClusterY;
+
+            for (uint32_t x = 0; x < LightClusterX; ++x)
+            {
+                const float ndcLeft = -1.0f + 2.0f * (float)x / LightClusterX;
+                const float ndcRight = -1.0f + 2.0f * (float)(x + 1) / LightClusterX;
+
+                // view 공간에서 ndc 경계 평면은 x = ndc * z / proj._11 → 가까운/먼 면 네 모서리로 AABB
+                LightClusterBounds& b = m_bounds[ClusterIndex(x, y, z)];
+                b.min = { std::min(ndcLeft * z0, ndcLeft * z1) / projX, std::min(ndcBottom * z0, ndcBottom * z1) / projY, z0 };
+                b.max = { std::max(ndcRight * z0, ndcRight * z1) / projX, std::max(ndcTop * z0, ndcTop * z1) / projY, z1 };
+            }
+        }
+    }
+}
+
+uint32_t LightClusterer::FindCluster(float ndcX, float ndcY, float viewZ) const
+{
+    const uint32_t x = ClampTile((ndcX + 1.0f) * 0.5f * LightClusterX, LightClusterX);
+    const uint32_t y = ClampTile((1.0f - ndcY) * 0.5f * LightClusterY, LightClusterY);
+    const uint32_t z = ClampTile(std::log(std::max(viewZ, 1e-6f)) * m_sliceScale + m_sliceBias, LightClusterZ);
+    return ClusterIndex(x, y, z);
+}
+
+void LightClusterer::Build(const FrameLight* lights, uint32_t count, const RenderCamera& cam)
+{
+    m_stats = {};
+    m_stats.lights = count;
+
+    m_clusters.assign(LightClusterCount, LightClusterRange{});
+    m_indices.clear();
+    m_pairs.clear();
+
+    // LH 원근: _33 = f/(f-n), _43 = -n*f/(f-n)
+    const XMFLOAT4X4& P = cam.proj;
+    const float nearZ = (P._33 != 0.0f) ? -P._43 / P._33 : 0.0f;
+    const float farZ = (P._33 != 1.0f) ? P._43 / (1.0f - P._33) : 0.0f;
+    const bool perspective = P._34 == 1.0f && nearZ > 0.0f && farZ > nearZ && P._11 > 0.0f && P._22 > 0.0f;
+
+    if (perspective && (P._11 != m_projX || P._22 != m_projY || nearZ != m_nearZ || farZ != m_farZ))
+        RebuildGrid(P._11, P._22, nearZ, farZ);
+
+    // 전역: directional (격자를 못 만드는 projection이면 전부 전역으로 → 예전처럼 모든 픽셀이 전부 루프)
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (lights[i].type == 0 || !perspective)
+            m_indices.push_back(i);
+    }
+    m_globalCount = (uint32_t)m_indices.size();
+    m_stats.globalLights = m_globalCount;
+
+    if (!perspective)
+        return;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        XMFLOAT3 c;
+        float r = 0.0f;
+        if (!ComputeLightSphere(lights[i], cam.view, c, r))
+        {
+            m_stats.culledLights += (lights[i].type != 0) ? 1u : 0u;
+            continue;
+        }
+
+        if (c.z + r < m_nearZ || c.z - r > m_farZ)
+        {
+            ++m_stats.culledLights;
+            continue;
+        }
+
+        // 슬라이스 후보는 float 경계 오차 대비 한 칸씩 넓힘 → 실제 판정은 AABB 테스트
+        const float zLo = std::max(c.z - r, m_nearZ);
+        const float zHi = std::min(c.z + r, m_farZ);
+        const uint32_t s0 = ClampTile(std::log(zLo) * m_sliceScale + m_sliceBias - 1.0f, LightClusterZ);
+        const uint32_t s1 = ClampTile(std::log(zHi) * m_sliceScale + m_sliceBias + 1.0f, LightClusterZ);
+
+        const size_t before = m_pairs.size();
+        for (uint32_t z = s0; z <= s1; ++z)
+        {
+            // 이 슬라이스 두께 안에서의 구 단면 반지름 (중심에서 슬라이스까지 z 거리만큼 줄어듦)
+            const float zFar = m_bounds[ClusterIndex(0, 0, z)].max.z;
+            const float zNear = m_bounds[ClusterIndex(0, 0, z)].min.z;
+            const float dz = std::max({ zNear - c.z, 0.0f, c.z - zFar });
+            if (dz > r)
+                continue;
+            const float rs = std::sqrt(r * r - dz * dz);
+
+            // 같은 슬라이스 안에서 타일 AABB의 x 범위는 x만, y 범위는 y만의 함수 → 겹치는 구간을 따로 구함
+            uint32_t x0 = LightClusterX, x1 = 0;
+            for (uint32_t x = 0; x < LightClusterX; ++x)
+            {
+                const LightClusterBounds& b = m_bounds[ClusterIndex(x, 0, z)];
+                if (b.max.x >= c.x - rs && b.min.x <= c.x + rs)
+                {
+                    x0 = std::min(x0, x);
+                    x1 = x;
+                }
+            }
+            if (x0 > x1)
+                continue;
+
+            uint32_t y0 = LightClusterY, y1 = 0;
+            for (uint32_t y = 0; y < LightClusterY; ++y)
+            {
+                const LightClusterBounds& b = m_bounds[ClusterIndex(0, y, z)];
+                if (b.max.y >= c.y - rs && b.min.y <= c.y + rs)
+                {
+                    y0 = std::min(y0, y);
+                    y1 = y;
+                }
+            }
+
+            for (uint32_t y = y0; y <= y1 && y0 <= y1; ++y)
+            {
+                for (uint32_t x = x0; x <= x1; ++x)
+                {
+                    const uint32_t ci = ClusterIndex(x, y, z);
+                    if (!SphereIntersects(m_bounds[ci], c, r))
+                        continue;
+
+                    m_pairs.push_back({ ci, i });
+                    ++m_clusters[ci].count;
+                }
+            }
+        }
+
+        if (m_pairs.size() > before)
+            ++m_stats.binnedLights;
+        else
+            ++m_stats.culledLights;
+    }
+
+    // count → offset (전역 목록 뒤부터), 그다음 light 순서 그대로 scatter
+    uint32_t offset = m_globalCount;
+    m_cursor.resize(LightClusterCount);
+    for (uint32_t ci = 0; ci < LightClusterCount; ++ci)
+    {
+        LightClusterRange& cr = m_clusters[ci];
+        cr.offset = offset;
+        m_cursor[ci] = offset;
+        offset += cr.count;
+
+        if (cr.count > 0)
+            ++m_stats.occupiedClusters;
+        m_stats.maxPerCluster = std::max(m_stats.maxPerCluster, cr.count);
+    }
+
+    m_indices.resize(offset);
+    for (const Pair& p : m_pairs)
+        m_indices[m_cursor[p.cluster]++] = p.light;
+
+    m_stats.indices = offset - m_globalCount;
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+#include "FrameLights.h"
+#include "RenderCamera.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+// Clustered(froxel) light 배정
+// - 화면을 LightClusterX x LightClusterY 타일, view 깊이를 near~far 지수 분할 LightClusterZ 슬라이스로 나눈 격자
+// - 점/스폿 광원은 영향 구(스폿은 cone을 감싸는 구)가 닿는 cluster에만 들어감 → 픽셀은 자기 cluster 목록만 루프
+// - directional은 어디에나 닿으므로 전역 목록 (light index 목록 맨 앞 [0, globalCount))
+// - 결과: cluster별 {offset, count} + light index 목록 (cluster 순서로 압축, cluster 안은 light 번호 순)
+// - 격자/슬라이스 규칙은 셰이더와 같아야 함 (FindCluster 참고)
+static constexpr uint32_t LightClusterX = 16;
+static constexpr uint32_t LightClusterY = 9;
+static constexpr uint32_t LightClusterZ = 24;
+static constexpr uint32_t LightClusterCount = LightClusterX * LightClusterY * LightClusterZ;
+
+// HLSL StructuredBuffer<uint2>와 같은 레이아웃
+struct LightClusterRange
+{
+    uint32_t offset = 0;    // light index 목록 시작
+    uint32_t count = 0;
+};
+
+// view 공간 cluster AABB
+struct LightClusterBounds
+{
+    DirectX::XMFLOAT3 min;
+    DirectX::XMFLOAT3 max;
+};
+
+struct LightClusterStats
+{
+    uint32_t lights = 0;            // 입력 light 수
+    uint32_t globalLights = 0;      // directional (모든 픽셀)
+    uint32_t binnedLights = 0;      // cluster 하나 이상에 들어간 점/스폿
+    uint32_t culledLights = 0;      // 시야(near~far, 옆면) 밖이라 빠진 점/스폿
+    uint32_t indices = 0;           // cluster 목록 총 길이 (전역 제외)
+    uint32_t occupiedClusters = 0;  // light가 하나 이상인 cluster 수
+    uint32_t maxPerCluster = 0;
+};
+
+class LightClusterer
+{
+public:
+    // lights[0, count) 배정. cam.proj는 원근(LH, 대칭 frustum) 가정, near/far도 proj에서 꺼냄
+    void Build(const FrameLight* lights, uint32_t count, const RenderCamera& cam);
+
+    const std::vector<LightClusterRange>& GetClusters() const { return m_clusters; }        // [LightClusterCount]
+    const std::vector<uint32_t>& GetLightIndices() const { return m_indices; }              // 전역 + cluster 목록
+    const std::vector<LightClusterBounds>& GetClusterBounds() const { return m_bounds; }    // [LightClusterCount]
+    uint32_t GetGlobalLightCount() const { return m_globalCount; }
+    const LightClusterStats& GetStats() const { return m_stats; }
+
+    float GetNearZ() const { return m_nearZ; }
+    float GetFarZ() const { return m_farZ; }
+
+    // 슬라이스 = floor(log(viewZ) * sliceScale + sliceBias) (셰이더가 그대로 씀)
+    float GetSliceScale() const { return m_sliceScale; }
+    float GetSliceBias() const { return m_sliceBias; }
+
+    // NDC x/y + view 깊이 → cluster 번호 (격자 밖은 가장자리로 clamp). 타일 y는 화면 위쪽(NDC +1)이 0
+    uint32_t FindCluster(float ndcX, float ndcY, float viewZ) const;
+
+    static uint32_t ClusterIndex(uint32_t x, uint32_t y, uint32_t z) { return x + LightClusterX * (y + LightClusterY * z); }
+
+    // light 영향 범위를 감싸는 view 공간 구 (directional/range 0이면 false)
+    static bool ComputeLightSphere(const FrameLight& light, const DirectX::XMFLOAT4X4& view, DirectX::XMFLOAT3& centerVS, float& radius);
+
+    static bool SphereIntersects(const LightClusterBounds& b, const DirectX::XMFLOAT3& c, float r);
+
+private:
+    // projection(near/far/시야각)이 바뀔 때만 cluster AABB 다시 계산
+    void RebuildGrid(float projX, float projY, float nearZ, float farZ);
+
+    struct Pair
+    {
+        uint32_t cluster;
+        uint32_t light;
+    };
+
+    std::vector<LightClusterBounds> m_bounds;
+    std::vector<LightClusterRange> m_clusters;
+    std::vector<uint32_t> m_indices;
+    std::vector<Pair> m_pairs;          // (cluster, light) 임시 목록, light 순서대로 쌓임
+    std::vector<uint32_t> m_cursor;     // scatter용 cluster별 쓰기 위치
+
+    float m_projX = 0.0f;               // proj._11
+    float m_projY = 0.0f;               // proj._22
+    float m_nearZ = 0.0f;
+    float m_farZ = 0.0f;
+    float m_sliceScale = 0.0f;
+    float m_sliceBias = 0.0f;
+
+    uint32_t m_globalCount = 0;
+    LightClusterStats m_stats{};
+};
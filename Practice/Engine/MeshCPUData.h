@@ -1,11 +1,55 @@
 #pragma once
 #include <DirectXMath.h>
+#include <cstdint>
 #include <vector>
+#include "Meshlet.h"
+
+// GPU   (CPU  attribute ׻ float , ε  ȯ)
+// - Float32: pos/normal/uv float  32 byte
+// - Compact: pos 16bit unorm (mesh AABB  ȭ) / normal 8 ڵ snorm16x2 / uv half2  16 byte
+enum class MeshVertexFormat : uint8_t
+{
+    Float32 = 0,
+    Compact = 1,
+};
 
 struct MeshCPUData
 {
     std::vector<DirectX::XMFLOAT3> positions;
     std::vector<DirectX::XMFLOAT3> normals;
     std::vector<DirectX::XMFLOAT2> uvs;
+
+    // ε   ϳ ä:  65536   indices(16bit),  indices32
+    // (SetIndices  ,  ä )
     std::vector<uint16_t> indices;
+    std::vector<uint32_t> indices32;
+
+    MeshVertexFormat vertexFormat = MeshVertexFormat::Float32;
+
+    // () ε   meshlet, startIndex  (ClusterCuller ̴  ׸)
+    std::vector<Meshlet> meshlets;
+
+    bool Uses32BitIndices() const { return !indices32.empty(); }
+    uint32_t GetIndexCount() const { return (uint32_t)(Uses32BitIndices() ? indices32.size() : indices.size()); }
+    uint32_t GetIndex(size_t i) const { return Uses32BitIndices() ? indices32[i] : (uint32_t)indices[i]; }
+
+    void SetIndices(const std::vector<uint32_t>& src)
+    {
+        indices.clear();
+        indices32.clear();
+
+        uint32_t maxIndex = 0;
+        for (uint32_t idx : src)
+            maxIndex = (idx > maxIndex) ? idx : maxIndex;
+
+        if (maxIndex > 0xFFFFu)
+        {
+            indices32 = src;
+            return;
+        }
+
+        indices.reserve(src.size());
+        for (uint32_t idx : src)
+            indices.push_back((uint16_t)idx);
+    }
 };
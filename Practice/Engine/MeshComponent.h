@@ -3,29 +3,50 @@
 #include <vector>
 #include <cstdint>
 
+static constexpr uint32_t MeshMaxLods = 4; // LOD0(draw ڽ ) 
+
+struct MeshLodRange
+{
+    uint32_t startIndex = 0;
+    uint32_t indexCount = 0;
+};
+
+//  mesh handle  ܼȭ ε  (AssetPipeline submesh ڿ ٿ  )
+// - levels[k] = LOD k+1, Ÿ  RenderSystem::Build
+struct MeshLodChain
+{
+    uint32_t count = 0;
+    MeshLodRange levels[MeshMaxLods - 1]{};
+};
+
 struct MeshSubmeshDraw
 {
     MeshHandle mesh;            //  ImportedMesh  mesh handle
     uint32_t startIndex = 0;    // DrawIndexedInstanced StartIndexLocation
     uint32_t indexCount = 0;    // 0̸ "ü" 
     uint32_t materialIndex = 0; // MaterialSetComponent  ε
+    MeshLodChain lods;          //   ׻  
 };
 
 struct MeshComponent
 {
     std::vector<MeshSubmeshDraw> draws;
 
+    // () Ʈ Ŭ  low-poly mesh ( ʿ  ). ȿϸ  ƼƼ
+    // RenderSystem CPU  ۿ ׷  draw . ٲٸ World::MarkRenderChanged
+    MeshHandle occluder;
+
     MeshComponent() = default;
 
     //  ȣ  MeshComponent{ handle } (ü  0)
     explicit MeshComponent(MeshHandle h)
     {
-        draws.push_back(MeshSubmeshDraw{ h, 0u, 0u, 0u });
+        draws.push_back(MeshSubmeshDraw{ h, 0u, 0u, 0u, {} });
     }
 
     // ޽
     MeshComponent(MeshHandle h, uint32_t start, uint32_t count, uint32_t matIndex)
     {
-        draws.push_back(MeshSubmeshDraw{ h, start, count, matIndex });
+        draws.push_back(MeshSubmeshDraw{ h, start, count, matIndex, {} });
     }
 };
@@ -5,6 +5,7 @@ MeshHandle MeshManager::Create(const MeshCPUData& mesh)
 {
     const uint32_t id = m_nextId++;
     m_meshes.emplace(id, mesh);
+    m_bounds.emplace(id, ComputeMeshBounds(mesh));
     return MeshHandle{ id };
 }
 
@@ -20,6 +21,25 @@ bool MeshManager::IsValid(MeshHandle h) const
     return m_meshes.find(h.id) != m_meshes.end();
 }
 
+bool MeshManager::GetBounds(MeshHandle h, MeshBounds& out) const
+{
+    auto it = m_bounds.find(h.id);
+    if (it == m_bounds.end())
+        return false;
+
+    out = it->second;
+    return true;
+}
+
+const std::vector<Meshlet>* MeshManager::GetMeshlets(MeshHandle h) const
+{
+    auto it = m_meshes.find(h.id);
+    if (it == m_meshes.end() || it->second.meshlets.empty())
+        return nullptr;
+
+    return &it->second.meshlets;
+}
+
 void MeshManager::Destroy(MeshHandle h)
 {
     auto it = m_meshes.find(h.id);
@@ -31,4 +51,5 @@ void MeshManager::Destroy(MeshHandle h)
         m_onDestroy(h.id);
 
     m_meshes.erase(it);
+    m_bounds.erase(h.id);
 }
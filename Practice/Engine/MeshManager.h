@@ -1,6 +1,7 @@
 #pragma once
 #include "MeshHandle.h"
 #include "MeshCPUData.h"
+#include "RenderBounds.h"
 #include <unordered_map>
 #include <functional>
 
@@ -11,6 +12,12 @@ public:
     const MeshCPUData& Get(MeshHandle h) const;
     bool IsValid(MeshHandle h) const;
 
+    // Create  positions    AABB (ø).  ڵ̸ false
+    bool GetBounds(MeshHandle h, MeshBounds& out) const;
+
+    // MeshCPUData::meshlets (ų   nullptr)
+    const std::vector<Meshlet>* GetMeshlets(MeshHandle h) const;
+
     void Destroy(MeshHandle h);
 
     using OnDestroyCallback = std::function<void(uint32_t meshId)>;
@@ -19,6 +26,7 @@ public:
 private:
     uint32_t m_nextId = 1;
     std::unordered_map<uint32_t, MeshCPUData> m_meshes;
+    std::unordered_map<uint32_t, MeshBounds> m_bounds;
 
     OnDestroyCallback m_onDestroy;
 };
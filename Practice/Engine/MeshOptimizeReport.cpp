@@ -0,0 +1,77 @@
+#include "MeshOptimizeReport.h"
+#include "ImportRegistry.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+MeshOptimizeReport RunMeshOptimizeReport(const ImportRegistry& registry, const std::string& directory,
+    const ImportOptions& importOpt)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    MeshOptimizeReport report{};
+
+    std::error_code ec;
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        const std::string path = entry.path().generic_string();
+        if (registry.FindImporterForFile(path))
+            files.push_back(path);
+    }
+    if (ec)
+        report.errors.push_back("Cannot open directory: " + directory);
+
+    std::sort(files.begin(), files.end());
+
+    for (const std::string& path : files)
+    {
+        IAssetImporter* importer = registry.FindImporterForFile(path);
+        auto imported = importer->Import(path, importOpt);
+        if (!imported.IsOk())
+        {
+            report.errors.push_back(path + ": " + imported.error->message);
+            continue;
+        }
+
+        for (ImportedMesh& mesh : imported.value.meshes)
+        {
+            MeshOptimizeReportEntry e{};
+            e.file = path;
+            e.mesh = mesh.name.empty() ? "Mesh" : mesh.name;
+
+            const auto t0 = Clock::now();
+            e.stats = OptimizeImportedMesh(mesh, true);
+            e.ms = ms(t0, Clock::now());
+
+            report.entries.push_back(std::move(e));
+        }
+    }
+
+    return report;
+}
+
+std::string FormatMeshOptimizeReport(const MeshOptimizeReport& report)
+{
+    std::string out = "file | mesh | tris | verts | ACMR before -> after | ATVR before -> after | ms\n";
+
+    char line[512];
+    for (const MeshOptimizeReportEntry& e : report.entries)
+    {
+        const MeshOptimizeStats& s = e.stats;
+        std::snprintf(line, sizeof(line), "%s | %s | %u | %u | %.3f -> %.3f | %.3f -> %.3f | %.1f\n",
+            e.file.c_str(), e.mesh.c_str(), s.before.triangles, s.after.vertices,
+            s.before.acmr, s.after.acmr, s.before.atvr, s.after.atvr, e.ms);
+        out += line;
+    }
+
+    for (const std::string& err : report.errors)
+        out += "error: " + err + "\n";
+
+    return out;
+}
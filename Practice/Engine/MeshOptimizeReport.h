@@ -0,0 +1,28 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include "MeshOptimizer.h"
+
+class ImportRegistry;
+
+// 헤드리스 mesh 최적화 리포트 (창/렌더러 없이 importer + MeshOptimizer만)
+// - directory 안의 import 가능한 파일마다 mesh별 ACMR/ATVR 전후 비교
+// - 실행: Engine.exe --mesh-report  → MeshOptimizeReport.txt
+struct MeshOptimizeReportEntry
+{
+    std::string file;
+    std::string mesh;
+    MeshOptimizeStats stats;
+    double ms = 0.0;            // OptimizeImportedMesh 시간
+};
+
+struct MeshOptimizeReport
+{
+    std::vector<MeshOptimizeReportEntry> entries;
+    std::vector<std::string> errors;    // import 실패 등
+};
+
+MeshOptimizeReport RunMeshOptimizeReport(const ImportRegistry& registry, const std::string& directory,
+    const ImportOptions& importOpt);
+
+std::string FormatMeshOptimizeReport(const MeshOptimizeReport& report);
@@ -0,0 +1,443 @@
+﻿#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    // ---------------------------
+    // Forsyth 점수 (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+    // ---------------------------
+    constexpr uint32_t ForsythCacheSize = 32;
+    constexpr uint32_t ForsythValenceMax = 64;
+
+    struct ForsythTables
+    {
+        float cache[ForsythCacheSize];
+        float valence[ForsythValenceMax];
+
+        ForsythTables()
+        {
+            // 방금 쓴 삼각형의 세 정점은 고정 점수 (바로 다시 쓰면 strip처럼 길게 늘어지는 걸 막음)
+            for (uint32_t i = 0; i < ForsythCacheSize; ++i)
+            {
+                if (i < 3)
+                {
+                    cache[i] = 0.75f;
+                    continue;
+                }
+                const float t = 1.0f - (float)(i - 3) / (float)(ForsythCacheSize - 3);
+                cache[i] = std::pow(t, 1.5f);
+            }
+
+            // 남은 삼각형이 적은 정점을 먼저 끝내도록 가산점
+            valence[0] = 0.0f;
+            for (uint32_t i = 1; i < ForsythValenceMax; ++i)
+                valence[i] = 2.0f / std::sqrt((float)i);
+        }
+    };
+
+    const ForsythTables& GetForsythTables()
+    {
+        static const ForsythTables t;
+        return t;
+    }
+
+    float VertexScore(const ForsythTables& t, int32_t cachePos, uint32_t remaining)
+    {
+        if (remaining == 0)
+            return -1.0f; // 더 이상 쓸 삼각형 없음
+
+        float s = (cachePos >= 0) ? t.cache[cachePos] : 0.0f;
+        s += t.valence[std::min(remaining, ForsythValenceMax - 1)];
+        return s;
+    }
+
+    struct Vec3
+    {
+        float x, y, z;
+    };
+
+    Vec3 LoadPosition(const float* positions, size_t stride, uint32_t v)
+    {
+        const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * stride);
+        return { p[0], p[1], p[2] };
+    }
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount,
+    uint32_t cacheSize)
+{
+    VertexCacheStats s{};
+    s.triangles = (uint32_t)(indexCount / 3);
+    if (s.triangles == 0 || vertexCount == 0 || cacheSize == 0)
+        return s;
+
+    // FIFO: 들어온 시각만 기록, (지금 - 시각) > cacheSize면 밀려난 것
+    std::vector<uint32_t> timestamps(vertexCount, 0);
+    std::vector<uint8_t> referenced(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+
+    for (size_t i = 0; i < (size_t)s.triangles * 3; ++i)
+    {
+        const uint32_t v = indices[i];
+        if (time - timestamps[v] > cacheSize)
+        {
+            timestamps[v] = time++;
+            ++s.misses;
+        }
+
+        if (!referenced[v])
+        {
+            referenced[v] = 1;
+            ++s.vertices;
+        }
+    }
+
+    s.acmr = (float)s.misses / (float)s.triangles;
+    s.atvr = (s.vertices > 0) ? (float)s.misses / (float)s.vertices : 0.0f;
+    return s;
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount < 2 || vertexCount == 0)
+        return;
+
+    const ForsythTables& tables = GetForsythTables();
+
+    // 1) 정점 → 인접 삼각형 (CSR). remaining = 아직 안 낸 인접 삼각형 수 (목록 앞쪽 remaining개가 유효)
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triCount * 3; ++i)
+        ++remaining[indices[i]];
+
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        offsets[v + 1] = offsets[v] + remaining[v];
+
+    std::vector<uint32_t> adjacency(triCount * 3);
+    {
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triCount * 3; ++i)
+            adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+    }
+
+    // 2) 초기 점수
+    std::vector<int32_t> cachePos(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        vertexScore[v] = VertexScore(tables, -1, remaining[v]);
+
+    std::vector<float> triScore(triCount);
+    std::vector<uint8_t> emitted(triCount, 0);
+    uint32_t best = InvalidIndex;
+    float bestScore = -1.0f;
+    for (size_t t = 0; t < triCount; ++t)
+    {
+        const uint32_t* tri = indices + t * 3;
+        triScore[t] = vertexScore[tri[0]] + vertexScore[tri[1]] + vertexScore[tri[2]];
+        if (triScore[t] > bestScore)
+        {
+            bestScore = triScore[t];
+            best = (uint32_t)t;
+        }
+    }
+
+    // 3) 가장 점수 높은 삼각형을 하나씩 내보내고 LRU 캐시 / 점수 갱신
+    std::vector<uint32_t> out(triCount * 3);
+    uint32_t cache[ForsythCacheSize + 3];
+    uint32_t cacheCount = 0;
+
+    // 막혔을 때 (캐시 주변에 남은 삼각형 없음) 최근에 쓴 정점 주변부터 이어감
+    // → 입력 순서로 건너뛰면 멀리 떨어진 섬이 생겨 나중에 경계에서 재사용을 잃음
+    std::vector<uint32_t> deadEndStack;
+    deadEndStack.reserve(triCount * 3);
+    size_t deadEndCursor = 0;
+
+    for (size_t outTri = 0; outTri < triCount; ++outTri)
+    {
+        while (best == InvalidIndex && !deadEndStack.empty())
+        {
+            const uint32_t v = deadEndStack.back();
+            deadEndStack.pop_back();
+            if (remaining[v] > 0)
+                best = adjacency[offsets[v]];
+        }
+
+        if (best == InvalidIndex)
+        {
+            // 그래도 없으면 아직 안 낸 첫 삼각형부터 다시
+            while (emitted[deadEndCursor])
+                ++deadEndCursor;
+            best = (uint32_t)deadEndCursor;
+        }
+
+        const uint32_t t = best;
+        const uint32_t* tri = indices + (size_t)t * 3;
+        emitted[t] = 1;
+        out[outTri * 3 + 0] = tri[0];
+        out[outTri * 3 + 1] = tri[1];
+        out[outTri * 3 + 2] = tri[2];
+        deadEndStack.insert(deadEndStack.end(), tri, tri + 3);
+
+        // 인접 목록에서 t 제거 (swap-remove)
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+            const uint32_t v = tri[k];
+            uint32_t* list = adjacency.data() + offsets[v];
+            const uint32_t n = remaining[v];
+            for (uint32_t j = 0; j < n; ++j)
+            {
+                if (list[j] == t)
+                {
+                    list[j] = list[n - 1];
+                    list[n - 1] = t;
+                    break;
+                }
+            }
+            --remaining[v];
+        }
+
+        // LRU: 이번 삼각형 정점을 앞으로, 나머지는 뒤로 밀림 (CacheSize 넘는 건 이번에 밀려남)
+        uint32_t newCache[ForsythCacheSize + 3];
+        uint32_t newCount = 0;
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+            const uint32_t v = tri[k];
+            if (std::find(newCache, newCache + newCount, v) == newCache + newCount)
+                newCache[newCount++] = v;
+        }
+        for (uint32_t i = 0; i < cacheCount; ++i)
+        {
+            const uint32_t v = cache[i];
+            if (std::find(newCache, newCache + newCount, v) == newCache + newCount)
+                newCache[newCount++] = v;
+        }
+
+        // 점수 변화량을 인접 삼각형에 반영
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            const uint32_t v = newCache[i];
+            const int32_t pos = (i < ForsythCacheSize) ? (int32_t)i : -1;
+            cachePos[v] = pos;
+
+            const float score = VertexScore(tables, pos, remaining[v]);
+            const float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+
+            const uint32_t* list = adjacency.data() + offsets[v];
+            for (uint32_t j = 0; j < remaining[v]; ++j)
+                triScore[list[j]] += delta;
+        }
+
+        // 다음 후보: 캐시 안 정점에 붙은 삼각형 중 최고점
+        cacheCount = std::min(newCount, ForsythCacheSize);
+        best = InvalidIndex;
+        bestScore = -1.0f;
+        for (uint32_t i = 0; i < cacheCount; ++i)
+        {
+            const uint32_t v = newCache[i];
+            cache[i] = v;
+
+            const uint32_t* list = adjacency.data() + offsets[v];
+            for (uint32_t j = 0; j < remaining[v]; ++j)
+            {
+                const uint32_t cand = list[j];
+                if (triScore[cand] > bestScore)
+                {
+                    bestScore = triScore[cand];
+                    best = cand;
+                }
+            }
+        }
+    }
+
+    std::copy(out.begin(), out.end(), indices);
+}
+
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    uint32_t vertexCount, float threshold)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount < 2 || vertexCount == 0)
+        return;
+
+    const VertexCacheStats before = AnalyzeVertexCache(indices, triCount * 3, vertexCount);
+
+    // 1) cluster 경계 = 세 정점이 전부 캐시 miss인 삼각형 (캐시 상태가 끊기는 곳이라 여기서 잘라도 ACMR 손해 적음)
+    std::vector<uint32_t> clusterStart;
+    {
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        uint32_t time = DefaultCacheSize + 1;
+
+        for (size_t t = 0; t < triCount; ++t)
+        {
+            uint32_t misses = 0;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const uint32_t v = indices[t * 3 + k];
+                if (time - timestamps[v] > DefaultCacheSize)
+                {
+                    timestamps[v] = time++;
+                    ++misses;
+                }
+            }
+
+            if (t == 0 || misses == 3)
+                clusterStart.push_back((uint32_t)t);
+        }
+        clusterStart.push_back((uint32_t)triCount);
+    }
+
+    const uint32_t clusterCount = (uint32_t)clusterStart.size() - 1;
+    if (clusterCount < 2)
+        return;
+
+    // 2) cluster별 면적 가중 중심/법선 → 정렬 값 = (cluster 중심 - mesh 중심) · cluster 법선
+    //    값이 클수록 바깥을 향한 면 → 먼저 그리면 뒤쪽 cluster가 early-Z로 많이 걸러짐
+    struct ClusterInfo
+    {
+        Vec3 centroid{ 0, 0, 0 };
+        Vec3 normal{ 0, 0, 0 };
+        float area = 0.0f;
+    };
+    std::vector<ClusterInfo> infos(clusterCount);
+
+    Vec3 meshCentroid{ 0, 0, 0 };
+    float meshArea = 0.0f;
+
+    for (uint32_t c = 0; c < clusterCount; ++c)
+    {
+        ClusterInfo& ci = infos[c];
+        for (uint32_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t)
+        {
+            const Vec3 a = LoadPosition(positions, positionStride, indices[t * 3 + 0]);
+            const Vec3 b = LoadPosition(positions, positionStride, indices[t * 3 + 1]);
+            const Vec3 d = LoadPosition(positions, positionStride, indices[t * 3 + 2]);
+
+            const Vec3 e0{ b.x - a.x, b.y - a.y, b.z - a.z };
+            const Vec3 e1{ d.x - a.x, d.y - a.y, d.z - a.z };
+            const Vec3 n{ e0.y * e1.z - e0.z * e1.y, e0.z * e1.x - e0.x * e1.z, e0.x * e1.y - e0.y * e1.x };
+            const float area = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z) * 0.5f;
+
+            const Vec3 center{ (a.x + b.x + d.x) / 3.0f, (a.y + b.y + d.y) / 3.0f, (a.z + b.z + d.z) / 3.0f };
+            ci.centroid = { ci.centroid.x + center.x * area, ci.centroid.y + center.y * area, ci.centroid.z + center.z * area };
+            ci.normal = { ci.normal.x + n.x, ci.normal.y + n.y, ci.normal.z + n.z };
+            ci.area += area;
+        }
+
+        meshCentroid = { meshCentroid.x + ci.centroid.x, meshCentroid.y + ci.centroid.y, meshCentroid.z + ci.centroid.z };
+        meshArea += ci.area;
+
+        if (ci.area > 0.0f)
+            ci.centroid = { ci.centroid.x / ci.area, ci.centroid.y / ci.area, ci.centroid.z / ci.area };
+    }
+
+    if (meshArea > 0.0f)
+        meshCentroid = { meshCentroid.x / meshArea, meshCentroid.y / meshArea, meshCentroid.z / meshArea };
+
+    std::vector<float> sortValue(clusterCount);
+    for (uint32_t c = 0; c < clusterCount; ++c)
+    {
+        const ClusterInfo& ci = infos[c];
+        const float len = std::sqrt(ci.normal.x * ci.normal.x + ci.normal.y * ci.normal.y + ci.normal.z * ci.normal.z);
+        if (len <= 0.0f)
+        {
+            sortValue[c] = 0.0f;
+            continue;
+        }
+
+        const Vec3 d{ ci.centroid.x - meshCentroid.x, ci.centroid.y - meshCentroid.y, ci.centroid.z - meshCentroid.z };
+        sortValue[c] = (d.x * ci.normal.x + d.y * ci.normal.y + d.z * ci.normal.z) / len;
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+    for (uint32_t c = 0; c < clusterCount; ++c)
+        order[c] = c;
+    std::stable_sort(order.begin(), order.end(),
+        [&](uint32_t a, uint32_t b) { return sortValue[a] > sortValue[b]; });
+
+    // 3) 재배치 → 캐시 효율이 threshold 넘게 나빠지면 버림
+    std::vector<uint32_t> out;
+    out.reserve(triCount * 3);
+    for (uint32_t c : order)
+        out.insert(out.end(), indices + (size_t)clusterStart[c] * 3, indices + (size_t)clusterStart[c + 1] * 3);
+
+    const VertexCacheStats after = AnalyzeVertexCache(out.data(), out.size(), vertexCount);
+    if (after.acmr > before.acmr * threshold)
+        return;
+
+    std::copy(out.begin(), out.end(), indices);
+}
+
+uint32_t MeshOptimizer::OptimizeVertexFetch(uint32_t* indices, size_t indexCount, uint32_t vertexCount, std::vector<uint32_t>& remap)
+{
+    remap.assign(vertexCount, InvalidIndex);
+
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+        uint32_t& v = remap[indices[i]];
+        if (v == InvalidIndex)
+            v = next++;
+        indices[i] = v;
+    }
+    return next;
+}
+
+MeshOptimizeStats OptimizeImportedMesh(ImportedMesh& mesh, bool overdraw)
+{
+    MeshOptimizeStats stats{};
+
+    const uint32_t vertexCount = (uint32_t)mesh.vertices.size();
+    if (mesh.indices.empty() || vertexCount == 0)
+        return stats;
+
+    stats.before = MeshOptimizer::AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(), vertexCount);
+
+    // 1) 2) submesh 구간마다 (없으면 전체 1개)
+    std::vector<ImportedSubmesh> ranges = mesh.submeshes;
+    if (ranges.empty())
+    {
+        ImportedSubmesh all{};
+        all.indexCount = (uint32_t)mesh.indices.size();
+        ranges.push_back(all);
+    }
+
+    const size_t total = mesh.indices.size();
+    for (const ImportedSubmesh& r : ranges)
+    {
+        if (r.startIndex >= total)
+            continue;
+
+        const size_t count = std::min<size_t>(r.indexCount, total - r.startIndex) / 3 * 3;
+        uint32_t* idx = mesh.indices.data() + r.startIndex;
+
+        MeshOptimizer::OptimizeVertexCache(idx, count, vertexCount);
+        if (overdraw)
+        {
+            MeshOptimizer::OptimizeOverdraw(idx, count, &mesh.vertices[0].position.x, sizeof(ImportedVertex), vertexCount);
+        }
+    }
+
+    // 3) 정점 순서 = 인덱스 첫 사용 순서
+    std::vector<uint32_t> remap;
+    const uint32_t used = MeshOptimizer::OptimizeVertexFetch(mesh.indices.data(), mesh.indices.size(), vertexCount, remap);
+
+    std::vector<ImportedVertex> vertices(used);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+        if (remap[v] != InvalidIndex)
+            vertices[remap[v]] = mesh.vertices[v];
+    }
+    mesh.vertices.swap(vertices);
+
+    mesh.bounds = AABBBound{};
+    for (const ImportedVertex& v : mesh.vertices)
+        ExpandAABB(mesh.bounds, v.position);
+
+    stats.after = MeshOptimizer::AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(), used);
+    return stats;
+}
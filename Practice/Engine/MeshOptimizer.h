@@ -0,0 +1,46 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "ImportTypes.h"
+
+// Import와 MeshManager::Create 사이의 mesh 최적화 (CPU만)
+// 1) 삼각형 순서: 정점 캐시 재사용 (Forsyth, LRU 32 기준 점수)
+// 2) (옵션) overdraw: 캐시가 끊기는 지점으로 cluster를 나눠 바깥을 향한 cluster부터 (early-Z)
+// 3) 정점 순서: 인덱스 첫 사용 순서로 재배치 (fetch 지역성), 안 쓰는 정점은 버림
+// - 삼각형은 submesh 구간 밖으로 나가지 않음 (startIndex/indexCount 그대로)
+struct VertexCacheStats
+{
+    uint32_t triangles = 0;
+    uint32_t vertices = 0;      // 인덱스가 참조하는 정점 수
+    uint32_t misses = 0;        // FIFO 캐시 miss (= 실제 VS 실행 수 근사)
+    float acmr = 0.0f;          // misses / triangles (0.5 ~ 3, 낮을수록 좋음)
+    float atvr = 0.0f;          // misses / vertices  (1.0이 이상적)
+};
+
+struct MeshOptimizeStats
+{
+    VertexCacheStats before;
+    VertexCacheStats after;
+};
+
+namespace MeshOptimizer
+{
+    static constexpr uint32_t DefaultCacheSize = 16;    // 분석용 FIFO 크기 (보수적인 post-transform 캐시)
+
+    VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount,
+        uint32_t cacheSize = DefaultCacheSize);
+
+    // 삼각형 순서만 바꿈 (in place)
+    void OptimizeVertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount);
+
+    // 캐시 최적화된 순서를 입력으로 받아 cluster 단위로 재정렬 (in place)
+    // threshold: 결과 ACMR이 입력 ACMR * threshold를 넘으면 원래 순서 유지
+    void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+        uint32_t vertexCount, float threshold = 1.05f);
+
+    // remap[old] = new (안 쓰는 정점은 0xFFFFFFFF), 인덱스도 새 번호로 바꿈. 반환 = 남는 정점 수
+    uint32_t OptimizeVertexFetch(uint32_t* indices, size_t indexCount, uint32_t vertexCount, std::vector<uint32_t>& remap);
+}
+
+// ImportedMesh 전체: submesh마다 1) 2) → 전체 3) → 정점/bounds 갱신
+MeshOptimizeStats OptimizeImportedMesh(ImportedMesh& mesh, bool overdraw);
@@ -0,0 +1,463 @@
+﻿#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    constexpr float BorderWeight = 10.0f;       // 경계 유지 평면 가중치 (클수록 외곽선이 안 움직임)
+    constexpr size_t MinLodIndexCount = 3 * 8;  // 이보다 작은 LOD는 만들지 않음
+
+    struct Vec3
+    {
+        float x, y, z;
+    };
+
+    Vec3 LoadPosition(const float* positions, size_t stride, uint32_t v)
+    {
+        const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * stride);
+        return { p[0], p[1], p[2] };
+    }
+
+    Vec3 Sub(const Vec3& a, const Vec3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    Vec3 Cross(const Vec3& a, const Vec3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+    float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    // 평면까지 거리 제곱의 합 (대칭 3x3 + 벡터 + 상수), w = 누적 가중치
+    struct Quadric
+    {
+        double a00 = 0, a11 = 0, a22 = 0, a01 = 0, a02 = 0, a12 = 0;
+        double b0 = 0, b1 = 0, b2 = 0;
+        double c = 0;
+        double w = 0;
+
+        // n은 정규화된 법선, 평면: n·p + d = 0
+        void AddPlane(const Vec3& n, float d, float weight)
+        {
+            a00 += weight * n.x * n.x; a11 += weight * n.y * n.y; a22 += weight * n.z * n.z;
+            a01 += weight * n.x * n.y; a02 += weight * n.x * n.z; a12 += weight * n.y * n.z;
+            b0 += weight * n.x * d; b1 += weight * n.y * d; b2 += weight * n.z * d;
+            c += weight * d * d;
+            w += weight;
+        }
+
+        void Add(const Quadric& q)
+        {
+            a00 += q.a00; a11 += q.a11; a22 += q.a22;
+            a01 += q.a01; a02 += q.a02; a12 += q.a12;
+            b0 += q.b0; b1 += q.b1; b2 += q.b2;
+            c += q.c;
+            w += q.w;
+        }
+
+        double Eval(const Vec3& p) const
+        {
+            const double x = p.x, y = p.y, z = p.z;
+            const double r = a00 * x * x + a11 * y * y + a22 * z * z
+                + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+                + 2.0 * (b0 * x + b1 * y + b2 * z)
+                + c;
+            return r > 0.0 ? r : 0.0;
+        }
+    };
+
+    enum VertexKind : uint8_t
+    {
+        KindInterior = 0,
+        KindBorder = 1,     // 열린 경계: 경계 edge를 따라서만 이동
+        KindLocked = 2,     // non-manifold edge에 붙음: 움직이지 않음
+    };
+
+    struct Collapse
+    {
+        uint32_t from;
+        uint32_t to;
+        double cost;
+    };
+
+    uint64_t EdgeKey(uint32_t a, uint32_t b)
+    {
+        return a < b ? ((uint64_t)a << 32 | b) : ((uint64_t)b << 32 | a);
+    }
+}
+
+size_t MeshSimplifier::Simplify(uint32_t* out, const uint32_t* indices, size_t indexCount,
+    const float* positions, size_t positionStride, uint32_t vertexCount,
+    size_t targetIndexCount, float targetError, float* outError)
+{
+    if (outError)
+        *outError = 0.0f;
+
+    indexCount = indexCount / 3 * 3;
+    std::copy(indices, indices + indexCount, out);
+    if (indexCount <= targetIndexCount || vertexCount == 0)
+        return indexCount;
+
+    // 0) 위치를 bounds 최대 변 기준 [0, 1]로 → 오차가 mesh 크기와 무관한 상대값
+    std::vector<Vec3> pos(vertexCount);
+    {
+        Vec3 mn{ +1e30f, +1e30f, +1e30f }, mx{ -1e30f, -1e30f, -1e30f };
+        for (uint32_t v = 0; v < vertexCount; ++v)
+        {
+            pos[v] = LoadPosition(positions, positionStride, v);
+            mn = { std::min(mn.x, pos[v].x), std::min(mn.y, pos[v].y), std::min(mn.z, pos[v].z) };
+            mx = { std::max(mx.x, pos[v].x), std::max(mx.y, pos[v].y), std::max(mx.z, pos[v].z) };
+        }
+
+        const float extent = std::max(mx.x - mn.x, std::max(mx.y - mn.y, mx.z - mn.z));
+        const float scale = extent > 0.0f ? 1.0f / extent : 1.0f;
+        for (Vec3& p : pos)
+            p = { (p.x - mn.x) * scale, (p.y - mn.y) * scale, (p.z - mn.z) * scale };
+    }
+
+    // 1) 위치 용접: 원본 위치 비트가 같은 정점 → group (대표 = 가장 작은 인덱스)
+    //    uv/normal만 다른 정점(wedge)은 같은 group이라 같이 움직임
+    std::vector<uint32_t> group(vertexCount);
+    {
+        std::vector<uint32_t> order(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; ++v)
+            order[v] = v;
+
+        auto less = [&](uint32_t a, uint32_t b)
+            {
+                const int c = std::memcmp(reinterpret_cast<const uint8_t*>(positions) + (size_t)a * positionStride,
+                    reinterpret_cast<const uint8_t*>(positions) + (size_t)b * positionStride, sizeof(float) * 3);
+                return c != 0 ? c < 0 : a < b;
+            };
+        std::sort(order.begin(), order.end(), less);
+
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            const uint32_t v = order[i];
+            const bool same = i > 0 && std::memcmp(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * positionStride,
+                reinterpret_cast<const uint8_t*>(positions) + (size_t)order[i - 1] * positionStride, sizeof(float) * 3) == 0;
+            group[v] = same ? group[order[i - 1]] : v;
+        }
+    }
+
+    // group 기준 퇴화 삼각형은 처음부터 버림
+    size_t count = 0;
+    for (size_t i = 0; i < indexCount; i += 3)
+    {
+        const uint32_t a = out[i], b = out[i + 1], c = out[i + 2];
+        if (group[a] == group[b] || group[b] == group[c] || group[a] == group[c])
+            continue;
+        out[count++] = a; out[count++] = b; out[count++] = c;
+    }
+
+    std::vector<Quadric> quadrics(vertexCount); // group 대표 정점에만 누적
+    std::vector<uint8_t> kind(vertexCount);
+    std::vector<uint8_t> locked(vertexCount);
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint32_t> adjOffset(vertexCount + 1);
+    std::vector<uint32_t> adjTris;
+    std::vector<uint64_t> edges;
+    std::vector<Collapse> candidates;
+    std::vector<std::pair<uint32_t, uint32_t>> wedgePairs;
+
+    const double errorLimit = (double)targetError * targetError;
+    double maxCost = 0.0;
+    bool firstPass = true;
+
+    while (count > targetIndexCount)
+    {
+        const size_t triCount = count / 3;
+
+        // 2) group 단위 edge (정렬된 key, 같은 key 개수 = 그 edge를 쓰는 삼각형 수)
+        edges.clear();
+        for (size_t t = 0; t < triCount; ++t)
+        {
+            for (uint32_t k = 0; k < 3; ++k)
+                edges.push_back(EdgeKey(group[out[t * 3 + k]], group[out[t * 3 + (k + 1) % 3]]));
+        }
+        std::sort(edges.begin(), edges.end());
+
+        std::fill(kind.begin(), kind.end(), (uint8_t)KindInterior);
+        for (size_t i = 0; i < edges.size();)
+        {
+            size_t j = i;
+            while (j < edges.size() && edges[j] == edges[i])
+                ++j;
+
+            const uint32_t a = (uint32_t)(edges[i] >> 32), b = (uint32_t)edges[i];
+            const uint8_t k = (j - i == 1) ? KindBorder : (j - i > 2) ? KindLocked : KindInterior;
+            kind[a] = std::max(kind[a], k);
+            kind[b] = std::max(kind[b], k);
+            i = j;
+        }
+
+        // 3) 첫 pass: 삼각형 평면(면적 가중) + 경계 edge에 수직인 평면
+        if (firstPass)
+        {
+            firstPass = false;
+            for (size_t t = 0; t < triCount; ++t)
+            {
+                const uint32_t* tri = out + t * 3;
+                const Vec3 p0 = pos[tri[0]], p1 = pos[tri[1]], p2 = pos[tri[2]];
+                Vec3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+                const float len = std::sqrt(Dot(n, n));
+                if (len <= 0.0f)
+                    continue;
+                n = { n.x / len, n.y / len, n.z / len };
+
+                const float area = len * 0.5f;
+                for (uint32_t k = 0; k < 3; ++k)
+                    quadrics[group[tri[k]]].AddPlane(n, -Dot(n, p0), area);
+
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    const uint32_t a = group[tri[k]], b = group[tri[(k + 1) % 3]];
+                    const auto range = std::equal_range(edges.begin(), edges.end(), EdgeKey(a, b));
+                    if (range.second - range.first != 1)
+                        continue;
+
+                    const Vec3 e = Sub(pos[b], pos[a]);
+                    Vec3 bn = Cross(e, n);
+                    const float bl = std::sqrt(Dot(bn, bn));
+                    if (bl <= 0.0f)
+                        continue;
+                    bn = { bn.x / bl, bn.y / bl, bn.z / bl };
+
+                    const float weight = Dot(e, e) * BorderWeight;
+                    quadrics[a].AddPlane(bn, -Dot(bn, pos[a]), weight);
+                    quadrics[b].AddPlane(bn, -Dot(bn, pos[a]), weight);
+                }
+            }
+        }
+
+        // 4) group별 삼각형 목록 (CSR)
+        std::fill(adjOffset.begin(), adjOffset.end(), 0u);
+        for (size_t i = 0; i < count; ++i)
+            ++adjOffset[group[out[i]] + 1];
+        for (uint32_t v = 0; v < vertexCount; ++v)
+            adjOffset[v + 1] += adjOffset[v];
+
+        adjTris.resize(count);
+        {
+            std::vector<uint32_t> cursor(adjOffset.begin(), adjOffset.end() - 1);
+            for (size_t i = 0; i < count; ++i)
+                adjTris[cursor[group[out[i]]]++] = (uint32_t)(i / 3);
+        }
+
+        // 5) edge마다 싼 방향의 collapse 후보 (from 위치를 to 위치로)
+        candidates.clear();
+        for (size_t i = 0; i < edges.size();)
+        {
+            size_t j = i;
+            while (j < edges.size() && edges[j] == edges[i])
+                ++j;
+
+            const uint32_t a = (uint32_t)(edges[i] >> 32), b = (uint32_t)edges[i];
+            const bool borderEdge = (j - i == 1);
+            i = j;
+
+            auto allowed = [&](uint32_t from, uint32_t to)
+                {
+                    if (kind[from] == KindLocked)
+                        return false;
+                    if (kind[from] == KindBorder)
+                        return borderEdge && kind[to] != KindInterior;
+                    return true;
+                };
+
+            auto cost = [&](uint32_t from, uint32_t to)
+                {
+                    Quadric q = quadrics[from];
+                    q.Add(quadrics[to]);
+                    return q.w > 0.0 ? q.Eval(pos[to]) / q.w : 0.0;
+                };
+
+            const bool ab = allowed(a, b), ba = allowed(b, a);
+            if (!ab && !ba)
+                continue;
+
+            const double cab = ab ? cost(a, b) : 0.0;
+            const double cba = ba ? cost(b, a) : 0.0;
+            if (ab && (!ba || cab <= cba))
+                candidates.push_back({ a, b, cab });
+            else
+                candidates.push_back({ b, a, cba });
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+            [](const Collapse& x, const Collapse& y) { return x.cost < y.cost; });
+
+        // 6) 싼 것부터 실행. 한 pass 안에서는 fan이 겹치지 않게 주변 group을 잠금
+        for (uint32_t v = 0; v < vertexCount; ++v)
+            remap[v] = v;
+        std::fill(locked.begin(), locked.end(), (uint8_t)0);
+
+        const size_t trianglesToRemove = (count - targetIndexCount + 2) / 3;
+        size_t removed = 0;
+        uint32_t collapses = 0;
+
+        for (const Collapse& c : candidates)
+        {
+            if (removed >= trianglesToRemove || c.cost > errorLimit)
+                break;
+            if (locked[c.from] || locked[c.to])
+                continue;
+
+            // from의 wedge마다 to 쪽 짝 wedge (edge를 공유하는 삼각형에서) → 짝이 없거나 둘이면 seam이 찢어짐
+            // to가 없는 삼각형은 법선이 뒤집히면 안 됨
+            wedgePairs.clear();
+            bool ok = true;
+            uint32_t shared = 0;
+
+            for (uint32_t k = adjOffset[c.from]; k < adjOffset[c.from + 1] && ok; ++k)
+            {
+                const uint32_t* tri = out + (size_t)adjTris[k] * 3;
+
+                int kf = -1, kt = -1;
+                for (int s = 0; s < 3; ++s)
+                {
+                    if (group[tri[s]] == c.from) kf = s;
+                    else if (group[tri[s]] == c.to) kt = s;
+                }
+
+                if (kt < 0)
+                    continue;
+
+                ++shared;
+                auto it = std::find_if(wedgePairs.begin(), wedgePairs.end(),
+                    [&](const std::pair<uint32_t, uint32_t>& p) { return p.first == tri[kf]; });
+                if (it == wedgePairs.end())
+                    wedgePairs.push_back({ tri[kf], tri[kt] });
+                else if (it->second != tri[kt])
+                    ok = false;
+            }
+
+            for (uint32_t k = adjOffset[c.from]; k < adjOffset[c.from + 1] && ok; ++k)
+            {
+                const uint32_t* tri = out + (size_t)adjTris[k] * 3;
+
+                int kf = -1;
+                bool hasTo = false;
+                for (int s = 0; s < 3; ++s)
+                {
+                    if (group[tri[s]] == c.from) kf = s;
+                    else if (group[tri[s]] == c.to) hasTo = true;
+                }
+                if (hasTo)
+                    continue;
+
+                const bool paired = std::any_of(wedgePairs.begin(), wedgePairs.end(),
+                    [&](const std::pair<uint32_t, uint32_t>& p) { return p.first == tri[kf]; });
+                if (!paired)
+                {
+                    ok = false;
+                    break;
+                }
+
+                Vec3 p[3] = { pos[tri[0]], pos[tri[1]], pos[tri[2]] };
+                const Vec3 n0 = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+                p[kf] = pos[c.to];
+                const Vec3 n1 = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+
+                // 뒤집힘 + 거의 세로로 선 sliver(법선이 75도 넘게 돎)도 거부
+                if (Dot(n0, n1) <= 0.25f * std::sqrt(Dot(n0, n0) * Dot(n1, n1)))
+                    ok = false;
+            }
+
+            if (!ok || shared == 0)
+                continue;
+
+            for (const auto& p : wedgePairs)
+                remap[p.first] = p.second;
+            quadrics[c.to].Add(quadrics[c.from]);
+
+            for (uint32_t k = adjOffset[c.from]; k < adjOffset[c.from + 1]; ++k)
+            {
+                const uint32_t* tri = out + (size_t)adjTris[k] * 3;
+                for (int s = 0; s < 3; ++s)
+                    locked[group[tri[s]]] = 1;
+            }
+
+            removed += shared;
+            maxCost = std::max(maxCost, c.cost);
+            ++collapses;
+        }
+
+        if (collapses == 0)
+            break;
+
+        // 7) 인덱스 갱신 + 접힌 삼각형 제거
+        size_t w = 0;
+        for (size_t i = 0; i < count; i += 3)
+        {
+            const uint32_t a = remap[out[i]], b = remap[out[i + 1]], c = remap[out[i + 2]];
+            if (group[a] == group[b] || group[b] == group[c] || group[a] == group[c])
+                continue;
+            out[w++] = a; out[w++] = b; out[w++] = c;
+        }
+        count = w;
+    }
+
+    if (outError)
+        *outError = (float)std::sqrt(maxCost);
+    return count;
+}
+
+std::vector<std::vector<MeshLodLevel>> GenerateImportedMeshLods(ImportedMesh& mesh, uint32_t lodCount,
+    float reduction, float maxError)
+{
+    std::vector<ImportedSubmesh> ranges = mesh.submeshes;
+    if (ranges.empty())
+    {
+        ImportedSubmesh all{};
+        all.indexCount = (uint32_t)mesh.indices.size();
+        ranges.push_back(all);
+    }
+
+    std::vector<std::vector<MeshLodLevel>> out(ranges.size());
+
+    const uint32_t vertexCount = (uint32_t)mesh.vertices.size();
+    if (lodCount < 2 || mesh.indices.empty() || vertexCount == 0)
+        return out;
+
+    std::vector<uint32_t> source;
+    std::vector<uint32_t> lod;
+
+    for (size_t r = 0; r < ranges.size(); ++r)
+    {
+        const size_t total = mesh.indices.size();
+        if (ranges[r].startIndex >= total)
+            continue;
+
+        // mesh.indices는 뒤에 LOD가 붙으며 재할당되므로 원본 구간을 복사해 둠
+        const size_t count = std::min<size_t>(ranges[r].indexCount, total - ranges[r].startIndex) / 3 * 3;
+        source.assign(mesh.indices.begin() + ranges[r].startIndex, mesh.indices.begin() + ranges[r].startIndex + count);
+
+        size_t prevCount = count;
+        for (uint32_t level = 1; level < lodCount; ++level)
+        {
+            const size_t target = (size_t)((double)count * std::pow((double)reduction, (double)level)) / 3 * 3;
+            if (target < MinLodIndexCount)
+                break;
+
+            // 매 단계 원본에서 단순화 (이전 LOD에서 이어 가면 오차가 누적됨)
+            lod.resize(count);
+            float error = 0.0f;
+            const size_t n = MeshSimplifier::Simplify(lod.data(), source.data(), count,
+                &mesh.vertices[0].position.x, sizeof(ImportedVertex), vertexCount, target, maxError, &error);
+
+            // 오차 한계/경계 때문에 거의 못 줄였으면 이전 LOD와 차이가 없음 → 여기서 끝
+            if (n == 0 || n * 10 > prevCount * 9)
+                break;
+
+            MeshOptimizer::OptimizeVertexCache(lod.data(), n, vertexCount);
+
+            MeshLodLevel l{};
+            l.startIndex = (uint32_t)mesh.indices.size();
+            l.indexCount = (uint32_t)n;
+            l.error = error;
+            mesh.indices.insert(mesh.indices.end(), lod.begin(), lod.begin() + n);
+            out[r].push_back(l);
+
+            prevCount = n;
+        }
+    }
+
+    return out;
+}
@@ -0,0 +1,32 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "ImportTypes.h"
+
+// Quadric error metric 기반 mesh 단순화 (Garland-Heckbert, 정점 → 기존 정점 edge collapse)
+// - 새 정점을 만들지 않고 인덱스만 줄임 → LOD가 같은 정점 버퍼를 공유 (submesh 범위만 추가)
+// - 위치가 같은 정점(uv/normal seam)은 같이 움직이고, seam 방향으로만 접힘 (속성이 찢어지지 않게)
+// - 열린 경계는 경계를 따라서만 접히고, 뒤집히는 삼각형이 생기는 collapse는 버림
+namespace MeshSimplifier
+{
+    // targetIndexCount 이하가 되거나 오차가 targetError를 넘기 직전까지 단순화
+    // - out: indexCount 이상 크기, 반환값 = 결과 인덱스 수
+    // - 오차는 mesh bounds 최대 변 길이 대비 상대 거리 (0.01 = 1%), outError에 실제 최대 오차
+    size_t Simplify(uint32_t* out, const uint32_t* indices, size_t indexCount,
+        const float* positions, size_t positionStride, uint32_t vertexCount,
+        size_t targetIndexCount, float targetError, float* outError = nullptr);
+}
+
+// AssetPipeline용: submesh(없으면 전체) 하나의 LOD 하나
+struct MeshLodLevel
+{
+    uint32_t startIndex = 0;
+    uint32_t indexCount = 0;
+    float error = 0.0f;         // Simplify 상대 오차
+};
+
+// submesh마다 LOD1.. 을 만들어 mesh.indices 뒤에 붙임 (정점은 그대로)
+// - LOD k 목표 = 원본 삼각형 수 * reduction^k, 오차가 maxError를 넘거나 더 줄지 않으면 거기서 멈춤
+// - 반환 [submesh][level-1] (submesh가 없으면 [0] = 전체)
+std::vector<std::vector<MeshLodLevel>> GenerateImportedMeshLods(ImportedMesh& mesh, uint32_t lodCount,
+    float reduction, float maxError);
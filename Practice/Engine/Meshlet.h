@@ -0,0 +1,24 @@
+﻿#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+
+// 삼각형 cluster (mesh shader 없이 인덱스 구간으로 그림)
+// - 한 meshlet의 삼각형은 mesh 인덱스 버퍼에서 연속 → 보이는 meshlet이 이어지면 draw 한 번
+// - bounds/cone은 mesh 로컬 공간, ClusterCuller가 world로 옮겨 검사
+static constexpr uint32_t MeshletMaxVertices = 64;
+static constexpr uint32_t MeshletMaxTriangles = 124;
+
+struct Meshlet
+{
+    uint32_t startIndex = 0;        // mesh 인덱스 버퍼 기준
+    uint32_t triangleCount = 0;
+    uint32_t vertexCount = 0;       // 고유 정점 수 (<= MeshletMaxVertices)
+
+    DirectX::XMFLOAT3 center{ 0, 0, 0 };   // bounding sphere
+    float radius = 0.0f;
+
+    // 법선 cone: dot(normalize(center - eye), axis) >= cutoff + radius / |center - eye| 이면 전부 뒷면
+    // cutoff >= 1이면 법선이 넓게 퍼져 있어 backface 컬링 안 함
+    DirectX::XMFLOAT3 coneAxis{ 0, 0, 1 };
+    float coneCutoff = 1.0f;
+};
@@ -0,0 +1,246 @@
+﻿#include "MeshletBuilder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    struct Vec3
+    {
+        float x, y, z;
+    };
+
+    Vec3 LoadPosition(const float* positions, size_t stride, uint32_t v)
+    {
+        const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * stride);
+        return { p[0], p[1], p[2] };
+    }
+
+    Vec3 Sub(const Vec3& a, const Vec3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    Vec3 Cross(const Vec3& a, const Vec3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+    float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    // 단위 법선 (퇴화 삼각형이면 false)
+    bool TriangleNormal(const float* positions, size_t stride, const uint32_t* tri, Vec3& out)
+    {
+        const Vec3 p0 = LoadPosition(positions, stride, tri[0]);
+        const Vec3 p1 = LoadPosition(positions, stride, tri[1]);
+        const Vec3 p2 = LoadPosition(positions, stride, tri[2]);
+
+        const Vec3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+        const float len = std::sqrt(Dot(n, n));
+        if (len <= 0.0f)
+            return false;
+
+        out = { n.x / len, n.y / len, n.z / len };
+        return true;
+    }
+
+    // bounding sphere (AABB 중심 + 가장 먼 정점) + 법선 cone
+    void ComputeMeshletBounds(const uint32_t* tris, uint32_t triCount, const float* positions, size_t stride, Meshlet& m)
+    {
+        Vec3 mn{ +1e30f, +1e30f, +1e30f }, mx{ -1e30f, -1e30f, -1e30f };
+        for (uint32_t i = 0; i < triCount * 3; ++i)
+        {
+            const Vec3 p = LoadPosition(positions, stride, tris[i]);
+            mn = { std::min(mn.x, p.x), std::min(mn.y, p.y), std::min(mn.z, p.z) };
+            mx = { std::max(mx.x, p.x), std::max(mx.y, p.y), std::max(mx.z, p.z) };
+        }
+
+        const Vec3 c{ (mn.x + mx.x) * 0.5f, (mn.y + mx.y) * 0.5f, (mn.z + mx.z) * 0.5f };
+        float r2 = 0.0f;
+        for (uint32_t i = 0; i < triCount * 3; ++i)
+        {
+            const Vec3 d = Sub(LoadPosition(positions, stride, tris[i]), c);
+            r2 = std::max(r2, Dot(d, d));
+        }
+
+        m.center = { c.x, c.y, c.z };
+        m.radius = std::sqrt(r2);
+
+        // cone 축 = 단위 법선 평균, 반각 = 축과 가장 벌어진 법선
+        Vec3 axis{ 0, 0, 0 };
+        for (uint32_t t = 0; t < triCount; ++t)
+        {
+            Vec3 n{};
+            if (TriangleNormal(positions, stride, tris + t * 3, n))
+                axis = { axis.x + n.x, axis.y + n.y, axis.z + n.z };
+        }
+
+        const float axisLen = std::sqrt(Dot(axis, axis));
+        m.coneAxis = { 0, 0, 1 };
+        m.coneCutoff = 1.0f;
+        if (axisLen <= 1e-6f)
+            return;
+
+        axis = { axis.x / axisLen, axis.y / axisLen, axis.z / axisLen };
+
+        float minDot = 1.0f;
+        for (uint32_t t = 0; t < triCount; ++t)
+        {
+            Vec3 n{};
+            if (TriangleNormal(positions, stride, tris + t * 3, n))
+                minDot = std::min(minDot, Dot(axis, n));
+        }
+
+        m.coneAxis = { axis.x, axis.y, axis.z };
+
+        // 거의 반구 이상 퍼져 있으면 어느 방향에서 봐도 앞면이 있음 → 컬링 안 함
+        if (minDot > 0.1f)
+            m.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+}
+
+void MeshletBuilder::Build(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    uint32_t vertexCount, uint32_t baseIndex, std::vector<Meshlet>& out, uint32_t maxVertices, uint32_t maxTriangles)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount == 0 || vertexCount == 0)
+        return;
+
+    maxVertices = std::max(maxVertices, 3u);
+    maxTriangles = std::max(maxTriangles, 1u);
+
+    // 1) 정점 → 삼각형 (CSR) + 삼각형 중심
+    std::vector<uint32_t> adjOffset(vertexCount + 1, 0);
+    for (size_t i = 0; i < triCount * 3; ++i)
+        ++adjOffset[indices[i] + 1];
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        adjOffset[v + 1] += adjOffset[v];
+
+    std::vector<uint32_t> adjTris(triCount * 3);
+    {
+        std::vector<uint32_t> cursor(adjOffset.begin(), adjOffset.end() - 1);
+        for (size_t i = 0; i < triCount * 3; ++i)
+            adjTris[cursor[indices[i]]++] = (uint32_t)(i / 3);
+    }
+
+    std::vector<Vec3> triCenter(triCount);
+    for (size_t t = 0; t < triCount; ++t)
+    {
+        const Vec3 a = LoadPosition(positions, positionStride, indices[t * 3 + 0]);
+        const Vec3 b = LoadPosition(positions, positionStride, indices[t * 3 + 1]);
+        const Vec3 c = LoadPosition(positions, positionStride, indices[t * 3 + 2]);
+        triCenter[t] = { (a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f };
+    }
+
+    // 2) meshlet 키우기
+    std::vector<uint8_t> emitted(triCount, 0);
+    std::vector<uint32_t> vertexTag(vertexCount, InvalidIndex); // 정점이 들어간 마지막 meshlet 번호
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> result;
+    result.reserve(triCount * 3);
+
+    size_t seed = 0;
+    uint32_t meshletId = 0;
+    while (result.size() < triCount * 3)
+    {
+        while (emitted[seed])
+            ++seed;
+
+        Meshlet m{};
+        m.startIndex = baseIndex + (uint32_t)result.size();
+
+        Vec3 sum{ 0, 0, 0 };
+        candidates.clear();
+
+        uint32_t next = (uint32_t)seed;
+        while (next != InvalidIndex)
+        {
+            emitted[next] = 1;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const uint32_t v = indices[(size_t)next * 3 + k];
+                result.push_back(v);
+
+                if (vertexTag[v] == meshletId)
+                    continue;
+
+                vertexTag[v] = meshletId;
+                ++m.vertexCount;
+                for (uint32_t a = adjOffset[v]; a < adjOffset[v + 1]; ++a)
+                {
+                    if (!emitted[adjTris[a]])
+                        candidates.push_back(adjTris[a]);
+                }
+            }
+
+            sum = { sum.x + triCenter[next].x, sum.y + triCenter[next].y, sum.z + triCenter[next].z };
+            ++m.triangleCount;
+            if (m.triangleCount >= maxTriangles)
+                break;
+
+            // 새 정점이 적은 이웃 → 같으면 meshlet 중심에 가까운 이웃 (둥글게 자라야 bounds/cone이 작음)
+            const float inv = 1.0f / (float)m.triangleCount;
+            const Vec3 center{ sum.x * inv, sum.y * inv, sum.z * inv };
+
+            next = InvalidIndex;
+            uint32_t bestNew = 4;
+            float bestDist = 0.0f;
+
+            size_t live = 0;
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                const uint32_t t = candidates[i];
+                if (emitted[t])
+                    continue;
+                candidates[live++] = t;
+
+                uint32_t newVerts = 0;
+                for (uint32_t k = 0; k < 3; ++k)
+                    newVerts += (vertexTag[indices[(size_t)t * 3 + k]] != meshletId) ? 1u : 0u;
+
+                if (m.vertexCount + newVerts > maxVertices)
+                    continue;
+
+                const Vec3 d = Sub(triCenter[t], center);
+                const float dist = Dot(d, d);
+                if (newVerts < bestNew || (newVerts == bestNew && dist < bestDist))
+                {
+                    next = t;
+                    bestNew = newVerts;
+                    bestDist = dist;
+                }
+            }
+            candidates.resize(live);
+        }
+
+        ComputeMeshletBounds(result.data() + (m.startIndex - baseIndex), m.triangleCount, positions, positionStride, m);
+        out.push_back(m);
+        ++meshletId;
+    }
+
+    std::copy(result.begin(), result.end(), indices);
+}
+
+std::vector<Meshlet> BuildImportedMeshMeshlets(ImportedMesh& mesh, uint32_t baseIndexCount)
+{
+    std::vector<Meshlet> out;
+
+    const uint32_t vertexCount = (uint32_t)mesh.vertices.size();
+    const size_t total = std::min<size_t>(baseIndexCount, mesh.indices.size());
+    if (total == 0 || vertexCount == 0)
+        return out;
+
+    std::vector<ImportedSubmesh> ranges = mesh.submeshes;
+    if (ranges.empty())
+    {
+        ImportedSubmesh all{};
+        all.indexCount = (uint32_t)total;
+        ranges.push_back(all);
+    }
+
+    for (const ImportedSubmesh& r : ranges)
+    {
+        if (r.startIndex >= total)
+            continue;
+
+        const size_t count = std::min<size_t>(r.indexCount, total - r.startIndex) / 3 * 3;
+        MeshletBuilder::Build(mesh.indices.data() + r.startIndex, count, &mesh.vertices[0].position.x, sizeof(ImportedVertex),
+            vertexCount, r.startIndex, out);
+    }
+
+    std::sort(out.begin(), out.end(), [](const Meshlet& a, const Meshlet& b) { return a.startIndex < b.startIndex; });
+    return out;
+}
@@ -0,0 +1,21 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "Meshlet.h"
+#include "ImportTypes.h"
+
+// 인덱스 구간을 meshlet 단위로 재배치 (in place) + meshlet bounds/cone 계산
+// - 시작 삼각형에서 이웃 삼각형으로 키움: 새 정점이 적은 것 → meshlet 중심에 가까운 것 순
+// - 정점/삼각형 한도를 넘거나 이웃이 없으면 다음 meshlet
+// - 입력 순서(캐시 최적화 결과)를 시작점 순서로 써서 meshlet 안 캐시 지역성도 대부분 유지
+namespace MeshletBuilder
+{
+    // indices[0, indexCount)를 재배치하고 meshlet을 out 뒤에 추가, startIndex = baseIndex + 구간 내 위치
+    void Build(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+        uint32_t vertexCount, uint32_t baseIndex, std::vector<Meshlet>& out,
+        uint32_t maxVertices = MeshletMaxVertices, uint32_t maxTriangles = MeshletMaxTriangles);
+}
+
+// AssetPipeline용: submesh(없으면 [0, baseIndexCount))마다 meshlet 생성 (LOD 구간은 건드리지 않음)
+// 반환 meshlet은 startIndex 순
+std::vector<Meshlet> BuildImportedMeshMeshlets(ImportedMesh& mesh, uint32_t baseIndexCount);
@@ -3,6 +3,7 @@
 #include <vector>
 #include <DirectXMath.h>
 #include "MeshHandle.h"
+#include "MeshComponent.h"
 
 struct ModelAssetSubmesh
 {
@@ -10,6 +11,8 @@ struct ModelAssetSubmesh
     uint32_t indexCount = 0;
     uint32_t materialIndex = 0;
     std::string name;
+
+    MeshLodChain lods;  //  mesh  ܼȭ  (ImportOptions::lodCount)
 };
 
 struct ModelAssetMesh
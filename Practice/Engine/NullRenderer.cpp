@@ -0,0 +1,279 @@
+﻿#include "NullRenderer.h"
+#include "MeshManager.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace DirectX;
+
+namespace
+{
+    bool IsFinite(const XMFLOAT4X4& m)
+    {
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                if (!std::isfinite(m.m[r][c]))
+                    return false;
+        return true;
+    }
+
+    bool IsFinite(const XMFLOAT3& v) { return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z); }
+    bool IsFinite(const XMFLOAT4& v) { return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z) && std::isfinite(v.w); }
+
+    // D3D12Renderer GeometryLayout과 같은 비트 (정렬 키 pipeline 필드)
+    uint8_t PipelineOf(const MeshCPUData& cpu)
+    {
+        uint8_t layout = 0;
+        if (cpu.vertexFormat == MeshVertexFormat::Compact)
+            layout |= 1u << 0;
+        if (cpu.Uses32BitIndices())
+            layout |= 1u << 1;
+        return layout;
+    }
+}
+
+void NullRenderer::Initialize(void* /*nativeWindow*/, uint32_t width, uint32_t height)
+{
+    m_width = width;
+    m_height = height;
+    m_initialized = true;
+
+    // D3D12Renderer와 같이 bindless 텍스처 (텍스처로는 batch가 안 갈라짐)
+    m_instanceBatcher.SetBindlessTextures(true);
+    ResetStats();
+}
+
+void NullRenderer::Resize(uint32_t width, uint32_t height)
+{
+    if (width == 0 || height == 0)
+    {
+        Error("Resize: zero size");
+        return;
+    }
+
+    m_width = width;
+    m_height = height;
+}
+
+void NullRenderer::Render(const std::vector<RenderItem>& items, const RenderCamera& cam, const FrameLights& lights, TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text)
+{
+    m_last = {};
+    if (!m_initialized)
+        Error("Render before Initialize");
+
+    ValidateCamera(cam);
+    ValidateItems(items);
+    ValidateLights(lights);
+    ValidateUI(ui, text);
+
+    if (skybox.IsValid())
+    {
+        ValidateTexture(skybox, true, "skybox", 0);
+        m_last.skyboxDraws = 1;
+    }
+
+    // -------- D3D12Renderer와 같은 CPU 단계: light cluster 배정 → (texture, mesh, submesh) 배칭
+    m_lightClusterer.Build(lights.lights.data(), (uint32_t)std::min<size_t>(lights.lights.size(), MaxLightsPerFrame), cam);
+    m_last.lights = (uint32_t)lights.lights.size();
+    m_last.lightIndices = m_lightClusterer.GetStats().indices;
+
+    const uint32_t itemCount = (uint32_t)items.size();
+    m_itemSrvIndices.resize(itemCount);
+    m_itemPipelines.resize(itemCount);
+
+    // 텍스처 슬롯은 GPU 힙이 없으니 핸들 id 그대로 (invalid = 0 = 기본 슬롯, D3D12Renderer와 같음)
+    uint32_t lastMeshId = 0xFFFFFFFFu;
+    uint8_t lastPipeline = 0;
+    for (uint32_t i = 0; i < itemCount; ++i)
+    {
+        m_itemSrvIndices[i] = items[i].albedo.id;
+
+        if (items[i].mesh.id != lastMeshId)
+        {
+            lastMeshId = items[i].mesh.id;
+            lastPipeline = (m_meshManager && m_meshManager->IsValid(items[i].mesh)) ? PipelineOf(m_meshManager->Get(items[i].mesh)) : 0;
+        }
+        m_itemPipelines[i] = lastPipeline;
+    }
+
+    m_instanceBatcher.Build(items, m_itemSrvIndices, m_itemPipelines, cam.view, itemCount);
+    CountBatchState();
+
+    RenderUI(ui);
+
+    m_last.textDraws = (uint32_t)text.size();
+    for (const UITextDraw& t : text)
+        m_last.textChars += (uint32_t)t.text.size();
+
+    Accumulate();
+}
+
+void NullRenderer::RenderUI(const std::vector<UIDrawItem>& ui)
+{
+    m_last.uiItems = (uint32_t)ui.size();
+}
+
+void NullRenderer::Shutdown()
+{
+    m_initialized = false;
+    m_itemSrvIndices.clear();
+    m_itemPipelines.clear();
+}
+
+void NullRenderer::ResetStats()
+{
+    m_frames = 0;
+    m_last = {};
+    m_total = {};
+    m_errors.clear();
+}
+
+void NullRenderer::ValidateCamera(const RenderCamera& cam)
+{
+    if (!IsFinite(cam.view) || !IsFinite(cam.proj) || !IsFinite(cam.positionWS))
+        Error("camera: non-finite view/proj/position");
+
+    // 원근이든 직교든 _11/_22가 0이면 화면이 퇴화
+    if (cam.proj._11 == 0.0f || cam.proj._22 == 0.0f)
+        Error("camera: degenerate projection");
+}
+
+void NullRenderer::ValidateItems(const std::vector<RenderItem>& items)
+{
+    m_last.items = (uint32_t)items.size();
+
+    for (uint32_t i = 0; i < (uint32_t)items.size(); ++i)
+    {
+        const RenderItem& it = items[i];
+
+        if (!it.mesh.IsValid())
+        {
+            Error("item " + std::to_string(i) + ": invalid mesh handle");
+            continue;
+        }
+        if (!IsFinite(it.world) || !IsFinite(it.color))
+            Error("item " + std::to_string(i) + ": non-finite world/color");
+
+        ValidateTexture(it.albedo, false, "item albedo", i);
+
+        if (!m_meshManager)
+            continue;
+
+        if (!m_meshManager->IsValid(it.mesh))
+        {
+            Error("item " + std::to_string(i) + ": mesh " + std::to_string(it.mesh.id) + " not in MeshManager");
+            continue;
+        }
+
+        // indexCount 0 = 전체 (D3D12Renderer는 startIndex부터 mesh 인덱스 수만큼 그림)
+        const uint32_t total = m_meshManager->Get(it.mesh).GetIndexCount();
+        const uint64_t end = (uint64_t)it.startIndex + (it.indexCount ? it.indexCount : total);
+        if (end > total)
+            Error("item " + std::to_string(i) + ": index range [" + std::to_string(it.startIndex) + ", " + std::to_string(end) +
+                ") outside mesh (" + std::to_string(total) + " indices)");
+        else if (it.indexCount % 3 != 0)
+            Error("item " + std::to_string(i) + ": indexCount not a multiple of 3");
+    }
+}
+
+void NullRenderer::ValidateLights(const FrameLights& lights)
+{
+    if (lights.lights.size() > MaxLightsPerFrame)
+        Error("lights: " + std::to_string(lights.lights.size()) + " > MaxLightsPerFrame");
+
+    for (uint32_t i = 0; i < (uint32_t)lights.lights.size(); ++i)
+    {
+        const FrameLight& L = lights.lights[i];
+        if (L.type > 2)
+            Error("light " + std::to_string(i) + ": unknown type " + std::to_string(L.type));
+        if (!IsFinite(L.positionWS) || !IsFinite(L.directionWS) || !IsFinite(L.color) || !std::isfinite(L.intensity))
+            Error("light " + std::to_string(i) + ": non-finite value");
+        if (L.type != 0 && !(L.range >= 0.0f))
+            Error("light " + std::to_string(i) + ": negative range");
+        if (L.type == 2 && L.innerCos < L.outerCos)
+            Error("light " + std::to_string(i) + ": spot inner cone wider than outer");
+    }
+}
+
+void NullRenderer::ValidateUI(const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text)
+{
+    for (uint32_t i = 0; i < (uint32_t)ui.size(); ++i)
+    {
+        const UIDrawItem& u = ui[i];
+        if (!std::isfinite(u.x) || !std::isfinite(u.y) || !(u.w >= 0.0f) || !(u.h >= 0.0f) || !IsFinite(u.color))
+            Error("ui " + std::to_string(i) + ": bad rect/color");
+        ValidateTexture(u.tex, false, "ui", i);
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)text.size(); ++i)
+    {
+        if (!(text[i].sizePx > 0.0f) || !std::isfinite(text[i].x) || !std::isfinite(text[i].y))
+            Error("text " + std::to_string(i) + ": bad position/size");
+    }
+}
+
+void NullRenderer::ValidateTexture(TextureHandle h, bool cube, const char* what, uint32_t index)
+{
+    if (!h.IsValid() || !m_textureQuery)
+        return;
+
+    const TextureKind kind = m_textureQuery(h);
+    if (kind == TextureKind::Missing)
+        Error(std::string(what) + " " + std::to_string(index) + ": texture " + std::to_string(h.id) + " not in TextureManager");
+    else if ((kind == TextureKind::Cubemap) != cube)
+        Error(std::string(what) + " " + std::to_string(index) + ": texture " + std::to_string(h.id) + (cube ? " is not a cubemap" : " is a cubemap"));
+}
+
+void NullRenderer::CountBatchState()
+{
+    const InstanceBatchStats& bs = m_instanceBatcher.GetStats();
+    m_last.batches = bs.batches;
+    m_last.instances = bs.instances;
+
+    uint32_t pipeline = 0xFFFFFFFFu, srv = 0xFFFFFFFFu, mesh = 0xFFFFFFFFu;
+    for (const InstanceBatch& b : m_instanceBatcher.GetBatches())
+    {
+        m_last.pipelineChanges += (b.pipeline != pipeline) ? 1u : 0u;
+        m_last.textureChanges += (!m_instanceBatcher.IsBindlessTextures() && b.srvIndex != srv) ? 1u : 0u;
+        m_last.meshChanges += (b.meshId != mesh) ? 1u : 0u;
+        pipeline = b.pipeline;
+        srv = b.srvIndex;
+        mesh = b.meshId;
+
+        uint32_t indexCount = b.indexCount;
+        if (indexCount == 0 && m_meshManager && m_meshManager->IsValid({ b.meshId }))
+            indexCount = m_meshManager->Get({ b.meshId }).GetIndexCount();
+        m_last.triangles += (uint64_t)(indexCount / 3) * b.instanceCount;
+    }
+}
+
+void NullRenderer::Accumulate()
+{
+    ++m_frames;
+
+    m_total.items += m_last.items;
+    m_total.batches += m_last.batches;
+    m_total.instances += m_last.instances;
+    m_total.triangles += m_last.triangles;
+    m_total.pipelineChanges += m_last.pipelineChanges;
+    m_total.textureChanges += m_last.textureChanges;
+    m_total.meshChanges += m_last.meshChanges;
+    m_total.skyboxDraws += m_last.skyboxDraws;
+    m_total.lights += m_last.lights;
+    m_total.lightIndices += m_last.lightIndices;
+    m_total.uiItems += m_last.uiItems;
+    m_total.textDraws += m_last.textDraws;
+    m_total.textChars += m_last.textChars;
+}
+
+void NullRenderer::Error(const std::string& message)
+{
+    // Render 밖(Resize)에서 난 것도 누적에는 들어가도록 둘 다 셈
+    ++m_last.errors;
+    ++m_total.errors;
+    if (m_errors.size() < MaxRecordedErrors)
+        m_errors.push_back("frame " + std::to_string(m_frames) + ": " + message);
+
+    if (m_throwOnError)
+        throw std::runtime_error("NullRenderer: " + message);
+}
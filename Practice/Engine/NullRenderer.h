@@ -0,0 +1,104 @@
+﻿#pragma once
+#include "IRenderer.h"
+#include "InstanceBatcher.h"
+#include "LightClusterer.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class MeshManager;
+
+// 한 프레임(Render 1번)에서 본 것
+struct NullRenderStats
+{
+    uint32_t items = 0;             // 입력 RenderItem 수
+    uint32_t batches = 0;           // instanced draw 수 (D3D12Renderer와 같은 InstanceBatcher)
+    uint32_t instances = 0;
+    uint64_t triangles = 0;         // batch indexCount/3 * instanceCount 합
+
+    // batch 순서대로 그렸을 때 바뀌는 상태 수 (첫 batch도 1번으로 셈)
+    uint32_t pipelineChanges = 0;   // 정점 포맷/인덱스 크기 변형
+    uint32_t textureChanges = 0;    // SRV 테이블 (bindless면 0)
+    uint32_t meshChanges = 0;       // VB/IB
+
+    uint32_t skyboxDraws = 0;
+    uint32_t lights = 0;
+    uint32_t lightIndices = 0;      // cluster 목록 총 길이 (LightClusterer)
+    uint32_t uiItems = 0;
+    uint32_t textDraws = 0;
+    uint32_t textChars = 0;
+
+    uint32_t errors = 0;            // 검증 실패 수
+};
+
+// GPU/창 없는 IRenderer (D3D 의존 없음)
+// - Render() 입력을 D3D12Renderer와 같은 규칙으로 검증하고, 같은 CPU 단계(InstanceBatcher, LightClusterer)를 돌려 통계만 남김
+// - 헤드리스 프레임 벤치(Application::InitializeHeadless)와 FrameLoop 테스트에서 씀. 플랫폼 의존 없음
+// - 검증 실패는 기본적으로 기록만 (GetErrors). SetThrowOnError(true)면 std::runtime_error
+// - MeshManager/텍스처 조회를 안 주면 핸들 존재/인덱스 범위 검사는 건너뜀
+class NullRenderer : public IRenderer
+{
+public:
+    static constexpr uint32_t MaxRecordedErrors = 64;   // 메시지는 앞쪽 것만 보관 (개수는 전부 셈)
+
+    // 텍스처 핸들 조회 결과. TextureManager는 WIC 로더(Windows.h)에 묶여 있어서 직접 안 받고 함수로 받음
+    enum class TextureKind : uint8_t { Missing, Texture2D, Cubemap };
+    using TextureQueryFn = std::function<TextureKind(TextureHandle h)>;
+
+    void Initialize(void* nativeWindow, uint32_t width, uint32_t height) override;
+    void Resize(uint32_t width, uint32_t height) override;
+
+    void Render(const std::vector<RenderItem>& items, const RenderCamera& cam, const FrameLights& lights, TextureHandle skybox, const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text) override;
+    void RenderUI(const std::vector<UIDrawItem>& ui) override;
+
+    void Shutdown() override;
+
+    void SetMeshManager(const MeshManager* meshes) { m_meshManager = meshes; }
+    void SetTextureQuery(TextureQueryFn query) { m_textureQuery = std::move(query); }
+    void SetThrowOnError(bool enabled) { m_throwOnError = enabled; }
+
+    uint32_t GetWidth() const { return m_width; }
+    uint32_t GetHeight() const { return m_height; }
+
+    uint64_t GetFrameCount() const { return m_frames; }
+    const NullRenderStats& GetLastFrameStats() const { return m_last; }
+    const NullRenderStats& GetTotalStats() const { return m_total; }     // Initialize 이후 누적
+    const std::vector<std::string>& GetErrors() const { return m_errors; }
+
+    const InstanceBatcher& GetInstanceBatcher() const { return m_instanceBatcher; }
+    const LightClusterer& GetLightClusterer() const { return m_lightClusterer; }
+
+    void ResetStats();
+
+private:
+    void ValidateCamera(const RenderCamera& cam);
+    void ValidateItems(const std::vector<RenderItem>& items);
+    void ValidateLights(const FrameLights& lights);
+    void ValidateUI(const std::vector<UIDrawItem>& ui, const std::vector<UITextDraw>& text);
+    void ValidateTexture(TextureHandle h, bool cube, const char* what, uint32_t index);
+
+    void CountBatchState();
+    void Accumulate();
+
+    void Error(const std::string& message);
+
+private:
+    const MeshManager* m_meshManager = nullptr;
+    TextureQueryFn m_textureQuery;
+    bool m_throwOnError = false;
+    bool m_initialized = false;
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+
+    InstanceBatcher m_instanceBatcher;
+    LightClusterer m_lightClusterer;
+    std::vector<uint32_t> m_itemSrvIndices;
+    std::vector<uint8_t> m_itemPipelines;
+
+    uint64_t m_frames = 0;
+    NullRenderStats m_last{};
+    NullRenderStats m_total{};
+    std::vector<std::string> m_errors;
+};
@@ -0,0 +1,111 @@
+﻿#include "OcclusionBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include "MeshManager.h"
+#include "RenderSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+
+using namespace DirectX;
+
+OcclusionBenchResult RunOcclusionBench(uint32_t propCount, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    OcclusionBenchResult r{};
+    runs = std::max(runs, 1u);
+
+    // 단위 박스 (렌더 mesh = 가리개 mesh)
+    MeshManager meshes;
+    MeshCPUData box;
+    for (int i = 0; i < 8; ++i)
+        box.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    box.SetIndices({ 0,2,1, 1,2,3, 4,5,6, 5,7,6, 0,1,4, 1,5,4, 2,6,3, 3,6,7, 0,4,2, 2,4,6, 1,3,5, 3,7,5 });
+    const MeshHandle mesh = meshes.Create(box);
+
+    World w;
+
+    // 건물: z = 0, 20, .. 180 줄마다 폭 18 높이 30 (틈 2)
+    for (int row = 0; row < 10; ++row)
+    {
+        for (int col = -5; col < 5; ++col)
+        {
+            EntityId e = w.CreateEntity();
+            w.AddTransform(e);
+            w.SetLocalPosition(e, { col * 20.0f + 10.0f, 15.0f, row * 20.0f });
+            w.SetLocalScale(e, { 18.0f, 30.0f, 4.0f });
+
+            MeshComponent mc{ mesh };
+            mc.occluder = mesh;
+            w.AddMesh(e, mc);
+        }
+    }
+
+    // 건물 줄 사이 소품
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> ux(-100.0f, 100.0f), uz(3.0f, 197.0f);
+    for (uint32_t i = 0; i < propCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { ux(rng), 0.5f, uz(rng) });
+        w.AddMesh(e, MeshComponent{ mesh });
+    }
+    r.entities = propCount + 100;
+
+    w.BeginFrame();
+    w.UpdateTransforms();
+
+    // 첫 줄 앞 길 위, 사람 눈높이
+    RenderCamera cam{};
+    cam.positionWS = { 1.0f, 2.0f, -30.0f };
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMVectorSet(1, 2, -30, 1), XMVectorSet(1, 2, 100, 1), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f));
+
+    RenderSystem frustumOnly;
+    frustumOnly.SetMeshManager(&meshes);
+    frustumOnly.SetOcclusionCullingEnabled(false);
+
+    RenderSystem occlusion;
+    occlusion.SetMeshManager(&meshes);
+
+    std::vector<RenderItem> frustumItems;
+    std::vector<RenderItem> occludedItems;
+
+    // proxy 생성 / 용량 확보
+    frustumOnly.Build(w, cam, frustumItems);
+    occlusion.Build(w, cam, occludedItems);
+
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        auto t0 = Clock::now();
+        frustumOnly.Build(w, cam, frustumItems);
+        auto t1 = Clock::now();
+        occlusion.Build(w, cam, occludedItems);
+        auto t2 = Clock::now();
+
+        r.frustumOnlyMs += ms(t0, t1);
+        r.occlusionMs += ms(t1, t2);
+    }
+    r.frustumOnlyMs /= runs;
+    r.occlusionMs /= runs;
+
+    r.drawsFrustum = (uint32_t)frustumItems.size();
+    r.drawsOccluded = (uint32_t)occludedItems.size();
+    r.occluders = occlusion.GetOcclusionStats().occluders;
+    r.triangles = occlusion.GetOcclusionStats().triangles;
+
+    // 둘 다 proxy 순서 → 오클루전 결과는 프러스텀 결과에서 몇 개 빠진 것
+    size_t j = 0;
+    for (size_t i = 0; i < frustumItems.size() && j < occludedItems.size(); ++i)
+    {
+        if (std::memcmp(&frustumItems[i].world, &occludedItems[j].world, sizeof(XMFLOAT4X4)) == 0)
+            ++j;
+    }
+    r.subset = j == occludedItems.size();
+
+    return r;
+}
@@ -0,0 +1,20 @@
+﻿#pragma once
+#include <cstdint>
+
+// 소프트웨어 오클루전 컬링 하네스 (순차 Build)
+// - 별도 World에 건물 줄(가리개 = 자기 박스 mesh) 사이로 propCount개 작은 박스 → 거리 높이 카메라
+// - 오클루전 끔 / 켬 RenderSystem::Build 평균 시간 + 남은 draw 수
+struct OcclusionBenchResult
+{
+    uint32_t entities = 0;
+    uint32_t occluders = 0;             // 프러스텀 안 가리개 (래스터한 것)
+    uint32_t triangles = 0;             // 래스터한 삼각형
+    uint32_t drawsFrustum = 0;          // 프러스텀 컬링만
+    uint32_t drawsOccluded = 0;         // 오클루전까지
+
+    double frustumOnlyMs = 0.0;
+    double occlusionMs = 0.0;           // 가리개 래스터 + Hi-Z 검사 포함
+    bool subset = false;                // 오클루전 결과가 프러스텀 결과의 부분집합인지
+};
+
+OcclusionBenchResult RunOcclusionBench(uint32_t propCount, uint32_t runs = 8);
@@ -0,0 +1,311 @@
+﻿#include "OcclusionCuller.h"
+#include "MeshManager.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace DirectX;
+
+namespace
+{
+    // 이 레벨에서 사각형이 차지하는 texel이 이 값 이하가 되는 가장 낮은 레벨을 읽음 (4x4 = 16번 이하)
+    constexpr uint32_t HiZMaxSpan = 4;
+}
+
+void OcclusionCuller::SetResolution(uint32_t width, uint32_t height)
+{
+    m_width = std::max((width + 3u) & ~3u, 4u);
+    m_height = std::max(height, 1u);
+    m_hasOccluders = false;
+}
+
+void OcclusionCuller::Render(const MeshManager& meshes, const std::vector<OccluderInstance>& occluders, const XMFLOAT4X4& viewProj)
+{
+    m_stats = {};
+    m_viewProj = viewProj;
+    m_hasOccluders = false;
+    if (occluders.empty())
+        return;
+
+    m_depth.assign((size_t)m_width * m_height, 1.0f);
+
+    const XMMATRIX VP = XMLoadFloat4x4(&viewProj);
+    for (const OccluderInstance& o : occluders)
+    {
+        if (!meshes.IsValid(o.mesh))
+            continue;
+
+        const MeshCPUData& mesh = meshes.Get(o.mesh);
+        const uint32_t indexCount = mesh.GetIndexCount();
+        if (indexCount < 3)
+            continue;
+
+        // 정점 → clip 한 번씩
+        const XMMATRIX WVP = XMMatrixMultiply(XMLoadFloat4x4(&o.world), VP);
+        m_clip.resize(mesh.positions.size());
+        for (size_t v = 0; v < mesh.positions.size(); ++v)
+            XMStoreFloat4(&m_clip[v], XMVector3Transform(XMLoadFloat3(&mesh.positions[v]), WVP));
+
+        for (uint32_t i = 0; i + 2 < indexCount; i += 3)
+            ClipAndRasterize(m_clip[mesh.GetIndex(i)], m_clip[mesh.GetIndex(i + 1)], m_clip[mesh.GetIndex(i + 2)]);
+
+        ++m_stats.occluders;
+    }
+
+    m_hasOccluders = m_stats.triangles > 0;
+    if (m_hasOccluders)
+        BuildHiZ();
+}
+
+void OcclusionCuller::ClipAndRasterize(const XMFLOAT4& a, const XMFLOAT4& b, const XMFLOAT4& c)
+{
+    auto toScreen = [this](const XMFLOAT4& p) -> XMFLOAT3
+        {
+            const float invW = 1.0f / p.w;
+            return { (p.x * invW * 0.5f + 0.5f) * (float)m_width, (0.5f - p.y * invW * 0.5f) * (float)m_height, p.z * invW };
+        };
+
+    const XMFLOAT4* v[3] = { &a, &b, &c };
+    const bool inside[3] = { a.z >= 0.0f, b.z >= 0.0f, c.z >= 0.0f };
+    const int insideCount = (int)inside[0] + (int)inside[1] + (int)inside[2];
+
+    if (insideCount == 0)
+        return;
+
+    if (insideCount == 3)
+    {
+        RasterizeTriangle(toScreen(a), toScreen(b), toScreen(c));
+        ++m_stats.triangles;
+        return;
+    }
+
+    // near(z = 0)에서 자른 다각형 (3~4개 정점, 감기 순서 유지) → 부채꼴
+    ++m_stats.nearClipped;
+
+    XMFLOAT4 poly[4];
+    int n = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        const XMFLOAT4& p = *v[i];
+        const XMFLOAT4& q = *v[(i + 1) % 3];
+        if (inside[i])
+            poly[n++] = p;
+        if (inside[i] != inside[(i + 1) % 3])
+        {
+            const float t = p.z / (p.z - q.z);
+            poly[n++] = { p.x + (q.x - p.x) * t, p.y + (q.y - p.y) * t, 0.0f, p.w + (q.w - p.w) * t };
+        }
+    }
+
+    for (int i = 1; i + 1 < n; ++i)
+    {
+        // z = 0인 점은 w = near > 0 (원근 투영)
+        if (poly[0].w <= 0.0f || poly[i].w <= 0.0f || poly[i + 1].w <= 0.0f)
+            continue;
+
+        RasterizeTriangle(toScreen(poly[0]), toScreen(poly[i]), toScreen(poly[i + 1]));
+        ++m_stats.triangles;
+    }
+}
+
+void OcclusionCuller::RasterizeTriangle(const XMFLOAT3& a, const XMFLOAT3& b, const XMFLOAT3& c)
+{
+    const float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (!(std::fabs(area) > 1e-8f))
+        return;
+
+    // 픽셀 중심(x + 0.5)이 닿을 수 있는 범위, x 시작은 4칸 정렬
+    const float fMinX = std::min({ a.x, b.x, c.x }), fMaxX = std::max({ a.x, b.x, c.x });
+    const float fMinY = std::min({ a.y, b.y, c.y }), fMaxY = std::max({ a.y, b.y, c.y });
+    if (fMaxX < 0.0f || fMaxY < 0.0f || fMinX >= (float)m_width || fMinY >= (float)m_height)
+        return;
+
+    const int minX = std::max((int)std::floor(fMinX), 0) & ~3;
+    const int maxX = std::min((int)std::ceil(fMaxX), (int)m_width - 1);
+    const int minY = std::max((int)std::floor(fMinY), 0);
+    const int maxY = std::min((int)std::ceil(fMaxY), (int)m_height - 1);
+
+    // barycentric w_i(p) = A_i * x + B_i * y + C_i (1/area로 미리 나눔 → 감기 방향과 상관없이 안쪽이 >= 0)
+    const float inv = 1.0f / area;
+    const float A0 = (b.y - c.y) * inv, B0 = (c.x - b.x) * inv, C0 = (b.x * c.y - b.y * c.x) * inv;
+    const float A1 = (c.y - a.y) * inv, B1 = (a.x - c.x) * inv, C1 = (c.x * a.y - c.y * a.x) * inv;
+    const float A2 = (a.y - b.y) * inv, B2 = (b.x - a.x) * inv, C2 = (a.x * b.y - a.y * b.x) * inv;
+
+    // z는 화면 공간에서 선형: z = Zx * x + Zy * y + Z0
+    const float Zx = A0 * a.z + A1 * b.z + A2 * c.z;
+    const float Zy = B0 * a.z + B1 * b.z + B2 * c.z;
+    const float Z0 = C0 * a.z + C1 * b.z + C2 * c.z;
+
+    // 레인 0~3 = x, x+1, x+2, x+3 (픽셀 중심)
+    const XMVECTOR lane = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+    const XMVECTOR zero = XMVectorZero();
+    const XMVECTOR vA0 = XMVectorReplicate(A0), vA1 = XMVectorReplicate(A1), vA2 = XMVectorReplicate(A2), vZx = XMVectorReplicate(Zx);
+    const XMVECTOR step0 = XMVectorReplicate(A0 * 4.0f), step1 = XMVectorReplicate(A1 * 4.0f);
+    const XMVECTOR step2 = XMVectorReplicate(A2 * 4.0f), stepZ = XMVectorReplicate(Zx * 4.0f);
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        const float py = (float)y + 0.5f;
+        const XMVECTOR px = XMVectorAdd(lane, XMVectorReplicate((float)minX));
+
+        XMVECTOR w0 = XMVectorMultiplyAdd(px, vA0, XMVectorReplicate(B0 * py + C0));
+        XMVECTOR w1 = XMVectorMultiplyAdd(px, vA1, XMVectorReplicate(B1 * py + C1));
+        XMVECTOR w2 = XMVectorMultiplyAdd(px, vA2, XMVectorReplicate(B2 * py + C2));
+        XMVECTOR z = XMVectorMultiplyAdd(px, vZx, XMVectorReplicate(Zy * py + Z0));
+
+        float* row = m_depth.data() + (size_t)y * m_width;
+        for (int x = minX; x <= maxX; x += 4)
+        {
+            const XMVECTOR mask = XMVectorAndInt(XMVectorAndInt(XMVectorGreaterOrEqual(w0, zero), XMVectorGreaterOrEqual(w1, zero)),
+                XMVectorGreaterOrEqual(w2, zero));
+
+            if (!XMVector4EqualInt(mask, XMVectorFalseInt()))
+            {
+                XMFLOAT4* dst = reinterpret_cast<XMFLOAT4*>(row + x);
+                const XMVECTOR d = XMLoadFloat4(dst);
+                XMStoreFloat4(dst, XMVectorSelect(d, XMVectorMin(d, z), mask));
+            }
+
+            w0 = XMVectorAdd(w0, step0);
+            w1 = XMVectorAdd(w1, step1);
+            w2 = XMVectorAdd(w2, step2);
+            z = XMVectorAdd(z, stepZ);
+        }
+    }
+}
+
+void OcclusionCuller::BuildHiZ()
+{
+    m_hizWidth.assign(1, m_width);
+    m_hizHeight.assign(1, m_height);
+
+    uint32_t level = 0;
+    while (m_hizWidth.back() > 1 || m_hizHeight.back() > 1)
+    {
+        const uint32_t sw = m_hizWidth.back(), sh = m_hizHeight.back();
+        const uint32_t dw = (sw + 1) / 2, dh = (sh + 1) / 2;
+        const float* src = (level == 0) ? m_depth.data() : m_hiz[level - 1].data();
+
+        if (m_hiz.size() <= level)
+            m_hiz.emplace_back();
+        std::vector<float>& dst = m_hiz[level];
+        dst.resize((size_t)dw * dh);
+
+        // 홀수 크기의 마지막 열/행은 한 칸만 (범위 밖 texel 없음)
+        for (uint32_t y = 0; y < dh; ++y)
+        {
+            const uint32_t y0 = y * 2, y1 = std::min(y0 + 1, sh - 1);
+            for (uint32_t x = 0; x < dw; ++x)
+            {
+                const uint32_t x0 = x * 2, x1 = std::min(x0 + 1, sw - 1);
+                dst[(size_t)y * dw + x] = std::max(std::max(src[(size_t)y0 * sw + x0], src[(size_t)y0 * sw + x1]),
+                    std::max(src[(size_t)y1 * sw + x0], src[(size_t)y1 * sw + x1]));
+            }
+        }
+
+        m_hizWidth.push_back(dw);
+        m_hizHeight.push_back(dh);
+        ++level;
+    }
+}
+
+bool OcclusionCuller::IsOccluded(const MeshBounds& wb) const
+{
+    if (!m_hasOccluders)
+        return false;
+
+    // 모서리 8개 → 화면 사각형 + 가장 가까운 깊이
+    const XMMATRIX VP = XMLoadFloat4x4(&m_viewProj);
+    float minX = 1e30f, minY = 1e30f, maxX = -1e30f, maxY = -1e30f, minZ = 1e30f;
+    for (int i = 0; i < 8; ++i)
+    {
+        const XMVECTOR p = XMVectorSet(
+            wb.center.x + ((i & 1) ? wb.extents.x : -wb.extents.x),
+            wb.center.y + ((i & 2) ? wb.extents.y : -wb.extents.y),
+            wb.center.z + ((i & 4) ? wb.extents.z : -wb.extents.z), 1.0f);
+
+        XMFLOAT4 c;
+        XMStoreFloat4(&c, XMVector3Transform(p, VP));
+        if (c.z < 0.0f || c.w <= 0.0f)
+            return false; // near에 걸침 → 보이는 것으로
+
+        const float invW = 1.0f / c.w;
+        const float sx = (c.x * invW * 0.5f + 0.5f) * (float)m_width;
+        const float sy = (0.5f - c.y * invW * 0.5f) * (float)m_height;
+        minX = std::min(minX, sx); maxX = std::max(maxX, sx);
+        minY = std::min(minY, sy); maxY = std::max(maxY, sy);
+        minZ = std::min(minZ, c.z * invW);
+    }
+
+    if (maxX < 0.0f || maxY < 0.0f || minX >= (float)m_width || minY >= (float)m_height)
+        return false;
+
+    // 닿는 픽셀 전부 (픽셀 중심이 안 들어가도 포함 → 보수적)
+    uint32_t x0 = (uint32_t)std::max(minX, 0.0f);
+    uint32_t y0 = (uint32_t)std::max(minY, 0.0f);
+    uint32_t x1 = std::min((uint32_t)std::max(maxX, 0.0f), m_width - 1);
+    uint32_t y1 = std::min((uint32_t)std::max(maxY, 0.0f), m_height - 1);
+
+    uint32_t level = 0;
+    while (level + 1 < m_hizWidth.size() && ((x1 - x0) + 1 > HiZMaxSpan || (y1 - y0) + 1 > HiZMaxSpan))
+    {
+        x0 >>= 1; y0 >>= 1; x1 >>= 1; y1 >>= 1;
+        ++level;
+    }
+
+    const float* d = (level == 0) ? m_depth.data() : m_hiz[level - 1].data();
+    const uint32_t w = m_hizWidth[level];
+
+    float maxDepth = 0.0f;
+    for (uint32_t y = y0; y <= y1; ++y)
+        for (uint32_t x = x0; x <= x1; ++x)
+            maxDepth = std::max(maxDepth, d[(size_t)y * w + x]);
+
+    return minZ > maxDepth;
+}
+
+void OcclusionCuller::Cull(const MeshManager& meshes, std::vector<RenderItem>& items)
+{
+    if (!m_hasOccluders)
+        return;
+
+    // 같은 엔티티의 draw들은 mesh/world가 같아 직전 판정 재사용
+    uint32_t lastMesh = 0;
+    XMFLOAT4X4 lastWorld{};
+    bool hasLast = false;
+    bool lastHidden = false;
+
+    size_t live = 0;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        const RenderItem& it = items[i];
+        ++m_stats.itemsTested;
+
+        bool hidden = false;
+        if (hasLast && it.mesh.id == lastMesh && std::memcmp(&lastWorld, &it.world, sizeof(XMFLOAT4X4)) == 0)
+        {
+            hidden = lastHidden;
+        }
+        else
+        {
+            MeshBounds local{};
+            hidden = meshes.GetBounds(it.mesh, local) && IsOccluded(TransformBounds(local, it.world));
+
+            lastMesh = it.mesh.id;
+            lastWorld = it.world;
+            lastHidden = hidden;
+            hasLast = true;
+        }
+
+        if (hidden)
+        {
+            ++m_stats.itemsCulled;
+            continue;
+        }
+
+        if (live != i)
+            items[live] = items[i];
+        ++live;
+    }
+    items.resize(live);
+}
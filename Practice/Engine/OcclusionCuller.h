@@ -0,0 +1,80 @@
+﻿#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+#include "MeshHandle.h"
+#include "RenderItem.h"
+#include "RenderBounds.h"
+
+class MeshManager;
+
+// 가리개 하나: MeshComponent::occluder mesh + 엔티티 world 행렬
+struct OccluderInstance
+{
+    MeshHandle mesh;
+    DirectX::XMFLOAT4X4 world;
+};
+
+// 마지막 Render/Cull 기준
+struct OcclusionCullStats
+{
+    uint32_t occluders = 0;
+    uint32_t triangles = 0;         // 래스터한 삼각형 수 (near 클립으로 쪼개진 것 포함)
+    uint32_t nearClipped = 0;       // near 평면에 걸려 잘린 삼각형 수
+    uint32_t itemsTested = 0;
+    uint32_t itemsCulled = 0;
+};
+
+// CPU 소프트웨어 오클루전 컬링
+// - 지정된 가리개(low-poly) mesh를 작은 깊이 버퍼에 래스터 (픽셀 4개씩 XMVECTOR로 edge/깊이 계산)
+// - 깊이 버퍼 → 2x2 max 계층(Hi-Z) → RenderItem 화면 사각형의 가장 먼 가리개 깊이보다 AABB가 더 멀면 버림
+// - 보수적: near에 걸친 item, 화면 밖 item, bounds 모르는 item은 통과. 가리개 삼각형은 양면으로 그림
+// - 가리개 mesh는 인덱스 전체를 그림 (submesh/LOD 구분 없음) → 원본보다 바깥으로 나오지 않는 가리개 전용 mesh를 쓸 것
+class OcclusionCuller
+{
+public:
+    static constexpr uint32_t DefaultWidth = 256;
+    static constexpr uint32_t DefaultHeight = 128;
+
+    // width는 4의 배수로 올림
+    void SetResolution(uint32_t width, uint32_t height);
+    uint32_t GetWidth() const { return m_width; }
+    uint32_t GetHeight() const { return m_height; }
+
+    // 깊이 버퍼 초기화(1 = far) → 가리개 래스터 → Hi-Z
+    void Render(const MeshManager& meshes, const std::vector<OccluderInstance>& occluders, const DirectX::XMFLOAT4X4& viewProj);
+
+    // world AABB가 가리개 뒤에 완전히 숨었나 (Render 이후)
+    bool IsOccluded(const MeshBounds& worldBounds) const;
+
+    // 가려진 item 제거 (나머지 순서 유지). 가리개를 하나도 안 그렸으면 그대로
+    void Cull(const MeshManager& meshes, std::vector<RenderItem>& items);
+
+    // [y * width + x], NDC 깊이 (테스트/디버그용)
+    const std::vector<float>& GetDepth() const { return m_depth; }
+    const OcclusionCullStats& GetStats() const { return m_stats; }
+
+private:
+    // 화면 좌표(픽셀, y 아래로) + NDC z
+    void RasterizeTriangle(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b, const DirectX::XMFLOAT3& c);
+
+    // clip 공간 삼각형: near(z >= 0)로 잘라서 래스터
+    void ClipAndRasterize(const DirectX::XMFLOAT4& a, const DirectX::XMFLOAT4& b, const DirectX::XMFLOAT4& c);
+
+    void BuildHiZ();
+
+private:
+    uint32_t m_width = DefaultWidth;
+    uint32_t m_height = DefaultHeight;
+
+    DirectX::XMFLOAT4X4 m_viewProj{};
+    bool m_hasOccluders = false;
+
+    std::vector<float> m_depth;                     // level 0
+    std::vector<std::vector<float>> m_hiz;          // [level-1] 2x2 max
+    std::vector<uint32_t> m_hizWidth, m_hizHeight;  // [level] (0 = m_depth)
+
+    std::vector<DirectX::XMFLOAT4> m_clip;          // 가리개 정점 clip 좌표 scratch
+
+    OcclusionCullStats m_stats{};
+};
@@ -0,0 +1,434 @@
+﻿#include "PhysicsBench.h"
+#include "Behaviour.h"
+#include "World.h"
+#include "PhysicsSystem.h"
+#include "ColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include "DebugDraw.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+// 바닥(static 박스) + bodyCount개 dynamic body를 정육면체 격자로 (3개 중 1개는 박스, 나머지는 구)
+// 맨 아래 층은 바닥에 닿은 채로 시작, 위층은 간격이 지름보다 조금 커서 떨어지면서 쌓임
+static std::vector<EntityId> BuildBenchWorld(World& w, uint32_t bodyCount)
+{
+    const uint32_t side = (uint32_t)std::ceil(std::cbrt((double)std::max(bodyCount, 1u)));
+    const float spacing = 1.1f;
+    const float half = (side - 1) * spacing * 0.5f;
+
+    EntityId ground = w.CreateEntity();
+    w.AddTransform(ground);
+    w.SetLocalPosition(ground, { 0.0f, -0.5f, 0.0f });
+    w.SetLocalScale(ground, { side * spacing + 20.0f, 1.0f, side * spacing + 20.0f });
+    {
+        RigidBodyComponent rb{};
+        rb.type = BodyType::Static;
+        rb.mass = 0.0f;
+        rb.RecalcInvMass();
+        w.AddRigidBody(ground, rb);
+
+        ColliderComponent col{};
+        col.shapeType = ShapeType::Box;
+        col.box.halfExtents = { 0.5f, 0.5f, 0.5f };
+        w.AddCollider(ground, col);
+    }
+
+    std::vector<EntityId> bodies;
+    bodies.reserve(bodyCount);
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> jitter(-0.04f, 0.04f);
+
+    for (uint32_t i = 0; i < bodyCount; ++i)
+    {
+        const uint32_t x = i % side;
+        const uint32_t z = (i / side) % side;
+        const uint32_t y = i / (side * side);
+
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { x * spacing - half + jitter(rng), 0.5f + y * spacing, z * spacing - half + jitter(rng) });
+
+        RigidBodyComponent rb{};
+        rb.type = BodyType::Dynamic;
+        rb.mass = 1.0f;
+        rb.RecalcInvMass();
+        w.AddRigidBody(e, rb);
+
+        ColliderComponent col{};
+        col.shapeType = (i % 3 == 0) ? ShapeType::Box : ShapeType::Sphere;
+        col.sphere.radius = 0.5f;
+        col.box.halfExtents = { 0.5f, 0.5f, 0.5f };
+        w.AddCollider(e, col);
+        bodies.push_back(e);
+    }
+    return bodies;
+}
+
+static PhysicsBenchRow RunOne(uint32_t bodyCount, bool tree, uint32_t steps, float dt)
+{
+    World w;
+    BuildBenchWorld(w, bodyCount);
+
+    PhysicsSystem physics;
+    physics.SetBroadphaseMode(tree ? PhysicsSystem::BroadphaseMode::DynamicTree : PhysicsSystem::BroadphaseMode::BruteForce);
+
+    PhysicsBenchRow r{};
+    r.bodies = bodyCount;
+    r.tree = tree;
+
+    double bpMs = 0.0, stepMs = 0.0, pairs = 0.0, contacts = 0.0;
+    std::vector<CollisionEvent> events;
+
+    for (uint32_t s = 0; s < steps; ++s)
+    {
+        // Application 프레임처럼 dirty/이벤트/디버그 라인을 매 Step 비움
+        w.BeginFrame();
+        DebugDraw::BeginFrame();
+
+        physics.Step(w, dt);
+        w.DrainCollisionEvents(events);
+        events.clear();
+
+        const PhysicsSystem::BroadphaseStats& bp = physics.GetBroadphaseStats();
+        if (s == 0)
+        {
+            r.firstBroadphaseMs = bp.broadphaseMs;
+            continue;
+        }
+
+        bpMs += bp.broadphaseMs;
+        stepMs += physics.GetStepStats().stepMs;
+        pairs += bp.pairCount;
+        contacts += bp.contactCount;
+    }
+    DebugDraw::BeginFrame();
+
+    const double n = (double)std::max(steps, 2u) - 1.0;
+    r.broadphaseMs = bpMs / n;
+    r.stepMs = stepMs / n;
+    r.pairs = pairs / n;
+    r.contacts = contacts / n;
+    r.pairsPerSec = (bpMs > 0.0) ? pairs / (bpMs * 0.001) : 0.0;
+    return r;
+}
+
+PhysicsBenchResult RunPhysicsBench(const std::vector<uint32_t>& bodyCounts, uint32_t steps)
+{
+    PhysicsBenchResult result{};
+    result.steps = std::max(steps, 2u);
+    result.dt = 1.0f / 60.0f;
+
+    for (uint32_t n : bodyCounts)
+    {
+        result.rows.push_back(RunOne(n, false, result.steps, result.dt));
+        result.rows.push_back(RunOne(n, true, result.steps, result.dt));
+    }
+    return result;
+}
+
+std::string FormatPhysicsBench(const PhysicsBenchResult& result)
+{
+    char line[512];
+    std::snprintf(line, sizeof(line), "steps %u (first step excluded from averages) | dt %.4f s\n", result.steps, result.dt);
+    std::string out = line;
+
+    out += "bodies | broadphase | first bp ms | bp ms | step ms | pairs | contacts | pairs/s | bp speedup | step speedup\n";
+
+    for (size_t i = 0; i < result.rows.size(); ++i)
+    {
+        const PhysicsBenchRow& r = result.rows[i];
+
+        // 같은 body 수의 BruteForce 줄 기준
+        double bpSpeedup = 1.0, stepSpeedup = 1.0;
+        if (r.tree && i > 0 && !result.rows[i - 1].tree && result.rows[i - 1].bodies == r.bodies)
+        {
+            const PhysicsBenchRow& brute = result.rows[i - 1];
+            bpSpeedup = (r.broadphaseMs > 0.0) ? brute.broadphaseMs / r.broadphaseMs : 0.0;
+            stepSpeedup = (r.stepMs > 0.0) ? brute.stepMs / r.stepMs : 0.0;
+        }
+
+        std::snprintf(line, sizeof(line), "%u | %s | %.3f | %.3f | %.3f | %.0f | %.0f | %.0f | %.2fx | %.2fx\n",
+            r.bodies, r.tree ? "DynamicTree" : "BruteForce", r.firstBroadphaseMs, r.broadphaseMs, r.stepMs,
+            r.pairs, r.contacts, r.pairsPerSec, bpSpeedup, stepSpeedup);
+        out += line;
+    }
+
+    return out;
+}
+
+static PhysicsScalingRow RunScalingOne(uint32_t bodyCount, uint32_t threads, uint32_t steps, float dt,
+    JobSystem& jobs, std::vector<XMFLOAT3>& positions)
+{
+    World w;
+    const std::vector<EntityId> bodies = BuildBenchWorld(w, bodyCount);
+
+    PhysicsSystem physics;
+    physics.SetBroadphaseMode(PhysicsSystem::BroadphaseMode::DynamicTree);
+    if (threads > 1)
+    {
+        jobs.SetMaxActiveWorkers(threads - 1);
+        physics.SetJobSystem(&jobs);
+    }
+
+    PhysicsScalingRow r{};
+    r.threads = threads;
+
+    double stepMs = 0.0;
+    std::vector<CollisionEvent> events;
+    for (uint32_t s = 0; s < steps; ++s)
+    {
+        w.BeginFrame();
+        DebugDraw::BeginFrame();
+
+        physics.Step(w, dt);
+        w.DrainCollisionEvents(events);
+        events.clear();
+
+        if (s > 0)
+            stepMs += physics.GetStepStats().stepMs;
+    }
+    DebugDraw::BeginFrame();
+
+    r.stepMs = stepMs / ((double)steps - 1.0);
+    r.islands = physics.GetStepStats().islandCount;
+    r.sleepingIslands = physics.GetStepStats().sleepingIslands;
+
+    positions.clear();
+    for (EntityId e : bodies)
+        positions.push_back(w.GetWorldPosition(e));
+    return r;
+}
+
+PhysicsScalingResult RunPhysicsScalingBench(uint32_t bodyCount, uint32_t steps, uint32_t maxThreads)
+{
+    PhysicsScalingResult result{};
+    result.bodies = bodyCount;
+    result.steps = std::max(steps, 2u);
+
+    JobSystem jobs;
+    jobs.Initialize(maxThreads > 0 ? maxThreads - 1 : 0);
+
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t t = 1; t < jobs.GetThreadCount(); t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(jobs.GetThreadCount());
+
+    const float dt = 1.0f / 60.0f;
+    std::vector<XMFLOAT3> serial, positions;
+
+    for (uint32_t t : threadCounts)
+    {
+        PhysicsScalingRow r = RunScalingOne(bodyCount, t, result.steps, dt, jobs, (t == 1) ? serial : positions);
+
+        if (t > 1)
+        {
+            r.matchesSerial = positions.size() == serial.size() &&
+                std::memcmp(positions.data(), serial.data(), serial.size() * sizeof(XMFLOAT3)) == 0;
+        }
+
+        const double base = result.rows.empty() ? r.stepMs : result.rows.front().stepMs;
+        r.speedup = (r.stepMs > 0.0) ? base / r.stepMs : 0.0;
+        result.rows.push_back(r);
+    }
+
+    jobs.Shutdown();
+    return result;
+}
+
+std::string FormatPhysicsScalingBench(const PhysicsScalingResult& result)
+{
+    char line[256];
+    std::snprintf(line, sizeof(line), "scaling: %u bodies | steps %u (first step excluded)\n", result.bodies, result.steps);
+    std::string out = line;
+
+    out += "threads | step ms | speedup | islands | sleeping islands | same as serial\n";
+    for (const PhysicsScalingRow& r : result.rows)
+    {
+        std::snprintf(line, sizeof(line), "%u | %.3f | %.2fx | %u | %u | %s\n",
+            r.threads, r.stepMs, r.speedup, r.islands, r.sleepingIslands, r.matchesSerial ? "yes" : "NO");
+        out += line;
+    }
+    return out;
+}
+
+// 쿼리 벤치 배치: 한 변이 cbrt(n) * 3인 정육면체 안에 무작위 (collider 하나당 부피 일정)
+static std::vector<EntityId> BuildQueryWorld(World& w, uint32_t colliderCount, float& outExtent)
+{
+    outExtent = (float)std::cbrt((double)std::max(colliderCount, 1u)) * 1.5f;
+
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> pos(-outExtent, outExtent);
+    std::uniform_real_distribution<float> size(0.25f, 1.0f);
+
+    std::vector<EntityId> out;
+    out.reserve(colliderCount);
+    for (uint32_t i = 0; i < colliderCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { pos(rng), pos(rng), pos(rng) });
+
+        RigidBodyComponent rb{};
+        rb.type = (i % 3 == 0) ? BodyType::Dynamic : BodyType::Static;
+        rb.mass = (rb.type == BodyType::Dynamic) ? 1.0f : 0.0f;
+        rb.useGravity = false;
+        rb.RecalcInvMass();
+        w.AddRigidBody(e, rb);
+
+        ColliderComponent col{};
+        col.shapeType = (i % 2 == 0) ? ShapeType::Sphere : ShapeType::Box;
+        col.sphere.radius = size(rng);
+        col.box.halfExtents = { size(rng), size(rng), size(rng) };
+        w.AddCollider(e, col);
+        out.push_back(e);
+    }
+    w.UpdateTransforms();
+    return out;
+}
+
+struct QueryBenchAnswers
+{
+    std::vector<float> rayT;            // 레이마다 가장 가까운 hit 거리 (미스 = -1, 거리가 같으면 어느 엔티티든 같은 답)
+    std::vector<uint32_t> overlapCount;
+};
+
+static PhysicsQueryBenchRow RunQueryOne(World& w, const std::vector<EntityId>& colliders, float extent, bool tree, uint32_t queries, QueryBenchAnswers& answers)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    PhysicsSystem physics;
+    physics.SetBroadphaseMode(tree ? PhysicsSystem::BroadphaseMode::DynamicTree : PhysicsSystem::BroadphaseMode::BruteForce);
+
+    // 두 모드가 같은 쿼리를 받도록 매번 같은 seed
+    std::mt19937 rng(777);
+    std::uniform_real_distribution<float> pos(-extent, extent);
+    std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+
+    std::vector<PhysicsSystem::RayQuery> rays(queries);
+    for (PhysicsSystem::RayQuery& r : rays)
+    {
+        r.origin = { pos(rng), pos(rng), pos(rng) };
+        XMFLOAT3 d{ dir(rng), dir(rng), dir(rng) };
+        const float len = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+        r.dir = (len > 1e-3f) ? XMFLOAT3{ d.x / len, d.y / len, d.z / len } : XMFLOAT3{ 0, 0, 1 };
+        r.maxDist = extent;
+    }
+    const float overlapRadius = 2.0f;
+
+    PhysicsQueryBenchRow row{};
+    row.colliders = (uint32_t)colliders.size();
+    row.tree = tree;
+
+    PhysicsSystem::RaycastHit hit{};
+    std::vector<EntityId> overlaps;
+
+    auto t0 = Clock::now();
+    physics.Raycast(w, rays[0].origin, rays[0].dir, rays[0].maxDist, hit);
+    row.firstQueryMs = ms(t0, Clock::now());
+
+    QueryBenchAnswers mine;
+    mine.rayT.resize(queries);
+    mine.overlapCount.resize(queries);
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < queries; ++i)
+    {
+        const bool h = physics.Raycast(w, rays[i].origin, rays[i].dir, rays[i].maxDist, hit);
+        mine.rayT[i] = h ? hit.t : -1.0f;
+        row.rayHits += h ? 1u : 0u;
+    }
+    auto t1 = Clock::now();
+    for (uint32_t i = 0; i < queries; ++i)
+        physics.RaycastAny(w, rays[i].origin, rays[i].dir, rays[i].maxDist);
+    auto t2 = Clock::now();
+    for (uint32_t i = 0; i < queries; ++i)
+    {
+        mine.overlapCount[i] = (uint32_t)physics.OverlapSphere(w, rays[i].origin, overlapRadius, overlaps);
+        row.overlapHits += mine.overlapCount[i];
+    }
+    auto t3 = Clock::now();
+
+    const double perQueryUs = 1000.0 / (double)std::max(queries, 1u);
+    row.raycastUs = ms(t0, t1) * perQueryUs;
+    row.raycastAnyUs = ms(t1, t2) * perQueryUs;
+    row.overlapUs = ms(t2, t3) * perQueryUs;
+
+    // 1/8을 옮긴 직후 첫 쿼리 (트리: version이 바뀌어서 Sync, BruteForce: 그냥 선형 스캔)
+    // 다음 모드가 같은 배치를 보도록 원래 자리로 되돌림
+    std::vector<XMFLOAT3> saved;
+    for (size_t i = 0; i < colliders.size(); i += 8)
+    {
+        const XMFLOAT3 p = w.GetTransform(colliders[i]).position;
+        saved.push_back(p);
+        w.SetLocalPosition(colliders[i], { p.x + 0.5f, p.y, p.z - 0.5f });
+    }
+    w.UpdateTransforms();
+
+    t0 = Clock::now();
+    physics.Raycast(w, rays[0].origin, rays[0].dir, rays[0].maxDist, hit);
+    row.resyncMs = ms(t0, Clock::now());
+
+    for (size_t i = 0, k = 0; i < colliders.size(); i += 8, ++k)
+        w.SetLocalPosition(colliders[i], saved[k]);
+    w.UpdateTransforms();
+
+    if (!tree)
+        answers = mine;
+    else
+        row.matchesBruteForce = mine.rayT == answers.rayT && mine.overlapCount == answers.overlapCount;
+    return row;
+}
+
+PhysicsQueryBenchResult RunPhysicsQueryBench(const std::vector<uint32_t>& colliderCounts, uint32_t queries)
+{
+    PhysicsQueryBenchResult result{};
+    result.queries = std::max(queries, 1u);
+
+    for (uint32_t n : colliderCounts)
+    {
+        World w;
+        float extent = 0.0f;
+        const std::vector<EntityId> colliders = BuildQueryWorld(w, n, extent);
+
+        QueryBenchAnswers answers;
+        result.rows.push_back(RunQueryOne(w, colliders, extent, false, result.queries, answers));
+        result.rows.push_back(RunQueryOne(w, colliders, extent, true, result.queries, answers));
+    }
+    return result;
+}
+
+std::string FormatPhysicsQueryBench(const PhysicsQueryBenchResult& result)
+{
+    char line[512];
+    std::snprintf(line, sizeof(line), "scene queries: %u rays / spheres per mode (us = per query)\n", result.queries);
+    std::string out = line;
+
+    out += "colliders | mode | first query ms | resync ms | raycast us | raycastAny us | overlap us | ray hits | overlap hits | raycast speedup | overlap speedup | same as brute force\n";
+
+    for (size_t i = 0; i < result.rows.size(); ++i)
+    {
+        const PhysicsQueryBenchRow& r = result.rows[i];
+
+        double raySpeedup = 1.0, overlapSpeedup = 1.0;
+        if (r.tree && i > 0 && !result.rows[i - 1].tree && result.rows[i - 1].colliders == r.colliders)
+        {
+            const PhysicsQueryBenchRow& brute = result.rows[i - 1];
+            raySpeedup = (r.raycastUs > 0.0) ? brute.raycastUs / r.raycastUs : 0.0;
+            overlapSpeedup = (r.overlapUs > 0.0) ? brute.overlapUs / r.overlapUs : 0.0;
+        }
+
+        std::snprintf(line, sizeof(line), "%u | %s | %.3f | %.3f | %.2f | %.2f | %.2f | %u | %u | %.2fx | %.2fx | %s\n",
+            r.colliders, r.tree ? "DynamicTree" : "BruteForce", r.firstQueryMs, r.resyncMs,
+            r.raycastUs, r.raycastAnyUs, r.overlapUs, r.rayHits, r.overlapHits, raySpeedup, overlapSpeedup,
+            r.matchesBruteForce ? "yes" : "NO");
+        out += line;
+    }
+    return out;
+}
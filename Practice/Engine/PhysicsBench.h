@@ -0,0 +1,91 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 헤드리스 물리 벤치 (창/렌더러 없이 World + PhysicsSystem만)
+// - 실행: Engine.exe --physics-bench [steps]  → PhysicsBench.txt
+// - body 수마다 같은 초기 배치(바닥 위 구/박스 격자, 고정 seed)를 두 World에 만들고
+//   BruteForce / DynamicTree 브로드페이즈로 각각 steps번 Step → pair 처리량 비교
+// - 첫 Step(트리 생성)은 평균에서 빼고 따로 기록
+struct PhysicsBenchRow
+{
+    uint32_t bodies = 0;
+    bool tree = false;              // false = BruteForce
+
+    double firstBroadphaseMs = 0.0;
+    double broadphaseMs = 0.0;      // 평균 (첫 Step 제외)
+    double stepMs = 0.0;            // 평균 (첫 Step 제외)
+    double pairs = 0.0;             // narrowphase 후보 쌍 평균
+    double contacts = 0.0;          // 실제 접촉 평균
+    double pairsPerSec = 0.0;       // pairs / broadphase 시간
+                                    // (BruteForce는 모든 쌍을 narrowphase로 넘김 → step 시간도 같이 비교)
+};
+
+struct PhysicsBenchResult
+{
+    uint32_t steps = 0;
+    float dt = 0.0f;
+    std::vector<PhysicsBenchRow> rows;  // body 수마다 [BruteForce, DynamicTree]
+};
+
+PhysicsBenchResult RunPhysicsBench(const std::vector<uint32_t>& bodyCounts, uint32_t steps);
+
+std::string FormatPhysicsBench(const PhysicsBenchResult& result);
+
+// 코어 수 스케일링 (같은 배치, DynamicTree)
+// - 1 스레드 = JobSystem 없이 순차 경로, 나머지는 SetMaxActiveWorkers(threads - 1)
+// - 마지막 Step 후 모든 body 위치를 순차 결과와 비트 단위로 비교 (섬 병렬 solve가 순차와 같은지)
+struct PhysicsScalingRow
+{
+    uint32_t threads = 1;
+    double stepMs = 0.0;            // 평균 (첫 Step 제외)
+    double speedup = 1.0;           // 1 스레드 대비
+    uint32_t islands = 0;           // 마지막 Step 기준
+    uint32_t sleepingIslands = 0;
+    bool matchesSerial = true;
+};
+
+struct PhysicsScalingResult
+{
+    uint32_t bodies = 0;
+    uint32_t steps = 0;
+    std::vector<PhysicsScalingRow> rows;
+};
+
+// maxThreads = 0이면 하드웨어 스레드 수. 1, 2, 4, ... , maxThreads 순서로 측정
+PhysicsScalingResult RunPhysicsScalingBench(uint32_t bodyCount, uint32_t steps, uint32_t maxThreads = 0);
+
+std::string FormatPhysicsScalingBench(const PhysicsScalingResult& result);
+
+// Scene query 처리량 (Raycast / RaycastAny / OverlapSphere)
+// - collider 수마다 같은 무작위 배치(static 2/3, dynamic 1/3, 구/박스 섞임, 밀도 일정)를 만들고
+//   같은 World를 BruteForce(선형 스캔) / DynamicTree(트리 + static BVH) 두 PhysicsSystem으로 쿼리
+// - 고정 seed 쿼리 queries개씩. 트리 결과가 선형 스캔과 같은지(레이별 hit 거리, 구별 겹친 수)도 기록
+// - firstQueryMs: 첫 쿼리 (트리면 Step 없이 쿼리가 트리를 만드는 비용 포함)
+// - resyncMs: collider 1/8을 옮기고 UpdateTransforms 한 뒤 첫 쿼리 (트리면 지연 Sync 포함)
+struct PhysicsQueryBenchRow
+{
+    uint32_t colliders = 0;
+    bool tree = false;              // false = BruteForce
+
+    double firstQueryMs = 0.0;
+    double resyncMs = 0.0;
+    double raycastUs = 0.0;         // 쿼리 1개 평균
+    double raycastAnyUs = 0.0;
+    double overlapUs = 0.0;
+
+    uint32_t rayHits = 0;
+    uint32_t overlapHits = 0;       // 전체 쿼리 결과 엔티티 수 합
+    bool matchesBruteForce = true;  // BruteForce 줄은 항상 true
+};
+
+struct PhysicsQueryBenchResult
+{
+    uint32_t queries = 0;
+    std::vector<PhysicsQueryBenchRow> rows;  // collider 수마다 [BruteForce, DynamicTree]
+};
+
+PhysicsQueryBenchResult RunPhysicsQueryBench(const std::vector<uint32_t>& colliderCounts, uint32_t queries);
+
+std::string FormatPhysicsQueryBench(const PhysicsQueryBenchResult& result);
@@ -2,6 +2,7 @@
 #include "DebugDraw.h"
 #include "CollisionEvents.h"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <DirectXMath.h>
 #include <unordered_set>
@@ -195,6 +196,9 @@ static bool RayAABB(const DirectX::XMFLOAT3& ro, const DirectX::XMFLOAT3& rdN, f
 // Integration
 void PhysicsSystem::Step(World& world, float dt)
 {
+    const auto stepStart = std::chrono::high_resolution_clock::now();
+    m_stepStats.threadCount = (m_jobs && m_parallelEnabled) ? std::min(m_jobs->GetWorkerCount(), m_jobs->GetMaxActiveWorkers()) + 1 : 1;
+
     // 1) Integrate (forces -> velocity -> position)
     Integrate(world, dt);
     world.UpdateTransforms(); // 浹 ʿ world matrix ֽȭ
@@ -206,14 +210,22 @@ void PhysicsSystem::Step(World& world, float dt)
     // 3) Narrowphase contacts
     std::vector<std::tuple<EntityId, EntityId, Contact>> contacts;
     Narrowphase(world, pairs, contacts);
+    m_bpStats.contactCount = (uint32_t)contacts.size();
+
+    // Islands: ִ  contact  [0, awakeContacts)  (  warm start/solve  ǳʶ)
+    const uint32_t awakeContacts = BuildIslands(world, contacts);
 
 	// 4) Warm Start :    ޽ ӵ ̸ 
-    WarmStart(world, contacts);
+    WarmStart(world, contacts, awakeContacts);
 
     // 5) Solve (penetration + velocity response)
-    Solve(world, contacts, dt);
+    Solve(world, contacts, awakeContacts, dt);
 	world.UpdateTransforms(); // 浹  ġ   world matrix ٽ ֽȭ
 
+    // Scene query(Raycast/Overlap)   ġ  Ʈ ٽ (κ fat AABB ̶ )
+    if (m_broadphaseMode == BroadphaseMode::DynamicTree)
+        SyncBroadphase(world);
+
     // 6) ̹  contact  ĳÿ (Exit ڵ )
     StoreContactCache(contacts);
 
@@ -224,38 +236,247 @@ void PhysicsSystem::Step(World& world, float dt)
 
 	// 8) Sleep Ʈ
     UpdateSleep(world, dt);
+
+    const auto stepEnd = std::chrono::high_resolution_clock::now();
+    m_stepStats.stepMs = std::chrono::duration<double, std::milli>(stepEnd - stepStart).count();
 }
 
-void PhysicsSystem::Integrate(World& world, float dt)
+bool PhysicsSystem::UseJobs(size_t itemCount) const
 {
-    const auto& cols = world.GetColliderEntities();
-    for (EntityId e : cols)
+    return m_parallelEnabled && m_jobs && m_jobs->GetWorkerCount() > 0 && itemCount >= ParallelMinItems;
+}
+
+// Islands: dynamic body contact union-find   contact  ӵǵ ġ
+//  dynamic body  Ƿ(static solver  ) ÿ Ǯ
+//  Ǭ Ͱ  .    body     ǳʶ.
+// ִ     ȯ =  [0, n) ִ  contact  ( ,   contact  )
+uint32_t PhysicsSystem::BuildIslands(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts)
+{
+    m_stepStats.islandCount = 0;
+    m_stepStats.sleepingIslands = 0;
+    m_stepStats.largestIsland = 0;
+
+    //  Step  ʱȭ(ǵ帰 ͸)
+    for (uint32_t idx : m_islandTouched)
+        m_islandSlotOfEntity[idx] = -1;
+    m_islandTouched.clear();
+    m_islandParent.clear();
+    m_islandAwake.clear();
+
+    auto slotOf = [&](EntityId e) -> int32_t
+        {
+            if (!world.HasRigidBody(e)) return -1;
+            const auto& rb = world.GetRigidBody(e);
+            if (rb.type != BodyType::Dynamic) return -1;
+
+            if (e.index >= m_islandSlotOfEntity.size())
+                m_islandSlotOfEntity.resize(size_t(e.index) + 1, -1);
+
+            int32_t& slot = m_islandSlotOfEntity[e.index];
+            if (slot < 0)
+            {
+                slot = (int32_t)m_islandParent.size();
+                m_islandParent.push_back(slot);
+                m_islandAwake.push_back(rb.isAwake ? 1 : 0);
+                m_islandTouched.push_back(e.index);
+            }
+            return slot;
+        };
+
+    auto find = [&](int32_t x) -> int32_t
+        {
+            while (m_islandParent[x] != x)
+            {
+                m_islandParent[x] = m_islandParent[m_islandParent[x]]; // path halving
+                x = m_islandParent[x];
+            }
+            return x;
+        };
+
+    // 1) union
+    const size_t n = contacts.size();
+    m_contactSlot.assign(n, -1);
+    for (size_t i = 0; i < n; ++i)
     {
-        if (!world.HasRigidBody(e) || !world.HasTransform(e)) continue;
+        const EntityId a = std::get<0>(contacts[i]);
+        const EntityId b = std::get<1>(contacts[i]);
 
-        auto& rb = world.GetRigidBody(e);
-        if (rb.type != BodyType::Dynamic) continue;
-		if (!rb.isAwake) continue; // ڱ 
+        // trigger solver ǳʶ    
+        if (world.GetCollider(a).isTrigger || world.GetCollider(b).isTrigger)
+            continue;
 
-        // gravity
-        if (rb.useGravity && m_gravityEnabled)
-            rb.velocity = Add(rb.velocity, Mul(m_gravity, rb.gravityScale * dt));
+        const int32_t sa = slotOf(a);
+        const int32_t sb = slotOf(b);
+        if (sa < 0 && sb < 0)
+            continue;
 
-        // damping
-        rb.velocity = Mul(rb.velocity, std::max(0.0f, 1.0f - rb.linearDamping));
+        if (sa >= 0 && sb >= 0)
+        {
+            const int32_t ra = find(sa);
+            const int32_t rb = find(sb);
+            if (ra != rb)
+            {
+                m_islandParent[rb] = ra;
+                m_islandAwake[ra] |= m_islandAwake[rb];
+            }
+        }
 
-        // position update (semi-implicit Euler)
-        XMFLOAT3 p = world.GetLocalPosition(e);
-        p = Add(p, Mul(rb.velocity, dt));
-        world.SetLocalPosition(e, p); // dirty ó 
+        m_contactSlot[i] = (sa >= 0) ? sa : sb;
     }
+
+    // 2)  ȣ(ó  ) +  contact 
+    m_islandOfRoot.assign(m_islandParent.size(), -1);
+    m_islandRanges.clear();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (m_contactSlot[i] < 0)
+            continue;
+
+        const int32_t root = find(m_contactSlot[i]);
+        int32_t& island = m_islandOfRoot[root];
+        if (island < 0)
+        {
+            island = (int32_t)m_islandRanges.size();
+            m_islandRanges.push_back({ 0, 0, m_islandAwake[root] != 0 });
+        }
+        m_contactSlot[i] = island; // ʹ  ȣ
+        ++m_islandRanges[island].count;
+    }
+
+    // 3) ִ       ġ (   contact ڿ  )
+    uint32_t offset = 0;
+    for (auto& r : m_islandRanges)
+    {
+        if (!r.awake) continue;
+        r.begin = offset;
+        offset += r.count;
+    }
+    const uint32_t awakeContacts = offset;
+    for (auto& r : m_islandRanges)
+    {
+        if (r.awake) continue;
+        r.begin = offset;
+        offset += r.count;
+    }
+
+    m_contactScratch.resize(n);
+    {
+        std::vector<uint32_t>& cursor = m_islandCursor;
+        cursor.resize(m_islandRanges.size());
+        for (size_t k = 0; k < m_islandRanges.size(); ++k)
+            cursor[k] = m_islandRanges[k].begin;
+
+        uint32_t tail = offset;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int32_t island = m_contactSlot[i];
+            const uint32_t dst = (island >= 0) ? cursor[island]++ : tail++;
+            m_contactScratch[dst] = contacts[i];
+        }
+    }
+    contacts.swap(m_contactScratch);
+
+    // 4) ִ , ū ( л)
+    m_islandOrder.clear();
+    for (uint32_t k = 0; k < (uint32_t)m_islandRanges.size(); ++k)
+    {
+        const auto& r = m_islandRanges[k];
+        m_stepStats.largestIsland = std::max(m_stepStats.largestIsland, r.count);
+        if (r.awake) m_islandOrder.push_back(k);
+        else         ++m_stepStats.sleepingIslands;
+    }
+    m_stepStats.islandCount = (uint32_t)m_islandRanges.size();
+
+    std::sort(m_islandOrder.begin(), m_islandOrder.end(), [&](uint32_t x, uint32_t y)
+        {
+            if (m_islandRanges[x].count != m_islandRanges[y].count)
+                return m_islandRanges[x].count > m_islandRanges[y].count;
+            return x < y;
+        });
+
+    return awakeContacts;
+}
+
+void PhysicsSystem::Integrate(World& world, float dt)
+{
+    // Collider + RigidBody + Transform  ƼƼ   body 
+    m_integrateBodies.clear();
+    world.ForEach<ColliderComponent, RigidBodyComponent, TransformComponent>(
+        [&](EntityId, ColliderComponent&, RigidBodyComponent& rb, TransformComponent& t)
+        {
+            if (rb.type != BodyType::Dynamic) return;
+            if (!rb.isAwake) return; // ڱ 
+            m_integrateBodies.push_back({ &rb, &t });
+        });
+
+    // body ̶    
+    auto integrateRange = [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                RigidBodyComponent& rb = *m_integrateBodies[i].first;
+                TransformComponent& t = *m_integrateBodies[i].second;
+
+                // gravity
+                if (rb.useGravity && m_gravityEnabled)
+                    rb.velocity = Add(rb.velocity, Mul(m_gravity, rb.gravityScale * dt));
+
+                // damping
+                rb.velocity = Mul(rb.velocity, std::max(0.0f, 1.0f - rb.linearDamping));
+
+                // position update (semi-implicit Euler)
+                // SetLocalPosition : ڱ ڽŸ dirty (ڽ Ĵ UpdateTransforms)
+                t.position = Add(t.position, Mul(rb.velocity, dt));
+                t.dirty = true;
+            }
+        };
+
+    const uint32_t n = (uint32_t)m_integrateBodies.size();
+    if (UseJobs(n))
+        m_jobs->ParallelFor(n, ParallelGrain, integrateRange);
+    else
+        integrateRange(0, n);
 }
 
 // Broadphase
 void PhysicsSystem::BuildPairs(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs)
 {
     outPairs.clear();
+    m_bpStats.reinsertCount = 0;
 
+    const auto t0 = std::chrono::high_resolution_clock::now();
+
+    if (m_broadphaseMode == BroadphaseMode::BruteForce)
+    {
+        // Ʈ ΰ( ȯ  ٽ Sync  )
+        if (!m_bpActive.empty())
+        {
+            m_staticTree.Clear();
+            m_dynamicTree.Clear();
+            m_staticBVH.Clear();
+            m_bpProxies.clear();
+            m_bpActive.clear();
+            m_bpWorldId = 0; // DynamicTree ƿ ù /Step  ٽ 
+        }
+        BuildPairs_BruteForce(world, outPairs);
+    }
+    else
+    {
+        BuildPairs_Tree(world, outPairs);
+    }
+
+    const auto t1 = std::chrono::high_resolution_clock::now();
+
+    m_bpStats.colliderCount = (uint32_t)world.GetColliderEntities().size();
+    m_bpStats.pairCount = (uint32_t)outPairs.size();
+    m_bpStats.staticTreeHeight = m_staticTree.GetHeight();
+    m_bpStats.dynamicTreeHeight = m_dynamicTree.GetHeight();
+    m_bpStats.broadphaseMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void PhysicsSystem::BuildPairs_BruteForce(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs)
+{
     const auto& ents = world.GetColliderEntities();
     const size_t n = ents.size();
 
@@ -290,6 +511,230 @@ void PhysicsSystem::BuildPairs(World& world, std::vector<std::pair<EntityId, Ent
         }
 }
 
+void PhysicsSystem::DestroyProxy(BroadphaseProxy& p)
+{
+    if (p.proxyId != DynamicAABBTree::NullNode)
+    {
+        if (p.inStaticTree) { m_staticTree.DestroyProxy(p.proxyId); m_staticBVHDirty = true; }
+        else                m_dynamicTree.DestroyProxy(p.proxyId);
+    }
+    p = BroadphaseProxy{};
+}
+
+void PhysicsSystem::RebuildStaticBVH()
+{
+    std::vector<AABB> boxes;
+    std::vector<uint32_t> ids;
+    for (uint32_t idx : m_bpActive)
+    {
+        BroadphaseProxy& p = m_bpProxies[idx];
+        if (!p.inStaticTree || p.proxyId == DynamicAABBTree::NullNode)
+        {
+            p.bvhItem = StaticBVH::InvalidIndex;
+            continue;
+        }
+
+        p.bvhItem = (uint32_t)boxes.size();
+        boxes.push_back(p.box);
+        ids.push_back(idx);
+    }
+
+    m_staticBVH.Build(boxes, ids);
+    m_staticBVHDirty = false;
+}
+
+// ݶ̴ ϰ Ʈ proxy : //static<->dynamic ̵/fat AABB  ͸ 
+void PhysicsSystem::SyncBroadphase(const World& world)
+{
+    ++m_bpStamp;
+    bool staticMoved = false;
+
+    const auto& ents = world.GetColliderEntities();
+    for (EntityId e : ents)
+    {
+        if (!world.HasTransform(e))
+            continue;
+
+        if (e.index >= m_bpProxies.size())
+            m_bpProxies.resize(size_t(e.index) + 1);
+
+        BroadphaseProxy& p = m_bpProxies[e.index];
+
+        //    ٸ ƼƼ  proxy (  )
+        if (p.proxyId != DynamicAABBTree::NullNode && !(p.entity == e))
+        {
+            if (p.inStaticTree) { m_staticTree.DestroyProxy(p.proxyId); m_staticBVHDirty = true; }
+            else                m_dynamicTree.DestroyProxy(p.proxyId);
+            p.proxyId = DynamicAABBTree::NullNode;
+        }
+
+        const auto& col = world.GetCollider(e);
+        const bool hasRb = world.HasRigidBody(e);
+        const bool isDyn = hasRb && world.GetRigidBody(e).type == BodyType::Dynamic;
+
+        p.isDynamic = isDyn;
+        p.isAwake = isDyn && world.GetRigidBody(e).isAwake;
+        p.isTrigger = col.isTrigger;
+        p.layerBit = 1u << col.layer;
+        p.collideMask = col.collideMask;
+        p.stamp = m_bpStamp;
+
+        const AABB box = ComputeWorldAABB(world, e);
+        const XMFLOAT3 center{ (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+
+        // body Ÿ ٲ ٸ Ʈ ű
+        const bool wantStatic = !isDyn;
+        if (p.proxyId != DynamicAABBTree::NullNode && p.inStaticTree != wantStatic)
+        {
+            if (p.inStaticTree) m_staticTree.DestroyProxy(p.proxyId);
+            else                m_dynamicTree.DestroyProxy(p.proxyId);
+            p.proxyId = DynamicAABBTree::NullNode;
+            m_staticBVHDirty = true; //  ̵ static  ٲ
+        }
+
+        if (p.proxyId == DynamicAABBTree::NullNode)
+        {
+            const bool isNew = !p.entity.IsValid();
+            p.entity = e;
+            p.inStaticTree = wantStatic;
+            p.proxyId = wantStatic ? m_staticTree.CreateProxy(box, e.index) : m_dynamicTree.CreateProxy(box, e.index);
+            p.lastCenter = center;
+            p.box = box;
+            if (wantStatic)
+                m_staticBVHDirty = true;
+            if (isNew)
+                m_bpActive.push_back(e.index);
+            continue;
+        }
+
+        // staticε Ű  ( ̸   box )
+        if (p.inStaticTree && !m_staticBVHDirty && p.bvhItem != StaticBVH::InvalidIndex
+            && (box.min.x != p.box.min.x || box.min.y != p.box.min.y || box.min.z != p.box.min.z
+             || box.max.x != p.box.max.x || box.max.y != p.box.max.y || box.max.z != p.box.max.z))
+        {
+            m_staticBVH.UpdateItem(p.bvhItem, box);
+            staticMoved = true;
+        }
+        p.box = box;
+
+        DynamicAABBTree& tree = p.inStaticTree ? m_staticTree : m_dynamicTree;
+        const XMFLOAT3 disp = Sub(center, p.lastCenter);
+        if (tree.MoveProxy(p.proxyId, box, disp))
+            ++m_bpStats.reinsertCount;
+        p.lastCenter = center;
+    }
+
+    // ̹ Sync   proxy(ݶ̴ /ƼƼ ı) 
+    for (size_t i = 0; i < m_bpActive.size(); )
+    {
+        BroadphaseProxy& p = m_bpProxies[m_bpActive[i]];
+        if (p.stamp == m_bpStamp)
+        {
+            ++i;
+            continue;
+        }
+
+        DestroyProxy(p);
+        m_bpActive[i] = m_bpActive.back();
+        m_bpActive.pop_back();
+    }
+
+    if (m_staticBVHDirty)
+        RebuildStaticBVH();
+    else if (staticMoved)
+        m_staticBVH.Refit();
+
+    m_bpWorldId = world.GetInstanceId();
+    m_bpColliderVersion = world.GetColliderVersion();
+}
+
+// Step ̿ collider ߰//̵   Ʈ  ( version Ƽ ٷ ȯ)
+// - Ʈ  ӿ ĳö const  ħ
+void PhysicsSystem::SyncQueryTree(const World& world) const
+{
+    if (m_broadphaseMode != BroadphaseMode::DynamicTree)
+        return;
+    if (m_bpWorldId == world.GetInstanceId() && m_bpColliderVersion == world.GetColliderVersion())
+        return;
+
+    const_cast<PhysicsSystem*>(this)->SyncBroadphase(world);
+}
+
+void PhysicsSystem::BuildPairs_Tree(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs)
+{
+    SyncBroadphase(world);
+
+    // BruteForce  (ĳõ  )
+    auto accept = [](const BroadphaseProxy& a, const BroadphaseProxy& b) -> bool
+        {
+            if (!((a.collideMask & b.layerBit) && (b.collideMask & a.layerBit))) return false;
+
+            const bool anyTrigger = a.isTrigger || b.isTrigger;
+            if (!a.isDynamic && !b.isDynamic && !anyTrigger) return false;
+            if (a.isDynamic && b.isDynamic && !anyTrigger && !a.isAwake && !b.isAwake) return false;
+            return true;
+        };
+
+    for (uint32_t idx : m_bpActive)
+    {
+        const BroadphaseProxy& self = m_bpProxies[idx];
+
+        if (!self.inStaticTree)
+        {
+            const AABB& fat = m_dynamicTree.GetFatAABB(self.proxyId);
+
+            // dynamic vs dynamic: ʿ   Ƿ index ū ʸ 
+            m_dynamicTree.Query(fat, [&](int32_t other) -> bool
+                {
+                    const uint32_t oi = m_dynamicTree.GetUserData(other);
+                    if (oi <= idx) return true;
+
+                    const BroadphaseProxy& o = m_bpProxies[oi];
+                    if (accept(self, o))
+                        outPairs.push_back({ self.entity, o.entity });
+                    return true;
+                });
+
+            // dynamic vs static
+            m_staticTree.Query(fat, [&](int32_t other) -> bool
+                {
+                    const BroadphaseProxy& o = m_bpProxies[m_staticTree.GetUserData(other)];
+                    if (accept(self, o))
+                        outPairs.push_back({ self.entity, o.entity });
+                    return true;
+                });
+        }
+        else if (self.isTrigger)
+        {
+            // static trigger vs static: static ƮŰ    ǹ 
+            const AABB& fat = m_staticTree.GetFatAABB(self.proxyId);
+            m_staticTree.Query(fat, [&](int32_t other) -> bool
+                {
+                    const uint32_t oi = m_staticTree.GetUserData(other);
+                    if (oi == idx) return true;
+
+                    const BroadphaseProxy& o = m_bpProxies[oi];
+                    if (o.isTrigger && oi < idx) return true; // Ʈų  
+
+                    if (accept(self, o))
+                        outPairs.push_back({ self.entity, o.entity });
+                    return true;
+                });
+        }
+    }
+
+    // Ʈ /ȸ  ϰ solver Է  ()
+    for (auto& [a, b] : outPairs)
+        SortPair(a, b);
+
+    std::sort(outPairs.begin(), outPairs.end(),
+        [](const std::pair<EntityId, EntityId>& x, const std::pair<EntityId, EntityId>& y)
+        {
+            if (x.first.index != y.first.index) return x.first.index < y.first.index;
+            return x.second.index < y.second.index;
+        });
+}
+
 bool PhysicsSystem::LayerMatch(const ColliderComponent& a, const ColliderComponent& b) const
 {
     const uint32_t bitA = 1u << a.layer;
@@ -302,8 +747,44 @@ void PhysicsSystem::Narrowphase(World& world, const std::vector<std::pair<Entity
 {
     outContacts.clear();
 
-    for (auto [a, b] : pairs)
+    const uint32_t n = (uint32_t)pairs.size();
+    if (!UseJobs(n))
     {
+        NarrowphaseRange(world, pairs.data(), n, outContacts);
+        return;
+    }
+
+    // ûũ    ûũ  ̾     /
+    const uint32_t chunkCount = (n + ParallelGrain - 1) / ParallelGrain;
+    if (m_narrowParts.size() < chunkCount)
+        m_narrowParts.resize(chunkCount);
+
+    m_jobs->ParallelFor(chunkCount, 1, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t c = begin; c < end; ++c)
+            {
+                const uint32_t first = c * ParallelGrain;
+                const uint32_t count = std::min(ParallelGrain, n - first);
+                m_narrowParts[c].clear();
+                NarrowphaseRange(world, pairs.data() + first, count, m_narrowParts[c]);
+            }
+        });
+
+    size_t total = 0;
+    for (uint32_t c = 0; c < chunkCount; ++c)
+        total += m_narrowParts[c].size();
+
+    outContacts.reserve(total);
+    for (uint32_t c = 0; c < chunkCount; ++c)
+        outContacts.insert(outContacts.end(), m_narrowParts[c].begin(), m_narrowParts[c].end());
+}
+
+// World б⸸ ϹǷ  忡 ÿ ȣص 
+void PhysicsSystem::NarrowphaseRange(const World& world, const std::pair<EntityId, EntityId>* pairs, uint32_t count, std::vector<std::tuple<EntityId, EntityId, Contact>>& outContacts) const
+{
+    for (uint32_t pi = 0; pi < count; ++pi)
+    {
+        auto [a, b] = pairs[pi];
         if (!world.HasTransform(a) || !world.HasTransform(b)) continue;
 
         const auto& ca = world.GetCollider(a);
@@ -354,20 +835,47 @@ void PhysicsSystem::Narrowphase(World& world, const std::vector<std::pair<Entity
 }
 
 // Solve
-void PhysicsSystem::Solve(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, float dt)
+// Į / /SoA  BuildIslands       ο ǳʶ
+void PhysicsSystem::Solve(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, uint32_t awakeContacts, float dt)
 {
     const int iterations = (m_iterations > 0) ? m_iterations : 10;
 
+    if (m_solverMode == SolverMode::SoA)
+    {
+        m_soaSolver.Solve(world, contacts.data(), awakeContacts, iterations, dt);
+        return;
+    }
+
+    //  (ū ). jobs ų contact        
+    auto solveIslands = [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t k = begin; k < end; ++k)
+            {
+                const auto& r = m_islandRanges[m_islandOrder[k]];
+                SolveRange(world, contacts.data() + r.begin, r.count, iterations, dt);
+            }
+        };
+
+    if (UseJobs(contacts.size()))
+        m_jobs->ParallelFor((uint32_t)m_islandOrder.size(), 1, solveIslands);
+    else
+        solveIslands(0, (uint32_t)m_islandOrder.size());
+}
+
+// Į sequential impulses. [first, first+count)  ǰ(   solve )
+void PhysicsSystem::SolveRange(World& world, std::tuple<EntityId, EntityId, Contact>* first, size_t count, int iterations, float dt)
+{
     // ȭ Ķ(  ⺻ )
-    const float slop = 0.01f;      //  뷮
-    const float beta = 0.10f;  // bias 
-    const float bounceThreshold = 2.0f; // ̺   ݹ (ٴ  )
-	const float percent = 0.35f;     // positional correction (0.2~0.8)
+    const float slop = SolverTuning::Slop;      //  뷮
+    const float beta = SolverTuning::Beta;  // bias 
+    const float bounceThreshold = SolverTuning::BounceThreshold; // ̺   ݹ (ٴ  )
+	const float percent = SolverTuning::Percent;     // positional correction (0.2~0.8)
 
     for (int it = 0; it < iterations; ++it)
     {
-        for (auto& [a0, b0, c] : contacts)
+        for (size_t ci = 0; ci < count; ++ci)
         {
+            auto& [a0, b0, c] = first[ci];
             EntityId a = a0, b = b0;
 
             auto& ca = world.GetCollider(a);
@@ -399,7 +907,7 @@ void PhysicsSystem::Solve(World& world, std::vector<std::tuple<EntityId, EntityI
             // --- bias ( ſ ӵ) ---
             float pen = std::max(0.0f, c.penetration - slop);
             float bias = (dt > 0.0f) ? (beta * (pen / dt)) : 0.0f;
-			bias = std::min(bias, 5.0f); // ʹ ũ ʰ Ŭ
+			bias = std::min(bias, SolverTuning::MaxBias); // ʹ ũ ʰ Ŭ
 
             // --- restitution( 浹) ---
             float e = std::min(ca.material.restitution, cb.material.restitution);
@@ -413,7 +921,7 @@ void PhysicsSystem::Solve(World& world, std::vector<std::tuple<EntityId, EntityI
             if (pen > 0.0f)
             {
                 float corrMag = (pen / invMassSum) * percent;
-                corrMag = std::min(corrMag, 0.2f); // Ӵ ִ 20cm  (Ͽ °)
+                corrMag = std::min(corrMag, SolverTuning::MaxCorrection); // Ӵ ִ 20cm  (Ͽ °)
                 XMFLOAT3 correction = Mul(n, corrMag);
 
                 if (aDyn)
@@ -442,7 +950,7 @@ void PhysicsSystem::Solve(World& world, std::vector<std::tuple<EntityId, EntityI
             c.normalImpulseSum = std::max(0.0f, oldN + lambdaN);
             float dN = c.normalImpulseSum - oldN;
 
-            const float wakeImpulse = 0.02f;
+            const float wakeImpulse = SolverTuning::WakeImpulse;
 
             if (lambdaN > wakeImpulse)
             {
@@ -828,10 +1336,13 @@ void PhysicsSystem::EmitCollisionEvents(World& world, const std::vector<std::tup
     m_prevPairs = std::move(cur);
 }
 
-void PhysicsSystem::WarmStart(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts)
+//  ޽  contact (ĳ ), ӵ ݿ ִ  [0, awakeContacts)
+// ( body  Step ϸ solve  ʾ ӵ )
+void PhysicsSystem::WarmStart(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, uint32_t awakeContacts)
 {
-    for (auto& [a0, b0, c] : contacts)
+    for (size_t ci = 0; ci < contacts.size(); ++ci)
     {
+        auto& [a0, b0, c] = contacts[ci];
         EntityId a = a0, b = b0;
 
         // key ؼ ã
@@ -858,6 +1369,9 @@ void PhysicsSystem::WarmStart(World& world, std::vector<std::tuple<EntityId, Ent
         c.normalImpulseSum = it->second.normalImpulseSum;
         c.tangentImpulseSum = it->second.tangentImpulseSum;
 
+        if (ci >= awakeContacts)
+            continue;
+
         // ŸƮ ޽ (ӵ ̸ ݿ)
         const bool aDyn = world.HasRigidBody(a) && world.GetRigidBody(a).type == BodyType::Dynamic;
         const bool bDyn = world.HasRigidBody(b) && world.GetRigidBody(b).type == BodyType::Dynamic;
@@ -955,91 +1469,214 @@ void PhysicsSystem::UpdateSleep(World& world, float dt)
     }
 }
 
-bool PhysicsSystem::Raycast(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, RaycastHit& outHit, uint32_t collideMask, bool hitTriggers) const
+bool PhysicsSystem::QueryCandidate(const World& world, uint32_t entityIndex, EntityId& outEntity) const
 {
-    outHit = {};
+    if (entityIndex >= m_bpProxies.size())
+        return false;
 
-    float bestT = maxDist;
-    bool found = false;
+    // Ʈ  Sync ̶,   ı/Ʈ ŵ ƼƼ ⼭ Ÿ (,  SyncQueryTree  )
+    const EntityId e = m_bpProxies[entityIndex].entity;
+    if (!world.IsAlive(e) || !world.HasCollider(e) || !world.HasTransform(e))
+        return false;
 
-    const auto& ents = world.GetColliderEntities();
-    for (EntityId e : ents)
+    outEntity = e;
+    return true;
+}
+
+bool PhysicsSystem::RaycastCollider(const World& world, EntityId e, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, float& outT, DirectX::XMFLOAT3& outN) const
+{
+    const auto& col = world.GetCollider(e);
+    if (col.shapeType == ShapeType::Sphere)
     {
-        const auto& col = world.GetCollider(e);
+        DirectX::XMFLOAT3 cW{};
+        float r = 0.0f;
+        GetSphereWorld_RowVector(world, e, cW, r);
+        return RaySphere(origin, dirNormalized, maxDist, cW, r, outT, outN);
+    }
 
-        // layer/mask
-        if ((col.layer & collideMask) == 0) continue;
-        if (!hitTriggers && col.isTrigger) continue;
+    // Box
+    AABB box = ComputeWorldAABB(world, e);
+    return RayAABB(origin, dirNormalized, maxDist, box, outT, outN);
+}
 
-        float t = 0.0f;
-        DirectX::XMFLOAT3 n{ 0,0,0 };
+bool PhysicsSystem::OverlapSphereCollider(const World& world, EntityId e, const DirectX::XMFLOAT3& center, float radius) const
+{
+    const auto& col = world.GetCollider(e);
+    if (col.shapeType == ShapeType::Sphere)
+    {
+        DirectX::XMFLOAT3 cW{};
+        float r = 0.0f;
+        GetSphereWorld_RowVector(world, e, cW, r);
+        float rr = radius + r;
+        DirectX::XMFLOAT3 d{ cW.x - center.x, cW.y - center.y, cW.z - center.z };
+        return (d.x * d.x + d.y * d.y + d.z * d.z) <= (rr * rr);
+    }
 
-        if (col.shapeType == ShapeType::Sphere)
+    // sphere vs AABB
+    AABB box = ComputeWorldAABB(world, e);
+    float x = std::max(box.min.x, std::min(center.x, box.max.x));
+    float y = std::max(box.min.y, std::min(center.y, box.max.y));
+    float z = std::max(box.min.z, std::min(center.z, box.max.z));
+    float dx = center.x - x, dy = center.y - y, dz = center.z - z;
+    return (dx * dx + dy * dy + dz * dz) <= radius * radius;
+}
+
+//  ĺ ȸ: fn(entity, maxT) ->  maxT (hit̸ ٿ ȯ, 0 ϸ )
+// Ʈ  static/dynamic Ʈ  , (BruteForce /collider )  ĵ
+template<typename Fn>
+void PhysicsSystem::RaycastCandidates(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, Fn&& fn) const
+{
+    float cur = maxDist;
+
+    SyncQueryTree(world);
+    if (!UseQueryTree())
+    {
+        for (EntityId e : world.GetColliderEntities())
         {
-            DirectX::XMFLOAT3 cW{};
-            float r = 0.0f;
-            GetSphereWorld_RowVector(world, e, cW, r);
-            if (!RaySphere(origin, dirNormalized, bestT, cW, r, t, n)) continue;
+            const float r = fn(e, cur);
+            if (r <= 0.0f) return;
+            cur = std::min(cur, r);
         }
-        else // Box
+        return;
+    }
+
+    bool stop = false;
+    auto candidate = [&](uint32_t entityIndex, float maxT) -> float
         {
-            AABB box = ComputeWorldAABB(world, e);
-            if (!RayAABB(origin, dirNormalized, bestT, box, t, n)) continue;
-        }
+            EntityId e;
+            if (!QueryCandidate(world, entityIndex, e))
+                return maxT;
+
+            const float r = fn(e, maxT);
+            if (r <= 0.0f) { stop = true; return 0.0f; }
+            cur = std::min(cur, r);
+            return cur;
+        };
+
+    // static BVH(tight AABB), dynamic Ʈ
+    m_staticBVH.RayCast(origin, dirNormalized, cur, candidate);
+    if (stop) return;
+
+    m_dynamicTree.RayCast(origin, dirNormalized, cur, [&](int32_t proxyId, float maxT) -> float
+        {
+            return candidate(m_dynamicTree.GetUserData(proxyId), maxT);
+        });
+}
+
+bool PhysicsSystem::Raycast(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, RaycastHit& outHit, uint32_t collideMask, bool hitTriggers) const
+{
+    outHit = {};
+
+    float bestT = maxDist;
+    bool found = false;
+
+    RaycastCandidates(world, origin, dirNormalized, maxDist, [&](EntityId e, float maxT) -> float
+        {
+            const auto& col = world.GetCollider(e);
+
+            // layer/mask
+            if (((1u << col.layer) & collideMask) == 0) return maxT;
+            if (!hitTriggers && col.isTrigger) return maxT;
+
+            float t = 0.0f;
+            DirectX::XMFLOAT3 n{ 0,0,0 };
+            if (!RaycastCollider(world, e, origin, dirNormalized, bestT, t, n)) return maxT;
+
+            if (t < bestT)
+            {
+                bestT = t;
+                found = true;
+                outHit.entity = e;
+                outHit.t = t;
+                outHit.point = { origin.x + dirNormalized.x * t,
+                                 origin.y + dirNormalized.y * t,
+                                 origin.z + dirNormalized.z * t };
+                outHit.normal = n;
+                outHit.isTrigger = col.isTrigger;
+            }
+
+            //  ٷ ¾    
+            return (bestT > 0.0f) ? bestT : 0.0f;
+        });
+
+    return found;
+}
+
+bool PhysicsSystem::RaycastAny(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, uint32_t collideMask, bool hitTriggers) const
+{
+    bool found = false;
 
-        if (t < bestT)
+    RaycastCandidates(world, origin, dirNormalized, maxDist, [&](EntityId e, float maxT) -> float
         {
-            bestT = t;
+            const auto& col = world.GetCollider(e);
+            if (((1u << col.layer) & collideMask) == 0) return maxT;
+            if (!hitTriggers && col.isTrigger) return maxT;
+
+            float t = 0.0f;
+            DirectX::XMFLOAT3 n{ 0,0,0 };
+            if (!RaycastCollider(world, e, origin, dirNormalized, maxDist, t, n)) return maxT;
+
             found = true;
-            outHit.entity = e;
-            outHit.t = t;
-            outHit.point = { origin.x + dirNormalized.x * t,
-                             origin.y + dirNormalized.y * t,
-                             origin.z + dirNormalized.z * t };
-            outHit.normal = n;
-            outHit.isTrigger = col.isTrigger;
-        }
-    }
+            return 0.0f; // early-out
+        });
 
     return found;
 }
 
+int PhysicsSystem::RaycastBatch(const World& world, const std::vector<RayQuery>& rays, std::vector<RaycastHit>& outHits, uint32_t collideMask, bool hitTriggers) const
+{
+    outHits.resize(rays.size());
+
+    int hitCount = 0;
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        const RayQuery& r = rays[i];
+        if (Raycast(world, r.origin, r.dir, r.maxDist, outHits[i], collideMask, hitTriggers))
+            ++hitCount;
+    }
+
+    return hitCount;
+}
+
 int PhysicsSystem::OverlapSphere(const World& world, const DirectX::XMFLOAT3& center, float radius, std::vector<EntityId>& outHits, uint32_t collideMask, bool includeTriggers) const
 {
     outHits.clear();
-    const float r2 = radius * radius;
 
-    const auto& ents = world.GetColliderEntities();
-    for (EntityId e : ents)
+    auto test = [&](EntityId e)
+        {
+            const auto& col = world.GetCollider(e);
+            if (((1u << col.layer) & collideMask) == 0) return;
+            if (!includeTriggers && col.isTrigger) return;
+
+            if (OverlapSphereCollider(world, e, center, radius))
+                outHits.push_back(e);
+        };
+
+    SyncQueryTree(world);
+    if (!UseQueryTree())
     {
-        const auto& col = world.GetCollider(e);
-        if ((col.layer & collideMask) == 0) continue;
-        if (!includeTriggers && col.isTrigger) continue;
+        for (EntityId e : world.GetColliderEntities())
+            test(e);
+        return (int)outHits.size();
+    }
 
-        bool hit = false;
+    AABB q{};
+    q.min = { center.x - radius, center.y - radius, center.z - radius };
+    q.max = { center.x + radius, center.y + radius, center.z + radius };
 
-        if (col.shapeType == ShapeType::Sphere)
+    auto candidate = [&](uint32_t entityIndex) -> bool
         {
-            DirectX::XMFLOAT3 cW{};
-            float r = 0.0f;
-            GetSphereWorld_RowVector(world, e, cW, r);
-            float rr = radius + r;
-            DirectX::XMFLOAT3 d{ cW.x - center.x, cW.y - center.y, cW.z - center.z };
-            hit = (d.x * d.x + d.y * d.y + d.z * d.z) <= (rr * rr);
-        }
-        else
-        {
-            // sphere vs AABB
-            AABB box = ComputeWorldAABB(world, e);
-            float x = std::max(box.min.x, std::min(center.x, box.max.x));
-            float y = std::max(box.min.y, std::min(center.y, box.max.y));
-            float z = std::max(box.min.z, std::min(center.z, box.max.z));
-            float dx = center.x - x, dy = center.y - y, dz = center.z - z;
-            hit = (dx * dx + dy * dy + dz * dz) <= r2;
-        }
+            EntityId e;
+            if (QueryCandidate(world, entityIndex, e))
+                test(e);
+            return true;
+        };
 
-        if (hit) outHits.push_back(e);
-    }
+    m_staticBVH.Query(q, candidate);
+    m_dynamicTree.Query(q, [&](int32_t proxyId) -> bool
+        {
+            return candidate(m_dynamicTree.GetUserData(proxyId));
+        });
 
     return (int)outHits.size();
-}
\ No newline at end of file
+}
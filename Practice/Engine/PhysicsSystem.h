@@ -1,6 +1,10 @@
 #pragma once
 #include "World.h"
 #include "PhysicsTypes.h"
+#include "DynamicAABBTree.h"
+#include "StaticBVH.h"
+#include "ContactSolverSoA.h"
+#include "JobSystem.h"
 #include <unordered_map>
 #include <cstdint>
 #include <vector>
@@ -17,7 +21,61 @@ public:
     void SetGravityEnabled(bool enabled) { m_gravityEnabled = enabled; }
     bool IsGravityEnabled() const { return m_gravityEnabled; }
 
+    // Broadphase
+    enum class BroadphaseMode : uint8_t
+    {
+        BruteForce,   // O(n^2) ü  (/)
+        DynamicTree,  // static/dynamic    AABB Ʈ
+    };
+
+    struct BroadphaseStats
+    {
+        uint32_t colliderCount = 0;
+        uint32_t pairCount = 0;      // narrowphase ѱ ĺ 
+        uint32_t contactCount = 0;   // narrowphase ( )
+        uint32_t reinsertCount = 0;  // fat AABB  Ʈ Ե proxy 
+        int32_t staticTreeHeight = 0;
+        int32_t dynamicTreeHeight = 0;
+        double broadphaseMs = 0.0;
+    };
+
+    void SetBroadphaseMode(BroadphaseMode mode) { m_broadphaseMode = mode; }
+    BroadphaseMode GetBroadphaseMode() const { return m_broadphaseMode; }
+    const BroadphaseStats& GetBroadphaseStats() const { return m_bpStats; }
+
+    // Solver
+    enum class SolverMode : uint8_t
+    {
+        Scalar,  // contact    ( )
+        SoA,     // gather/scatter + ׷ ÷ 4-lane SIMD (ContactSolverSoA)
+    };
+
+    void SetSolverMode(SolverMode mode) { m_solverMode = mode; }
+    SolverMode GetSolverMode() const { return m_solverMode; }
+    const ContactSolverSoA::Stats& GetSoASolverStats() const { return m_soaSolver.GetStats(); }
+
+    //  Step: Integrate/Narrowphase   + Į solver island  ÿ ǯ
+    // jobs nullptr̰ų Ȱȭ  ȣ 忡  
+    void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+    JobSystem* GetJobSystem() const { return m_jobs; }
+    void SetParallelEnabled(bool enabled) { m_parallelEnabled = enabled; }
+    bool IsParallelEnabled() const { return m_parallelEnabled; }
+
+    struct StepStats
+    {
+        double stepMs = 0.0;
+        uint32_t threadCount = 1;
+        uint32_t islandCount = 0;      // solver  ϰ  Step ä
+        uint32_t sleepingIslands = 0;
+        uint32_t largestIsland = 0;    // contact 
+    };
+
+    const StepStats& GetStepStats() const { return m_stepStats; }
+
 	// Raycast
+    // - Scene query(Raycast/RaycastAny/RaycastBatch/OverlapSphere)  UpdateTransforms  ġ 
+    //   Step  collider ߰//̵(World::GetColliderVersion)   Ʈ ٽ 
+    // - ׷ const Ʈ ĳø ĥ    Step  忡 ȣ
     struct RaycastHit
     {
         EntityId entity = EntityId::Invalid();
@@ -29,20 +87,74 @@ public:
 
     bool Raycast(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, RaycastHit& outHit, uint32_t collideMask = ~0u, bool hitTriggers = false) const;
 
+    // ƹų ϳ  ٷ true (׸/þ üũ,   hit ã )
+    bool RaycastAny(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, uint32_t collideMask = ~0u, bool hitTriggers = false) const;
+
+    struct RayQuery
+    {
+        DirectX::XMFLOAT3 origin{ 0,0,0 };
+        DirectX::XMFLOAT3 dir{ 0,0,1 };   // normalized
+        float maxDist = 1000.0f;
+    };
+
+    //  ̸  : outHits[i] rays[i] (̽ entity Invalid). ȯ = hit 
+    int RaycastBatch(const World& world, const std::vector<RayQuery>& rays, std::vector<RaycastHit>& outHits, uint32_t collideMask = ~0u, bool hitTriggers = false) const;
+
 	// Overlap Sphere
     int OverlapSphere(const World& world, const DirectX::XMFLOAT3& center, float radius, std::vector<EntityId>& outHits, uint32_t collideMask = ~0u, bool includeTriggers = true) const;
 
 private:
     XMFLOAT3 m_gravity{ 0.0f, -9.81f, 0.0f };
     int m_iterations = 10; // solver ݺ
+    SolverMode m_solverMode = SolverMode::Scalar;
+    ContactSolverSoA m_soaSolver;
+
+    JobSystem* m_jobs = nullptr;
+    bool m_parallelEnabled = true;
+    StepStats m_stepStats{};
+
+    static constexpr uint32_t ParallelMinItems = 256; // ̺     ŭ
+    static constexpr uint32_t ParallelGrain = 128;
     bool m_gravityEnabled = true;
 
     // --- pipeline stages ---
     void Integrate(World& world, float dt);
     void BuildPairs(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs);
+    void BuildPairs_BruteForce(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs);
+    void BuildPairs_Tree(World& world, std::vector<std::pair<EntityId, EntityId>>& outPairs);
     void Narrowphase(World& world, const std::vector<std::pair<EntityId, EntityId>>& pairs, std::vector<std::tuple<EntityId, EntityId, Contact>>& outContacts);
 
-    void Solve(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, float dt);
+    void NarrowphaseRange(const World& world, const std::pair<EntityId, EntityId>* pairs, uint32_t count, std::vector<std::tuple<EntityId, EntityId, Contact>>& outContacts) const;
+
+    void Solve(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, uint32_t awakeContacts, float dt);
+    void SolveRange(World& world, std::tuple<EntityId, EntityId, Contact>* first, size_t count, int iterations, float dt);
+    uint32_t BuildIslands(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts);
+
+    bool UseJobs(size_t itemCount) const;
+
+    // Islands (BuildIslands  Step )
+    struct IslandRange
+    {
+        uint32_t begin = 0;
+        uint32_t count = 0;
+        bool awake = false;
+    };
+
+    std::vector<int32_t> m_islandSlotOfEntity;   // entity.index -> union-find slot (-1 = )
+    std::vector<uint32_t> m_islandTouched;
+    std::vector<int32_t> m_islandParent;
+    std::vector<uint8_t> m_islandAwake;
+    std::vector<int32_t> m_islandOfRoot;
+    std::vector<int32_t> m_contactSlot;
+    std::vector<IslandRange> m_islandRanges;
+    std::vector<uint32_t> m_islandCursor;
+    std::vector<uint32_t> m_islandOrder;
+    std::vector<std::tuple<EntityId, EntityId, Contact>> m_contactScratch;
+
+    std::vector<std::vector<std::tuple<EntityId, EntityId, Contact>>> m_narrowParts;
+
+    // Integrate  (dynamic & awake body) - World::ForEach    
+    std::vector<std::pair<RigidBodyComponent*, TransformComponent*>> m_integrateBodies;
 
     // --- helpers ---
     AABB ComputeWorldAABB(const World& world, EntityId e) const;
@@ -52,6 +164,59 @@ private:
     bool Collide_AABBAABB(const AABB& a, const AABB& b, Contact& out) const;
     bool Collide_SphereAABB(const XMFLOAT3& c, float r, const AABB& b, Contact& out) const;
 
+    // Broadphase (dynamic AABB tree)
+    struct BroadphaseProxy
+    {
+        EntityId entity = EntityId::Invalid();
+        int32_t proxyId = DynamicAABBTree::NullNode;
+        bool inStaticTree = false;
+        uint32_t stamp = 0;
+
+        //  Ϳ ĳ(ָ World ȸ ʵ Sync  ä)
+        bool isDynamic = false;
+        bool isAwake = false;
+        bool isTrigger = false;
+        uint32_t layerBit = 0;
+        uint32_t collideMask = 0;
+        XMFLOAT3 lastCenter{ 0,0,0 };
+
+        // static  BVH (static Ʈ ִ proxy)
+        AABB box{};                         // tight world AABB (refit Ǵܿ)
+        uint32_t bvhItem = StaticBVH::InvalidIndex;
+    };
+
+    BroadphaseMode m_broadphaseMode = BroadphaseMode::DynamicTree;
+    BroadphaseStats m_bpStats{};
+
+    DynamicAABBTree m_staticTree;
+    DynamicAABBTree m_dynamicTree;
+
+    // static ݶ̴ scene query BVH (tight AABB, SAH  fat Ʈ / ĺ )
+    // -  ã ״ m_staticTree(fat AABB) 
+    // - static proxy /  , static ̸ refit
+    StaticBVH m_staticBVH;
+    bool m_staticBVHDirty = false;
+    std::vector<BroadphaseProxy> m_bpProxies; // entity.index ε
+    std::vector<uint32_t> m_bpActive;         // proxy  entity index 
+    uint32_t m_bpStamp = 0;
+
+    // Ʈ  World  (ٸ   SyncBroadphase)
+    uint32_t m_bpWorldId = 0;
+    uint32_t m_bpColliderVersion = 0;
+
+    void SyncBroadphase(const World& world);
+    void SyncQueryTree(const World& world) const;
+    void DestroyProxy(BroadphaseProxy& p);
+    void RebuildStaticBVH();
+
+    // Scene query : Ʈ    / ĺ ϳ   ׽Ʈ
+    bool UseQueryTree() const { return m_broadphaseMode == BroadphaseMode::DynamicTree && !m_bpActive.empty(); }
+    bool QueryCandidate(const World& world, uint32_t entityIndex, EntityId& outEntity) const;
+    bool RaycastCollider(const World& world, EntityId e, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, float& outT, DirectX::XMFLOAT3& outN) const;
+    bool OverlapSphereCollider(const World& world, EntityId e, const DirectX::XMFLOAT3& center, float radius) const;
+    template<typename Fn>
+    void RaycastCandidates(const World& world, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dirNormalized, float maxDist, Fn&& fn) const;
+
     // Collision Events
     std::unordered_map<uint64_t, std::pair<EntityId, EntityId>> m_prevPairs;
 
@@ -68,7 +233,7 @@ private:
 
     std::unordered_map<uint64_t, CachedContact> m_contactCache;
 
-    void WarmStart(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts);
+    void WarmStart(World& world, std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts, uint32_t awakeContacts);
     void StoreContactCache(const std::vector<std::tuple<EntityId, EntityId, Contact>>& contacts);
     void UpdateSleep(World& world, float dt);
 
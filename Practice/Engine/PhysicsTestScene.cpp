@@ -10,6 +10,9 @@
 #include "DebugDraw.h"
 #include "PhysicsSystem.h"
 #include <string>
+#include <cstdio>
+#include <chrono>
+#include <algorithm>
 
 using namespace DirectX;
 
@@ -124,6 +127,41 @@ EntityId PhysicsTestScene::CreateBall(SceneContext& ctx, const XMFLOAT3& pos)
     return e;
 }
 
+void PhysicsTestScene::SpawnBallGrid(SceneContext& ctx, int n, float spacing)
+{
+    const float half = (n - 1) * spacing * 0.5f;
+    for (int y = 0; y < n; ++y)
+        for (int z = 0; z < n; ++z)
+            for (int x = 0; x < n; ++x)
+            {
+                XMFLOAT3 pos{ x * spacing - half, 2.0f + y * spacing, z * spacing - half };
+                m_balls.push_back(CreateBall(ctx, pos));
+            }
+}
+
+void PhysicsTestScene::MeasureRayBatch(SceneContext& ctx, int& outHits, double& outMs)
+{
+    // 16 x 16 = 256, ٴ(20x20)   
+    const int n = 16;
+    std::vector<PhysicsSystem::RayQuery> rays;
+    rays.reserve(n * n);
+    for (int z = 0; z < n; ++z)
+        for (int x = 0; x < n; ++x)
+        {
+            PhysicsSystem::RayQuery r{};
+            r.origin = { -9.5f + x * (19.0f / (n - 1)), 30.0f, -9.5f + z * (19.0f / (n - 1)) };
+            r.dir = { 0.0f, -1.0f, 0.0f };
+            r.maxDist = 40.0f;
+            rays.push_back(r);
+        }
+
+    std::vector<PhysicsSystem::RaycastHit> hits;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    outHits = ctx.physics.RaycastBatch(ctx.world, rays, hits);
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    outMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
 void PhysicsTestScene::ResetWorld(SceneContext& ctx)
 {
     //  
@@ -252,6 +290,43 @@ void PhysicsTestScene::OnUpdate(SceneContext& ctx)
         ctx.physics.SetGravityEnabled(m_gravityOn);
     }
 
+    // N:  1000 ߰, B: ε  ȯ(BruteForce <-> DynamicTree 񱳿)
+    if (ctx.input.IsKeyPressed(Key::N))
+    {
+        SpawnBallGrid(ctx, 10, 1.1f);
+    }
+
+    if (ctx.input.IsKeyPressed(Key::B))
+    {
+        using Mode = PhysicsSystem::BroadphaseMode;
+        const Mode cur = ctx.physics.GetBroadphaseMode();
+        ctx.physics.SetBroadphaseMode(cur == Mode::DynamicTree ? Mode::BruteForce : Mode::DynamicTree);
+    }
+
+    // M: solver  ȯ(Scalar <-> SoA)
+    if (ctx.input.IsKeyPressed(Key::M))
+    {
+        using Mode = PhysicsSystem::SolverMode;
+        const Mode cur = ctx.physics.GetSolverMode();
+        ctx.physics.SetSolverMode(cur == Mode::SoA ? Mode::Scalar : Mode::SoA);
+    }
+
+    // J:  Ŀ  ȯ(0  1  2  4  ...  ü) -   step ð 񱳿
+    if (ctx.input.IsKeyPressed(Key::J))
+    {
+        if (JobSystem* jobs = ctx.physics.GetJobSystem())
+        {
+            const uint32_t all = jobs->GetWorkerCount();
+            const uint32_t cur = std::min(jobs->GetMaxActiveWorkers(), all);
+
+            uint32_t next = (cur == 0) ? 1 : cur * 2;
+            if (cur >= all) next = 0;
+            else if (next > all) next = all;
+
+            jobs->SetMaxActiveWorkers(next);
+        }
+    }
+
     // --- 浹 ̺Ʈ   ٲٱ ---
     std::vector<CollisionEvent> evs;
     ctx.world.DrainCollisionEvents(evs);
@@ -264,6 +339,7 @@ void PhysicsTestScene::OnUpdate(SceneContext& ctx)
                 if (!ctx.world.IsAlive(e) || !ctx.world.HasMaterial(e)) return;
                 auto& m = ctx.world.GetMaterial(e);
                 m.Primary().color = col;
+                ctx.world.MarkRenderChanged(e, RenderChangeFlags::Material);
             };
 
         // Enter: , Stay: Ȳ, Exit: ϴû()
@@ -286,4 +362,40 @@ void PhysicsTestScene::OnUpdate(SceneContext& ctx)
 
     ctx.DrawText(12.0f, 12.0f, L"ѱ ׽Ʈ", 18.0f);
     ctx.DrawText(12.0f, 36.0f, L"Hello DWrite", 18.0f, { 1,1,0,1 }, L"Segoe UI");
+
+    // ε 
+    {
+        const auto& st = ctx.physics.GetBroadphaseStats();
+        const bool tree = ctx.physics.GetBroadphaseMode() == PhysicsSystem::BroadphaseMode::DynamicTree;
+        const double pairsPerSec = (st.broadphaseMs > 0.0) ? (st.pairCount / (st.broadphaseMs * 0.001)) : 0.0;
+
+        wchar_t buf[256];
+        swprintf_s(buf, L"[%s] colliders %u  pairs %u  contacts %u  reinsert %u  bp %.3f ms (%.0f pairs/s)",
+            tree ? L"Tree" : L"Brute", st.colliderCount, st.pairCount, st.contactCount, st.reinsertCount,
+            st.broadphaseMs, pairsPerSec);
+        ctx.DrawText(12.0f, 60.0f, buf, 16.0f, { 0.6f,1,0.6f,1 });
+
+        int rayHits = 0;
+        double rayMs = 0.0;
+        MeasureRayBatch(ctx, rayHits, rayMs);
+        swprintf_s(buf, L"raycast batch 256: hits %d  %.3f ms", rayHits, rayMs);
+        ctx.DrawText(12.0f, 80.0f, buf, 16.0f, { 0.6f,1,0.6f,1 });
+
+        if (ctx.physics.GetSolverMode() == PhysicsSystem::SolverMode::SoA)
+        {
+            const auto& ss = ctx.physics.GetSoASolverStats();
+            swprintf_s(buf, L"[SoA solver] bodies %u  contacts %u  colors %u  batches %u  overflow %u",
+                ss.bodyCount, ss.contactCount, ss.colorCount, ss.batchCount, ss.overflowContacts);
+        }
+        else
+        {
+            swprintf_s(buf, L"[Scalar solver]");
+        }
+        ctx.DrawText(12.0f, 100.0f, buf, 16.0f, { 0.6f,1,0.6f,1 });
+
+        const auto& ps = ctx.physics.GetStepStats();
+        swprintf_s(buf, L"step %.3f ms  threads %u  islands %u (sleeping %u)  largest %u",
+            ps.stepMs, ps.threadCount, ps.islandCount, ps.sleepingIslands, ps.largestIsland);
+        ctx.DrawText(12.0f, 120.0f, buf, 16.0f, { 0.6f,1,0.6f,1 });
+    }
 }
@@ -30,4 +30,9 @@ private:
     EntityId CreateGround(SceneContext& ctx);
     EntityId CreateBall(SceneContext& ctx, const DirectX::XMFLOAT3& pos);
 
+    // ε  ׽Ʈ: n x n x n ڷ  
+    void SpawnBallGrid(SceneContext& ctx, int n, float spacing);
+
+    //   ׽Ʈ:    Ʒ   (RaycastBatch) ð 
+    void MeasureRayBatch(SceneContext& ctx, int& outHits, double& outMs);
 };
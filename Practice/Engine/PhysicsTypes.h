@@ -29,4 +29,16 @@ struct Contact
     // --- Sequential Impulses( ޽) ---
     float normalImpulseSum = 0.0f;   // n  (>=0)
     float tangentImpulseSum = 0.0f;  // t  ()
-};
\ No newline at end of file
+};
+
+// Sequential Impulses Ʃװ (Į/SoA solver )
+namespace SolverTuning
+{
+    constexpr float Slop = 0.01f;             //  뷮
+    constexpr float Beta = 0.10f;             // bias 
+    constexpr float MaxBias = 5.0f;           // bias Ŭ
+    constexpr float BounceThreshold = 2.0f;   // ̺   ݹ (ٴ  )
+    constexpr float Percent = 0.35f;          // positional correction (0.2~0.8)
+    constexpr float MaxCorrection = 0.2f;     // ݺ ִ ġ 
+    constexpr float WakeImpulse = 0.02f;      // ̺ ū ޽ 
+}
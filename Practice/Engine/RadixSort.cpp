@@ -0,0 +1,62 @@
+﻿#include "RadixSort.h"
+#include <cstring>
+
+uint32_t RadixSort64(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch)
+{
+    constexpr uint32_t Digits = 8;
+    constexpr uint32_t Buckets = 256;
+
+    const size_t n = entries.size();
+    if (n < 2)
+        return 0;
+
+    // 자릿수별 히스토그램 (한 번 훑기)
+    uint32_t hist[Digits][Buckets];
+    std::memset(hist, 0, sizeof(hist));
+
+    for (const SortEntry& e : entries)
+    {
+        const uint64_t k = e.key;
+        for (uint32_t d = 0; d < Digits; ++d)
+            ++hist[d][(k >> (d * 8)) & 0xFF];
+    }
+
+    scratch.resize(n);
+    SortEntry* src = entries.data();
+    SortEntry* dst = scratch.data();
+
+    uint32_t passes = 0;
+    for (uint32_t d = 0; d < Digits; ++d)
+    {
+        const uint32_t shift = d * 8;
+
+        // 전부 같은 bucket → 이 자릿수는 순서를 안 바꿈
+        const uint32_t firstBucket = (uint32_t)((src[0].key >> shift) & 0xFF);
+        if (hist[d][firstBucket] == n)
+            continue;
+
+        // 누적합 → bucket 시작 위치
+        uint32_t offsets[Buckets];
+        uint32_t sum = 0;
+        for (uint32_t b = 0; b < Buckets; ++b)
+        {
+            offsets[b] = sum;
+            sum += hist[d][b];
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const SortEntry& e = src[i];
+            dst[offsets[(e.key >> shift) & 0xFF]++] = e;
+        }
+
+        SortEntry* t = src; src = dst; dst = t;
+        ++passes;
+    }
+
+    // 홀수 패스면 결과가 scratch 쪽에 있음
+    if (src != entries.data())
+        entries.swap(scratch);
+
+    return passes;
+}
@@ -0,0 +1,16 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+// 64bit 키 + 32bit payload LSD radix sort (8bit 자릿수 8패스, 안정 정렬)
+// - 히스토그램 8개를 한 번에 세고, 모든 키가 같은 bucket에 몰린 자릿수는 패스 생략
+//   (정렬 키 상위 pass/pipeline 비트처럼 프레임 내내 같은 값이면 공짜)
+// - scratch는 호출 쪽이 들고 있어 매 프레임 재할당 없음
+struct SortEntry
+{
+    uint64_t key = 0;
+    uint32_t value = 0;
+};
+
+// entries를 key 오름차순으로 정렬 (같은 key는 입력 순서 유지). 반환값 = 실제 수행한 패스 수
+uint32_t RadixSort64(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
@@ -0,0 +1,174 @@
+﻿#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+#include "MeshCPUData.h"
+
+// 렌더링용 바운딩 볼륨 (center/extents AABB)
+struct MeshBounds
+{
+    DirectX::XMFLOAT3 center{ 0, 0, 0 };
+    DirectX::XMFLOAT3 extents{ 0, 0, 0 }; // half size
+};
+
+// 로컬 공간 AABB (positions 전체 기준: submesh도 같은 bounds를 공유 → 보수적)
+static inline MeshBounds ComputeMeshBounds(const MeshCPUData& mesh)
+{
+    using namespace DirectX;
+
+    MeshBounds b{};
+    if (mesh.positions.empty())
+        return b;
+
+    XMVECTOR mn = XMLoadFloat3(&mesh.positions[0]);
+    XMVECTOR mx = mn;
+    for (const XMFLOAT3& p : mesh.positions)
+    {
+        const XMVECTOR v = XMLoadFloat3(&p);
+        mn = XMVectorMin(mn, v);
+        mx = XMVectorMax(mx, v);
+    }
+
+    XMStoreFloat3(&b.center, XMVectorScale(XMVectorAdd(mn, mx), 0.5f));
+    XMStoreFloat3(&b.extents, XMVectorScale(XMVectorSubtract(mx, mn), 0.5f));
+    return b;
+}
+
+// 두 AABB를 감싸는 AABB
+static inline MeshBounds MergeBounds(const MeshBounds& a, const MeshBounds& b)
+{
+    using namespace DirectX;
+
+    const XMVECTOR ac = XMLoadFloat3(&a.center), ae = XMLoadFloat3(&a.extents);
+    const XMVECTOR bc = XMLoadFloat3(&b.center), be = XMLoadFloat3(&b.extents);
+    const XMVECTOR mn = XMVectorMin(XMVectorSubtract(ac, ae), XMVectorSubtract(bc, be));
+    const XMVECTOR mx = XMVectorMax(XMVectorAdd(ac, ae), XMVectorAdd(bc, be));
+
+    MeshBounds out{};
+    XMStoreFloat3(&out.center, XMVectorScale(XMVectorAdd(mn, mx), 0.5f));
+    XMStoreFloat3(&out.extents, XMVectorScale(XMVectorSubtract(mx, mn), 0.5f));
+    return out;
+}
+
+// 로컬 AABB → 월드 AABB (row-vector 관례: p' = p * W)
+// extents' = |W(3x3)|^T * extents (회전된 박스를 감싸는 최소 AABB)
+static inline MeshBounds TransformBounds(const MeshBounds& local, const DirectX::XMFLOAT4X4& world)
+{
+    using namespace DirectX;
+
+    const XMMATRIX W = XMLoadFloat4x4(&world);
+    const XMVECTOR c = XMVector3Transform(XMLoadFloat3(&local.center), W);
+
+    XMVECTOR e = XMVectorMultiply(XMVectorReplicate(local.extents.x), XMVectorAbs(W.r[0]));
+    e = XMVectorMultiplyAdd(XMVectorReplicate(local.extents.y), XMVectorAbs(W.r[1]), e);
+    e = XMVectorMultiplyAdd(XMVectorReplicate(local.extents.z), XMVectorAbs(W.r[2]), e);
+
+    MeshBounds out{};
+    XMStoreFloat3(&out.center, c);
+    XMStoreFloat3(&out.extents, e);
+    return out;
+}
+
+enum class FrustumTest : uint8_t { Outside, Intersects, Inside };
+
+// view * proj에서 뽑은 6개 평면 (안쪽이 +)
+// - 평면을 SoA로 4개씩 묶어 둠: AABB 하나를 평면 4개와 한 번에 비교 (2번이면 6개 끝)
+struct Frustum
+{
+    // [0]: left/right/bottom/top, [1]: near/far/near/far (패딩은 중복 평면)
+    DirectX::XMVECTOR px[2], py[2], pz[2], pw[2];
+    DirectX::XMVECTOR apx[2], apy[2], apz[2]; // |normal| (extents 투영용)
+
+    // D3D 관례 (clip z: 0..1), row-vector: clip = v * viewProj
+    static Frustum FromViewProj(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& proj)
+    {
+        using namespace DirectX;
+
+        // 열 벡터를 행으로 꺼내기 위해 전치
+        const XMMATRIX VP = XMMatrixMultiply(XMLoadFloat4x4(&view), XMLoadFloat4x4(&proj));
+        const XMMATRIX T = XMMatrixTranspose(VP);
+
+        const XMVECTOR left = XMPlaneNormalize(XMVectorAdd(T.r[3], T.r[0]));
+        const XMVECTOR right = XMPlaneNormalize(XMVectorSubtract(T.r[3], T.r[0]));
+        const XMVECTOR bottom = XMPlaneNormalize(XMVectorAdd(T.r[3], T.r[1]));
+        const XMVECTOR top = XMPlaneNormalize(XMVectorSubtract(T.r[3], T.r[1]));
+        const XMVECTOR nearP = XMPlaneNormalize(T.r[2]);
+        const XMVECTOR farP = XMPlaneNormalize(XMVectorSubtract(T.r[3], T.r[2]));
+
+        XMMATRIX g0; g0.r[0] = left;  g0.r[1] = right; g0.r[2] = bottom; g0.r[3] = top;
+        XMMATRIX g1; g1.r[0] = nearP; g1.r[1] = farP;  g1.r[2] = nearP;  g1.r[3] = farP;
+
+        Frustum f{};
+        const XMMATRIX s0 = XMMatrixTranspose(g0);
+        const XMMATRIX s1 = XMMatrixTranspose(g1);
+        f.px[0] = s0.r[0]; f.py[0] = s0.r[1]; f.pz[0] = s0.r[2]; f.pw[0] = s0.r[3];
+        f.px[1] = s1.r[0]; f.py[1] = s1.r[1]; f.pz[1] = s1.r[2]; f.pw[1] = s1.r[3];
+
+        for (int i = 0; i < 2; ++i)
+        {
+            f.apx[i] = XMVectorAbs(f.px[i]);
+            f.apy[i] = XMVectorAbs(f.py[i]);
+            f.apz[i] = XMVectorAbs(f.pz[i]);
+        }
+        return f;
+    }
+
+    // AABB가 어느 한 평면의 완전히 바깥이면 false (경계 걸침은 보이는 걸로)
+    bool IntersectsAABB(const MeshBounds& b) const
+    {
+        using namespace DirectX;
+
+        const XMVECTOR cx = XMVectorReplicate(b.center.x);
+        const XMVECTOR cy = XMVectorReplicate(b.center.y);
+        const XMVECTOR cz = XMVectorReplicate(b.center.z);
+        const XMVECTOR ex = XMVectorReplicate(b.extents.x);
+        const XMVECTOR ey = XMVectorReplicate(b.extents.y);
+        const XMVECTOR ez = XMVectorReplicate(b.extents.z);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            // d = n·c + w, r = |n|·e → d + r < 0 이면 바깥
+            XMVECTOR d = XMVectorMultiplyAdd(cx, px[i], pw[i]);
+            d = XMVectorMultiplyAdd(cy, py[i], d);
+            d = XMVectorMultiplyAdd(cz, pz[i], d);
+
+            XMVECTOR r = XMVectorMultiply(ex, apx[i]);
+            r = XMVectorMultiplyAdd(ey, apy[i], r);
+            r = XMVectorMultiplyAdd(ez, apz[i], r);
+
+            if (!XMVector4GreaterOrEqual(XMVectorAdd(d, r), XMVectorZero()))
+                return false;
+        }
+        return true;
+    }
+
+    // 계층 컬링용: 모든 평면 안쪽(d - r >= 0)이면 Inside → 자식은 검사 생략 가능
+    FrustumTest Classify(const MeshBounds& b) const
+    {
+        using namespace DirectX;
+
+        const XMVECTOR cx = XMVectorReplicate(b.center.x);
+        const XMVECTOR cy = XMVectorReplicate(b.center.y);
+        const XMVECTOR cz = XMVectorReplicate(b.center.z);
+        const XMVECTOR ex = XMVectorReplicate(b.extents.x);
+        const XMVECTOR ey = XMVectorReplicate(b.extents.y);
+        const XMVECTOR ez = XMVectorReplicate(b.extents.z);
+
+        bool inside = true;
+        for (int i = 0; i < 2; ++i)
+        {
+            XMVECTOR d = XMVectorMultiplyAdd(cx, px[i], pw[i]);
+            d = XMVectorMultiplyAdd(cy, py[i], d);
+            d = XMVectorMultiplyAdd(cz, pz[i], d);
+
+            XMVECTOR r = XMVectorMultiply(ex, apx[i]);
+            r = XMVectorMultiplyAdd(ey, apy[i], r);
+            r = XMVectorMultiplyAdd(ez, apz[i], r);
+
+            if (!XMVector4GreaterOrEqual(XMVectorAdd(d, r), XMVectorZero()))
+                return FrustumTest::Outside;
+            if (!XMVector4GreaterOrEqual(XMVectorSubtract(d, r), XMVectorZero()))
+                inside = false;
+        }
+        return inside ? FrustumTest::Inside : FrustumTest::Intersects;
+    }
+};
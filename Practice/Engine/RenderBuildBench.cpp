@@ -0,0 +1,107 @@
+﻿#include "RenderBuildBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include "MeshManager.h"
+#include "RenderSystem.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+RenderBuildBenchResult RunRenderBuildBench(JobSystem* jobs, uint32_t entityCount, uint32_t drawsPerEntity, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    RenderBuildBenchResult r{};
+    r.entities = entityCount;
+    runs = std::max(runs, 1u);
+
+    // bounds만 있으면 되므로 박스 꼭짓점 8개
+    MeshManager meshes;
+    MeshCPUData box;
+    for (int i = 0; i < 8; ++i)
+        box.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    const MeshHandle mesh = meshes.Create(box);
+
+    World w;
+    const uint32_t side = (uint32_t)std::ceil(std::sqrt((float)std::max(entityCount, 1u)));
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { (float)(i % side) * 2.0f - side, 0.0f, (float)(i / side) * 2.0f - side });
+
+        MeshComponent mc{};
+        MaterialComponent mat{};
+        for (uint32_t d = 0; d < drawsPerEntity; ++d)
+        {
+            mc.draws.push_back(MeshSubmeshDraw{ mesh, 0u, 0u, d, {} });
+            mat.slots.push_back(MaterialSlot{ { 1.0f, (float)d / drawsPerEntity, 0.5f, 1.0f }, TextureHandle{ 0 } });
+        }
+        w.AddMesh(e, mc);
+        w.AddMaterial(e, mat);
+    }
+    w.BeginFrame();
+    w.UpdateTransforms();
+
+    // 격자 전체가 들어오는 높은 카메라 (컬링 비용은 그대로 두고 대부분 그림)
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMVectorSet(0, (float)side * 1.5f, -(float)side * 0.5f, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, (float)side * 4.0f));
+
+    RenderSystem rs;
+    rs.SetMeshManager(&meshes);
+
+    std::vector<RenderItem> serialItems;
+    std::vector<RenderItem> items;
+
+    // 순차
+    rs.SetJobSystem(nullptr);
+    rs.Build(w, cam, serialItems); // 용량 확보
+    auto t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+        rs.Build(w, cam, serialItems);
+    auto t1 = Clock::now();
+    r.serialMs = ms(t0, t1) / runs;
+    r.drawsTotal = rs.GetCullStats().drawsTotal;
+    r.drawsVisible = rs.GetCullStats().drawsVisible;
+
+    if (!jobs)
+        return r;
+
+    // 병렬
+    rs.SetJobSystem(jobs);
+    r.threads = std::min(jobs->GetWorkerCount(), jobs->GetMaxActiveWorkers()) + 1;
+
+    t0 = Clock::now();
+    rs.Build(w, cam, items);
+    t1 = Clock::now();
+    r.parallelFirstMs = ms(t0, t1);
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+        rs.Build(w, cam, items);
+    t1 = Clock::now();
+    r.parallelMs = ms(t0, t1) / runs;
+    r.chunks = rs.GetCullStats().buildChunks;
+
+    // 순회 순서가 달라(mesh pool 기준 vs transform dense 기준) 정렬 후 비교
+    auto less = [](const RenderItem& a, const RenderItem& b)
+        {
+            if (a.world._41 != b.world._41) return a.world._41 < b.world._41;
+            if (a.world._43 != b.world._43) return a.world._43 < b.world._43;
+            return a.color.y < b.color.y;
+        };
+    std::sort(serialItems.begin(), serialItems.end(), less);
+    std::sort(items.begin(), items.end(), less);
+    r.sameResult = serialItems.size() == items.size()
+        && std::equal(serialItems.begin(), serialItems.end(), items.begin(), [](const RenderItem& a, const RenderItem& b)
+            {
+                return a.world._41 == b.world._41 && a.world._43 == b.world._43 && a.color.y == b.color.y && a.mesh.id == b.mesh.id;
+            });
+
+    return r;
+}
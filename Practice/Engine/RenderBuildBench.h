@@ -0,0 +1,23 @@
+﻿#pragma once
+#include <cstdint>
+
+class JobSystem;
+
+// RenderSystem::Build 타이밍 하네스
+// - World / MeshManager / RenderSystem만 사용 → Engine.exe --bench로 창 없이 실행
+// - 별도 World에 entityCount개 엔티티(엔티티당 drawsPerEntity개 draw) → 순차 / 병렬 Build 평균 시간
+struct RenderBuildBenchResult
+{
+    uint32_t entities = 0;
+    uint32_t drawsTotal = 0;
+    uint32_t drawsVisible = 0;
+    uint32_t threads = 1;
+    uint32_t chunks = 0;
+
+    double serialMs = 0.0;
+    double parallelFirstMs = 0.0;   // 첫 병렬 Build (bucket 할당 포함)
+    double parallelMs = 0.0;        // bucket 용량이 잡힌 뒤 평균
+    bool sameResult = false;        // 병렬 결과가 순차와 같은 draw 집합인지
+};
+
+RenderBuildBenchResult RunRenderBuildBench(JobSystem* jobs, uint32_t entityCount, uint32_t drawsPerEntity, uint32_t runs = 8);
@@ -0,0 +1,20 @@
+﻿#pragma once
+#include "EntityId.h"
+#include <cstdint>
+
+// World → RenderScene 변경 알림 (엔티티당 하나로 합쳐짐, flags는 OR)
+// - Transform: world 행렬이 바뀜 (UpdateTransforms의 dirty sweep에서)
+// - Material : MaterialComponent 추가/제거/수정 (non-const GetMaterial 포함)
+// - Mesh     : Mesh/Transform 추가/제거, non-const GetMesh → proxy를 새로 만듦
+namespace RenderChangeFlags
+{
+    static constexpr uint32_t Transform = 1u << 0;
+    static constexpr uint32_t Material = 1u << 1;
+    static constexpr uint32_t Mesh = 1u << 2;
+}
+
+struct RenderChange
+{
+    EntityId entity;
+    uint32_t flags = 0;
+};
@@ -0,0 +1,219 @@
+﻿#include "RenderScene.h"
+#include "MeshManager.h"
+#include "TextureHandle.h"
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+void AppendRenderItems(const World& world, EntityId e, const TransformComponent& tr, const MeshComponent& mc, std::vector<RenderItem>& out)
+{
+    const MaterialComponent* mat = world.HasMaterial(e) ? &world.GetMaterial(e) : nullptr;
+
+    for (const auto& d : mc.draws)
+    {
+        RenderItem it{};
+        it.mesh = d.mesh;
+        it.world = tr.world;
+        it.startIndex = d.startIndex;
+        it.indexCount = d.indexCount;
+
+        if (mat)
+        {
+            const uint32_t idx = (d.materialIndex < mat->slots.size()) ? d.materialIndex : 0u;
+            const auto& slot = mat->slots.empty() ? mat->Primary() : mat->slots[idx];
+            it.color = slot.color;
+            it.albedo = slot.albedo;
+        }
+        else
+        {
+            it.color = { 1,1,1,1 };
+            it.albedo = TextureHandle{ 0 };
+        }
+
+        out.push_back(it);
+    }
+}
+
+bool ComputeMeshWorldBounds(const MeshManager& meshes, const MeshComponent& mc, const DirectX::XMFLOAT4X4& world, MeshBounds& out)
+{
+    MeshBounds local{};
+    bool hasBounds = false;
+    for (const auto& d : mc.draws)
+    {
+        MeshBounds b{};
+        if (!meshes.GetBounds(d.mesh, b))
+            return false;
+
+        local = hasBounds ? MergeBounds(local, b) : b;
+        hasBounds = true;
+    }
+
+    if (!hasBounds)
+        return false;
+
+    out = TransformBounds(local, world);
+    return true;
+}
+
+void RenderScene::SetMeshManager(const MeshManager* meshManager)
+{
+    if (m_meshManager == meshManager)
+        return;
+
+    m_meshManager = meshManager;
+    m_worldId = 0; // 캐시된 bounds 무효
+}
+
+void RenderScene::Clear()
+{
+    m_proxies.clear();
+    m_proxyOfEntity.clear();
+    m_worldId = 0;
+}
+
+uint32_t RenderScene::IndexOf(EntityId e) const
+{
+    if (!e.IsValid() || e.index >= m_proxyOfEntity.size())
+        return InvalidIndex;
+
+    const uint32_t i = m_proxyOfEntity[e.index];
+    return (i != InvalidIndex && m_proxies[i].entity == e) ? i : InvalidIndex;
+}
+
+const RenderProxy* RenderScene::Find(EntityId e) const
+{
+    const uint32_t i = IndexOf(e);
+    return (i != InvalidIndex) ? &m_proxies[i] : nullptr;
+}
+
+void RenderScene::UpdateBounds(const World& world, RenderProxy& p)
+{
+    p.hasBounds = m_meshManager
+        && ComputeMeshWorldBounds(*m_meshManager, world.GetMesh(p.entity), world.GetTransform(p.entity).world, p.worldBounds);
+}
+
+void RenderScene::CreateProxy(const World& world, EntityId e)
+{
+    assert(IndexOf(e) == InvalidIndex);
+
+    if (m_proxyOfEntity.size() <= e.index)
+        m_proxyOfEntity.resize(e.index + 1, InvalidIndex);
+    m_proxyOfEntity[e.index] = (uint32_t)m_proxies.size();
+
+    RenderProxy& p = m_proxies.emplace_back();
+    p.entity = e;
+    const MeshComponent& mc = world.GetMesh(e);
+    p.occluder = mc.occluder;
+    AppendRenderItems(world, e, world.GetTransform(e), mc, p.items);
+    UpdateBounds(world, p);
+
+    // item 순서 = draw 순서 (AppendRenderItems)
+    const bool anyLod = std::any_of(mc.draws.begin(), mc.draws.end(),
+        [](const MeshSubmeshDraw& d) { return d.lods.count > 0; });
+    if (anyLod)
+    {
+        for (const auto& d : mc.draws)
+            p.lods.push_back(d.lods);
+    }
+}
+
+void RenderScene::DestroyProxy(EntityId e)
+{
+    const uint32_t i = IndexOf(e);
+    if (i == InvalidIndex)
+        return;
+
+    // swap-and-pop (순서는 의미 없음: 정렬은 InstanceBatcher에서)
+    const uint32_t last = (uint32_t)m_proxies.size() - 1;
+    if (i != last)
+    {
+        m_proxies[i] = std::move(m_proxies[last]);
+        m_proxyOfEntity[m_proxies[i].entity.index] = i;
+    }
+    m_proxies.pop_back();
+    m_proxyOfEntity[e.index] = InvalidIndex;
+}
+
+void RenderScene::Rebuild(const World& world)
+{
+    Clear();
+
+    world.ForEach<TransformComponent, MeshComponent>([&](EntityId e, const TransformComponent&, const MeshComponent&)
+        {
+            CreateProxy(world, e);
+        });
+
+    // 지금 상태로 전부 만들었으므로 여기까지의 변경은 반영된 셈
+    // - 빈 구간이라도 Collect로 읽어야 World가 이전 항목에 flags를 합치지 않음 (합치면 여기서 놓침)
+    m_worldId = world.GetInstanceId();
+    m_changeSerial = world.GetRenderChangeSerial();
+    world.CollectRenderChanges(m_changeSerial, m_changes);
+    m_stats.rebuilt = true;
+    m_stats.created = (uint32_t)m_proxies.size();
+}
+
+void RenderScene::Sync(const World& world)
+{
+    m_stats = RenderSceneStats{};
+
+    // 처음 보는 World거나 로그가 이미 버려진 구간이면 전체 생성
+    if (m_worldId != world.GetInstanceId() || !world.CollectRenderChanges(m_changeSerial, m_changes))
+    {
+        Rebuild(world);
+        m_stats.proxies = (uint32_t)m_proxies.size();
+        return;
+    }
+
+    m_changeSerial = world.GetRenderChangeSerial();
+    m_stats.changes = (uint32_t)m_changes.size();
+
+    for (const RenderChange& c : m_changes)
+    {
+        const EntityId e = c.entity;
+
+        // 구조 변경 (Mesh/Transform 추가·제거, draw 수정): 지우고 아직 그릴 수 있으면 새로
+        if (c.flags & RenderChangeFlags::Mesh)
+        {
+            if (IndexOf(e) != InvalidIndex)
+            {
+                DestroyProxy(e);
+                ++m_stats.destroyed;
+            }
+
+            if (world.IsAlive(e) && world.HasTransform(e) && world.HasMesh(e))
+            {
+                CreateProxy(world, e);
+                ++m_stats.created;
+            }
+            continue;
+        }
+
+        const uint32_t i = IndexOf(e);
+        if (i == InvalidIndex)
+            continue;
+
+        RenderProxy& p = m_proxies[i];
+        const TransformComponent& tr = world.GetTransform(e);
+
+        if (c.flags & RenderChangeFlags::Material)
+        {
+            // slot 해석까지 다시 (world도 같이 채워짐)
+            p.items.clear();
+            AppendRenderItems(world, e, tr, world.GetMesh(e), p.items);
+            ++m_stats.materialUpdates;
+        }
+        else if (c.flags & RenderChangeFlags::Transform)
+        {
+            for (RenderItem& it : p.items)
+                it.world = tr.world;
+        }
+
+        if (c.flags & RenderChangeFlags::Transform)
+        {
+            UpdateBounds(world, p);
+            ++m_stats.transformUpdates;
+        }
+    }
+
+    m_stats.proxies = (uint32_t)m_proxies.size();
+}
@@ -0,0 +1,78 @@
+﻿#pragma once
+#include <vector>
+#include <cstdint>
+#include "RenderItem.h"
+#include "RenderBounds.h"
+#include "RenderChange.h"
+#include "World.h"
+
+class MeshManager;
+
+// 엔티티 하나의 retained 렌더 상태: draw별 RenderItem + world bounds
+struct RenderProxy
+{
+    EntityId entity;
+    std::vector<RenderItem> items;
+    MeshBounds worldBounds{};
+    bool hasBounds = false;     // 메쉬 bounds를 몰라서 컬링 못 하면 false
+    std::vector<MeshLodChain> lods; // [item] draw별 LOD 범위 (LOD 있는 draw가 없으면 비어 있음)
+    MeshHandle occluder;            // MeshComponent::occluder
+};
+
+// 마지막 Sync 기준
+struct RenderSceneStats
+{
+    uint32_t proxies = 0;
+    uint32_t changes = 0;           // World에서 읽은 변경 항목 수
+    uint32_t created = 0;
+    uint32_t destroyed = 0;
+    uint32_t transformUpdates = 0;  // world 행렬 + bounds만 갱신
+    uint32_t materialUpdates = 0;   // RenderItem 색/텍스처 다시 채움
+    bool rebuilt = false;           // 처음 / World·MeshManager 변경 / 변경 로그를 놓쳐서 전체 생성
+};
+
+// 엔티티마다 RenderItem을 들고 있는 retained 렌더 씬
+// - Transform + Mesh를 가진 엔티티 = proxy 하나 (dense 배열, 제거는 swap-and-pop)
+// - Sync에서 World::CollectRenderChanges로 읽은 엔티티만 갱신 → 안 움직이는 씬은 프레임 비용이 변경 수에 비례
+// - RenderSystem이 proxy 배열을 순회하며 컬링 (bounds 캐시, 컴포넌트 조회 없음)
+// - 변경 로그는 여기서 소비됨. 렌더러(IRenderer::Render)는 여전히 컬링된 RenderItem 목록을 매 프레임 받음
+//   (보이는 집합이 카메라에 따라 매 프레임 바뀌므로 delta 대신 목록. 렌더러 쪽 resident/SRV 조회는 item당 map 조회 1~2번)
+class RenderScene
+{
+public:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    // 바뀌면 다음 Sync에서 전체 다시 생성 (bounds가 MeshManager에서 옴)
+    void SetMeshManager(const MeshManager* meshManager);
+
+    void Sync(const World& world);
+    void Clear();
+
+    const std::vector<RenderProxy>& GetProxies() const { return m_proxies; }
+    const RenderProxy* Find(EntityId e) const;
+    const RenderSceneStats& GetStats() const { return m_stats; }
+
+private:
+    void Rebuild(const World& world);
+    void CreateProxy(const World& world, EntityId e);
+    void DestroyProxy(EntityId e);
+    void UpdateBounds(const World& world, RenderProxy& p);
+    uint32_t IndexOf(EntityId e) const;
+
+private:
+    const MeshManager* m_meshManager = nullptr;
+    uint32_t m_worldId = 0;                    // 마지막 Sync한 World::GetInstanceId (0 = 없음)
+
+    std::vector<RenderProxy> m_proxies;
+    std::vector<uint32_t> m_proxyOfEntity;     // [entity.index] → m_proxies
+    uint64_t m_changeSerial = 0;               // World 변경 로그에서 여기까지 반영함
+    std::vector<RenderChange> m_changes;       // Collect scratch (용량 유지)
+
+    RenderSceneStats m_stats{};
+};
+
+// 엔티티 하나의 draw들 → RenderItem (material slot 해석 포함)
+void AppendRenderItems(const World& world, EntityId e, const TransformComponent& tr, const MeshComponent& mc, std::vector<RenderItem>& out);
+
+// draw들이 쓰는 메쉬 로컬 AABB 합 → world. 하나라도 bounds를 모르면 false
+bool ComputeMeshWorldBounds(const MeshManager& meshes, const MeshComponent& mc, const DirectX::XMFLOAT4X4& world, MeshBounds& out);
@@ -0,0 +1,127 @@
+﻿#include "RenderSceneBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include "MeshManager.h"
+#include "RenderSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+RenderSceneBenchResult RunRenderSceneBench(uint32_t entityCount, uint32_t movedPerFrame, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    RenderSceneBenchResult r{};
+    r.entities = entityCount;
+    r.movedPerFrame = std::min(movedPerFrame, entityCount);
+    runs = std::max(runs, 1u);
+
+    // bounds만 있으면 되므로 박스 꼭짓점 8개
+    MeshManager meshes;
+    MeshCPUData box;
+    for (int i = 0; i < 8; ++i)
+        box.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    const MeshHandle mesh = meshes.Create(box);
+
+    World w;
+    std::vector<EntityId> ents;
+    ents.reserve(entityCount);
+
+    const uint32_t side = (uint32_t)std::ceil(std::sqrt((float)std::max(entityCount, 1u)));
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { (float)(i % side) * 2.0f - side, 0.0f, (float)(i / side) * 2.0f - side });
+        w.AddMesh(e, MeshComponent{ mesh });
+        w.AddMaterial(e, MaterialComponent{ { 1.0f, (float)(i % 7) / 7.0f, 0.5f, 1.0f }, TextureHandle{ 0 } });
+        ents.push_back(e);
+    }
+    w.BeginFrame();
+    w.UpdateTransforms();
+
+    // 격자 전체가 들어오는 높은 카메라 (RenderBuildBench와 같음)
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMVectorSet(0, (float)side * 1.5f, -(float)side * 0.5f, 1), XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, (float)side * 4.0f));
+
+    RenderSystem immediate;
+    immediate.SetMeshManager(&meshes);
+    immediate.SetRetainedSceneEnabled(false);
+
+    RenderSystem retained;
+    retained.SetMeshManager(&meshes);
+
+    std::vector<RenderItem> immediateItems;
+    std::vector<RenderItem> retainedItems;
+
+    // 용량 확보 + proxy 전체 생성
+    immediate.Build(w, cam, immediateItems);
+    auto t0 = Clock::now();
+    retained.Build(w, cam, retainedItems);
+    r.rebuildMs = ms(t0, Clock::now());
+
+    // 1) 변경 없는 프레임
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        w.BeginFrame();
+        w.UpdateTransforms();
+
+        t0 = Clock::now();
+        immediate.Build(w, cam, immediateItems);
+        auto t1 = Clock::now();
+        retained.Build(w, cam, retainedItems);
+        auto t2 = Clock::now();
+
+        r.immediateMs += ms(t0, t1);
+        r.retainedMs += ms(t1, t2);
+    }
+    r.immediateMs /= runs;
+    r.retainedMs /= runs;
+    r.drawsVisible = retained.GetCullStats().drawsVisible;
+
+    // 2) 매 프레임 일부만 이동 (격자 안에서 살짝 들썩임 → 보이는 집합은 거의 그대로)
+    uint32_t cursor = 0;
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        w.BeginFrame();
+        for (uint32_t k = 0; k < r.movedPerFrame; ++k)
+        {
+            const uint32_t i = cursor++ % entityCount;
+            w.SetLocalPosition(ents[i], { (float)(i % side) * 2.0f - side, 0.1f * (float)((run + 1) % 4), (float)(i / side) * 2.0f - side });
+        }
+        w.UpdateTransforms(); // 시간에서 제외 (두 방식 공통)
+
+        t0 = Clock::now();
+        immediate.Build(w, cam, immediateItems);
+        auto t1 = Clock::now();
+        retained.Build(w, cam, retainedItems);
+        auto t2 = Clock::now();
+
+        r.immediateMovingMs += ms(t0, t1);
+        r.retainedMovingMs += ms(t1, t2);
+    }
+    r.immediateMovingMs /= runs;
+    r.retainedMovingMs /= runs;
+
+    // 순회 순서가 달라(mesh pool 기준 vs proxy 배열 기준) 정렬 후 비교
+    auto less = [](const RenderItem& a, const RenderItem& b)
+        {
+            if (a.world._41 != b.world._41) return a.world._41 < b.world._41;
+            if (a.world._43 != b.world._43) return a.world._43 < b.world._43;
+            return a.world._42 < b.world._42;
+        };
+    std::sort(immediateItems.begin(), immediateItems.end(), less);
+    std::sort(retainedItems.begin(), retainedItems.end(), less);
+    r.sameResult = immediateItems.size() == retainedItems.size()
+        && std::equal(immediateItems.begin(), immediateItems.end(), retainedItems.begin(), [](const RenderItem& a, const RenderItem& b)
+            {
+                return a.world._41 == b.world._41 && a.world._42 == b.world._42 && a.world._43 == b.world._43
+                    && a.color.y == b.color.y && a.mesh.id == b.mesh.id;
+            });
+
+    return r;
+}
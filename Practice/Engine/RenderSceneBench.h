@@ -0,0 +1,21 @@
+﻿#pragma once
+#include <cstdint>
+
+// retained RenderScene vs 매 프레임 RenderItem 재생성 비교 하네스 (순차 Build)
+// - 별도 World에 entityCount개 엔티티(draw 1개, material 있음) 격자 → 카메라 고정
+// - 변경 없는 프레임 / 매 프레임 movedPerFrame개 이동하는 프레임 각각 Build 평균 시간
+struct RenderSceneBenchResult
+{
+    uint32_t entities = 0;
+    uint32_t drawsVisible = 0;
+    uint32_t movedPerFrame = 0;
+
+    double rebuildMs = 0.0;             // 첫 retained Build (proxy 전체 생성)
+    double immediateMs = 0.0;           // 변경 없음, 매 프레임 재생성
+    double retainedMs = 0.0;            // 변경 없음, proxy 컬링 + 복사만
+    double immediateMovingMs = 0.0;     // movedPerFrame개 이동
+    double retainedMovingMs = 0.0;      // movedPerFrame개 이동 (그 proxy만 갱신)
+    bool sameResult = false;            // 마지막 프레임 두 결과가 같은 draw 집합인지
+};
+
+RenderSceneBenchResult RunRenderSceneBench(uint32_t entityCount, uint32_t movedPerFrame, uint32_t runs = 8);
@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+
+// 64bit draw 정렬 키 (상위 비트 = 바꾸기 비싼 상태)
+//   [63..62] pass      (Opaque / AlphaTest / Transparent / Overlay)
+//   [61..60] pipeline  (같은 pass 안의 PSO 변형)
+//   [59..48] material  (SRV 슬롯)
+//   [47..32] mesh
+//   [31..22] submesh   (startIndex/indexCount 해시)
+//   [21..0]  depth     (카메라 view-space z, Transparent는 뒤집어서 back-to-front)
+// - 필드보다 큰 값은 잘려서 다른 상태와 키가 겹칠 수 있음 → 정렬 순서만 흐트러질 뿐,
+//   batch 판정은 실제 값(srv/mesh/range)을 비교하므로 잘못 그리지는 않음 (batch만 쪼개짐)
+enum class RenderPassKey : uint32_t
+{
+    Opaque = 0,
+    AlphaTest = 1,
+    Transparent = 2,
+    Overlay = 3,
+};
+
+namespace RenderSortKey
+{
+    static constexpr uint32_t PassBits = 2;
+    static constexpr uint32_t PipelineBits = 2;
+    static constexpr uint32_t MaterialBits = 12;
+    static constexpr uint32_t MeshBits = 16;
+    static constexpr uint32_t SubmeshBits = 10;
+    static constexpr uint32_t DepthBits = 22;
+
+    static constexpr uint32_t DepthShift = 0;
+    static constexpr uint32_t SubmeshShift = DepthShift + DepthBits;
+    static constexpr uint32_t MeshShift = SubmeshShift + SubmeshBits;
+    static constexpr uint32_t MaterialShift = MeshShift + MeshBits;
+    static constexpr uint32_t PipelineShift = MaterialShift + MaterialBits;
+    static constexpr uint32_t PassShift = PipelineShift + PipelineBits;
+    static_assert(PassShift + PassBits == 64, "sort key layout must fill 64 bits");
+
+    static inline uint64_t Field(uint32_t v, uint32_t bits, uint32_t shift)
+    {
+        return (uint64_t(v) & ((1ull << bits) - 1ull)) << shift;
+    }
+
+    // view-space z → 22bit. 양수 float의 비트 패턴은 값 순서와 같음 → 지수 8bit + 상위 가수 13bit
+    // (범위 지정 없이 가까운 쪽일수록 촘촘한 상대 정밀도, 카메라 뒤쪽은 0)
+    static inline uint32_t QuantizeDepth(float viewZ)
+    {
+        if (!(viewZ > 0.0f))
+            return 0;
+
+        uint32_t bits = 0;
+        std::memcpy(&bits, &viewZ, sizeof(bits));
+        return bits >> (32 - 1 - DepthBits); // 부호 비트(0) 제외 상위 DepthBits
+    }
+
+    static inline uint32_t SubmeshHash(uint32_t startIndex, uint32_t indexCount)
+    {
+        const uint32_t h = startIndex * 0x9E3779B1u ^ indexCount * 0x85EBCA77u;
+        return h >> (32 - SubmeshBits);
+    }
+
+    static inline uint64_t Make(RenderPassKey pass, uint32_t pipeline, uint32_t material,
+        uint32_t mesh, uint32_t startIndex, uint32_t indexCount, float viewZ)
+    {
+        uint32_t depth = QuantizeDepth(viewZ);
+        if (pass == RenderPassKey::Transparent)
+            depth = ~depth; // 반투명은 먼 것부터
+
+        return Field((uint32_t)pass, PassBits, PassShift)
+            | Field(pipeline, PipelineBits, PipelineShift)
+            | Field(material, MaterialBits, MaterialShift)
+            | Field(mesh, MeshBits, MeshShift)
+            | Field(SubmeshHash(startIndex, indexCount), SubmeshBits, SubmeshShift)
+            | Field(depth, DepthBits, DepthShift);
+    }
+}
@@ -1,49 +1,442 @@
 #include "RenderSystem.h"
-#include "TextureHandle.h"
+#include "MeshManager.h"
+#include "RenderBounds.h"
+#include "JobSystem.h"
 #include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
 
 using namespace DirectX;
 
-void RenderSystem::Build(const World& world, std::vector<RenderItem>& outItem) const
+static inline AABB ToAABB(const MeshBounds& b)
+{
+    AABB out;
+    out.min = { b.center.x - b.extents.x, b.center.y - b.extents.y, b.center.z - b.extents.z };
+    out.max = { b.center.x + b.extents.x, b.center.y + b.extents.y, b.center.z + b.extents.z };
+    return out;
+}
+
+// screen size(bounding sphere  / ȭ ) ̺  LOD k+1
+// (ܰ踶 ﰢ   ȭ ũ⵵   Ѿ ȼ ﰢ е 뷫 )
+static constexpr float LodScreenSizes[MeshMaxLods - 1] = { 0.5f, 0.25f, 0.125f };
+
+//  * proj._22 / Ÿ =   / ȭ  (ī޶ sphere ̸ LOD0)
+static inline uint32_t SelectLod(const XMFLOAT3& eye, float scale, const MeshBounds& wb)
+{
+    const float dx = wb.center.x - eye.x, dy = wb.center.y - eye.y, dz = wb.center.z - eye.z;
+    const float dist2 = dx * dx + dy * dy + dz * dz;
+    const float r2 = wb.extents.x * wb.extents.x + wb.extents.y * wb.extents.y + wb.extents.z * wb.extents.z;
+    if (dist2 <= r2)
+        return 0;
+
+    const float size = std::sqrt(r2 / dist2) * scale;
+
+    uint32_t level = 0;
+    while (level < MeshMaxLods - 1 && size < LodScreenSizes[level])
+        ++level;
+    return level;
+}
+
+// items[i]  chainOf(i) level  (chain  ª  ģ ), ٲ  ȯ
+template <typename ChainOf>
+static inline uint32_t ApplyLod(uint32_t level, RenderItem* items, size_t count, ChainOf chainOf)
+{
+    if (level == 0)
+        return 0;
+
+    uint32_t changed = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const MeshLodChain& c = chainOf(i);
+        const uint32_t l = std::min(level, c.count);
+        if (l == 0)
+            continue;
+
+        items[i].startIndex = c.levels[l - 1].startIndex;
+        items[i].indexCount = c.levels[l - 1].indexCount;
+        ++changed;
+    }
+    return changed;
+}
+
+void RenderSystem::SetStaticBVHEnabled(bool enabled)
+{
+    if (m_staticBVHEnabled == enabled)
+        return;
+
+    m_staticBVHEnabled = enabled;
+    ClearStaticBVH();
+}
+
+void RenderSystem::SetRetainedSceneEnabled(bool enabled)
+{
+    if (m_retainedEnabled == enabled)
+        return;
+
+    m_retainedEnabled = enabled;
+    m_scene.Clear(); // ٽ Ѹ  World ü 
+}
+
+bool RenderSystem::ComputeWorldBounds(const MeshComponent& mc, const XMFLOAT4X4& world, MeshBounds& out) const
+{
+    return ComputeMeshWorldBounds(*m_meshManager, mc, world, out);
+}
+
+void RenderSystem::ClearStaticBVH()
+{
+    m_staticBVH.Clear();
+    m_staticEntities.clear();
+    m_staticItemOfEntity.clear();
+    m_staticWorld = nullptr;
+}
+
+bool RenderSystem::InStaticBVH(EntityId e) const
+{
+    if (e.index >= m_staticItemOfEntity.size())
+        return false;
+
+    const uint32_t item = m_staticItemOfEntity[e.index];
+    return item != StaticBVH::InvalidIndex && m_staticEntities[item] == e;
+}
+
+void RenderSystem::RebuildStaticBVH(const World& world)
+{
+    ClearStaticBVH();
+    m_staticBoxScratch.clear();
+    m_staticIdScratch.clear();
+
+    // bounds ƴ static ƼƼ (𸣸 Ϲ ο ø  ׸)
+    world.ForEach<TransformComponent, MeshComponent>([&](EntityId e, const TransformComponent& tr, const MeshComponent& mc)
+        {
+            if (!tr.isStatic)
+                return;
+
+            MeshBounds wb{};
+            if (!ComputeWorldBounds(mc, tr.world, wb))
+                return;
+
+            const uint32_t item = (uint32_t)m_staticEntities.size();
+            m_staticEntities.push_back(e);
+            m_staticBoxScratch.push_back(ToAABB(wb));
+            m_staticIdScratch.push_back(item);
+
+            if (m_staticItemOfEntity.size() <= e.index)
+                m_staticItemOfEntity.resize(e.index + 1, StaticBVH::InvalidIndex);
+            m_staticItemOfEntity[e.index] = item;
+        });
+
+    m_staticBVH.Build(m_staticBoxScratch, m_staticIdScratch);
+
+    m_staticWorld = &world;
+    m_staticVersion = world.GetStaticVersion();
+    m_stats.bvhRebuilt = true;
+}
+
+void RenderSystem::SyncStaticBVH(const World& world)
+{
+    if (m_staticWorld != &world || m_staticVersion != world.GetStaticVersion())
+    {
+        RebuildStaticBVH(world);
+        return;
+    }
+
+    // Ʈ  ϰ  item bounds 
+    bool any = false;
+    for (EntityId e : world.GetMovedStaticEntities())
+    {
+        if (!InStaticBVH(e))
+            continue;
+
+        MeshBounds wb{};
+        if (!ComputeWorldBounds(world.GetMesh(e), world.GetTransform(e).world, wb))
+            continue;
+
+        m_staticBVH.UpdateItem(m_staticItemOfEntity[e.index], ToAABB(wb));
+        any = true;
+    }
+
+    if (any)
+        m_stats.bvhRefitNodes = m_staticBVH.Refit();
+}
+
+void RenderSystem::Build(const World& world, const RenderCamera& camera, std::vector<RenderItem>& outItem)
 {
 #if defined(_DEBUG)
     assert(world.TransformsUpdatedThisFrame());
 #endif
 
     outItem.clear();
+    m_stats = RenderCullStats{};
 
-    for (EntityId e : world.GetTransformEntities())
+    // retained: ٲ ƼƼ proxy  (ø   )
+    const bool retained = m_retainedEnabled;
+    if (retained)
     {
-        if (!world.HasMesh(e))
-            continue;
+        m_scene.Sync(world);
+        m_stats.retained = true;
+        m_stats.proxyChanges = m_scene.GetStats().changes;
+    }
+
+    const bool cull = m_cullingEnabled && m_meshManager;
+    const Frustum frustum = Frustum::FromViewProj(camera.view, camera.proj);
+
+    // LOD: Ȱ ī޶ ġ +    (bounds MeshManager)
+    LodView lod{};
+    if (m_lodEnabled && m_meshManager)
+    {
+        lod.eye = camera.positionWS;
+        lod.scale = camera.proj._22 * m_lodBias;
+    }
+
+    // static ƼƼ: BVH  ø (°   ڽ ˻ )
+    const bool useBVH = cull && m_staticBVHEnabled;
+    if (useBVH)
+    {
+        SyncStaticBVH(world);
 
-        const auto& mc = world.GetMesh(e);
-        const auto& tr = world.GetTransform(e);
+        m_stats.staticItems = m_staticBVH.GetItemCount();
+        m_stats.bvhNodesVisited = m_staticBVH.CullFrustum(frustum, [&](uint32_t item)
+            {
+                const EntityId e = m_staticEntities[item];
+                const size_t first = outItem.size();
+                if (!retained)
+                {
+                    const TransformComponent& tr = world.GetTransform(e);
+                    const MeshComponent& mc = world.GetMesh(e);
+                    AppendRenderItems(world, e, tr, mc, outItem);
 
-        const MaterialComponent* mat = world.HasMaterial(e) ? &world.GetMaterial(e) : nullptr;
+                    MeshBounds wb{};
+                    if (lod.scale > 0.0f && ComputeWorldBounds(mc, tr.world, wb))
+                    {
+                        m_stats.lodReduced += ApplyLod(SelectLod(lod.eye, lod.scale, wb), outItem.data() + first, mc.draws.size(),
+                            [&](size_t i) -> const MeshLodChain& { return mc.draws[i].lods; });
+                    }
+                }
+                else if (const RenderProxy* p = m_scene.Find(e))
+                {
+                    outItem.insert(outItem.end(), p->items.begin(), p->items.end());
+                    if (lod.scale > 0.0f && p->hasBounds && !p->lods.empty())
+                    {
+                        m_stats.lodReduced += ApplyLod(SelectLod(lod.eye, lod.scale, p->worldBounds), outItem.data() + first, p->items.size(),
+                            [&](size_t i) -> const MeshLodChain& { return p->lods[i]; });
+                    }
+                }
+                ++m_stats.staticVisible;
+            });
+        m_stats.culledEntities += m_stats.staticItems - m_stats.staticVisible;
+    }
+    else if (m_staticWorld)
+    {
+        ClearStaticBVH(); // ø   ٽ 
+    }
 
-        for (const auto& d : mc.draws)
+    // ȸ : retained proxy 迭, ƴϸ transform dense 迭
+    const uint32_t transformCount = retained
+        ? (uint32_t)m_scene.GetProxies().size()
+        : (uint32_t)world.GetTransformsDense().size();
+    if (!m_jobs || m_jobs->GetWorkerCount() == 0 || transformCount < ParallelMinTransforms)
+    {
+        if (retained)
         {
-            RenderItem it{};
-            it.mesh = d.mesh;
-            it.world = tr.world;
-            it.startIndex = d.startIndex;
-            it.indexCount = d.indexCount;
+            BuildProxyRange(frustum, cull, useBVH, lod, 0, transformCount, outItem, m_stats);
+        }
+        else
+        {
+            // Transform + Mesh  ƼƼ ȸ
+            world.ForEach<TransformComponent, MeshComponent>([&](EntityId e, const TransformComponent& tr, const MeshComponent& mc)
+                {
+                    CullAndEmit(world, frustum, cull, useBVH, lod, e, tr, mc, outItem, m_stats);
+                });
+        }
 
-            if (mat)
+        FinishBuild(world, frustum, camera, outItem);
+        return;
+    }
+
+    // ûũ  : ûũ ڱ bucket    
+    // bucket clear ϹǷ   ũ⸸ŭ 뷮  ־  Ҵ 
+    const uint32_t chunkCount = (transformCount + ParallelGrain - 1) / ParallelGrain;
+    if (m_buildParts.size() < chunkCount)
+    {
+        m_buildParts.resize(chunkCount);
+        m_buildPartStats.resize(chunkCount);
+    }
+
+    m_jobs->ParallelFor(chunkCount, 1, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t c = begin; c < end; ++c)
+            {
+                const uint32_t first = c * ParallelGrain;
+                const uint32_t last = std::min(first + ParallelGrain, transformCount);
+                m_buildParts[c].clear();
+                m_buildPartStats[c] = RenderCullStats{};
+                if (retained)
+                    BuildProxyRange(frustum, cull, useBVH, lod, first, last, m_buildParts[c], m_buildPartStats[c]);
+                else
+                    BuildRange(world, frustum, cull, useBVH, lod, first, last, m_buildParts[c], m_buildPartStats[c]);
+            }
+        });
+
+    // ûũ  ̾ (ѷŭ   reserve  outItem   뷮̸ Ҵ )
+    size_t total = outItem.size();
+    for (uint32_t c = 0; c < chunkCount; ++c)
+        total += m_buildParts[c].size();
+
+    outItem.reserve(total);
+    for (uint32_t c = 0; c < chunkCount; ++c)
+    {
+        outItem.insert(outItem.end(), m_buildParts[c].begin(), m_buildParts[c].end());
+
+        const RenderCullStats& ps = m_buildPartStats[c];
+        m_stats.entities += ps.entities;
+        m_stats.culledEntities += ps.culledEntities;
+        m_stats.unbounded += ps.unbounded;
+        m_stats.drawsTotal += ps.drawsTotal;
+        m_stats.lodReduced += ps.lodReduced;
+    }
+
+    m_stats.buildChunks = chunkCount;
+    FinishBuild(world, frustum, camera, outItem);
+}
+
+void RenderSystem::GatherOccluders(const World& world, const Frustum& frustum)
+{
+    m_occluders.clear();
+
+    if (m_retainedEnabled)
+    {
+        for (const RenderProxy& p : m_scene.GetProxies())
+        {
+            if (!p.occluder.IsValid() || (p.hasBounds && !frustum.IntersectsAABB(p.worldBounds)))
+                continue;
+            m_occluders.push_back({ p.occluder, world.GetTransform(p.entity).world });
+        }
+        return;
+    }
+
+    world.ForEach<TransformComponent, MeshComponent>([&](EntityId, const TransformComponent& tr, const MeshComponent& mc)
+        {
+            if (!mc.occluder.IsValid())
+                return;
+
+            MeshBounds wb{};
+            if (ComputeWorldBounds(mc, tr.world, wb) && !frustum.IntersectsAABB(wb))
+                return;
+            m_occluders.push_back({ mc.occluder, tr.world });
+        });
+}
+
+void RenderSystem::FinishBuild(const World& world, const Frustum& frustum, const RenderCamera& camera, std::vector<RenderItem>& outItem)
+{
+    //  ڿ  item °  (meshlet ɰ )
+    if (m_occlusionEnabled && m_meshManager && m_cullingEnabled)
+    {
+        GatherOccluders(world, frustum);
+
+        XMFLOAT4X4 viewProj;
+        XMStoreFloat4x4(&viewProj, XMMatrixMultiply(XMLoadFloat4x4(&camera.view), XMLoadFloat4x4(&camera.proj)));
+        m_occlusionCuller.Render(*m_meshManager, m_occluders, viewProj);
+        m_occlusionCuller.Cull(*m_meshManager, outItem);
+    }
+
+    // ƼƼ ̴ ū mesh ȭ /޸ meshlet   ׸ (LOD  meshlet  ״)
+    if (m_clusterCullingEnabled && m_meshManager && m_cullingEnabled)
+        m_clusterCuller.Cull(*m_meshManager, frustum, camera.positionWS, outItem);
+
+    m_stats.drawsVisible = (uint32_t)outItem.size();
+}
+
+void RenderSystem::CullAndEmit(const World& world, const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+    EntityId e, const TransformComponent& tr, const MeshComponent& mc,
+    std::vector<RenderItem>& out, RenderCullStats& stats) const
+{
+    ++stats.entities;
+    stats.drawsTotal += (uint32_t)mc.draws.size();
+
+    if (skipStatic && tr.isStatic && InStaticBVH(e))
+        return; // static BVH ó
+
+    // ƼƼ bounds = draw  ޽  AABB   world ȯؼ   ˻ (LOD ÿ )
+    MeshBounds wb{};
+    const bool hasBounds = (cull || lod.scale > 0.0f) && ComputeWorldBounds(mc, tr.world, wb);
+    if (cull)
+    {
+        if (!hasBounds)
+        {
+            ++stats.unbounded;
+        }
+        else if (!frustum.IntersectsAABB(wb))
+        {
+            ++stats.culledEntities;
+            return;
+        }
+    }
+
+    const size_t first = out.size();
+    AppendRenderItems(world, e, tr, mc, out);
+
+    if (hasBounds && lod.scale > 0.0f)
+    {
+        stats.lodReduced += ApplyLod(SelectLod(lod.eye, lod.scale, wb), out.data() + first, mc.draws.size(),
+            [&](size_t i) -> const MeshLodChain& { return mc.draws[i].lods; });
+    }
+}
+
+void RenderSystem::BuildProxyRange(const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+    uint32_t begin, uint32_t end, std::vector<RenderItem>& out, RenderCullStats& stats) const
+{
+    const std::vector<RenderProxy>& proxies = m_scene.GetProxies();
+
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const RenderProxy& p = proxies[i];
+        ++stats.entities;
+        stats.drawsTotal += (uint32_t)p.items.size();
+
+        // static BVH  ƼƼ  ó (SyncStaticBVH ڶ isStatic Ȯ ʿ)
+        if (skipStatic && InStaticBVH(p.entity))
+            continue;
+
+        if (cull)
+        {
+            if (!p.hasBounds)
             {
-                const uint32_t idx = (d.materialIndex < mat->slots.size()) ? d.materialIndex : 0u;
-                const auto& slot = mat->slots.empty() ? mat->Primary() : mat->slots[idx];
-                it.color = slot.color;
-                it.albedo = slot.albedo;
+                ++stats.unbounded;
             }
-            else
+            else if (!frustum.IntersectsAABB(p.worldBounds))
             {
-                it.color = { 1,1,1,1 };
-                it.albedo = TextureHandle{ 0 };
+                ++stats.culledEntities;
+                continue;
             }
+        }
+
+        const size_t first = out.size();
+        out.insert(out.end(), p.items.begin(), p.items.end());
 
-            outItem.push_back(it);
+        if (lod.scale > 0.0f && p.hasBounds && !p.lods.empty())
+        {
+            stats.lodReduced += ApplyLod(SelectLod(lod.eye, lod.scale, p.worldBounds), out.data() + first, p.items.size(),
+                [&](size_t i) -> const MeshLodChain& { return p.lods[i]; });
         }
     }
-}
\ No newline at end of file
+}
+
+void RenderSystem::BuildRange(const World& world, const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+    uint32_t begin, uint32_t end, std::vector<RenderItem>& out, RenderCullStats& stats) const
+{
+    const std::vector<TransformComponent>& transforms = world.GetTransformsDense();
+    const std::vector<EntityId>& ents = world.GetTransformEntities();
+
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const EntityId e = ents[i];
+        if (!e.IsValid())
+            continue;
+
+        const MeshComponent* mc = world.TryGetMesh(e);
+        if (!mc)
+            continue;
+
+        CullAndEmit(world, frustum, cull, skipStatic, lod, e, transforms[i], *mc, out, stats);
+    }
+}
@@ -1,13 +1,156 @@
 #pragma once
 #include <vector>
 #include "RenderItem.h"
+#include "RenderCamera.h"
 #include "World.h"
+#include "StaticBVH.h"
+#include "RenderScene.h"
+#include "ClusterCuller.h"
+#include "OcclusionCuller.h"
+
+class MeshManager;
+class JobSystem;
+
+//  ø  ( Build )
+struct RenderCullStats
+{
+    uint32_t entities = 0;        // Transform + Mesh ƼƼ 
+    uint32_t culledEntities = 0;  //  ̶  ƼƼ
+    uint32_t unbounded = 0;       // bounds  ø  ׸ ƼƼ
+    uint32_t drawsTotal = 0;      // ø  draw 
+    uint32_t drawsVisible = 0;    //   RenderItem 
+
+    // static BVH
+    uint32_t staticItems = 0;     // BVH  ִ ƼƼ 
+    uint32_t staticVisible = 0;   //   
+    uint32_t bvhNodesVisited = 0;
+    uint32_t bvhRefitNodes = 0;   // ̹ Build refit ŵ  
+    bool bvhRebuilt = false;
+
+    uint32_t buildChunks = 0;     //  Build ûũ  (0 = )
+
+    // retained scene (RenderScene::Sync)
+    bool retained = false;
+    uint32_t proxyChanges = 0;    // ̹ Build World   
+
+    // LOD (MeshSubmeshDraw::lods)
+    uint32_t lodReduced = 0;      // LOD1 ̻  ٲ ׸ RenderItem 
+};
 
 class RenderSystem
 {
 public:
-    // ̹  RenderItem Ʈ 
-    void Build(const World& world, std::vector<RenderItem>& outItems) const;
+    // ޽  bounds ȸ (nullptr̸ ø   ׸)
+    void SetMeshManager(const MeshManager* meshManager) { m_meshManager = meshManager; m_scene.SetMeshManager(meshManager); }
+
+    void SetFrustumCullingEnabled(bool enabled) { m_cullingEnabled = enabled; }
+    bool IsFrustumCullingEnabled() const { return m_cullingEnabled; }
+
+    // World::SetStatic ƼƼ BVH  ø ( ٸ ƼƼó ϳ ˻)
+    void SetStaticBVHEnabled(bool enabled);
+    bool IsStaticBVHEnabled() const { return m_staticBVHEnabled; }
+
+    // Ѹ(⺻) ƼƼ RenderItem/bounds RenderScene proxy ϰ World   ٲ ͸ 
+    //    World Ʈ RenderItem  
+    void SetRetainedSceneEnabled(bool enabled);
+    bool IsRetainedSceneEnabled() const { return m_retainedEnabled; }
+    const RenderScene& GetScene() const { return m_scene; }
+
+    // Ѹ(⺻) bounds ȭ鿡 ϴ ũ draw LOD   (bounds ˾ƾ )
+    // bias > 1̸ ػ󵵸   
+    void SetLodEnabled(bool enabled) { m_lodEnabled = enabled; }
+    bool IsLodEnabled() const { return m_lodEnabled; }
+    void SetLodBias(float bias) { m_lodBias = bias; }
+    float GetLodBias() const { return m_lodBias; }
+
+    // Ѹ(⺻) meshlet ִ ū mesh item ̴ meshlet  ɰ ( + backface cone)
+    void SetClusterCullingEnabled(bool enabled) { m_clusterCullingEnabled = enabled; }
+    bool IsClusterCullingEnabled() const { return m_clusterCullingEnabled; }
+    ClusterCuller& GetClusterCuller() { return m_clusterCuller; }
+    const ClusterCullStats& GetClusterStats() const { return m_clusterCuller.GetStats(); }
+
+    // Ѹ(⺻) MeshComponent::occluder ִ ̴ ƼƼ CPU  ۿ ׸  ڿ  item 
+    // (   )
+    void SetOcclusionCullingEnabled(bool enabled) { m_occlusionEnabled = enabled; }
+    bool IsOcclusionCullingEnabled() const { return m_occlusionEnabled; }
+    OcclusionCuller& GetOcclusionCuller() { return m_occlusionCuller; }
+    const OcclusionCullStats& GetOcclusionStats() const { return m_occlusionCuller.GetStats(); }
+
+    // ϸ transform   dense 迭 ûũ  ķ ø/RenderItem  (nullptr = )
+    void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+    // ̹  RenderItem Ʈ  (camera   ƼƼ )
+    // -  : ûũ ڱ bucket  ûũ  ̾ (bucket 뷮   )
+    void Build(const World& world, const RenderCamera& camera, std::vector<RenderItem>& outItems);
+
+    const RenderCullStats& GetCullStats() const { return m_stats; }
+
+private:
+    // Build    LOD  Է (scale = proj._22 * bias, 0̸ LOD  )
+    struct LodView
+    {
+        DirectX::XMFLOAT3 eye{ 0, 0, 0 };
+        float scale = 0.0f;
+    };
+
+    // ƼƼ   Ŭ  cluster ø  + drawsVisible  (Build )
+    void FinishBuild(const World& world, const Frustum& frustum, const RenderCamera& camera, std::vector<RenderItem>& outItems);
+
+    //     m_occluders
+    void GatherOccluders(const World& world, const Frustum& frustum);
+
+    // draw  ޽  AABB   world. ϳ bounds 𸣸 false
+    bool ComputeWorldBounds(const MeshComponent& mc, const DirectX::XMFLOAT4X4& world, MeshBounds& out) const;
+
+    // proxy [begin, end): ĳõ bounds ˻  ̸ RenderItem 
+    void BuildProxyRange(const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+        uint32_t begin, uint32_t end, std::vector<RenderItem>& out, RenderCullStats& stats) const;
+
+    // ƼƼ ϳ:  ˻  ̸ draw out ߰ (б⸸ ϹǷ  忡 ȣ )
+    void CullAndEmit(const World& world, const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+        EntityId e, const TransformComponent& tr, const MeshComponent& mc,
+        std::vector<RenderItem>& out, RenderCullStats& stats) const;
+
+    // transform dense [begin, end)  Mesh  ƼƼ
+    void BuildRange(const World& world, const Frustum& frustum, bool cull, bool skipStatic, const LodView& lod,
+        uint32_t begin, uint32_t end, std::vector<RenderItem>& out, RenderCullStats& stats) const;
+
+    // static  ٲ , ƴϸ ̹   static refit
+    void SyncStaticBVH(const World& world);
+    void RebuildStaticBVH(const World& world);
+    void ClearStaticBVH();
+    bool InStaticBVH(EntityId e) const;
 
 private:
+    const MeshManager* m_meshManager = nullptr;
+    bool m_cullingEnabled = true;
+    RenderCullStats m_stats;
+
+    bool m_lodEnabled = true;
+    float m_lodBias = 1.0f;
+
+    bool m_clusterCullingEnabled = true;
+    ClusterCuller m_clusterCuller;
+
+    bool m_occlusionEnabled = true;
+    OcclusionCuller m_occlusionCuller;
+    std::vector<OccluderInstance> m_occluders;
+
+    JobSystem* m_jobs = nullptr;
+    static constexpr uint32_t ParallelMinTransforms = 4096; // ̺  
+    static constexpr uint32_t ParallelGrain = 2048;         // ûũ ϳ transform 
+    std::vector<std::vector<RenderItem>> m_buildParts;      // [ûũ] RenderItem bucket
+    std::vector<RenderCullStats> m_buildPartStats;          // [ûũ]
+
+    bool m_retainedEnabled = true;
+    RenderScene m_scene;
+
+    bool m_staticBVHEnabled = true;
+    StaticBVH m_staticBVH;
+    std::vector<EntityId> m_staticEntities;     // BVH item  ƼƼ
+    std::vector<uint32_t> m_staticItemOfEntity; // [entity.index]  BVH item
+    const World* m_staticWorld = nullptr;
+    uint32_t m_staticVersion = 0;
+    std::vector<AABB> m_staticBoxScratch;
+    std::vector<uint32_t> m_staticIdScratch;
 };
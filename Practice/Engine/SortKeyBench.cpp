@@ -0,0 +1,67 @@
+﻿#include "SortKeyBench.h"
+#include "RenderSortKey.h"
+#include "RadixSort.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+SortKeyBenchResult RunSortKeyBench(uint32_t count, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    SortKeyBenchResult r{};
+    r.count = count;
+    runs = std::max(runs, 1u);
+
+    // 입력 키 (고정 시드 → 매번 같은 분포)
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<uint32_t> material(0, 31);
+    std::uniform_int_distribution<uint32_t> mesh(1, 64);
+    std::uniform_int_distribution<uint32_t> submesh(0, 3);
+    std::uniform_real_distribution<float> depth(0.1f, 500.0f);
+
+    std::vector<SortEntry> input(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const uint32_t sub = submesh(rng);
+        input[i].key = RenderSortKey::Make(RenderPassKey::Opaque, 0, material(rng), mesh(rng), sub * 36u, 36u, depth(rng));
+        input[i].value = i;
+    }
+
+    std::vector<SortEntry> a;
+    std::vector<SortEntry> b;
+    std::vector<SortEntry> scratch;
+
+    // 1) std::sort (예전 renderer처럼 람다 비교, 같은 키는 index로 → radix의 안정 정렬과 같은 결과)
+    double total = 0.0;
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        a = input;
+        const auto t0 = Clock::now();
+        std::sort(a.begin(), a.end(), [](const SortEntry& x, const SortEntry& y)
+            {
+                return (x.key != y.key) ? x.key < y.key : x.value < y.value;
+            });
+        total += ms(t0, Clock::now());
+    }
+    r.stdSortMs = total / runs;
+
+    // 2) radix (scratch는 첫 run에 잡히고 이후 재사용)
+    total = 0.0;
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        b = input;
+        const auto t0 = Clock::now();
+        r.radixPasses = RadixSort64(b, scratch);
+        total += ms(t0, Clock::now());
+    }
+    r.radixMs = total / runs;
+
+    r.sameOrder = a.size() == b.size();
+    for (size_t i = 0; r.sameOrder && i < a.size(); ++i)
+        r.sameOrder = a[i].key == b[i].key && a[i].value == b[i].value;
+
+    return r;
+}
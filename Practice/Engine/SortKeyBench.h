@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <cstdint>
+
+// draw 정렬 비교 하네스 (std::sort vs LSD radix sort)
+// - RenderSortKey로 만든 현실적인 키 (material 32종, mesh 64종, 랜덤 깊이) count개를 runs번 정렬한 평균
+struct SortKeyBenchResult
+{
+    uint32_t count = 0;
+    double stdSortMs = 0.0;     // std::sort (key, index 비교 람다)
+    double radixMs = 0.0;       // RadixSort64 (scratch 재사용)
+    uint32_t radixPasses = 0;   // 생략 안 된 자릿수 패스 수
+    bool sameOrder = false;     // 두 결과가 같은 순서인지
+};
+
+SortKeyBenchResult RunSortKeyBench(uint32_t count, uint32_t runs = 8);
@@ -0,0 +1,252 @@
+﻿#include "StaticBVH.h"
+#include <cassert>
+#include <cfloat>
+
+// Helpers
+static inline AABB Union(const AABB& a, const AABB& b)
+{
+    AABB out;
+    out.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+    out.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+    return out;
+}
+
+static inline float HalfArea(const AABB& b)
+{
+    const float dx = b.max.x - b.min.x;
+    const float dy = b.max.y - b.min.y;
+    const float dz = b.max.z - b.min.z;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+static inline bool SameBox(const AABB& a, const AABB& b)
+{
+    return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z
+        && a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+static inline AABB EmptyBox()
+{
+    AABB b;
+    b.min = { FLT_MAX, FLT_MAX, FLT_MAX };
+    b.max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    return b;
+}
+
+static inline float Axis(const XMFLOAT3& v, int axis)
+{
+    return (axis == 0) ? v.x : (axis == 1) ? v.y : v.z;
+}
+
+void StaticBVH::Clear()
+{
+    m_nodes.clear();
+    m_order.clear();
+    m_itemBoxes.clear();
+    m_centroids.clear();
+    m_userData.clear();
+    m_itemLeaf.clear();
+    m_dirtyLeaves.clear();
+    m_leafDirty.clear();
+    m_depth = 0;
+}
+
+AABB StaticBVH::RangeBounds(uint32_t first, uint32_t count) const
+{
+    AABB b = EmptyBox();
+    for (uint32_t k = first; k < first + count; ++k)
+        b = Union(b, m_itemBoxes[m_order[k]]);
+    return b;
+}
+
+uint32_t StaticBVH::Partition(uint32_t first, uint32_t count, const AABB& centroidBox)
+{
+    // 중심점 분포가 가장 넓은 축
+    const float ex = centroidBox.max.x - centroidBox.min.x;
+    const float ey = centroidBox.max.y - centroidBox.min.y;
+    const float ez = centroidBox.max.z - centroidBox.min.z;
+    const int axis = (ex >= ey && ex >= ez) ? 0 : (ey >= ez ? 1 : 2);
+
+    const float lo = Axis(centroidBox.min, axis);
+    const float extent = Axis(centroidBox.max, axis) - lo;
+    if (extent <= 1e-6f)
+        return 0; // 중심점이 다 겹침 → 호출 쪽에서 반으로 자름
+
+    const float scale = (float)BinCount / extent;
+    auto binOf = [&](uint32_t item)
+        {
+            const int b = (int)((Axis(m_centroids[item], axis) - lo) * scale);
+            return (uint32_t)std::clamp(b, 0, (int)BinCount - 1);
+        };
+
+    struct Bin { AABB box; uint32_t count; };
+    Bin bins[BinCount];
+    for (Bin& b : bins) { b.box = EmptyBox(); b.count = 0; }
+
+    for (uint32_t k = first; k < first + count; ++k)
+    {
+        const uint32_t item = m_order[k];
+        Bin& b = bins[binOf(item)];
+        b.box = Union(b.box, m_itemBoxes[item]);
+        ++b.count;
+    }
+
+    // 왼쪽/오른쪽 누적 → 경계 i (bin 0..i-1 | i..) 별 SAH 비용
+    float leftCost[BinCount] = {};
+    AABB acc = EmptyBox();
+    uint32_t accCount = 0;
+    for (uint32_t i = 1; i < BinCount; ++i)
+    {
+        acc = Union(acc, bins[i - 1].box);
+        accCount += bins[i - 1].count;
+        leftCost[i] = accCount ? HalfArea(acc) * (float)accCount : 0.0f;
+    }
+
+    float bestCost = FLT_MAX;
+    uint32_t bestSplit = 0;
+    acc = EmptyBox();
+    accCount = 0;
+    for (uint32_t i = BinCount - 1; i >= 1; --i)
+    {
+        acc = Union(acc, bins[i].box);
+        accCount += bins[i].count;
+
+        const float cost = leftCost[i] + (accCount ? HalfArea(acc) * (float)accCount : 0.0f);
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            bestSplit = i;
+        }
+    }
+
+    uint32_t* begin = m_order.data() + first;
+    uint32_t* mid = std::partition(begin, begin + count, [&](uint32_t item) { return binOf(item) < bestSplit; });
+    return (uint32_t)(mid - begin);
+}
+
+void StaticBVH::Build(const std::vector<AABB>& boxes, const std::vector<uint32_t>& userData)
+{
+    assert(boxes.size() == userData.size());
+    Clear();
+
+    const uint32_t n = (uint32_t)boxes.size();
+    if (n == 0)
+        return;
+
+    m_itemBoxes = boxes;
+    m_userData = userData;
+    m_itemLeaf.assign(n, InvalidIndex);
+    m_order.resize(n);
+    m_centroids.resize(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        m_order[i] = i;
+        const AABB& b = boxes[i];
+        m_centroids[i] = { (b.min.x + b.max.x) * 0.5f, (b.min.y + b.max.y) * 0.5f, (b.min.z + b.max.z) * 0.5f };
+    }
+
+    m_nodes.reserve(2 * ((n + MaxLeafItems - 1) / MaxLeafItems) + 1);
+    m_nodes.emplace_back();
+    m_nodes[0].first = 0;
+    m_nodes[0].count = n;
+
+    // (node, depth) 작업 스택: 재귀 없이 top-down
+    std::vector<std::pair<uint32_t, uint32_t>> work;
+    work.push_back({ 0u, 1u });
+
+    while (!work.empty())
+    {
+        const auto [id, depth] = work.back();
+        work.pop_back();
+        m_depth = std::max(m_depth, depth);
+
+        const uint32_t first = m_nodes[id].first;
+        const uint32_t count = m_nodes[id].count;
+        m_nodes[id].box = RangeBounds(first, count);
+
+        if (count <= MaxLeafItems)
+        {
+            for (uint32_t k = first; k < first + count; ++k)
+                m_itemLeaf[m_order[k]] = id;
+            continue;
+        }
+
+        AABB cb = EmptyBox();
+        for (uint32_t k = first; k < first + count; ++k)
+        {
+            const XMFLOAT3& c = m_centroids[m_order[k]];
+            cb.min = { std::min(cb.min.x, c.x), std::min(cb.min.y, c.y), std::min(cb.min.z, c.z) };
+            cb.max = { std::max(cb.max.x, c.x), std::max(cb.max.y, c.y), std::max(cb.max.z, c.z) };
+        }
+
+        uint32_t leftCount = Partition(first, count, cb);
+        if (leftCount == 0 || leftCount == count)
+            leftCount = count / 2; // 분할 실패 → 순서대로 반씩 (깊이 폭주 방지)
+
+        const uint32_t left = (uint32_t)m_nodes.size();
+        m_nodes.emplace_back();
+        m_nodes.emplace_back(); // 여기서 재할당될 수 있음 → 이후 인덱스로 접근
+
+        m_nodes[id].left = left;
+
+        m_nodes[left].first = first;
+        m_nodes[left].count = leftCount;
+        m_nodes[left].parent = id;
+
+        m_nodes[left + 1].first = first + leftCount;
+        m_nodes[left + 1].count = count - leftCount;
+        m_nodes[left + 1].parent = id;
+
+        work.push_back({ left + 1, depth + 1 });
+        work.push_back({ left, depth + 1 });
+    }
+
+    m_leafDirty.assign(m_nodes.size(), 0);
+
+    m_centroids.clear();
+    m_centroids.shrink_to_fit();
+}
+
+void StaticBVH::UpdateItem(uint32_t item, const AABB& box)
+{
+    assert(item < m_itemBoxes.size());
+    m_itemBoxes[item] = box;
+
+    const uint32_t leaf = m_itemLeaf[item];
+    if (!m_leafDirty[leaf])
+    {
+        m_leafDirty[leaf] = 1;
+        m_dirtyLeaves.push_back(leaf);
+    }
+}
+
+uint32_t StaticBVH::Refit()
+{
+    uint32_t updated = 0;
+
+    for (uint32_t leaf : m_dirtyLeaves)
+    {
+        m_leafDirty[leaf] = 0;
+
+        Node& n = m_nodes[leaf];
+        const AABB box = RangeBounds(n.first, n.count);
+        if (SameBox(box, n.box))
+            continue;
+        n.box = box;
+        ++updated;
+
+        // 조상 방향: 합집합이 그대로면 그 위도 그대로
+        for (uint32_t p = n.parent; p != InvalidIndex; p = m_nodes[p].parent)
+        {
+            Node& pn = m_nodes[p];
+            const AABB merged = Union(m_nodes[pn.left].box, m_nodes[pn.left + 1].box);
+            if (SameBox(merged, pn.box))
+                break;
+            pn.box = merged;
+            ++updated;
+        }
+    }
+
+    m_dirtyLeaves.clear();
+    return updated;
+}
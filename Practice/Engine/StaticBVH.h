@@ -0,0 +1,244 @@
+﻿#pragma once
+#include "PhysicsTypes.h"
+#include "DynamicAABBTree.h"
+#include "RenderBounds.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// 거의 안 움직이는 물체용 BVH (한 번 빌드 + 증분 refit)
+// - Build: 중심점 기준 binned SAH로 top-down 분할, 노드는 배열 하나(자식 두 개는 연속 인덱스)
+// - item 순서를 분할하면서 같이 재배치 → 어떤 노드든 자기 subtree의 item이 m_order에서 연속 구간
+//   (프러스텀 안에 완전히 들어간 노드는 자식 검사 없이 구간을 통째로 방출)
+// - UpdateItem으로 bounds만 바뀐 item을 표시 → Refit에서 해당 leaf부터 루트 방향으로만 다시 계산
+//   (트리 모양은 그대로라 많이 움직이면 품질이 떨어짐 → 그땐 Build 다시)
+class StaticBVH
+{
+public:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+    static constexpr uint32_t MaxLeafItems = 4;
+    static constexpr uint32_t BinCount = 12;
+
+    // boxes[i] / userData[i] = item i
+    void Build(const std::vector<AABB>& boxes, const std::vector<uint32_t>& userData);
+    void Clear();
+
+    bool Empty() const { return m_nodes.empty(); }
+    uint32_t GetItemCount() const { return (uint32_t)m_itemBoxes.size(); }
+    uint32_t GetNodeCount() const { return (uint32_t)m_nodes.size(); }
+    uint32_t GetDepth() const { return m_depth; }
+
+    const AABB& GetItemBox(uint32_t item) const { return m_itemBoxes[item]; }
+    uint32_t GetUserData(uint32_t item) const { return m_userData[item]; }
+
+    // item bounds 변경 (Refit 전까지 노드 bounds는 옛값)
+    void UpdateItem(uint32_t item, const AABB& box);
+
+    // UpdateItem으로 표시된 leaf → 조상 방향으로 bounds 재계산. 갱신된 노드 수 반환
+    uint32_t Refit();
+
+    // AABB와 겹치는 item마다 cb(userData). cb가 false면 중단
+    template<typename Fn>
+    void Query(const AABB& aabb, Fn&& cb) const;
+
+    // DynamicAABBTree::RayCast와 같은 규약: cb(userData, maxT) -> 새 maxT (0 이하면 종료), 가까운 자식부터
+    template<typename Fn>
+    void RayCast(const XMFLOAT3& origin, const XMFLOAT3& dir, float maxT, Fn&& cb) const;
+
+    // 프러스텀과 겹치는 item마다 cb(userData). 반환값 = 검사한 노드 수
+    // (완전히 안쪽인 노드는 그 아래 item을 개별 검사 없이 전부 방출)
+    template<typename Fn>
+    uint32_t CullFrustum(const Frustum& frustum, Fn&& cb) const;
+
+private:
+    struct Node
+    {
+        AABB box{};
+        uint32_t first = 0;             // subtree item 구간 시작 (m_order 기준)
+        uint32_t count = 0;             // subtree item 수
+        uint32_t left = InvalidIndex;   // 오른쪽 자식 = left + 1, leaf면 InvalidIndex
+        uint32_t parent = InvalidIndex;
+
+        bool IsLeaf() const { return left == InvalidIndex; }
+    };
+
+    // 순회 스택: 보통 배열로 충분, 깊으면 vector로 넘침
+    class NodeStack
+    {
+    public:
+        void Push(uint32_t id)
+        {
+            if (m_count < LocalCap) m_local[m_count] = id;
+            else m_overflow.push_back(id);
+            ++m_count;
+        }
+        uint32_t Pop()
+        {
+            --m_count;
+            if (m_count < LocalCap) return m_local[m_count];
+            const uint32_t id = m_overflow.back();
+            m_overflow.pop_back();
+            return id;
+        }
+        bool Empty() const { return m_count == 0; }
+
+    private:
+        static constexpr uint32_t LocalCap = 64;
+        uint32_t m_local[LocalCap];
+        std::vector<uint32_t> m_overflow;
+        uint32_t m_count = 0;
+    };
+
+    static MeshBounds ToBounds(const AABB& b)
+    {
+        MeshBounds out{};
+        out.center = { (b.min.x + b.max.x) * 0.5f, (b.min.y + b.max.y) * 0.5f, (b.min.z + b.max.z) * 0.5f };
+        out.extents = { (b.max.x - b.min.x) * 0.5f, (b.max.y - b.min.y) * 0.5f, (b.max.z - b.min.z) * 0.5f };
+        return out;
+    }
+
+    // [first, first+count) 구간의 분할 위치 (m_order 재배치 포함). 분할 못 하면 0
+    uint32_t Partition(uint32_t first, uint32_t count, const AABB& centroidBox);
+    AABB RangeBounds(uint32_t first, uint32_t count) const;
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_order;      // 노드 구간 → item index
+    std::vector<AABB> m_itemBoxes;      // [item]
+    std::vector<XMFLOAT3> m_centroids;  // [item] (Build 중에만 사용)
+    std::vector<uint32_t> m_userData;   // [item]
+    std::vector<uint32_t> m_itemLeaf;   // [item] → 속한 leaf 노드
+
+    std::vector<uint32_t> m_dirtyLeaves;
+    std::vector<uint8_t> m_leafDirty;   // [node]
+    uint32_t m_depth = 0;
+};
+
+template<typename Fn>
+void StaticBVH::Query(const AABB& aabb, Fn&& cb) const
+{
+    if (m_nodes.empty())
+        return;
+
+    NodeStack stack;
+    stack.Push(0);
+    while (!stack.Empty())
+    {
+        const Node& n = m_nodes[stack.Pop()];
+        if (!DynamicAABBTree::Overlaps(n.box, aabb))
+            continue;
+
+        if (!n.IsLeaf())
+        {
+            stack.Push(n.left + 1);
+            stack.Push(n.left);
+            continue;
+        }
+
+        for (uint32_t k = n.first; k < n.first + n.count; ++k)
+        {
+            const uint32_t item = m_order[k];
+            if (DynamicAABBTree::Overlaps(m_itemBoxes[item], aabb) && !cb(m_userData[item]))
+                return;
+        }
+    }
+}
+
+template<typename Fn>
+void StaticBVH::RayCast(const XMFLOAT3& origin, const XMFLOAT3& dir, float maxT, Fn&& cb) const
+{
+    if (m_nodes.empty())
+        return;
+
+    const XMFLOAT3 invDir = DynamicAABBTree::SafeInverse(dir);
+
+    float tEnter = 0.0f;
+    if (!DynamicAABBTree::RayOverlaps(origin, invDir, maxT, m_nodes[0].box, tEnter))
+        return;
+
+    NodeStack stack;
+    stack.Push(0);
+    while (!stack.Empty())
+    {
+        const Node& n = m_nodes[stack.Pop()];
+
+        // push 이후 maxT가 줄었을 수 있으니 다시 확인
+        if (!DynamicAABBTree::RayOverlaps(origin, invDir, maxT, n.box, tEnter))
+            continue;
+
+        if (n.IsLeaf())
+        {
+            for (uint32_t k = n.first; k < n.first + n.count; ++k)
+            {
+                const uint32_t item = m_order[k];
+                if (!DynamicAABBTree::RayOverlaps(origin, invDir, maxT, m_itemBoxes[item], tEnter))
+                    continue;
+
+                const float t = cb(m_userData[item], maxT);
+                if (t <= 0.0f)
+                    return;
+                maxT = std::min(maxT, t);
+            }
+            continue;
+        }
+
+        float t1 = 0.0f, t2 = 0.0f;
+        const bool hit1 = DynamicAABBTree::RayOverlaps(origin, invDir, maxT, m_nodes[n.left].box, t1);
+        const bool hit2 = DynamicAABBTree::RayOverlaps(origin, invDir, maxT, m_nodes[n.left + 1].box, t2);
+
+        // 먼 쪽을 먼저 push → 가까운 쪽이 먼저 pop
+        if (hit1 && hit2)
+        {
+            if (t1 <= t2) { stack.Push(n.left + 1); stack.Push(n.left); }
+            else          { stack.Push(n.left); stack.Push(n.left + 1); }
+        }
+        else if (hit1) stack.Push(n.left);
+        else if (hit2) stack.Push(n.left + 1);
+    }
+}
+
+template<typename Fn>
+uint32_t StaticBVH::CullFrustum(const Frustum& frustum, Fn&& cb) const
+{
+    if (m_nodes.empty())
+        return 0;
+
+    uint32_t tested = 0;
+
+    NodeStack stack;
+    stack.Push(0);
+    while (!stack.Empty())
+    {
+        const Node& n = m_nodes[stack.Pop()];
+        ++tested;
+
+        const FrustumTest r = frustum.Classify(ToBounds(n.box));
+        if (r == FrustumTest::Outside)
+            continue;
+
+        if (r == FrustumTest::Inside)
+        {
+            // subtree item 구간 통째로
+            for (uint32_t k = n.first; k < n.first + n.count; ++k)
+                cb(m_userData[m_order[k]]);
+            continue;
+        }
+
+        if (!n.IsLeaf())
+        {
+            stack.Push(n.left + 1);
+            stack.Push(n.left);
+            continue;
+        }
+
+        // 경계에 걸친 leaf: item별로 확인
+        for (uint32_t k = n.first; k < n.first + n.count; ++k)
+        {
+            const uint32_t item = m_order[k];
+            if (frustum.IntersectsAABB(ToBounds(m_itemBoxes[item])))
+                cb(m_userData[item]);
+        }
+    }
+
+    return tested;
+}
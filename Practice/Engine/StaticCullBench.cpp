@@ -0,0 +1,99 @@
+﻿#include "StaticCullBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include "MeshManager.h"
+#include "RenderSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace DirectX;
+
+StaticCullBenchResult RunStaticCullBench(uint32_t instanceCount, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    runs = std::max(runs, 1u);
+
+    // bounds만 있으면 되므로 박스 꼭짓점 8개
+    MeshManager meshes;
+    MeshCPUData box;
+    for (int i = 0; i < 8; ++i)
+        box.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    const MeshHandle mesh = meshes.Create(box);
+
+    World w;
+    std::vector<EntityId> ents;
+    ents.reserve(instanceCount);
+
+    const uint32_t side = (uint32_t)std::ceil(std::sqrt((float)std::max(instanceCount, 1u)));
+    for (uint32_t i = 0; i < instanceCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { (float)(i % side) * 2.0f - side, 0.0f, (float)(i / side) * 2.0f - side });
+        w.AddMesh(e, MeshComponent(mesh));
+        w.SetStatic(e, true);
+        ents.push_back(e);
+    }
+    w.BeginFrame();
+    w.UpdateTransforms();
+
+    // 격자 가운데 위에서 비스듬히 내려다보는 카메라
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMVectorSet(0, 30, -60, 1), XMVectorSet(0, 0, 40, 1), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f));
+
+    RenderSystem rs;
+    rs.SetMeshManager(&meshes);
+    std::vector<RenderItem> items;
+    items.reserve(instanceCount);
+
+    StaticCullBenchResult r{};
+    r.instances = instanceCount;
+
+    rs.SetStaticBVHEnabled(false);
+    auto t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+        rs.Build(w, cam, items);
+    auto t1 = Clock::now();
+    r.linearMs = ms(t0, t1) / runs;
+
+    rs.SetStaticBVHEnabled(true);
+    t0 = Clock::now();
+    rs.Build(w, cam, items);
+    t1 = Clock::now();
+    r.bvhBuildMs = ms(t0, t1);
+
+    // 첫 프레임의 dirty(전부 moved로 잡힘)를 비우고 측정
+    w.BeginFrame();
+    w.UpdateTransforms();
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+        rs.Build(w, cam, items);
+    t1 = Clock::now();
+    r.bvhMs = ms(t0, t1) / runs;
+    r.visible = rs.GetCullStats().staticVisible;
+    r.bvhNodesVisited = rs.GetCullStats().bvhNodesVisited;
+
+    // 1%만 조금씩 이동 → World가 모아 둔 moved static으로 refit
+    double refitTotal = 0.0;
+    for (uint32_t i = 0; i < runs; ++i)
+    {
+        w.BeginFrame();
+        for (uint32_t k = i; k < instanceCount; k += 100)
+            w.TranslateLocal(ents[k], { 0.0f, 0.01f, 0.0f });
+        w.UpdateTransforms();
+
+        t0 = Clock::now();
+        rs.Build(w, cam, items);
+        t1 = Clock::now();
+        refitTotal += ms(t0, t1);
+    }
+    r.refitMs = refitTotal / runs;
+
+    return r;
+}
@@ -0,0 +1,17 @@
+﻿#pragma once
+#include <cstdint>
+
+// static BVH 컬링 벤치
+// - 별도 World에 static 박스 격자 → 비스듬히 내려다보는 카메라로 RenderSystem::Build 시간 (선형 / BVH)
+struct StaticCullBenchResult
+{
+    uint32_t instances = 0;
+    uint32_t visible = 0;
+    uint32_t bvhNodesVisited = 0;
+    double linearMs = 0.0;      // BVH 끔: 엔티티마다 프러스텀 검사
+    double bvhBuildMs = 0.0;    // 첫 Build (BVH 빌드 포함)
+    double bvhMs = 0.0;         // BVH 유지 상태 Build
+    double refitMs = 0.0;       // 1% 이동 후 Build (refit 포함)
+};
+
+StaticCullBenchResult RunStaticCullBench(uint32_t instanceCount, uint32_t runs = 8);
@@ -0,0 +1,83 @@
+﻿#include "StorageBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+StorageBenchResult RunStorageBench(uint32_t entityCount, bool archetype, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    runs = std::max(runs, 1u);
+
+    World w;
+    w.SetArchetypeStorageEnabled(archetype);
+
+    StorageBenchResult r{};
+    r.entities = entityCount;
+    r.archetype = archetype;
+
+    std::vector<EntityId> ents;
+    ents.reserve(entityCount);
+
+    // 시그니처 섞기: 렌더용(T+Mesh+Material) / 물리용(T+RB+Collider) / Transform만
+    MeshComponent mesh{};
+    mesh.draws.push_back({});
+
+    auto t0 = Clock::now();
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        switch (i % 3)
+        {
+        case 0:
+            w.AddMesh(e, mesh);
+            w.AddMaterial(e, MaterialComponent{});
+            break;
+        case 1:
+            w.AddRigidBody(e, RigidBodyComponent{});
+            w.AddCollider(e, ColliderComponent{});
+            break;
+        default:
+            break;
+        }
+        ents.push_back(e);
+    }
+    auto t1 = Clock::now();
+    r.addMs = ms(t0, t1);
+
+    uint32_t visited = 0;
+    float sink = 0.0f;
+    t0 = Clock::now();
+    for (uint32_t k = 0; k < runs; ++k)
+    {
+        w.ForEach<TransformComponent, MeshComponent>([&](EntityId, TransformComponent& t, MeshComponent& m)
+            {
+                sink += t.world._41 + (float)m.draws.size();
+                ++visited;
+            });
+        w.ForEach<ColliderComponent, RigidBodyComponent, TransformComponent>([&](EntityId, ColliderComponent&, RigidBodyComponent& rb, TransformComponent& t)
+            {
+                t.position.y += rb.velocity.y;
+                ++visited;
+            });
+    }
+    t1 = Clock::now();
+    r.iterateMs = ms(t0, t1) / runs;
+    r.visited = visited / runs + (sink < 0.0f ? 1u : 0u);
+
+    // 물리용 엔티티에서 컴포넌트 떼기 (archetype 이동 + dense swap-remove)
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        w.RemoveCollider(ents[i]);
+        w.RemoveRigidBody(ents[i]);
+    }
+    t1 = Clock::now();
+    r.removeMs = ms(t0, t1);
+
+    return r;
+}
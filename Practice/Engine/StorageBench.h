@@ -0,0 +1,17 @@
+﻿#pragma once
+#include <cstdint>
+
+// 컴포넌트 저장소 벤치: sparse set vs archetype (World::SetArchetypeStorageEnabled)
+// - 별도 World에 렌더용(T+Mesh+Material) / 물리용(T+RB+Collider) / Transform만 엔티티를 섞어서
+//   add / iterate / remove 시간
+struct StorageBenchResult
+{
+    uint32_t entities = 0;
+    bool archetype = false;
+    double addMs = 0.0;
+    double iterateMs = 0.0;     // ForEach<Transform, Mesh> + ForEach<Collider, RigidBody, Transform>
+    double removeMs = 0.0;
+    uint32_t visited = 0;
+};
+
+StorageBenchResult RunStorageBench(uint32_t entityCount, bool archetype, uint32_t runs = 8);
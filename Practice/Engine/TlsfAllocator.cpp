@@ -0,0 +1,384 @@
+﻿#include "TlsfAllocator.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+void TlsfAllocator::Mapping(uint32_t size, uint32_t& fl, uint32_t& sl)
+{
+    if (size < SLCount)
+    {
+        fl = 0;
+        sl = size;
+        return;
+    }
+
+    const uint32_t f = (uint32_t)std::bit_width(size) - 1; // floor(log2)
+    fl = f - SLBits + 1;
+    sl = (size >> (f - SLBits)) - SLCount;
+}
+
+void TlsfAllocator::MappingSearch(uint32_t size, uint32_t& fl, uint32_t& sl)
+{
+    // 등급 안 어떤 블록이든 size 이상이도록 다음 등급 경계로 올림
+    uint64_t rounded = size;
+    if (size >= SLCount)
+    {
+        const uint32_t f = (uint32_t)std::bit_width(size) - 1;
+        rounded += (1ull << (f - SLBits)) - 1;
+    }
+
+    if (rounded > 0xFFFFFFFFull)
+    {
+        fl = FLCount; // 찾을 등급 없음
+        sl = 0;
+        return;
+    }
+
+    Mapping((uint32_t)rounded, fl, sl);
+}
+
+void TlsfAllocator::Initialize(uint32_t capacity)
+{
+    Clear();
+    Grow(capacity);
+}
+
+void TlsfAllocator::Clear()
+{
+    m_blocks.clear();
+    m_freeNodes.clear();
+
+    for (auto& row : m_heads)
+        std::fill(std::begin(row), std::end(row), InvalidNode);
+    m_flBitmap = 0;
+    std::fill(std::begin(m_slBitmap), std::end(m_slBitmap), 0u);
+
+    m_lastPhys = InvalidNode;
+    m_capacity = 0;
+    m_used = 0;
+    m_allocations = 0;
+}
+
+uint32_t TlsfAllocator::NewNode()
+{
+    uint32_t n;
+    if (!m_freeNodes.empty())
+    {
+        n = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        n = (uint32_t)m_blocks.size();
+        m_blocks.emplace_back();
+    }
+
+    m_blocks[n] = Block{};
+    m_blocks[n].live = true;
+    return n;
+}
+
+void TlsfAllocator::DeleteNode(uint32_t n)
+{
+    m_blocks[n].live = false;
+    m_freeNodes.push_back(n);
+}
+
+void TlsfAllocator::InsertFree(uint32_t n)
+{
+    Block& b = m_blocks[n];
+    uint32_t fl, sl;
+    Mapping(b.size, fl, sl);
+
+    b.free = true;
+    b.prevFree = InvalidNode;
+    b.nextFree = m_heads[fl][sl];
+    if (b.nextFree != InvalidNode)
+        m_blocks[b.nextFree].prevFree = n;
+    m_heads[fl][sl] = n;
+
+    m_flBitmap |= 1u << fl;
+    m_slBitmap[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::RemoveFree(uint32_t n)
+{
+    Block& b = m_blocks[n];
+    uint32_t fl, sl;
+    Mapping(b.size, fl, sl);
+
+    if (b.prevFree != InvalidNode)
+        m_blocks[b.prevFree].nextFree = b.nextFree;
+    else
+        m_heads[fl][sl] = b.nextFree;
+
+    if (b.nextFree != InvalidNode)
+        m_blocks[b.nextFree].prevFree = b.prevFree;
+
+    if (m_heads[fl][sl] == InvalidNode)
+    {
+        m_slBitmap[fl] &= ~(1u << sl);
+        if (m_slBitmap[fl] == 0)
+            m_flBitmap &= ~(1u << fl);
+    }
+
+    b.free = false;
+    b.prevFree = b.nextFree = InvalidNode;
+}
+
+uint32_t TlsfAllocator::FindFree(uint32_t size) const
+{
+    uint32_t fl, sl;
+    MappingSearch(size, fl, sl);
+    if (fl >= FLCount)
+        return FindFreeExact(size);
+
+    // 같은 FL에서 sl 이상 → 없으면 더 큰 FL의 가장 작은 SL
+    uint32_t slMap = m_slBitmap[fl] & (~0u << sl);
+    if (slMap == 0)
+    {
+        const uint32_t flMap = (fl + 1 < 32) ? (m_flBitmap & (~0u << (fl + 1))) : 0u;
+        if (flMap == 0)
+            return FindFreeExact(size);
+
+        fl = (uint32_t)std::countr_zero(flMap);
+        slMap = m_slBitmap[fl];
+    }
+
+    sl = (uint32_t)std::countr_zero(slMap);
+    return m_heads[fl][sl];
+}
+
+uint32_t TlsfAllocator::FindFreeExact(uint32_t size) const
+{
+    // 올림 검색이 실패해도 size가 속한 등급 안에 딱 맞는 블록이 있을 수 있음 (꽉 찬 버퍼의 마지막 조각)
+    // → 그 리스트만 선형으로 확인
+    uint32_t fl, sl;
+    Mapping(size, fl, sl);
+    for (uint32_t n = m_heads[fl][sl]; n != InvalidNode; n = m_blocks[n].nextFree)
+    {
+        if (m_blocks[n].size >= size)
+            return n;
+    }
+    return InvalidNode;
+}
+
+TlsfAllocation TlsfAllocator::Allocate(uint32_t size)
+{
+    TlsfAllocation out{};
+    if (size == 0)
+        return out;
+
+    const uint32_t n = FindFree(size);
+    if (n == InvalidNode)
+        return out;
+
+    RemoveFree(n);
+    assert(m_blocks[n].size >= size);
+
+    // 남는 뒤쪽은 새 빈 블록으로 분리
+    const uint32_t rest = m_blocks[n].size - size;
+    if (rest > 0)
+    {
+        const uint32_t r = NewNode(); // m_blocks 재할당 가능 → 참조는 이후에 다시 잡음
+        Block& b = m_blocks[n];
+        Block& rb = m_blocks[r];
+
+        rb.offset = b.offset + size;
+        rb.size = rest;
+        rb.prevPhys = n;
+        rb.nextPhys = b.nextPhys;
+        if (b.nextPhys != InvalidNode)
+            m_blocks[b.nextPhys].prevPhys = r;
+        else
+            m_lastPhys = r;
+
+        b.nextPhys = r;
+        b.size = size;
+        InsertFree(r);
+    }
+
+    m_used += size;
+    ++m_allocations;
+
+    out.offset = m_blocks[n].offset;
+    out.size = size;
+    out.node = n;
+    return out;
+}
+
+void TlsfAllocator::Free(const TlsfAllocation& a)
+{
+    if (!a.IsValid())
+        return;
+
+    uint32_t n = a.node;
+    assert(n < m_blocks.size() && m_blocks[n].live && !m_blocks[n].free && m_blocks[n].offset == a.offset);
+
+    m_used -= m_blocks[n].size;
+    --m_allocations;
+
+    // 앞 이웃이 비어 있으면 그쪽으로 합침
+    const uint32_t prev = m_blocks[n].prevPhys;
+    if (prev != InvalidNode && m_blocks[prev].free)
+    {
+        RemoveFree(prev);
+        Block& p = m_blocks[prev];
+        Block& b = m_blocks[n];
+
+        p.size += b.size;
+        p.nextPhys = b.nextPhys;
+        if (b.nextPhys != InvalidNode)
+            m_blocks[b.nextPhys].prevPhys = prev;
+        else
+            m_lastPhys = prev;
+
+        DeleteNode(n);
+        n = prev;
+    }
+
+    // 뒤 이웃도
+    const uint32_t next = m_blocks[n].nextPhys;
+    if (next != InvalidNode && m_blocks[next].free)
+    {
+        RemoveFree(next);
+        Block& b = m_blocks[n];
+        Block& nb = m_blocks[next];
+
+        b.size += nb.size;
+        b.nextPhys = nb.nextPhys;
+        if (nb.nextPhys != InvalidNode)
+            m_blocks[nb.nextPhys].prevPhys = n;
+        else
+            m_lastPhys = n;
+
+        DeleteNode(next);
+    }
+
+    InsertFree(n);
+}
+
+void TlsfAllocator::Grow(uint32_t newCapacity)
+{
+    if (newCapacity <= m_capacity)
+        return;
+
+    const uint32_t added = newCapacity - m_capacity;
+
+    if (m_lastPhys != InvalidNode && m_blocks[m_lastPhys].free)
+    {
+        // 끝 블록이 비어 있으면 늘리기만 (등급이 바뀌므로 뺐다 다시 넣음)
+        RemoveFree(m_lastPhys);
+        m_blocks[m_lastPhys].size += added;
+        InsertFree(m_lastPhys);
+    }
+    else
+    {
+        const uint32_t n = NewNode();
+        Block& b = m_blocks[n];
+        b.offset = m_capacity;
+        b.size = added;
+        b.prevPhys = m_lastPhys;
+        if (m_lastPhys != InvalidNode)
+            m_blocks[m_lastPhys].nextPhys = n;
+        m_lastPhys = n;
+        InsertFree(n);
+    }
+
+    m_capacity = newCapacity;
+}
+
+TlsfStats TlsfAllocator::GetStats() const
+{
+    TlsfStats s{};
+    s.capacity = m_capacity;
+    s.used = m_used;
+    s.allocations = m_allocations;
+
+    for (const Block& b : m_blocks)
+    {
+        if (!b.live || !b.free)
+            continue;
+        ++s.freeBlocks;
+        s.largestFree = std::max(s.largestFree, b.size);
+    }
+    return s;
+}
+
+bool TlsfAllocator::Validate() const
+{
+    // 1) 주소 순서 체인: 0부터 capacity까지 빈틈 없이, 빈 블록끼리 붙어 있으면 안 됨
+    uint32_t first = InvalidNode;
+    uint32_t liveCount = 0;
+    for (uint32_t i = 0; i < (uint32_t)m_blocks.size(); ++i)
+    {
+        if (!m_blocks[i].live)
+            continue;
+        ++liveCount;
+        if (m_blocks[i].prevPhys == InvalidNode)
+        {
+            if (first != InvalidNode)
+                return false;
+            first = i;
+        }
+    }
+
+    if (m_capacity == 0)
+        return liveCount == 0;
+
+    uint32_t offset = 0, used = 0, allocs = 0, visited = 0, last = InvalidNode;
+    bool prevFree = false;
+    for (uint32_t n = first; n != InvalidNode; n = m_blocks[n].nextPhys)
+    {
+        const Block& b = m_blocks[n];
+        if (!b.live || b.offset != offset || b.size == 0 || b.prevPhys != last)
+            return false;
+        if (b.free && prevFree)
+            return false;
+
+        if (!b.free)
+        {
+            used += b.size;
+            ++allocs;
+        }
+
+        prevFree = b.free;
+        offset += b.size;
+        last = n;
+        if (++visited > liveCount)
+            return false;
+    }
+
+    if (offset != m_capacity || last != m_lastPhys || visited != liveCount || used != m_used || allocs != m_allocations)
+        return false;
+
+    // 2) 빈 리스트: 등급 맞는지, 비트맵과 일치하는지, 빈 블록 수 = 리스트 항목 수
+    uint32_t listed = 0;
+    for (uint32_t fl = 0; fl < FLCount; ++fl)
+    {
+        for (uint32_t sl = 0; sl < SLCount; ++sl)
+        {
+            const bool bit = (m_slBitmap[fl] >> sl) & 1u;
+            if (bit != (m_heads[fl][sl] != InvalidNode))
+                return false;
+
+            uint32_t prev = InvalidNode;
+            for (uint32_t n = m_heads[fl][sl]; n != InvalidNode; n = m_blocks[n].nextFree)
+            {
+                const Block& b = m_blocks[n];
+                uint32_t f, s;
+                Mapping(b.size, f, s);
+                if (!b.live || !b.free || f != fl || s != sl || b.prevFree != prev)
+                    return false;
+                prev = n;
+                if (++listed > liveCount)
+                    return false;
+            }
+        }
+
+        if (((m_flBitmap >> fl) & 1u) != (m_slBitmap[fl] != 0 ? 1u : 0u))
+            return false;
+    }
+
+    return listed == visited - allocs;
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+// 범위 [0, capacity) 서브 할당기 (TLSF: two-level segregated fit)
+// - 단위는 호출 쪽 마음대로 (geometry 메가버퍼는 정점 / 인덱스 개수)
+// - 빈 블록을 크기 등급 [FL = log2][SL = 다음 SLBits 비트]별 리스트에 두고 비트맵 2단으로 찾음
+//   → Allocate / Free 모두 O(1), 단편화는 good-fit 수준
+// - Free는 물리적으로 이웃한 빈 블록과 즉시 합침
+// - Grow로 끝에 빈 공간을 덧붙일 수 있음 (버퍼를 키운 뒤 호출)
+struct TlsfAllocation
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    uint32_t node = 0xFFFFFFFFu;    // 내부 블록 번호 (Free에 필요)
+
+    bool IsValid() const { return node != 0xFFFFFFFFu; }
+};
+
+struct TlsfStats
+{
+    uint32_t capacity = 0;
+    uint32_t used = 0;
+    uint32_t allocations = 0;
+    uint32_t freeBlocks = 0;
+    uint32_t largestFree = 0;
+};
+
+class TlsfAllocator
+{
+public:
+    static constexpr uint32_t InvalidNode = 0xFFFFFFFFu;
+    static constexpr uint32_t SLBits = 4;                   // 등급 하나를 16칸으로
+    static constexpr uint32_t SLCount = 1u << SLBits;
+    static constexpr uint32_t FLCount = 32 - SLBits + 1;    // FL 0 = SLCount 미만 작은 블록 (1단위 간격)
+
+    TlsfAllocator() { Clear(); }
+
+    void Initialize(uint32_t capacity);
+    void Clear();
+
+    // 실패(size 이상 연속 빈 블록이 없음)하면 IsValid() == false
+    TlsfAllocation Allocate(uint32_t size);
+    void Free(const TlsfAllocation& a);
+
+    // capacity를 늘림 (줄이기 없음). 늘어난 구간은 빈 블록, 끝 블록이 비어 있으면 합침
+    void Grow(uint32_t newCapacity);
+
+    uint32_t GetCapacity() const { return m_capacity; }
+    uint32_t GetUsed() const { return m_used; }
+    TlsfStats GetStats() const;
+
+    // 블록 체인/빈 리스트/비트맵이 서로 맞는지 (디버그·테스트용)
+    bool Validate() const;
+
+private:
+    struct Block
+    {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+        uint32_t prevPhys = InvalidNode;    // 주소 순서 이웃
+        uint32_t nextPhys = InvalidNode;
+        uint32_t prevFree = InvalidNode;    // 같은 등급 빈 리스트
+        uint32_t nextFree = InvalidNode;
+        bool free = false;
+        bool live = false;                  // node 풀에서 사용 중
+    };
+
+    static void Mapping(uint32_t size, uint32_t& fl, uint32_t& sl);
+    // size 이상이 보장되는 가장 작은 등급 (검색용: 올림)
+    static void MappingSearch(uint32_t size, uint32_t& fl, uint32_t& sl);
+
+    uint32_t NewNode();
+    void DeleteNode(uint32_t n);
+
+    void InsertFree(uint32_t n);
+    void RemoveFree(uint32_t n);
+    uint32_t FindFree(uint32_t size) const;
+    uint32_t FindFreeExact(uint32_t size) const;
+
+private:
+    std::vector<Block> m_blocks;
+    std::vector<uint32_t> m_freeNodes;      // 재사용할 node 번호
+
+    uint32_t m_heads[FLCount][SLCount];
+    uint32_t m_flBitmap = 0;
+    uint32_t m_slBitmap[FLCount] = {};
+
+    uint32_t m_lastPhys = InvalidNode;      // 주소가 가장 큰 블록 (Grow용)
+    uint32_t m_capacity = 0;
+    uint32_t m_used = 0;
+    uint32_t m_allocations = 0;
+};
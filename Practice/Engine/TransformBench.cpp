@@ -0,0 +1,71 @@
+﻿#include "TransformBench.h"
+#include "World.h"
+#include "Behaviour.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+TransformBenchResult RunTransformBench(JobSystem* jobs, uint32_t nodeCount, uint32_t branching, uint32_t runs)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    runs = std::max(runs, 1u);
+    branching = std::max(branching, 1u);
+
+    World w;
+    std::vector<EntityId> nodes;
+    nodes.reserve(nodeCount);
+
+    for (uint32_t i = 0; i < nodeCount; ++i)
+    {
+        EntityId e = w.CreateEntity();
+        w.AddTransform(e);
+        w.SetLocalPosition(e, { 0.5f, 0.25f, 0.0f });
+        w.SetLocalRotationEuler(e, { 0.0f, 0.1f, 0.0f });
+        if (i > 0)
+            w.SetParent(e, nodes[(i - 1) / branching]); // 완전 branching-ary 트리
+        nodes.push_back(e);
+    }
+
+    TransformBenchResult r{};
+    r.nodeCount = nodeCount;
+    if (nodes.empty())
+        return r;
+
+    auto t0 = Clock::now();
+    w.UpdateTransforms();
+    auto t1 = Clock::now();
+    r.rebuildMs = ms(t0, t1);
+    r.depthCount = w.GetTransformDepthCount();
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+    {
+        w.SetLocalPosition(nodes[0], { 0.0f, (float)i, 0.0f });
+        w.UpdateTransforms();
+    }
+    t1 = Clock::now();
+    r.serialMs = ms(t0, t1) / runs;
+
+    if (jobs)
+    {
+        w.SetJobSystem(jobs);
+        t0 = Clock::now();
+        for (uint32_t i = 0; i < runs; ++i)
+        {
+            w.SetLocalPosition(nodes[0], { 0.0f, (float)i, 0.0f });
+            w.UpdateTransforms();
+        }
+        t1 = Clock::now();
+        r.parallelMs = ms(t0, t1) / runs;
+    }
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < runs; ++i)
+        w.UpdateTransforms();
+    t1 = Clock::now();
+    r.cleanMs = ms(t0, t1) / runs;
+
+    return r;
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+#include <cstdint>
+
+class JobSystem;
+
+// transform 계층 갱신 벤치
+// - 별도 World에 nodeCount개 노드의 완전 branching-ary 트리 → 루트 dirty 후 UpdateTransforms 시간
+// - jobs가 있으면 같은 World에 붙여 병렬 갱신도 측정
+struct TransformBenchResult
+{
+    uint32_t nodeCount = 0;
+    uint32_t depthCount = 0;
+    double rebuildMs = 0.0;     // 첫 갱신(깊이 정렬 포함)
+    double serialMs = 0.0;      // 루트 dirty → 전체 갱신, 순차
+    double parallelMs = 0.0;    // 루트 dirty → 전체 갱신, JobSystem (jobs 없으면 0)
+    double cleanMs = 0.0;       // dirty 없음(sweep만)
+};
+
+TransformBenchResult RunTransformBench(JobSystem* jobs, uint32_t nodeCount, uint32_t branching, uint32_t runs = 8);
@@ -18,4 +18,5 @@ struct TransformComponent
     DirectX::XMFLOAT4X4 world{};
 
     bool dirty = true; // local /θ   true
+    bool isStatic = false; // World::SetStaticθ  ( static BVH )
 };
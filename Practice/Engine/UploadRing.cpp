@@ -0,0 +1,146 @@
+﻿#include "UploadRing.h"
+#include <cassert>
+
+static inline uint64_t AlignUp(uint64_t v, uint64_t a)
+{
+    return (v + a - 1) & ~(a - 1);
+}
+
+void UploadRing::Initialize(uint64_t pageSize, CreatePageFn create, DestroyPageFn destroy)
+{
+    assert(pageSize > 0);
+    Shutdown();
+
+    m_pageSize = pageSize;
+    m_create = std::move(create);
+    m_destroy = std::move(destroy);
+}
+
+void UploadRing::Shutdown()
+{
+    if (m_destroy)
+    {
+        for (uint32_t i = 0; i < (uint32_t)m_pages.size(); ++i)
+            m_destroy(i);
+    }
+
+    m_pages.clear();
+    m_free.clear();
+    m_inFlight.clear();
+    m_closedThisFrame.clear();
+    m_current = InvalidPage;
+    m_offset = 0;
+    m_stats = UploadRingStats{};
+}
+
+void UploadRing::BeginFrame(uint64_t completedFence)
+{
+    while (!m_inFlight.empty() && m_inFlight.front().fence <= completedFence)
+    {
+        m_free.push_back(m_inFlight.front().page);
+        m_inFlight.pop_front();
+    }
+
+    m_stats.pagesCreated = 0;
+    m_stats.bytesThisFrame = 0;
+    m_stats.pagesInFlight = (uint32_t)m_inFlight.size();
+    m_stats.pagesFree = (uint32_t)m_free.size();
+}
+
+uint32_t UploadRing::AcquirePage(uint64_t size)
+{
+    // 크기가 맞는 free page 재사용 (보통 전부 m_pageSize라 첫 번째)
+    for (size_t i = 0; i < m_free.size(); ++i)
+    {
+        const uint32_t page = m_free[i];
+        if (m_pages[page].size < size)
+            continue;
+
+        m_free[i] = m_free.back();
+        m_free.pop_back();
+        return page;
+    }
+
+    const uint32_t page = (uint32_t)m_pages.size();
+    const uint64_t pageBytes = AlignUp(size, m_pageSize);
+
+    UploadPage mem{};
+    if (!m_create || !m_create(page, pageBytes, mem) || !mem.cpu)
+        return InvalidPage;
+
+    m_pages.push_back(mem);
+    ++m_stats.pages;
+    ++m_stats.pagesCreated;
+    m_stats.capacity += mem.size;
+    return page;
+}
+
+void UploadRing::ClosePage(uint32_t page)
+{
+    // fence 값은 EndFrame에서 정해짐
+    m_closedThisFrame.push_back(page);
+}
+
+UploadAllocation UploadRing::Allocate(uint64_t size, uint64_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    UploadAllocation out{};
+    if (size == 0)
+        return out;
+
+    // page 하나를 넘는 요청: 전용 page에 통째로 (현재 page는 그대로 계속 씀)
+    if (size > m_pageSize)
+    {
+        const uint32_t page = AcquirePage(size);
+        if (page == InvalidPage)
+            return out;
+
+        ClosePage(page);
+
+        const UploadPage& mem = m_pages[page];
+        out.cpu = mem.cpu;
+        out.gpu = mem.gpu;
+        out.size = size;
+        out.page = page;
+        out.offset = 0;
+        m_stats.bytesThisFrame += size;
+        return out;
+    }
+
+    uint64_t offset = AlignUp(m_offset, alignment);
+    if (m_current == InvalidPage || offset + size > m_pages[m_current].size)
+    {
+        if (m_current != InvalidPage)
+            ClosePage(m_current);
+
+        m_current = AcquirePage(size);
+        if (m_current == InvalidPage)
+            return out;
+
+        m_offset = 0;
+        offset = 0; // page 시작은 어떤 alignment든 만족 (업로드 리소스는 64KB 정렬)
+    }
+
+    const UploadPage& mem = m_pages[m_current];
+    out.cpu = mem.cpu + offset;
+    out.gpu = mem.gpu + offset;
+    out.size = size;
+    out.page = m_current;
+    out.offset = offset;
+
+    m_stats.bytesThisFrame += (offset + size) - m_offset;
+    m_offset = offset + size;
+    return out;
+}
+
+void UploadRing::EndFrame(uint64_t fenceValue)
+{
+    // 아직 안 찬 현재 page는 다음 프레임도 이어서 씀 → 닫히는 프레임의 fence로 retire
+    for (uint32_t page : m_closedThisFrame)
+        m_inFlight.push_back({ page, fenceValue });
+    m_closedThisFrame.clear();
+
+    m_stats.pagesInFlight = (uint32_t)m_inFlight.size();
+    m_stats.pagesFree = (uint32_t)m_free.size();
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+// 프레임 단위 선형 업로드 할당기
+// - page(고정 크기 업로드 메모리)를 앞에서부터 채우고, 다 차면 다음 page로 넘어감
+// - EndFrame(fence): 이번 프레임에 쓴 page에 fence 값 기록
+//   BeginFrame(completed): 다 찬 page 중 fence가 끝난 것만 free로 되돌림 (FIFO → page 단위 ring)
+// - free page가 없으면 새 page 생성 (상한 없음), page보다 큰 요청은 전용 page
+// - 실제 메모리(리소스 생성/Map/Unmap)는 콜백이 담당
+struct UploadPage
+{
+    uint8_t* cpu = nullptr;     // persist-mapped 주소
+    uint64_t gpu = 0;           // GPU 가상 주소
+    uint64_t size = 0;
+};
+
+struct UploadAllocation
+{
+    uint8_t* cpu = nullptr;     // 실패 시 nullptr
+    uint64_t gpu = 0;
+    uint64_t size = 0;
+
+    uint32_t page = 0;
+    uint64_t offset = 0;        // page 내 오프셋
+};
+
+struct UploadRingStats
+{
+    uint32_t pages = 0;             // 만든 page 수 (free 포함)
+    uint32_t pagesInFlight = 0;     // GPU가 아직 읽을 수 있는 다 찬 page
+    uint32_t pagesFree = 0;
+    uint32_t pagesCreated = 0;      // 이번 프레임에 새로 만든 page
+    uint64_t bytesThisFrame = 0;    // 정렬 padding 포함
+    uint64_t capacity = 0;          // 전체 page 크기 합
+};
+
+class UploadRing
+{
+public:
+    static constexpr uint32_t InvalidPage = 0xFFFFFFFFu;
+
+    // out을 채우고 true. 실패하면 false (Allocate가 nullptr 반환)
+    using CreatePageFn = std::function<bool(uint32_t pageIndex, uint64_t size, UploadPage& out)>;
+    using DestroyPageFn = std::function<void(uint32_t pageIndex)>;
+
+    void Initialize(uint64_t pageSize, CreatePageFn create, DestroyPageFn destroy);
+
+    // 모든 page 해제 (GPU가 다 끝났다는 걸 호출 쪽이 보장)
+    void Shutdown();
+
+    // completedFence 이하로 표시된 page 재활용
+    void BeginFrame(uint64_t completedFence);
+
+    // alignment는 2의 거듭제곱
+    UploadAllocation Allocate(uint64_t size, uint64_t alignment);
+
+    // 이번 프레임 커맨드가 끝나면 fence가 fenceValue가 됨
+    void EndFrame(uint64_t fenceValue);
+
+    const UploadRingStats& GetStats() const { return m_stats; }
+    uint64_t GetPageSize() const { return m_pageSize; }
+
+private:
+    struct InFlight
+    {
+        uint32_t page = 0;
+        uint64_t fence = 0;
+    };
+
+    // size 이상인 page 하나 확보 (free 재사용 → 없으면 생성)
+    uint32_t AcquirePage(uint64_t size);
+    void ClosePage(uint32_t page);
+
+private:
+    uint64_t m_pageSize = 0;
+    CreatePageFn m_create;
+    DestroyPageFn m_destroy;
+
+    std::vector<UploadPage> m_pages;
+    std::vector<uint32_t> m_free;
+    std::deque<InFlight> m_inFlight;    // fence 오름차순
+    std::vector<uint32_t> m_closedThisFrame;
+
+    uint32_t m_current = InvalidPage;
+    uint64_t m_offset = 0;
+
+    UploadRingStats m_stats{};
+};
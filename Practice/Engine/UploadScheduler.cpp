@@ -0,0 +1,161 @@
+﻿#include "UploadScheduler.h"
+#include <algorithm>
+
+void UploadScheduler::Initialize(uint32_t maxUploadsPerSubmit, uint64_t maxBytesPerSubmit, uint64_t maxBytesPerFrame, CompleteFn onComplete)
+{
+    Clear();
+
+    m_maxUploadsPerSubmit = std::max(maxUploadsPerSubmit, 1u);
+    m_maxBytesPerSubmit = maxBytesPerSubmit;
+    m_maxBytesPerFrame = maxBytesPerFrame;
+    m_onComplete = std::move(onComplete);
+}
+
+void UploadScheduler::Clear()
+{
+    m_pending.clear();
+    m_queue.clear();
+    m_inFlight.clear();
+    m_batch.clear();
+    m_batchBytes = 0;
+    m_stats = UploadSchedulerStats{};
+}
+
+bool UploadScheduler::Request(UploadKind kind, uint32_t id, uint64_t bytes)
+{
+    if (!m_pending.emplace(Key(kind, id), PendingState::Queued).second)
+        return false;
+
+    m_queue.push_back(UploadRequest{ kind, id, bytes });
+    ++m_stats.queued;
+    return true;
+}
+
+void UploadScheduler::Cancel(UploadKind kind, uint32_t id)
+{
+    auto it = m_pending.find(Key(kind, id));
+    if (it == m_pending.end())
+        return;
+
+    if (it->second == PendingState::Queued)
+    {
+        --m_stats.queued;
+    }
+    else
+    {
+        for (InFlight& f : m_inFlight)
+        {
+            if (f.request.kind == kind && f.request.id == id)
+                f.cancelled = true;
+        }
+    }
+
+    // 대기열의 요청은 꺼낼 때 m_pending에 없으면 건너뜀
+    m_pending.erase(it);
+}
+
+void UploadScheduler::BeginFrame(uint64_t completedFence)
+{
+    m_stats.recordedThisFrame = 0;
+    m_stats.submitsThisFrame = 0;
+    m_stats.completedThisFrame = 0;
+    m_stats.bytesThisFrame = 0;
+
+    Complete(completedFence);
+}
+
+void UploadScheduler::Pump(IUploadQueue& queue)
+{
+    PumpBudget(queue, m_maxBytesPerFrame);
+}
+
+void UploadScheduler::Flush(IUploadQueue& queue)
+{
+    PumpBudget(queue, UINT64_MAX);
+
+    if (!m_inFlight.empty())
+        queue.WaitUploadFence(m_inFlight.back().fence);
+
+    Complete(queue.GetCompletedUploadFence());
+}
+
+void UploadScheduler::PumpBudget(IUploadQueue& queue, uint64_t frameBudget)
+{
+    uint64_t frameBytes = 0;
+
+    while (!m_queue.empty())
+    {
+        const UploadRequest r = m_queue.front();
+
+        // 취소됐거나 (취소 후 다시 요청돼) 이미 앞에서 녹화된 중복
+        auto it = m_pending.find(Key(r.kind, r.id));
+        if (it == m_pending.end() || it->second != PendingState::Queued)
+        {
+            m_queue.pop_front();
+            continue;
+        }
+
+        // 프레임 예산: 이미 뭔가 올렸으면 넘치는 요청은 다음 프레임
+        if (frameBytes > 0 && frameBytes + r.bytes > frameBudget)
+            break;
+
+        // 제출 단위: 개수/바이트가 차면 먼저 제출
+        if (!m_batch.empty() && (m_batch.size() >= m_maxUploadsPerSubmit || m_batchBytes + r.bytes > m_maxBytesPerSubmit))
+            SubmitBatch(queue);
+
+        if (!queue.RecordUpload(r))
+            break;
+
+        m_queue.pop_front();
+        it->second = PendingState::InFlight;
+        --m_stats.queued;
+
+        m_batch.push_back(r);
+        m_batchBytes += r.bytes;
+        frameBytes += r.bytes;
+
+        ++m_stats.recordedThisFrame;
+        m_stats.bytesThisFrame += r.bytes;
+    }
+
+    if (!m_batch.empty())
+        SubmitBatch(queue);
+}
+
+void UploadScheduler::SubmitBatch(IUploadQueue& queue)
+{
+    const uint64_t fence = queue.SubmitUploads();
+
+    for (const UploadRequest& r : m_batch)
+        m_inFlight.push_back(InFlight{ r, fence, false });
+
+    m_stats.inFlight = (uint32_t)m_inFlight.size();
+    ++m_stats.submitsThisFrame;
+    ++m_stats.totalSubmits;
+
+    m_batch.clear();
+    m_batchBytes = 0;
+}
+
+void UploadScheduler::Complete(uint64_t completedFence)
+{
+    while (!m_inFlight.empty() && m_inFlight.front().fence <= completedFence)
+    {
+        const InFlight f = m_inFlight.front();
+        m_inFlight.pop_front();
+
+        if (f.cancelled)
+            continue;
+
+        m_pending.erase(Key(f.request.kind, f.request.id));
+
+        ++m_stats.completedThisFrame;
+        ++m_stats.totalCompleted;
+        m_stats.totalBytes += f.request.bytes;
+
+        if (m_onComplete)
+            m_onComplete(f.request, f.fence);
+    }
+
+    m_stats.inFlight = (uint32_t)m_inFlight.size();
+}
@@ -0,0 +1,125 @@
+﻿#pragma once
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// 에셋 업로드(mesh / texture → GPU) 스케줄링
+// - Request: 처음 본 에셋을 대기열에 (이미 대기/진행 중이면 무시). 완료 전까지 캐시는 fallback을 씀
+// - Pump: 대기열을 프레임 바이트 예산 안에서 꺼내 제출 하나에 여러 개씩 녹화 → 제출
+//   (예산보다 큰 에셋도 프레임당 최소 1개는 나감)
+// - BeginFrame(completed): fence가 끝난 제출의 요청마다 완료 콜백 → 캐시가 resident로 표시
+//   (큐 하나라 fence는 제출 순서대로 끝남 → FIFO)
+// - 실제 녹화/제출/대기는 IUploadQueue 몫 (D3D12 = copy queue + staging ring, 테스트 = 가짜 큐)
+enum class UploadKind : uint8_t
+{
+    Mesh,
+    Texture,
+};
+
+struct UploadRequest
+{
+    UploadKind kind = UploadKind::Mesh;
+    uint32_t id = 0;            // MeshHandle / TextureHandle id
+    uint64_t bytes = 0;         // staging에 쓸 대략의 크기 (예산 계산용)
+};
+
+struct UploadSchedulerStats
+{
+    uint32_t queued = 0;                // 아직 녹화 안 한 요청
+    uint32_t inFlight = 0;              // 제출했고 fence 대기 중
+
+    uint32_t recordedThisFrame = 0;
+    uint32_t submitsThisFrame = 0;
+    uint32_t completedThisFrame = 0;
+    uint64_t bytesThisFrame = 0;
+
+    uint64_t totalCompleted = 0;        // 누적
+    uint64_t totalBytes = 0;
+    uint64_t totalSubmits = 0;
+};
+
+class IUploadQueue
+{
+public:
+    virtual ~IUploadQueue() = default;
+
+    // 열린 제출에 요청 하나 녹화 (staging 채우기 + 복사 명령). false = 지금은 못 함 → 다음 Pump에 다시
+    virtual bool RecordUpload(const UploadRequest& request) = 0;
+
+    // 녹화한 것 제출. 전부 끝나면 GetCompletedUploadFence()가 반환값 이상이 됨
+    virtual uint64_t SubmitUploads() = 0;
+
+    virtual uint64_t GetCompletedUploadFence() const = 0;
+
+    // CPU 대기 (Flush 전용)
+    virtual void WaitUploadFence(uint64_t fenceValue) = 0;
+};
+
+class UploadScheduler
+{
+public:
+    // 완료 콜백 (BeginFrame/Flush 안에서 호출). 취소된 요청은 안 옴
+    using CompleteFn = std::function<void(const UploadRequest& request, uint64_t fenceValue)>;
+
+    // 제출 하나당 요청 수/바이트 상한, Pump 한 번(프레임)당 바이트 예산
+    void Initialize(uint32_t maxUploadsPerSubmit, uint64_t maxBytesPerSubmit, uint64_t maxBytesPerFrame, CompleteFn onComplete);
+
+    // 대기열/진행 목록 비움 (콜백 없음, GPU가 다 끝났다는 걸 호출 쪽이 보장)
+    void Clear();
+
+    // 새로 대기열에 넣었으면 true
+    bool Request(UploadKind kind, uint32_t id, uint64_t bytes);
+
+    // 대기 중이면 빼고, 진행 중이면 완료 콜백만 생략 (리소스 수명은 호출 쪽 fence로)
+    void Cancel(UploadKind kind, uint32_t id);
+
+    bool IsPending(UploadKind kind, uint32_t id) const { return m_pending.count(Key(kind, id)) != 0; }
+
+    // 프레임 통계 리셋 + completedFence 이하 제출 완료 처리
+    void BeginFrame(uint64_t completedFence);
+
+    // 예산만큼 녹화/제출
+    void Pump(IUploadQueue& queue);
+
+    // 예산 무시하고 전부 제출 + CPU 대기 + 완료 처리 (초기화/로딩용)
+    void Flush(IUploadQueue& queue);
+
+    const UploadSchedulerStats& GetStats() const { return m_stats; }
+
+private:
+    enum class PendingState : uint8_t
+    {
+        Queued,
+        InFlight,
+    };
+
+    struct InFlight
+    {
+        UploadRequest request;
+        uint64_t fence = 0;
+        bool cancelled = false;
+    };
+
+    static uint64_t Key(UploadKind kind, uint32_t id) { return ((uint64_t)kind << 32) | id; }
+
+    void PumpBudget(IUploadQueue& queue, uint64_t frameBudget);
+    void SubmitBatch(IUploadQueue& queue);
+    void Complete(uint64_t completedFence);
+
+private:
+    uint32_t m_maxUploadsPerSubmit = 1;
+    uint64_t m_maxBytesPerSubmit = 0;
+    uint64_t m_maxBytesPerFrame = 0;
+    CompleteFn m_onComplete;
+
+    std::unordered_map<uint64_t, PendingState> m_pending;  // Key → 상태 (중복 요청 판정)
+    std::deque<UploadRequest> m_queue;                      // 요청 순서 (취소된 것은 꺼낼 때 건너뜀)
+    std::deque<InFlight> m_inFlight;                        // fence 오름차순
+
+    std::vector<UploadRequest> m_batch;                     // 녹화했지만 아직 제출 안 한 것
+    uint64_t m_batchBytes = 0;
+
+    UploadSchedulerStats m_stats{};
+};
@@ -0,0 +1,51 @@
+﻿#include "VertexQuantize.h"
+#include <DirectXPackedVector.h>
+#include <algorithm>
+
+using namespace DirectX;
+
+PositionDequant QuantizeMeshVertices(const MeshCPUData& mesh, CompactVertex* out)
+{
+    PositionDequant dq{};
+    const size_t n = mesh.positions.size();
+    if (n == 0)
+        return dq;
+
+    // 1) AABB → 역양자화 상수
+    XMFLOAT3 mn = mesh.positions[0];
+    XMFLOAT3 mx = mn;
+    for (const XMFLOAT3& p : mesh.positions)
+    {
+        mn = { std::min(mn.x, p.x), std::min(mn.y, p.y), std::min(mn.z, p.z) };
+        mx = { std::max(mx.x, p.x), std::max(mx.y, p.y), std::max(mx.z, p.z) };
+    }
+
+    dq.offset = mn;
+    dq.scale = { mx.x - mn.x, mx.y - mn.y, mx.z - mn.z };
+
+    // 두께 0인 축은 0으로 (나눗셈 회피)
+    const float ix = (dq.scale.x > 0.0f) ? 1.0f / dq.scale.x : 0.0f;
+    const float iy = (dq.scale.y > 0.0f) ? 1.0f / dq.scale.y : 0.0f;
+    const float iz = (dq.scale.z > 0.0f) ? 1.0f / dq.scale.z : 0.0f;
+
+    // 2) 정점별 인코딩
+    for (size_t i = 0; i < n; ++i)
+    {
+        const XMFLOAT3& p = mesh.positions[i];
+        CompactVertex& v = out[i];
+
+        v.pos[0] = VertexQuantize::ToUnorm16((p.x - mn.x) * ix);
+        v.pos[1] = VertexQuantize::ToUnorm16((p.y - mn.y) * iy);
+        v.pos[2] = VertexQuantize::ToUnorm16((p.z - mn.z) * iz);
+        v.pos[3] = 0;
+
+        const XMFLOAT3 nrm = (i < mesh.normals.size()) ? mesh.normals[i] : XMFLOAT3{ 0, 1, 0 };
+        VertexQuantize::EncodeOctahedral(nrm, v.nrm);
+
+        const XMFLOAT2 uv = (i < mesh.uvs.size()) ? mesh.uvs[i] : XMFLOAT2{ 0, 0 };
+        v.uv[0] = PackedVector::XMConvertFloatToHalf(uv.x);
+        v.uv[1] = PackedVector::XMConvertFloatToHalf(uv.y);
+    }
+
+    return dq;
+}
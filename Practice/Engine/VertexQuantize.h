@@ -0,0 +1,91 @@
+﻿#pragma once
+#include <DirectXMath.h>
+#include <cmath>
+#include <cstdint>
+#include "MeshCPUData.h"
+
+// Compact GPU 정점 (MeshVertexFormat::Compact)
+//   pos : R16G16B16A16_UNORM  (mesh AABB 안의 상대 위치, w 미사용) → pos = offset + unorm * scale
+//   nrm : R16G16_SNORM        (8면체 인코딩, z 반구 접기)
+//   uv  : R16G16_FLOAT        (half)
+// → 32 byte(VertexPNU) 대비 절반. 위치 오차는 축마다 AABB 길이 / 65535 / 2 이하
+struct CompactVertex
+{
+    uint16_t pos[4];
+    int16_t  nrm[2];
+    uint16_t uv[2];
+};
+static_assert(sizeof(CompactVertex) == 16, "CompactVertex must stay 16 bytes (input layout)");
+
+// mesh별 위치 역양자화 상수 (shader root constant로 전달)
+struct PositionDequant
+{
+    DirectX::XMFLOAT3 offset{ 0, 0, 0 };  // AABB min
+    DirectX::XMFLOAT3 scale{ 0, 0, 0 };   // AABB 크기 (max - min)
+};
+
+namespace VertexQuantize
+{
+    static inline int16_t ToSnorm16(float v)
+    {
+        v = (v < -1.0f) ? -1.0f : (v > 1.0f ? 1.0f : v);
+        return (int16_t)std::lround(v * 32767.0f);
+    }
+
+    static inline uint16_t ToUnorm16(float v)
+    {
+        v = (v < 0.0f) ? 0.0f : (v > 1.0f ? 1.0f : v);
+        return (uint16_t)std::lround(v * 65535.0f);
+    }
+
+    // 단위 벡터 → 8면체 [-1,1]^2 (길이 0이면 +z)
+    static inline void EncodeOctahedral(const DirectX::XMFLOAT3& n, int16_t out[2])
+    {
+        const float sum = std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z);
+        float x = 0.0f, y = 0.0f;
+        if (sum > 0.0f)
+        {
+            x = n.x / sum;
+            y = n.y / sum;
+            if (n.z < 0.0f)
+            {
+                // 아래 반구는 대각선 너머로 접음 (shader 디코드와 같은 부호 규칙: 0은 +)
+                const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+                const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+                x = fx;
+                y = fy;
+            }
+        }
+
+        out[0] = ToSnorm16(x);
+        out[1] = ToSnorm16(y);
+    }
+
+    // shader와 같은 디코드 (검증용)
+    static inline DirectX::XMFLOAT3 DecodeOctahedral(const int16_t in[2])
+    {
+        const float ex = std::fmax((float)in[0] / 32767.0f, -1.0f);
+        const float ey = std::fmax((float)in[1] / 32767.0f, -1.0f);
+
+        float x = ex, y = ey;
+        const float z = 1.0f - std::fabs(ex) - std::fabs(ey);
+        const float t = (-z > 0.0f) ? -z : 0.0f;
+        x += (x >= 0.0f) ? -t : t;
+        y += (y >= 0.0f) ? -t : t;
+
+        const float len = std::sqrt(x * x + y * y + z * z);
+        return (len > 0.0f) ? DirectX::XMFLOAT3{ x / len, y / len, z / len } : DirectX::XMFLOAT3{ 0, 0, 1 };
+    }
+
+    static inline DirectX::XMFLOAT3 DecodePosition(const CompactVertex& v, const PositionDequant& dq)
+    {
+        return {
+            dq.offset.x + (float)v.pos[0] / 65535.0f * dq.scale.x,
+            dq.offset.y + (float)v.pos[1] / 65535.0f * dq.scale.y,
+            dq.offset.z + (float)v.pos[2] / 65535.0f * dq.scale.z };
+    }
+}
+
+// mesh 정점 전체를 Compact로 변환 (out은 positions.size()개, 업로드 메모리에 바로 써도 됨)
+// normals/uvs가 모자라면 (0,1,0) / (0,0)
+PositionDequant QuantizeMeshVertices(const MeshCPUData& mesh, CompactVertex* out);
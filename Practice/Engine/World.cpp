@@ -1,11 +1,33 @@
 ﻿#include "World.h"
 #include <cassert>
 #include <algorithm>
+#include <atomic>
 #include <DirectXMath.h>
 #include "Behaviour.h"
+#include "JobSystem.h"
 
 using namespace DirectX;
 
+uint32_t World::NextInstanceId()
+{
+    static std::atomic<uint32_t> s_worldInstanceCount{ 0 };
+    return ++s_worldInstanceCount;
+}
+
+World::World()
+{
+    // pool 안에서 dense 위치가 바뀌면(swap-and-pop/재정렬) archetype slot 갱신
+    m_transforms.SetMovedCallback(&World::OnComponentMoved<ComponentType::Transform>, this);
+    m_meshes.SetMovedCallback(&World::OnComponentMoved<ComponentType::Mesh>, this);
+    m_materials.SetMovedCallback(&World::OnComponentMoved<ComponentType::Material>, this);
+    m_cameras.SetMovedCallback(&World::OnComponentMoved<ComponentType::Camera>, this);
+    m_rigidBodies.SetMovedCallback(&World::OnComponentMoved<ComponentType::RigidBody>, this);
+    m_colliders.SetMovedCallback(&World::OnComponentMoved<ComponentType::Collider>, this);
+    m_audioSources.SetMovedCallback(&World::OnComponentMoved<ComponentType::AudioSource>, this);
+    m_lights.SetMovedCallback(&World::OnComponentMoved<ComponentType::Light>, this);
+    m_uiElements.SetMovedCallback(&World::OnComponentMoved<ComponentType::UIElement>, this);
+    m_scripts.SetMovedCallback(&World::OnComponentMoved<ComponentType::Script>, this);
+}
 
 EntityId World::CreateEntity(const std::string& name)
 {
@@ -33,12 +55,6 @@ EntityId World::CreateEntity(const std::string& name)
 
     EntityId e{ index, m_slots[index].generation };
 
-    EnsureTransformSparseSize(index);
-    EnsureMeshSparseSize(index);
-    EnsureMaterialSparseSize(index);
-    EnsureCameraSparseSize(index);
-    EnsureLightSparseSize(index);
-
     if (!name.empty())
         m_nameToEntity[name] = e;
 
@@ -75,6 +91,11 @@ void World::DestroyEntity(EntityId e)
 	RemoveRigidBody(e);
     RemoveAudioSource(e);
     RemoveLight(e);
+    RemoveUIElement(e);
+
+    // 혹시 남은 게 있어도 archetype에서는 빠지게
+    if (m_archetypeEnabled)
+        m_archetypes.RemoveEntity(e);
 
     Slot& s = m_slots[e.index];
     s.alive = false;
@@ -132,235 +153,142 @@ void World::RemoveNameMapping(EntityId e)
 
 // --- Transform API 구현 ---
 
-void World::EnsureTransformSparseSize(uint32_t entityIndex)
-{
-    if (m_transformSparse.size() <= entityIndex)
-        m_transformSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 // --- Mesh Storage ---
-void World::EnsureMeshSparseSize(uint32_t entityIndex)
-{
-    if (m_meshSparse.size() <= entityIndex)
-        m_meshSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 void World::AddMesh(EntityId e, const MeshComponent& comp)
 {
     if (!IsAlive(e)) return;
-    EnsureMeshSparseSize(e.index);
 
-    // 이미 MeshComponent가 있으면 append
-    if (m_meshSparse[e.index] != InvalidDenseIndex)
+    if (IsStatic(e))
+        ++m_staticVersion; // static 집합의 bounds가 바뀜
+
+    bool added = false;
+    MeshComponent& dst = m_meshes.Emplace(e, &added, comp);
+    MarkRenderChanged(e, RenderChangeFlags::Mesh);
+    if (added)
     {
-        const uint32_t di = m_meshSparse[e.index];
-        auto& dst = m_meshes[di].draws;
-        dst.insert(dst.end(), comp.draws.begin(), comp.draws.end());
+        ArchetypeAdd(e, ComponentType::Mesh, m_meshes.Size() - 1);
         return;
     }
 
-    const uint32_t denseIndex = (uint32_t)m_meshes.size();
-    m_meshSparse[e.index] = denseIndex;
-    m_meshDenseEntities.push_back(e);
-    m_meshes.push_back(comp);
+    // 이미 MeshComponent가 있으면 append
+    dst.draws.insert(dst.draws.end(), comp.draws.begin(), comp.draws.end());
 }
 
 bool World::HasMesh(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_meshSparse.size()) return false;
-
-    const uint32_t di = m_meshSparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_meshDenseEntities.size()) return false;
-    return m_meshDenseEntities[di] == e;
+    return m_meshes.Has(e);
 }
 
 MeshComponent& World::GetMesh(EntityId e)
 {
+    MeshComponent& m = m_meshes.Get(e);
 #if defined(_DEBUG)
-    assert(HasMesh(e));
-    assert(!m_meshes[m_meshSparse[e.index]].draws.empty());
-    assert(m_meshes[m_meshSparse[e.index]].draws[0].mesh.IsValid());
+    assert(!m.draws.empty());
+    assert(m.draws[0].mesh.IsValid());
 #endif
-    return m_meshes[m_meshSparse[e.index]];
+    return m;
 }
 
 const MeshComponent& World::GetMesh(EntityId e) const
 {
+    const MeshComponent& m = m_meshes.Get(e);
 #if defined(_DEBUG)
-    assert(HasMesh(e));
-    assert(!m_meshes[m_meshSparse[e.index]].draws.empty());
-    assert(m_meshes[m_meshSparse[e.index]].draws[0].mesh.IsValid());
+    assert(!m.draws.empty());
+    assert(m.draws[0].mesh.IsValid());
 #endif
-    return m_meshes[m_meshSparse[e.index]];
+    return m;
 }
 
 void World::RemoveMesh(EntityId e)
 {
-    if (!HasMesh(e)) return;
-    const uint32_t denseIndex = m_meshSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_meshes.size() - 1;
-
-    if (denseIndex != lastIndex)
-    {
-        m_meshes[denseIndex] = std::move(m_meshes[lastIndex]);
-        m_meshDenseEntities[denseIndex] = m_meshDenseEntities[lastIndex];
-        EntityId movedEntity = m_meshDenseEntities[denseIndex];
-        m_meshSparse[movedEntity.index] = denseIndex;
-    }
+    if (!m_meshes.Remove(e))
+        return;
 
-    m_meshes.pop_back();
-    m_meshDenseEntities.pop_back();
-    m_meshSparse[e.index] = InvalidDenseIndex;
+    MarkRenderChanged(e, RenderChangeFlags::Mesh);
+    ArchetypeRemove(e, ComponentType::Mesh);
+    if (IsStatic(e))
+        ++m_staticVersion;
 }
 
 // --- Material Storage ---
-void World::EnsureMaterialSparseSize(uint32_t entityIndex)
-{
-    if (m_materialSparse.size() <= entityIndex)
-        m_materialSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 void World::AddMaterial(EntityId e, const MaterialComponent& comp)
 {
     if (!IsAlive(e)) return;
-    EnsureMaterialSparseSize(e.index);
 
-    if (m_materialSparse[e.index] != InvalidDenseIndex)
-    {
-        m_materials[m_materialSparse[e.index]] = comp; // ✅ 교체
-        return;
-    }
-
-    const uint32_t denseIndex = (uint32_t)m_materials.size();
-    m_materialSparse[e.index] = denseIndex;
-    m_materialDenseEntities.push_back(e);
-    m_materials.push_back(comp);
+    bool added = false;
+    MaterialComponent& dst = m_materials.Emplace(e, &added, comp);
+    MarkRenderChanged(e, RenderChangeFlags::Material);
+    if (added)
+        ArchetypeAdd(e, ComponentType::Material, m_materials.Size() - 1);
+    else
+        dst = comp; // 교체
 }
 
 bool World::HasMaterial(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_materialSparse.size()) return false;
-
-	const uint32_t di = m_materialSparse[e.index];
-	if (di == InvalidDenseIndex) return false;
-	if (di >= m_materialDenseEntities.size()) return false;
-    return m_materialDenseEntities[di] == e;
+    return m_materials.Has(e);
 }
 
 MaterialComponent& World::GetMaterial(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasMaterial(e));
-#endif
-    uint32_t denseIndex = m_materialSparse[e.index];
-    return m_materials[denseIndex];
+    return m_materials.Get(e);
 }
 
 const MaterialComponent& World::GetMaterial(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasMaterial(e));
-#endif
-    const uint32_t denseIndex = m_materialSparse[e.index];
-    return m_materials[denseIndex];
+    return m_materials.Get(e);
 }
 
 void World::RemoveMaterial(EntityId e)
 {
-    if (!HasMaterial(e)) return;
-    const uint32_t denseIndex = m_materialSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_materials.size() - 1;
-
-    if (denseIndex != lastIndex)
+    // swap-and-pop으로 옮겨진 엔티티는 pool 콜백(OnComponentMoved)이 archetype에 반영
+    if (m_materials.Remove(e))
     {
-        m_materials[denseIndex] = std::move(m_materials[lastIndex]);
-        m_materialDenseEntities[denseIndex] = m_materialDenseEntities[lastIndex];
-        EntityId movedEntity = m_materialDenseEntities[denseIndex];
-        m_materialSparse[movedEntity.index] = denseIndex;
+        MarkRenderChanged(e, RenderChangeFlags::Material);
+        ArchetypeRemove(e, ComponentType::Material);
     }
-
-    m_materials.pop_back();
-    m_materialDenseEntities.pop_back();
-    m_materialSparse[e.index] = InvalidDenseIndex;
 }
 
 // --- Camera Storage (뼈대) ---
-void World::EnsureCameraSparseSize(uint32_t entityIndex)
-{
-    if (m_cameraSparse.size() <= entityIndex)
-        m_cameraSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 void World::AddCamera(EntityId e)
 {
     if (!IsAlive(e)) return;
-    EnsureCameraSparseSize(e.index);
-    if (m_cameraSparse[e.index] != InvalidDenseIndex)
-        return;
 
-    const uint32_t denseIndex = (uint32_t)m_cameras.size();
-    m_cameraSparse[e.index] = denseIndex;
-    m_cameraDenseEntities.push_back(e);
-    m_cameras.emplace_back();
+    bool added = false;
+    m_cameras.Emplace(e, &added);
+    if (added)
+        ArchetypeAdd(e, ComponentType::Camera, m_cameras.Size() - 1);
 }
 
 bool World::HasCamera(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_cameraSparse.size()) return false;
-
-	const uint32_t di = m_cameraSparse[e.index];
-	if (di == InvalidDenseIndex) return false;
-	if (di >= m_cameraDenseEntities.size()) return false;
-	return m_cameraDenseEntities[di] == e;
+    return m_cameras.Has(e);
 }
 
 CameraComponent& World::GetCamera(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasCamera(e));
-#endif
-    uint32_t denseIndex = m_cameraSparse[e.index];
-    return m_cameras[denseIndex];
+    return m_cameras.Get(e);
 }
 
 const CameraComponent& World::GetCamera(EntityId e) const
 {
-#if defined(_DEBUG)
-	assert(HasCamera(e));
-#endif
-    const uint32_t denseIndex = m_cameraSparse[e.index];
-    return m_cameras[denseIndex];
+    return m_cameras.Get(e);
 }
 
 void World::RemoveCamera(EntityId e)
 {
-    if (!HasCamera(e)) return;
-    const uint32_t denseIndex = m_cameraSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_cameras.size() - 1;
-
-    if (denseIndex != lastIndex)
-    {
-        m_cameras[denseIndex] = std::move(m_cameras[lastIndex]);
-        m_cameraDenseEntities[denseIndex] = m_cameraDenseEntities[lastIndex];
-        EntityId movedEntity = m_cameraDenseEntities[denseIndex];
-        m_cameraSparse[movedEntity.index] = denseIndex;
-    }
-
-    m_cameras.pop_back();
-    m_cameraDenseEntities.pop_back();
-    m_cameraSparse[e.index] = InvalidDenseIndex;
+    if (m_cameras.Remove(e))
+        ArchetypeRemove(e, ComponentType::Camera);
 }
 
 EntityId World::FindActiveCamera() const
 {
-    for (size_t i = 0; i < m_cameras.size(); ++i)
+    const std::vector<CameraComponent>& cams = m_cameras.Data();
+    const std::vector<EntityId>& ents = m_cameras.Entities();
+    for (size_t i = 0; i < cams.size(); ++i)
     {
-        if (m_cameras[i].active)
-            return m_cameraDenseEntities[i];
+        if (cams[i].active && ents[i].IsValid())
+            return ents[i];
     }
     return EntityId::Invalid();
 }
@@ -406,49 +334,45 @@ void World::FlushDestroy()
 void World::AddTransform(EntityId e)
 {
     if (!IsAlive(e)) return;
-    EnsureTransformSparseSize(e.index);
 
-    if (m_transformSparse[e.index] != InvalidDenseIndex)
+    bool added = false;
+    TransformComponent& t = m_transforms.Emplace(e, &added);
+    if (!added)
         return; // already has
 
-    const uint32_t denseIndex = (uint32_t)m_transforms.size();
-    m_transformSparse[e.index] = denseIndex;
-
-    m_transformDenseEntities.push_back(e);
-    m_transforms.emplace_back();
+    ArchetypeAdd(e, ComponentType::Transform, m_transforms.Size() - 1);
+    if (m_meshes.Has(e))
+        MarkRenderChanged(e, RenderChangeFlags::Mesh); // Mesh가 먼저 있었으면 이제 proxy 생성
 
     // world를 identity로 초기화
-    XMStoreFloat4x4(&m_transforms.back().world, XMMatrixIdentity());
-    m_transforms.back().dirty = true;
+    XMStoreFloat4x4(&t.world, XMMatrixIdentity());
+    t.dirty = true;
+
+    // 새 transform은 루트로 맨 뒤에 붙음 → 전부 루트(depth 1단계)일 때만 정렬 유지
+    if (!m_hierarchyDirty && m_transformLevelStart.size() <= 2)
+    {
+        m_transformParentDense.push_back(InvalidDenseIndex);
+        m_transformLevelStart.assign({ 0u, m_transforms.Size() });
+    }
+    else
+    {
+        m_hierarchyDirty = true;
+    }
 }
 
 bool World::HasTransform(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_transformSparse.size()) return false;
-
-	const uint32_t di = m_transformSparse[e.index];
-	if (di == InvalidDenseIndex) return false;
-	if (di >= m_transformDenseEntities.size()) return false;
-	return m_transformDenseEntities[di] == e;
+    return m_transforms.Has(e);
 }
 
 TransformComponent& World::GetTransform(EntityId e)
 {
-#if defined(_DEBUG)
-	assert(HasTransform(e));
-#endif
-    const uint32_t denseIndex = m_transformSparse[e.index];
-    return m_transforms[denseIndex];
+    return m_transforms.Get(e);
 }
 
 const TransformComponent& World::GetTransform(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasTransform(e));
-#endif
-    const uint32_t denseIndex = m_transformSparse[e.index];
-    return m_transforms[denseIndex];
+    return m_transforms.Get(e);
 }
 
 void World::RemoveTransform(EntityId e)
@@ -458,6 +382,15 @@ void World::RemoveTransform(EntityId e)
 
     // parent/child 관계 정리: 부모에서 나 제거, 자식들은 부모 invalid로
     TransformComponent& t = GetTransform(e);
+    if (t.isStatic)
+        ++m_staticVersion;
+    if (m_meshes.Has(e))
+        MarkRenderChanged(e, RenderChangeFlags::Mesh);
+
+    // 전부 루트인 상태에서 루트 하나 빠지는 건 swap-remove 해도 정렬 유지
+    // (순회 중이라 제거가 지연되면 dense 크기가 그대로라 재정렬로 처리)
+    const bool keepsOrder = !m_transforms.IsLocked() && !m_hierarchyDirty && m_transformLevelStart.size() <= 2
+        && !t.parent.IsValid() && t.children.empty();
 
     // 부모에서 분리
     if (t.parent.IsValid() && HasTransform(t.parent))
@@ -488,24 +421,22 @@ void World::RemoveTransform(EntityId e)
     t.children.clear();
     t.parent = EntityId::Invalid();
 
-    // sparse-set swap-remove
-    const uint32_t denseIndex = m_transformSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_transforms.size() - 1;
+    if (HasCollider(e))
+        ++m_colliderVersion;
 
-    if (denseIndex != lastIndex)
-    {
-        // 마지막 요소를 denseIndex 위치로 옮김
-        m_transforms[denseIndex] = std::move(m_transforms[lastIndex]);
-        m_transformDenseEntities[denseIndex] = m_transformDenseEntities[lastIndex];
+    m_transforms.Remove(e);
+    ArchetypeRemove(e, ComponentType::Transform);
 
-        // sparse 갱신
-        EntityId movedEntity = m_transformDenseEntities[denseIndex];
-        m_transformSparse[movedEntity.index] = denseIndex;
+    if (keepsOrder)
+    {
+        m_transformParentDense.pop_back();
+        if (m_transforms.Empty()) m_transformLevelStart.clear();
+        else                      m_transformLevelStart.assign({ 0u, m_transforms.Size() });
+    }
+    else
+    {
+        m_hierarchyDirty = true;
     }
-
-    m_transforms.pop_back();
-    m_transformDenseEntities.pop_back();
-    m_transformSparse[e.index] = InvalidDenseIndex;
 }
 
 void World::SetParent(EntityId child, EntityId newParent)
@@ -541,16 +472,18 @@ void World::SetParent(EntityId child, EntityId newParent)
         np.children.push_back(child);
     }
 
-    // 계층 변경은 월드행렬 전체에 영향
-    MarkDirtyRecursive(child);
+    // 계층 변경은 월드행렬 전체에 영향 (자손은 UpdateTransforms에서 전파)
+    MarkDirty(child);
+    m_hierarchyDirty = true;
 }
 
 bool World::IsDescendant(EntityId node, EntityId potentialAncestor) const
 {
-    EntityId current = potentialAncestor;
+    // node에서 부모 방향으로 올라가며 potentialAncestor를 찾음
+    EntityId current = node;
     while (current.IsValid())
     {
-        if (current == node)
+        if (current == potentialAncestor)
             return true;
         if (!HasTransform(current))
             break;
@@ -560,16 +493,29 @@ bool World::IsDescendant(EntityId node, EntityId potentialAncestor) const
     return false;
 }
 
-void World::MarkDirtyRecursive(EntityId e)
+void World::SetStatic(EntityId e, bool isStatic)
 {
     if (!HasTransform(e)) return;
 
     TransformComponent& t = GetTransform(e);
-    if (!t.dirty)
-        t.dirty = true;
+    if (t.isStatic == isStatic)
+        return;
 
-    for (EntityId c : t.children)
-        MarkDirtyRecursive(c);
+    t.isStatic = isStatic;
+    ++m_staticVersion;
+}
+
+bool World::IsStatic(EntityId e) const
+{
+    const TransformComponent* t = m_transforms.TryGet(e);
+    return t && t->isStatic;
+}
+
+void World::MarkDirty(EntityId e)
+{
+    if (!HasTransform(e)) return;
+
+    GetTransform(e).dirty = true;
 }
 
 DirectX::XMMATRIX World::LocalMatrix(const TransformComponent& t) const
@@ -581,44 +527,157 @@ DirectX::XMMATRIX World::LocalMatrix(const TransformComponent& t) const
     return S * R * T; // row-vector 관례
 }
 
-void World::UpdateWorldRecursive(EntityId e, const DirectX::XMMATRIX& parentWorld)
+void World::RebuildTransformOrder()
 {
-    using namespace DirectX;
-    TransformComponent& t = GetTransform(e);
+    assert(!m_transforms.IsLocked());
 
-    XMMATRIX local = LocalMatrix(t);
-    XMMATRIX worldM = local * parentWorld;
+    const std::vector<TransformComponent>& ts = m_transforms.Data();
+    const uint32_t n = m_transforms.Size();
 
-    XMStoreFloat4x4(&t.world, worldM);
-    t.dirty = false;
+    // 1) BFS 순서 만들기 (dense index 목록): 루트들 → 자식들 → 손자들 ...
+    std::vector<uint32_t>& order = m_transformOrderScratch;
+    order.clear();
+    order.reserve(n);
 
-    for (EntityId c : t.children)
-        if (HasTransform(c)) UpdateWorldRecursive(c, worldM);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (!ts[i].parent.IsValid())
+            order.push_back(i);
+    }
+
+    m_transformLevelStart.clear();
+    m_transformLevelStart.push_back(0);
+
+    size_t levelBegin = 0;
+    while (levelBegin < order.size())
+    {
+        const size_t levelEnd = order.size();
+        for (size_t k = levelBegin; k < levelEnd; ++k)
+        {
+            for (EntityId c : ts[order[k]].children)
+            {
+                const uint32_t ci = m_transforms.DenseIndexOf(c);
+                if (ci != InvalidDenseIndex)
+                    order.push_back(ci);
+            }
+        }
+
+        m_transformLevelStart.push_back((uint32_t)levelEnd);
+        levelBegin = levelEnd;
+    }
+
+    assert(order.size() == n);
+
+    // 2) dense 배열을 그 순서로 재배치 (이미 정렬돼 있으면 생략)
+    bool identity = true;
+    for (uint32_t k = 0; k < n; ++k)
+    {
+        if (order[k] != k) { identity = false; break; }
+    }
+
+    // (Reorder가 옮겨진 엔티티마다 archetype slot도 갱신)
+    if (!identity)
+        m_transforms.Reorder(order);
+
+    // 3) 부모 dense index 캐시 (부모는 항상 자기보다 앞쪽 레벨)
+    m_transformParentDense.resize(n);
+    for (uint32_t k = 0; k < n; ++k)
+    {
+        const EntityId p = ts[k].parent;
+        m_transformParentDense[k] = p.IsValid() ? m_transforms.DenseIndexOf(p) : InvalidDenseIndex;
+    }
+
+    if (n == 0)
+        m_transformLevelStart.clear();
+
+    m_hierarchyDirty = false;
+}
+
+void World::UpdateTransformRange(uint32_t begin, uint32_t end)
+{
+    // 같은 depth 구간만 받음: 부모(이전 레벨)는 이미 끝났고, 쓰는 건 자기 자신뿐
+    std::vector<TransformComponent>& ts = m_transforms.Data();
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        TransformComponent& t = ts[i];
+        const uint32_t p = m_transformParentDense[i];
+
+        if (p == InvalidDenseIndex)
+        {
+            if (t.dirty)
+                XMStoreFloat4x4(&t.world, LocalMatrix(t));
+            continue;
+        }
+
+        const TransformComponent& pt = ts[p];
+        if (pt.dirty)
+            t.dirty = true; // flag sweep: 부모 dirty → 자식 dirty
+
+        if (t.dirty)
+            XMStoreFloat4x4(&t.world, LocalMatrix(t) * XMLoadFloat4x4(&pt.world));
+    }
 }
 
 void World::UpdateTransforms()
 {
-    // 루트들부터 갱신 (parent가 invalid인 transform)
-    const XMMATRIX I = XMMatrixIdentity();
+    if (m_hierarchyDirty)
+        RebuildTransformOrder();
 
-    for (size_t i = 0; i < m_transformDenseEntities.size(); ++i)
+    // depth 순서대로: 레벨 안에서는 병렬 가능, 레벨 사이는 순차(부모가 먼저 끝나야 함)
+    const uint32_t levels = GetTransformDepthCount();
+    for (uint32_t level = 0; level < levels; ++level)
     {
-        EntityId e = m_transformDenseEntities[i];
-        if (!HasTransform(e)) continue;
+        const uint32_t begin = m_transformLevelStart[level];
+        const uint32_t end = m_transformLevelStart[level + 1];
+        const uint32_t count = end - begin;
 
-        const TransformComponent& t = GetTransform(e);
-        if (!t.parent.IsValid() && t.dirty)
+        if (m_jobs && count >= TransformParallelMin)
         {
-            UpdateWorldRecursive(e, I);
+            m_jobs->ParallelFor(count, TransformParallelGrain, [this, begin](uint32_t b, uint32_t e)
+                {
+                    UpdateTransformRange(begin + b, begin + e);
+                });
+        }
+        else
+        {
+            UpdateTransformRange(begin, end);
         }
     }
 
+    // 자식 전파가 다 끝난 뒤에 dirty 해제 (static인데 움직인 건 따로 모아 둠 → 렌더 BVH refit용)
+    // world가 바뀐 mesh 엔티티는 렌더 변경 목록에 → RenderScene이 그 proxy만 갱신
+    // collider가 움직였으면 물리 쿼리 트리도 낡음 → collider version 증가
+    std::vector<TransformComponent>& data = m_transforms.Data();
+    const std::vector<EntityId>& ents = m_transforms.Entities();
+    bool colliderMoved = false;
+    for (uint32_t i = 0; i < (uint32_t)data.size(); ++i)
+    {
+        TransformComponent& t = data[i];
+        if (t.dirty && ents[i].IsValid())
+        {
+            if (t.isStatic)
+                m_movedStatic.push_back(ents[i]);
+            MarkRenderChanged(ents[i], RenderChangeFlags::Transform);
+            colliderMoved = colliderMoved || m_colliders.Has(ents[i]);
+        }
+        t.dirty = false;
+    }
+    if (colliderMoved)
+        ++m_colliderVersion;
+
     m_transformUpdatedFrame = m_frameIndex;
 }
 
 void World::BeginFrame()
 {
     ++m_frameIndex;
+    m_movedStatic.clear();
+
+    // 렌더 변경 로그: 지난 프레임 것까지만 남김
+    const size_t drop = (size_t)(m_renderChangeFrameStart - m_renderChangeBase);
+    m_renderChanges.erase(m_renderChanges.begin(), m_renderChanges.begin() + drop);
+    m_renderChangeBase = m_renderChangeFrameStart;
+    m_renderChangeFrameStart = GetRenderChangeSerial();
 }
 
 bool World::TransformsUpdatedThisFrame() const
@@ -626,10 +685,101 @@ bool World::TransformsUpdatedThisFrame() const
     return m_transformUpdatedFrame == m_frameIndex;
 }
 
-void World::EnsureScriptSparseSize(uint32_t entityIndex)
+void World::SetArchetypeStorageEnabled(bool enabled)
+{
+    if (m_archetypeEnabled == enabled)
+        return;
+
+    m_archetypeEnabled = enabled;
+    m_archetypes.Clear();
+
+    if (!enabled)
+        return;
+
+    // 현재 sparse set 내용으로 archetype 인덱스 구성
+    auto addAll = [this](const std::vector<EntityId>& ents, ComponentType t)
+        {
+            for (uint32_t di = 0; di < (uint32_t)ents.size(); ++di)
+            {
+                if (IsAlive(ents[di]))
+                    m_archetypes.OnAdd(ents[di], t, di);
+            }
+        };
+
+    addAll(m_transforms.Entities(), ComponentType::Transform);
+    addAll(m_meshes.Entities(), ComponentType::Mesh);
+    addAll(m_materials.Entities(), ComponentType::Material);
+    addAll(m_cameras.Entities(), ComponentType::Camera);
+    addAll(m_rigidBodies.Entities(), ComponentType::RigidBody);
+    addAll(m_colliders.Entities(), ComponentType::Collider);
+    addAll(m_audioSources.Entities(), ComponentType::AudioSource);
+    addAll(m_lights.Entities(), ComponentType::Light);
+    addAll(m_uiElements.Entities(), ComponentType::UIElement);
+    addAll(m_scripts.Entities(), ComponentType::Script);
+}
+
+void World::ArchetypeAdd(EntityId e, ComponentType t, uint32_t slot)
 {
-    if (m_scriptSparse.size() <= entityIndex)
-		m_scriptSparse.resize(entityIndex + 1, InvalidDenseIndex);
+    if (!m_archetypeEnabled) return;
+
+    if (m_iterationDepth > 0)
+        m_pendingArchetypeOps.push_back({ e, t, slot, true });
+    else
+        m_archetypes.OnAdd(e, t, slot);
+}
+
+void World::ArchetypeRemove(EntityId e, ComponentType t)
+{
+    if (!m_archetypeEnabled) return;
+
+    if (m_iterationDepth > 0)
+        m_pendingArchetypeOps.push_back({ e, t, 0, false });
+    else
+        m_archetypes.OnRemove(e, t);
+}
+
+void World::BeginIteration()
+{
+    ++m_iterationDepth;
+
+    m_transforms.Lock();
+    m_meshes.Lock();
+    m_materials.Lock();
+    m_cameras.Lock();
+    m_rigidBodies.Lock();
+    m_colliders.Lock();
+    m_audioSources.Lock();
+    m_lights.Lock();
+    m_uiElements.Lock();
+    m_scripts.Lock();
+}
+
+void World::EndIteration()
+{
+    assert(m_iterationDepth > 0);
+
+    // 1) 미룬 archetype 추가/제거를 일어난 순서대로 반영 (slot은 Lock 중이라 그대로 유효)
+    if (--m_iterationDepth == 0 && !m_pendingArchetypeOps.empty())
+    {
+        for (const PendingArchetypeOp& op : m_pendingArchetypeOps)
+        {
+            if (op.add) m_archetypes.OnAdd(op.entity, op.type, op.slot);
+            else        m_archetypes.OnRemove(op.entity, op.type);
+        }
+        m_pendingArchetypeOps.clear();
+    }
+
+    // 2) 지연 제거 swap-and-pop (옮겨진 slot은 OnComponentMoved로 반영)
+    m_transforms.Unlock();
+    m_meshes.Unlock();
+    m_materials.Unlock();
+    m_cameras.Unlock();
+    m_rigidBodies.Unlock();
+    m_colliders.Unlock();
+    m_audioSources.Unlock();
+    m_lights.Unlock();
+    m_uiElements.Unlock();
+    m_scripts.Unlock();
 }
 
 void World::RemoveScript(EntityId e, Behaviour* which)
@@ -643,23 +793,8 @@ void World::RemoveScript(EntityId e, Behaviour* which)
 
 void World::RemoveScriptComponent(EntityId e)
 {
-    if (!HasScript(e)) return;
-
-    const uint32_t di = m_scriptSparse[e.index];
-    const uint32_t last = (uint32_t)m_scripts.size() - 1;
-
-    if (di != last)
-    {
-        m_scripts[di] = std::move(m_scripts[last]);
-        m_scriptDenseEntities[di] = m_scriptDenseEntities[last];
-
-        EntityId moved = m_scriptDenseEntities[di];
-        m_scriptSparse[moved.index] = di;
-    }
-
-    m_scripts.pop_back();
-    m_scriptDenseEntities.pop_back();
-    m_scriptSparse[e.index] = InvalidDenseIndex;
+    if (m_scripts.Remove(e))
+        ArchetypeRemove(e, ComponentType::Script);
 }
 
 XMFLOAT3 World::GetLocalPosition(EntityId e) const
@@ -675,7 +810,7 @@ void World::SetLocalPosition(EntityId e, const XMFLOAT3& p)
 
     TransformComponent& t = GetTransform(e);
     t.position = p;
-    MarkDirtyRecursive(e);
+    MarkDirty(e);
 }
 
 XMFLOAT4 World::GetLocalRotation(EntityId e) const
@@ -691,7 +826,7 @@ void World::SetLocalRotation(EntityId e, const XMFLOAT4& q)
 
     TransformComponent& t = GetTransform(e);
     t.rotation = q;
-    MarkDirtyRecursive(e);
+    MarkDirty(e);
 }
 
 DirectX::XMFLOAT3 World::GetLocalRotationEuler(EntityId e) const
@@ -737,7 +872,7 @@ void World::SetLocalRotationEuler(EntityId e, const DirectX::XMFLOAT3& eulerRad)
     TransformComponent& t = GetTransform(e);
     XMStoreFloat4(&t.rotation, q);
 
-    MarkDirtyRecursive(e);
+    MarkDirty(e);
 }
 
 XMFLOAT3 World::GetLocalScale(EntityId e) const
@@ -753,7 +888,7 @@ void World::SetLocalScale(EntityId e, const XMFLOAT3& s)
 
     TransformComponent& t = GetTransform(e);
     t.scale = s;
-    MarkDirtyRecursive(e);
+    MarkDirty(e);
 }
 
 void World::TranslateLocal(EntityId e, const XMFLOAT3& delta)
@@ -763,7 +898,7 @@ void World::TranslateLocal(EntityId e, const XMFLOAT3& delta)
     t.position.x += delta.x;
     t.position.y += delta.y;
     t.position.z += delta.z;
-    MarkDirtyRecursive(e);
+    MarkDirty(e);
 }
 
 XMFLOAT4X4 World::GetWorldMatrix(EntityId e) const
@@ -799,78 +934,41 @@ XMFLOAT3 World::GetWorldPosition(EntityId e) const
 // Rigidbody (dense/sparse) - World.cpp 새 함수
 // ================================
 
-void World::EnsureRigidBodySparseSize(uint32_t entityIndex)
-{
-    if (m_rigidBodySparse.size() <= entityIndex)
-        m_rigidBodySparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 void World::AddRigidBody(EntityId e, const RigidBodyComponent& comp)
 {
     if (!IsAlive(e)) return;
-    EnsureRigidBodySparseSize(e.index);
 
-    // 이미 있으면 갱신(덮어쓰기)
-    if (m_rigidBodySparse[e.index] != InvalidDenseIndex)
-    {
-        const uint32_t di = m_rigidBodySparse[e.index];
-        m_rigidBodies[di] = comp;
-        return;
-    }
-
-    const uint32_t denseIndex = (uint32_t)m_rigidBodies.size();
-    m_rigidBodySparse[e.index] = denseIndex;
-    m_rigidBodyDenseEntities.push_back(e);
-    m_rigidBodies.push_back(comp);
+    bool added = false;
+    RigidBodyComponent& dst = m_rigidBodies.Emplace(e, &added, comp);
+    if (added)
+        ArchetypeAdd(e, ComponentType::RigidBody, m_rigidBodies.Size() - 1);
+    else
+        dst = comp; // 이미 있으면 갱신(덮어쓰기)
+    ++m_colliderVersion; // static/dynamic 트리가 바뀔 수 있음
 }
 
 bool World::HasRigidBody(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_rigidBodySparse.size()) return false;
-
-    const uint32_t di = m_rigidBodySparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_rigidBodyDenseEntities.size()) return false;
-    return m_rigidBodyDenseEntities[di] == e;
+    return m_rigidBodies.Has(e);
 }
 
 RigidBodyComponent& World::GetRigidBody(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasRigidBody(e));
-#endif
-    return m_rigidBodies[m_rigidBodySparse[e.index]];
+    return m_rigidBodies.Get(e);
 }
 
 const RigidBodyComponent& World::GetRigidBody(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasRigidBody(e));
-#endif
-    return m_rigidBodies[m_rigidBodySparse[e.index]];
+    return m_rigidBodies.Get(e);
 }
 
 void World::RemoveRigidBody(EntityId e)
 {
-    if (!HasRigidBody(e)) return;
-
-    const uint32_t denseIndex = m_rigidBodySparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_rigidBodies.size() - 1;
-
-    if (denseIndex != lastIndex)
+    if (m_rigidBodies.Remove(e))
     {
-        m_rigidBodies[denseIndex] = std::move(m_rigidBodies[lastIndex]);
-        m_rigidBodyDenseEntities[denseIndex] = m_rigidBodyDenseEntities[lastIndex];
-
-        EntityId movedEntity = m_rigidBodyDenseEntities[denseIndex];
-        EnsureRigidBodySparseSize(movedEntity.index);
-        m_rigidBodySparse[movedEntity.index] = denseIndex;
+        ArchetypeRemove(e, ComponentType::RigidBody);
+        ++m_colliderVersion;
     }
-
-    m_rigidBodies.pop_back();
-    m_rigidBodyDenseEntities.pop_back();
-    m_rigidBodySparse[e.index] = InvalidDenseIndex;
 }
 
 
@@ -878,78 +976,41 @@ void World::RemoveRigidBody(EntityId e)
 // Collider (dense/sparse) - World.cpp 새 함수
 // ================================
 
-void World::EnsureColliderSparseSize(uint32_t entityIndex)
-{
-    if (m_colliderSparse.size() <= entityIndex)
-        m_colliderSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
 void World::AddCollider(EntityId e, const ColliderComponent& comp)
 {
     if (!IsAlive(e)) return;
-    EnsureColliderSparseSize(e.index);
 
-    // 이미 있으면 갱신(덮어쓰기)
-    if (m_colliderSparse[e.index] != InvalidDenseIndex)
-    {
-        const uint32_t di = m_colliderSparse[e.index];
-        m_colliders[di] = comp;
-        return;
-    }
-
-    const uint32_t denseIndex = (uint32_t)m_colliders.size();
-    m_colliderSparse[e.index] = denseIndex;
-    m_colliderDenseEntities.push_back(e);
-    m_colliders.push_back(comp);
+    bool added = false;
+    ColliderComponent& dst = m_colliders.Emplace(e, &added, comp);
+    if (added)
+        ArchetypeAdd(e, ComponentType::Collider, m_colliders.Size() - 1);
+    else
+        dst = comp; // 이미 있으면 갱신(덮어쓰기)
+    ++m_colliderVersion;
 }
 
 bool World::HasCollider(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_colliderSparse.size()) return false;
-
-    const uint32_t di = m_colliderSparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_colliderDenseEntities.size()) return false;
-    return m_colliderDenseEntities[di] == e;
+    return m_colliders.Has(e);
 }
 
 ColliderComponent& World::GetCollider(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasCollider(e));
-#endif
-    return m_colliders[m_colliderSparse[e.index]];
+    return m_colliders.Get(e);
 }
 
 const ColliderComponent& World::GetCollider(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasCollider(e));
-#endif
-    return m_colliders[m_colliderSparse[e.index]];
+    return m_colliders.Get(e);
 }
 
 void World::RemoveCollider(EntityId e)
 {
-    if (!HasCollider(e)) return;
-
-    const uint32_t denseIndex = m_colliderSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_colliders.size() - 1;
-
-    if (denseIndex != lastIndex)
+    if (m_colliders.Remove(e))
     {
-        m_colliders[denseIndex] = std::move(m_colliders[lastIndex]);
-        m_colliderDenseEntities[denseIndex] = m_colliderDenseEntities[lastIndex];
-
-        EntityId movedEntity = m_colliderDenseEntities[denseIndex];
-        EnsureColliderSparseSize(movedEntity.index);
-        m_colliderSparse[movedEntity.index] = denseIndex;
+        ArchetypeRemove(e, ComponentType::Collider);
+        ++m_colliderVersion;
     }
-
-    m_colliders.pop_back();
-    m_colliderDenseEntities.pop_back();
-    m_colliderSparse[e.index] = InvalidDenseIndex;
 }
 
 void World::PushCollisionEvent(const CollisionEvent& ev)
@@ -963,19 +1024,51 @@ void World::DrainCollisionEvents(std::vector<CollisionEvent>& out)
     out.swap(m_collisionEvents); // 빠르게 넘기고 내부 비움
 }
 
-ScriptComponent& World::EnsureScriptComponent(EntityId e)
+void World::MarkRenderChanged(EntityId e, uint32_t flags)
 {
-    EnsureScriptSparseSize(e.index);
+    // 그릴 게 없는 엔티티는 기록 안 함 (Mesh 제거 시점엔 pool에서 이미 빠졌으므로 Mesh flag는 예외)
+    if (!e.IsValid() || (!(flags & RenderChangeFlags::Mesh) && !m_meshes.Has(e)))
+        return;
 
-    uint32_t di = m_scriptSparse[e.index];
-    if (di != InvalidDenseIndex)
-        return m_scripts[di];
+    if (m_renderChangeSerialOf.size() <= e.index)
+        m_renderChangeSerialOf.resize(e.index + 1, UINT64_MAX);
 
-    di = (uint32_t)m_scripts.size();
-    m_scriptSparse[e.index] = di;
-    m_scriptDenseEntities.push_back(e);
-    m_scripts.emplace_back();          // empty ScriptComponent
-    return m_scripts.back();
+    // 아직 아무도 안 읽은 항목이고 같은 엔티티(generation까지)면 합침
+    uint64_t& serial = m_renderChangeSerialOf[e.index];
+    if (serial != UINT64_MAX && serial >= m_renderChangeBase && serial >= m_renderChangeMergeFrom)
+    {
+        RenderChange& c = m_renderChanges[(size_t)(serial - m_renderChangeBase)];
+        if (c.entity == e)
+        {
+            c.flags |= flags;
+            return;
+        }
+    }
+
+    serial = GetRenderChangeSerial();
+    m_renderChanges.push_back(RenderChange{ e, flags });
+}
+
+bool World::CollectRenderChanges(uint64_t since, std::vector<RenderChange>& out) const
+{
+    out.clear();
+
+    const uint64_t end = GetRenderChangeSerial();
+    if (since < m_renderChangeBase || since > end)
+        return false;
+
+    out.assign(m_renderChanges.begin() + (size_t)(since - m_renderChangeBase), m_renderChanges.end());
+    m_renderChangeMergeFrom = end; // 읽힌 항목에 flags를 더하면 읽은 쪽이 놓침
+    return true;
+}
+
+ScriptComponent& World::EnsureScriptComponent(EntityId e)
+{
+    bool added = false;
+    ScriptComponent& sc = m_scripts.Emplace(e, &added); // 없으면 empty ScriptComponent
+    if (added)
+        ArchetypeAdd(e, ComponentType::Script, m_scripts.Size() - 1);
+    return sc;
 }
 
 void World::AddScript(EntityId e, std::unique_ptr<Behaviour> b, bool enabled)
@@ -990,34 +1083,24 @@ void World::AddScript(EntityId e, std::unique_ptr<Behaviour> b, bool enabled)
 
 bool World::HasScript(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_scriptSparse.size()) return false;
-
-    const uint32_t di = m_scriptSparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_scriptDenseEntities.size()) return false;
-	return m_scriptDenseEntities[di] == e;
+    return m_scripts.Has(e);
 }
 
 ScriptComponent& World::GetScript(EntityId e)
 {
-    #if defined(_DEBUG)
-	assert(HasScript(e));
-    #endif
-    const uint32_t denseIndex = m_scriptSparse[e.index];
-	return m_scripts[denseIndex];
+    return m_scripts.Get(e);
 }
 
 void World::FlushScripts()
 {
     // ScriptComponent를 가진 엔티티만 순회
-    for (size_t di = 0; di < m_scripts.size(); ++di)
+    for (size_t di = 0; di < m_scripts.Size(); ++di)
     {
-        EntityId e = m_scriptDenseEntities[di];
+        EntityId e = m_scripts.Entities()[di];
         if (!IsAlive(e)) continue;
         if (IsPendingDestroy(e)) continue;
 
-        auto& sc = m_scripts[di];
+        auto& sc = m_scripts.Data()[di];
 
         // 1) pendingRemove 처리 (OnDestroy 1회 보장)
         if (!sc.pendingRemove.empty())
@@ -1074,214 +1157,102 @@ void World::FlushScripts()
     }
 }
 
-void World::EnsureAudioSourceSparseSize(uint32_t entityIndex)
-{
-    if (m_audioSourceSparse.size() <= entityIndex)
-        m_audioSourceSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
-
-
-void World::EnsureLightSparseSize(uint32_t entityIndex)
-{
-    if (m_lightSparse.size() <= entityIndex)
-        m_lightSparse.resize(entityIndex + 1, InvalidDenseIndex);
-}
 
 void World::AddAudioSource(EntityId e, const AudioSourceComponent& c)
 {
     if (!IsAlive(e)) return;
-    EnsureAudioSourceSparseSize(e.index);
-
-    // 이미 있으면 갱신(덮어쓰기)
-    if (m_audioSourceSparse[e.index] != InvalidDenseIndex)
-    {
-        const uint32_t di = m_audioSourceSparse[e.index];
-        m_audioSources[di] = c;
-        return;
-    }
 
-    const uint32_t denseIndex = (uint32_t)m_audioSources.size();
-    m_audioSourceSparse[e.index] = denseIndex;
-    m_audioSourceDenseEntities.push_back(e);
-    m_audioSources.push_back(c);
+    bool added = false;
+    AudioSourceComponent& dst = m_audioSources.Emplace(e, &added, c);
+    if (added)
+        ArchetypeAdd(e, ComponentType::AudioSource, m_audioSources.Size() - 1);
+    else
+        dst = c; // 이미 있으면 갱신(덮어쓰기)
 }
 
 bool World::HasAudioSource(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_audioSourceSparse.size()) return false;
-
-    const uint32_t di = m_audioSourceSparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_audioSourceDenseEntities.size()) return false;
-    return m_audioSourceDenseEntities[di] == e;
+    return m_audioSources.Has(e);
 }
 
 AudioSourceComponent& World::GetAudioSource(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasAudioSource(e));
-#endif
-    return m_audioSources[m_audioSourceSparse[e.index]];
+    return m_audioSources.Get(e);
 }
 
 const AudioSourceComponent& World::GetAudioSource(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasAudioSource(e));
-#endif
-    return m_audioSources[m_audioSourceSparse[e.index]];
+    return m_audioSources.Get(e);
 }
 
 void World::RemoveAudioSource(EntityId e)
 {
-    if (!HasAudioSource(e)) return;
-
-    const uint32_t denseIndex = m_audioSourceSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_audioSources.size() - 1;
-
-    if (denseIndex != lastIndex)
-    {
-        m_audioSources[denseIndex] = std::move(m_audioSources[lastIndex]);
-        m_audioSourceDenseEntities[denseIndex] = m_audioSourceDenseEntities[lastIndex];
-
-        EntityId movedEntity = m_audioSourceDenseEntities[denseIndex];
-        EnsureAudioSourceSparseSize(movedEntity.index);
-        m_audioSourceSparse[movedEntity.index] = denseIndex;
-    }
-
-    m_audioSources.pop_back();
-    m_audioSourceDenseEntities.pop_back();
-    m_audioSourceSparse[e.index] = InvalidDenseIndex;
+    if (m_audioSources.Remove(e))
+        ArchetypeRemove(e, ComponentType::AudioSource);
 }
 
 void World::AddLight(EntityId e, const LightComponent& c)
 {
-	if (!IsAlive(e)) return;
-    EnsureLightSparseSize(e.index);
-
-    if (HasLight(e))
-    {
-        m_lights[m_lightSparse[e.index]] = c;
-        return;
-    }
+    if (!IsAlive(e)) return;
 
-    const uint32_t denseIndex = (uint32_t)m_lights.size();
-    m_lights.push_back(c);
-    m_lightDenseEntities.push_back(e);
-    m_lightSparse[e.index] = denseIndex;
+    bool added = false;
+    LightComponent& dst = m_lights.Emplace(e, &added, c);
+    if (added)
+        ArchetypeAdd(e, ComponentType::Light, m_lights.Size() - 1);
+    else
+        dst = c; // 이미 있으면 갱신(덮어쓰기)
 }
 
 bool World::HasLight(EntityId e) const
 {
-    if (e.index >= m_lightSparse.size()) return false;
-    const uint32_t denseIndex = m_lightSparse[e.index];
-    if (denseIndex == InvalidDenseIndex) return false;
-    if (denseIndex >= m_lightDenseEntities.size()) return false;
-    return m_lightDenseEntities[denseIndex].index == e.index && m_lightDenseEntities[denseIndex].generation == e.generation;
+    return m_lights.Has(e);
 }
 
 LightComponent& World::GetLight(EntityId e)
 {
-    return m_lights[m_lightSparse[e.index]];
+    return m_lights.Get(e);
 }
 
 const LightComponent& World::GetLight(EntityId e) const
 {
-    return m_lights[m_lightSparse[e.index]];
+    return m_lights.Get(e);
 }
 
 void World::RemoveLight(EntityId e)
 {
-    if (!HasLight(e)) return;
-
-    const uint32_t denseIndex = m_lightSparse[e.index];
-    const uint32_t last = (uint32_t)m_lights.size() - 1;
-
-    if (denseIndex != last)
-    {
-        m_lights[denseIndex] = m_lights[last];
-        m_lightDenseEntities[denseIndex] = m_lightDenseEntities[last];
-        m_lightSparse[m_lightDenseEntities[denseIndex].index] = denseIndex;
-    }
-
-    m_lights.pop_back();
-    m_lightDenseEntities.pop_back();
-    m_lightSparse[e.index] = InvalidDenseIndex;
-}
-
-const std::vector<LightComponent>& World::GetLightsDense() const { return m_lights; }
-
-void World::EnsureUIElementSparseSize(uint32_t entityIndex)
-{
-    if (m_uiElementSparse.size() <= entityIndex)
-        m_uiElementSparse.resize(entityIndex + 1, InvalidDenseIndex);
+    if (m_lights.Remove(e))
+        ArchetypeRemove(e, ComponentType::Light);
 }
 
 void World::AddUIElement(EntityId e, const UIElementComponent& c)
 {
     if (!IsAlive(e)) return;
-    EnsureUIElementSparseSize(e.index);
 
-    // 이미 있으면 갱신(덮어쓰기)
-    if (m_uiElementSparse[e.index] != InvalidDenseIndex)
-    {
-        const uint32_t di = m_uiElementSparse[e.index];
-        m_uiElements[di] = c;
-        return;
-    }
-
-    const uint32_t denseIndex = (uint32_t)m_uiElements.size();
-    m_uiElementSparse[e.index] = denseIndex;
-    m_uiElementDenseEntities.push_back(e);
-    m_uiElements.push_back(c);
+    bool added = false;
+    UIElementComponent& dst = m_uiElements.Emplace(e, &added, c);
+    if (added)
+        ArchetypeAdd(e, ComponentType::UIElement, m_uiElements.Size() - 1);
+    else
+        dst = c; // 이미 있으면 갱신(덮어쓰기)
 }
 
 bool World::HasUIElement(EntityId e) const
 {
-    if (!IsAlive(e)) return false;
-    if (e.index >= m_uiElementSparse.size()) return false;
-
-    const uint32_t di = m_uiElementSparse[e.index];
-    if (di == InvalidDenseIndex) return false;
-    if (di >= m_uiElementDenseEntities.size()) return false;
-    return m_uiElementDenseEntities[di] == e;
+    return m_uiElements.Has(e);
 }
 
 UIElementComponent& World::GetUIElement(EntityId e)
 {
-#if defined(_DEBUG)
-    assert(HasUIElement(e));
-#endif
-    return m_uiElements[m_uiElementSparse[e.index]];
+    return m_uiElements.Get(e);
 }
 
 const UIElementComponent& World::GetUIElement(EntityId e) const
 {
-#if defined(_DEBUG)
-    assert(HasUIElement(e));
-#endif
-    return m_uiElements[m_uiElementSparse[e.index]];
+    return m_uiElements.Get(e);
 }
 
 void World::RemoveUIElement(EntityId e)
 {
-    if (!HasUIElement(e)) return;
-
-    const uint32_t denseIndex = m_uiElementSparse[e.index];
-    const uint32_t lastIndex = (uint32_t)m_uiElements.size() - 1;
-
-    if (denseIndex != lastIndex)
-    {
-        m_uiElements[denseIndex] = std::move(m_uiElements[lastIndex]);
-        m_uiElementDenseEntities[denseIndex] = m_uiElementDenseEntities[lastIndex];
-
-        EntityId movedEntity = m_uiElementDenseEntities[denseIndex];
-        EnsureUIElementSparseSize(movedEntity.index);
-        m_uiElementSparse[movedEntity.index] = denseIndex;
-    }
-
-    m_uiElements.pop_back();
-    m_uiElementDenseEntities.pop_back();
-    m_uiElementSparse[e.index] = InvalidDenseIndex;
+    if (m_uiElements.Remove(e))
+        ArchetypeRemove(e, ComponentType::UIElement);
 }
\ No newline at end of file
@@ -11,15 +11,24 @@
 #include "RigidBodyComponent.h"
 #include "ColliderComponent.h"
 #include "CollisionEvents.h"
+#include "RenderChange.h"
 #include "AudioSourceComponent.h"
 #include "LightComponent.h"
 #include "UIElementComponent.h"
 #include "ScriptComponent.h"
+#include "ArchetypeStorage.h"
+#include "ComponentPool.h"
+
+class JobSystem;
 
 class World
 {
 public:
-    World() = default;
+    World();
+
+    // Ʈ pool this ݹ user  ־  
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
 
     EntityId CreateEntity(const std::string& name = "");
     bool IsAlive(EntityId e) const;
@@ -30,6 +39,9 @@ public:
 
     uint32_t AliveCount() const { return m_aliveCount; }
 
+    // World ٸ  ( ּҿ   World : ý ĳ ȿȭ)
+    uint32_t GetInstanceId() const { return m_instanceId; }
+
     // --- Transform API ---
     void AddTransform(EntityId e);
     bool HasTransform(EntityId e) const;
@@ -42,8 +54,24 @@ public:
     bool IsDescendant(EntityId node, EntityId potentialAncestor) const;
 
     //   ȣ(Ǵ ʿ  ȣ): dirty Ʈ 
+    // - transform dense 迭 (BFS)  ĵǾ : [depth 0 Ʈ][depth 1]...[depth N]
+    // - depth    ȸ: θ dirty ڽĵ dirty(flag sweep)  world = local * parentWorld
+    // -  depth 峢  ̶ JobSystem  depth   ó
     void UpdateTransforms();
 
+    // ϸ UpdateTransforms ū depth  ķ ó (nullptr = )
+    void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+    uint32_t GetTransformDepthCount() const { return m_transformLevelStart.empty() ? 0 : (uint32_t)m_transformLevelStart.size() - 1; }
+
+    // --- Static ǥ (  ̴ ü:   BVH   ְ ) ---
+    // - static  ٲ(SetStatic, static ƼƼ mesh ߰/, transform ) version   BVH 
+    // - staticε ̹  world ŵ ƼƼ GetMovedStaticEntities   BVH refit (BeginFrame )
+    void SetStatic(EntityId e, bool isStatic);
+    bool IsStatic(EntityId e) const;
+    uint32_t GetStaticVersion() const { return m_staticVersion; }
+    const std::vector<EntityId>& GetMovedStaticEntities() const { return m_movedStatic; }
+
     //  
     void BeginFrame();
     bool TransformsUpdatedThisFrame() const;
@@ -61,6 +89,10 @@ private:
     std::unordered_map<std::string, EntityId> m_nameToEntity;
 
     uint32_t m_aliveCount = 0;
+    uint32_t m_instanceId = NextInstanceId();
+    uint32_t m_colliderVersion = 0;      // GetColliderVersion
+
+    static uint32_t NextInstanceId();
 
 	std::vector<EntityId> m_pendingDestroy; //  ı 
 
@@ -73,84 +105,97 @@ private:
 
     void RemoveNameMapping(EntityId e);
 
-    // --- Transform Storage (sparse set) ---
     static constexpr uint32_t InvalidDenseIndex = 0xFFFFFFFFu;
 
-    std::vector<uint32_t> m_transformSparse;        // [entity.index] -> denseIndex or Invalid
-    std::vector<EntityId> m_transformDenseEntities; // denseIndex -> EntityId
-    std::vector<TransformComponent> m_transforms;   // denseIndex -> TransformComponent
+    // --- Component Storage (ComponentPool: paged sparse + dense swap-and-pop) ---
+    ComponentPool<TransformComponent>   m_transforms;
+    ComponentPool<MeshComponent>        m_meshes;
+    ComponentPool<MaterialComponent>    m_materials;
+    ComponentPool<CameraComponent>      m_cameras;
+    ComponentPool<RigidBodyComponent>   m_rigidBodies;
+    ComponentPool<ColliderComponent>    m_colliders;
+    ComponentPool<AudioSourceComponent> m_audioSources;
+    ComponentPool<LightComponent>       m_lights;
+    ComponentPool<UIElementComponent>   m_uiElements;
+    ComponentPool<ScriptComponent>      m_scripts;
+
+    // pool dense ġ ٲ archetype ε ݿ
+    template<ComponentType Type>
+    static void OnComponentMoved(void* user, EntityId moved, uint32_t newDense)
+    {
+        static_cast<World*>(user)->ArchetypeMoved(moved, Type, newDense);
+    }
 
-    void EnsureTransformSparseSize(uint32_t entityIndex);
+    // Ʈ Ÿ  pool  (ForEach/View)
+    template<class T> static constexpr ComponentType TypeOf();
+    template<class T> ComponentPool<T>& Pool();
+    template<class T> const ComponentPool<T>& Pool() const;
 
     void RemoveTransform(EntityId e);
-
-    void MarkDirtyRecursive(EntityId e);
-
-    DirectX::XMMATRIX LocalMatrix(const TransformComponent& t) const;
-    void UpdateWorldRecursive(EntityId e, const DirectX::XMMATRIX& parentWorld);
-
-    // --- Mesh Storage (sparse set) ---
-    std::vector<uint32_t> m_meshSparse;
-    std::vector<EntityId> m_meshDenseEntities;
-    std::vector<MeshComponent> m_meshes;
-    void EnsureMeshSparseSize(uint32_t entityIndex);
     void RemoveMesh(EntityId e);
-
-    // --- Material Storage (sparse set) ---
-    std::vector<uint32_t> m_materialSparse;
-    std::vector<EntityId> m_materialDenseEntities;
-    std::vector<MaterialComponent> m_materials;
-    void EnsureMaterialSparseSize(uint32_t entityIndex);
     void RemoveMaterial(EntityId e);
-
-    // --- Camera Storage (sparse set) ---
-    std::vector<uint32_t> m_cameraSparse;
-    std::vector<EntityId> m_cameraDenseEntities;
-    std::vector<CameraComponent> m_cameras;
-    void EnsureCameraSparseSize(uint32_t entityIndex);
     void RemoveCamera(EntityId e);
+	void RemoveScript(EntityId e, Behaviour* which);
+
+    // ڱ ڽŸ dirty ǥ (ڽ Ĵ UpdateTransforms flag sweep)
+    void MarkDirty(EntityId e);
 
-    // Rigidbody storage (dense/sparse)
-    std::vector<RigidBodyComponent> m_rigidBodies;
-    std::vector<EntityId> m_rigidBodyDenseEntities;
-    std::vector<uint32_t> m_rigidBodySparse;
+    DirectX::XMMATRIX LocalMatrix(const TransformComponent& t) const;
 
-    // Collider storage
-    std::vector<ColliderComponent> m_colliders;
-    std::vector<EntityId> m_colliderDenseEntities;
-    std::vector<uint32_t> m_colliderSparse;
+    // --- Transform   (depth-sorted) ---
+    // AddTransform/RemoveTransform/SetParent  m_hierarchyDirty   UpdateTransforms dense 迭 
+    bool m_hierarchyDirty = false;
+    std::vector<uint32_t> m_transformParentDense;   // denseIndex -> θ denseIndex (Invalid = Ʈ)
+    std::vector<uint32_t> m_transformLevelStart;    // depth  denseIndex,  transform 
+    std::vector<uint32_t> m_transformOrderScratch;
 
-	// Collision Events
-    std::vector<CollisionEvent> m_collisionEvents;
+    JobSystem* m_jobs = nullptr;
+    static constexpr uint32_t TransformParallelMin = 2048; //    ̺  
+    static constexpr uint32_t TransformParallelGrain = 512;
 
-    // AudioSource storage (dense/sparse)
-    std::vector<AudioSourceComponent> m_audioSources;
-    std::vector<EntityId>            m_audioSourceDenseEntities;
-    std::vector<uint32_t>            m_audioSourceSparse;
+    void RebuildTransformOrder();
+    void UpdateTransformRange(uint32_t begin, uint32_t end);
 
-    void EnsureAudioSourceSparseSize(uint32_t entityIndex);
+    uint32_t m_staticVersion = 0;
+    std::vector<EntityId> m_movedStatic;
 
+    // --- Archetype storage (ɼ) ---
+    bool m_archetypeEnabled = false;
+    ArchetypeStorage m_archetypes;
 
-    // Light storage (dense/sparse)
-    std::vector<LightComponent>     m_lights;
-    std::vector<EntityId>           m_lightDenseEntities;
-    std::vector<uint32_t>           m_lightSparse;
+    // archetype ForEach  ߰/Ŵ  ŰǷ   ̷ٰ  ݿ
+    struct PendingArchetypeOp
+    {
+        EntityId entity;
+        ComponentType type;
+        uint32_t slot;
+        bool add;
+    };
+    uint32_t m_iterationDepth = 0;
+    std::vector<PendingArchetypeOp> m_pendingArchetypeOps;
 
-    void EnsureLightSparseSize(uint32_t entityIndex);
+    void ArchetypeAdd(EntityId e, ComponentType t, uint32_t slot);
+    void ArchetypeRemove(EntityId e, ComponentType t);
+    void ArchetypeMoved(EntityId e, ComponentType t, uint32_t slot) { if (m_archetypeEnabled) m_archetypes.OnSlotMoved(e, t, slot); }
 
-    // UIElement storage (dense/sparse)
-    std::vector<UIElementComponent> m_uiElements;
-    std::vector<EntityId>           m_uiElementDenseEntities;
-    std::vector<uint32_t>           m_uiElementSparse;
+    // archetype ForEach :  pool Lock(dense ġ ) / ̷ archetype  ݿ  Unlock
+    void BeginIteration();
+    void EndIteration();
 
-    void EnsureUIElementSparseSize(uint32_t entityIndex);
+    template<class Self, class... Ts, class Fn>
+    static void ForEachImpl(Self& self, Fn&& fn);
 
-	// Script storage (dense/sparse)
-    std::vector<ScriptComponent>    m_scripts;
-    std::vector<EntityId>           m_scriptDenseEntities;
-    std::vector<uint32_t>           m_scriptSparse;
-    void EnsureScriptSparseSize(uint32_t entityIndex);
-	void RemoveScript(EntityId e, Behaviour* which);
+	// Collision Events
+    std::vector<CollisionEvent> m_collisionEvents;
+
+    //   α: m_renderChanges[i] serial = m_renderChangeBase + i
+    // - BeginFrame     ׸  (  д  ׻  )
+    // -  ƼƼ  Collect  ׸̸ flags OR ħ (̹  ׸ ǵ帮 )
+    std::vector<RenderChange> m_renderChanges;
+    std::vector<uint64_t> m_renderChangeSerialOf;   // [entity.index]   ƼƼ  ׸ serial
+    uint64_t m_renderChangeBase = 0;
+    uint64_t m_renderChangeFrameStart = 0;          // ̹  BeginFrame  serial
+    mutable uint64_t m_renderChangeMergeFrom = 0;   //  Collect  serial ( ׸ ġ )
 
 public:
     // --- Transform Public API ---
@@ -177,6 +222,7 @@ public:
     bool HasMesh(EntityId e) const;
     MeshComponent& GetMesh(EntityId e);
     const MeshComponent& GetMesh(EntityId e) const;
+    const MeshComponent* TryGetMesh(EntityId e) const { return m_meshes.TryGet(e); }
 
     // --- Material API ---
     void AddMaterial(EntityId e, const MaterialComponent& m);
@@ -200,7 +246,7 @@ public:
     const AudioSourceComponent& GetAudioSource(EntityId e) const;
     void RemoveAudioSource(EntityId e);
 
-    const std::vector<EntityId>& GetAudioSourceEntities() const { return m_audioSourceDenseEntities; }
+    const std::vector<EntityId>& GetAudioSourceEntities() const { return m_audioSources.Entities(); }
 
     // --- Light API ---
     void AddLight(EntityId e, const LightComponent& c);
@@ -209,8 +255,8 @@ public:
     const LightComponent& GetLight(EntityId e) const;
     void RemoveLight(EntityId e);
 
-    const std::vector<EntityId>& GetLightEntities() const { return m_lightDenseEntities; }
-    const std::vector<LightComponent>& GetLightsDense() const;
+    const std::vector<EntityId>& GetLightEntities() const { return m_lights.Entities(); }
+    const std::vector<LightComponent>& GetLightsDense() const { return m_lights.Data(); }
 
     // --- UIElement API ---
     void AddUIElement(EntityId e, const UIElementComponent& c);
@@ -219,18 +265,35 @@ public:
     const UIElementComponent& GetUIElement(EntityId e) const;
     void RemoveUIElement(EntityId e);
 
-    const std::vector<EntityId>& GetUIElementEntities() const { return m_uiElementDenseEntities; }
+    const std::vector<EntityId>& GetUIElementEntities() const { return m_uiElements.Entities(); }
 
     // ---- Debug/Iteration ----
     // (ӽ) dense transform ƼƼ  ȯ(ý۵ ȸϱ  ʿ)
-    const std::vector<EntityId>& GetTransformEntities() const { return m_transformDenseEntities; }
+    const std::vector<EntityId>& GetTransformEntities() const { return m_transforms.Entities(); }
+    const std::vector<TransformComponent>& GetTransformsDense() const { return m_transforms.Data(); }
+
+    // ---- Ƽ Ʈ  ----
+    // Ts   ƼƼ fn(EntityId, Ts&...) ȣ
+    // - archetype storage : Ī archetype chunk  ȸ (dense index chunk ־ sparse ȸ )
+    // - : View<Ts...> (  pool )
+    // - ȸ  Ʈ ߰/ OK: Ŵ pool Lock , archetype  ȸ  ݿ
+    //   (ȸ  ߰ ƼƼ ̹ ȸ 湮   . ƼƼ ı RequestDestroy)
+    template<class... Ts, class Fn> void ForEach(Fn&& fn) { ForEachImpl<World, Ts...>(*this, fn); }
+    template<class... Ts, class Fn> void ForEach(Fn&& fn) const { ForEachImpl<const World, Ts...>(*this, fn); }
+
+    // sparse  View   (const T б )
+    template<class... Ts> View<Ts...> Query() { return View<Ts...>(Pool<std::remove_const_t<Ts>>()...); }
+
+    // Ѹ  sparse set  archetype ε ,  Add/Remove  
+    void SetArchetypeStorageEnabled(bool enabled);
+    bool IsArchetypeStorageEnabled() const { return m_archetypeEnabled; }
+    const ArchetypeStorage& GetArchetypeStorage() const { return m_archetypes; }
 
 	// ---- ı  ó ----
     void RequestDestroy(EntityId e);
     void FlushDestroy();
 
     // Rigidbody
-	void EnsureRigidBodySparseSize(uint32_t entityIndex);
     void AddRigidBody(EntityId e, const RigidBodyComponent& rb);
     bool HasRigidBody(EntityId e) const;
     RigidBodyComponent& GetRigidBody(EntityId e);
@@ -238,7 +301,6 @@ public:
 	void RemoveRigidBody(EntityId e);
 
     // Collider
-	void EnsureColliderSparseSize(uint32_t entityIndex);
     void AddCollider(EntityId e, const ColliderComponent& c);
     bool HasCollider(EntityId e) const;
     ColliderComponent& GetCollider(EntityId e);
@@ -246,19 +308,90 @@ public:
 	void RemoveCollider(EntityId e);
 
     //  ý ĺ  ȸ  ְ
-    const std::vector<EntityId>& GetColliderEntities() const { return m_colliderDenseEntities; }
+    const std::vector<EntityId>& GetColliderEntities() const { return m_colliders.Entities(); }
+
+    // Collider/RigidBody ߰, collider ƼƼ Transform , UpdateTransforms collider ƼƼ world ٲ 
+    //  PhysicsSystem scene query  Sync  Ʈ ٽ  ϴ Ǵ
+    // - GetCollider/GetRigidBody  ģ    ( Step ݿ)
+    uint32_t GetColliderVersion() const { return m_colliderVersion; }
 
     // Collision Events
     void PushCollisionEvent(const CollisionEvent& ev);
     void DrainCollisionEvents(std::vector<CollisionEvent>& out); // out ű  
 
+    // Render changes (RenderScene Ӹ о  ٲ proxy )
+    // - Mesh  ƼƼ . Add/Remove ڵ, GetMesh/GetMaterial/ForEach   MarkRenderChanged ˷ 
+    //   (non-const Get б⿡ ̹Ƿ ٸδ   )
+    // - д ʸ serial Ŀ    RenderSystem    World  
+    void MarkRenderChanged(EntityId e, uint32_t flags); // RenderChangeFlags 
+    uint64_t GetRenderChangeSerial() const { return m_renderChangeBase + m_renderChanges.size(); }
+
+    // [since, GetRenderChangeSerial())  out 
+    // since ̹  (  Ѱ  )̰ų ̷ ̸ false  д  ü ٽ  
+    bool CollectRenderChanges(uint64_t since, std::vector<RenderChange>& out) const;
+
 	// --- Script API ---
     ScriptComponent& EnsureScriptComponent(EntityId e);
     void AddScript(EntityId e, std::unique_ptr<Behaviour> b, bool enabled = true);
     bool HasScript(EntityId e) const;
     ScriptComponent& GetScript(EntityId e);
-    const std::vector<EntityId>& GetScriptEntities() const { return m_scriptDenseEntities; }
+    const std::vector<EntityId>& GetScriptEntities() const { return m_scripts.Entities(); }
     void FlushScripts();
     void RemoveScriptComponent(EntityId e);
     bool IsPendingDestroy(EntityId e) const;
 };
+
+// ---- Ʈ Ÿ  ----
+#define WORLD_COMPONENT_POOL(T, Type, pool) \
+    template<> constexpr ComponentType World::TypeOf<T>() { return ComponentType::Type; } \
+    template<> inline ComponentPool<T>& World::Pool<T>() { return pool; } \
+    template<> inline const ComponentPool<T>& World::Pool<T>() const { return pool; }
+
+WORLD_COMPONENT_POOL(TransformComponent, Transform, m_transforms)
+WORLD_COMPONENT_POOL(MeshComponent, Mesh, m_meshes)
+WORLD_COMPONENT_POOL(MaterialComponent, Material, m_materials)
+WORLD_COMPONENT_POOL(CameraComponent, Camera, m_cameras)
+WORLD_COMPONENT_POOL(RigidBodyComponent, RigidBody, m_rigidBodies)
+WORLD_COMPONENT_POOL(ColliderComponent, Collider, m_colliders)
+WORLD_COMPONENT_POOL(AudioSourceComponent, AudioSource, m_audioSources)
+WORLD_COMPONENT_POOL(LightComponent, Light, m_lights)
+WORLD_COMPONENT_POOL(UIElementComponent, UIElement, m_uiElements)
+WORLD_COMPONENT_POOL(ScriptComponent, Script, m_scripts)
+
+#undef WORLD_COMPONENT_POOL
+
+template<class Self, class... Ts, class Fn>
+void World::ForEachImpl(Self& self, Fn&& fn)
+{
+    static_assert(sizeof...(Ts) > 0, "ForEach needs at least one component type");
+    constexpr bool isConst = std::is_const_v<Self>;
+
+    if (!self.m_archetypeEnabled)
+    {
+        if constexpr (isConst) View<const Ts...>(self.template Pool<Ts>()...).Each(fn);
+        else                   View<Ts...>(self.template Pool<Ts>()...).Each(fn);
+        return;
+    }
+
+    constexpr ComponentMask required = (ComponentBit(TypeOf<Ts>()) | ...);
+
+    // const ȸ fn World ٲ   Lock ʿ
+    if constexpr (!isConst) self.BeginIteration();
+
+    self.m_archetypes.ForEachChunk(required, [&](const ArchetypeStorage::ChunkView& v)
+        {
+            for (uint32_t i = 0; i < v.count; ++i)
+            {
+                // ̹ ȸ  ŵ Ʈ(pool Invalid ڸ ) ǳʶ
+                if constexpr (!isConst)
+                {
+                    if (!(self.template Pool<Ts>().Entities()[v.slots[(uint32_t)TypeOf<Ts>()][i]].IsValid() && ...))
+                        continue;
+                }
+
+                fn(v.entities[i], self.template Pool<Ts>().Data()[v.slots[(uint32_t)TypeOf<Ts>()][i]]...);
+            }
+        });
+
+    if constexpr (!isConst) self.EndIteration();
+}
@@ -0,0 +1,133 @@
+﻿#include "TestFramework.h"
+#include "CommandRecordScheduler.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// CommandRecordScheduler: null backend로 청크 분할/녹화 순서 확인
+// - 청크별 "command list" = 녹화된 draw 번호 목록 → 청크 순서대로 이으면 0..n-1 그대로여야 함
+// - 청크마다 RecordChunk 정확히 한 번 (한 청크를 두 스레드가 나눠 녹화하지 않음)
+
+namespace
+{
+    struct NullBackend final : ICommandRecordBackend
+    {
+        std::vector<std::vector<uint32_t>> lists;
+        std::vector<std::atomic<int>> calls;
+        std::vector<std::thread::id> owner;
+
+        explicit NullBackend(uint32_t chunkCount)
+            : lists(chunkCount), calls(chunkCount), owner(chunkCount)
+        {
+        }
+
+        void RecordChunk(uint32_t chunkIndex, uint32_t first, uint32_t count) override
+        {
+            ++calls[chunkIndex];
+            owner[chunkIndex] = std::this_thread::get_id();
+            for (uint32_t i = first; i < first + count; ++i)
+            {
+                lists[chunkIndex].push_back(i);
+                // 청크 사이 실행이 실제로 겹치도록 약간의 일
+                volatile uint32_t sink = 0;
+                for (uint32_t k = 0; k < 32; ++k)
+                    sink = sink + k;
+            }
+        }
+    };
+
+    void CheckPlan(const CommandRecordScheduler& s, uint32_t drawCount, uint32_t maxChunks, uint32_t minPerChunk)
+    {
+        const auto& chunks = s.GetChunks();
+        if (drawCount == 0)
+        {
+            CHECK(chunks.empty());
+            return;
+        }
+
+        CHECK(!chunks.empty());
+        CHECK(chunks.size() <= std::max(maxChunks, 1u));
+        CHECK(chunks.size() <= drawCount);
+        if (chunks.size() > 1)
+            CHECK(drawCount / chunks.size() >= minPerChunk);
+
+        // 빈틈없이 연속, 크기 차이 최대 1 (앞쪽이 큼)
+        uint32_t next = 0;
+        for (size_t c = 0; c < chunks.size(); ++c)
+        {
+            CHECK(chunks[c].first == next);
+            CHECK(chunks[c].count > 0);
+            if (c > 0)
+                CHECK(chunks[c - 1].count == chunks[c].count || chunks[c - 1].count == chunks[c].count + 1);
+            next += chunks[c].count;
+        }
+        CHECK(next == drawCount);
+    }
+
+    void CheckRecord(const CommandRecordScheduler& s, JobSystem* jobs, uint32_t drawCount)
+    {
+        NullBackend backend(s.GetChunkCount());
+        s.Record(jobs, backend);
+
+        std::vector<uint32_t> all;
+        for (uint32_t c = 0; c < s.GetChunkCount(); ++c)
+        {
+            CHECK(backend.calls[c].load() == 1);
+            all.insert(all.end(), backend.lists[c].begin(), backend.lists[c].end());
+        }
+
+        CHECK(all.size() == drawCount);
+        for (uint32_t i = 0; i < (uint32_t)all.size(); ++i)
+            CHECK(all[i] == i);
+    }
+}
+
+TEST_CASE(PlanCoversAllDrawsInOrder)
+{
+    CommandRecordScheduler s;
+    for (uint32_t n : { 0u, 1u, 5u, 63u, 64u, 127u, 128u, 1000u, 4096u, 9999u })
+        for (uint32_t maxChunks : { 0u, 1u, 2u, 3u, 8u, 64u })
+            for (uint32_t minPer : { 0u, 1u, 64u, 128u })
+            {
+                s.Plan(n, maxChunks, minPer);
+                CheckPlan(s, n, maxChunks, minPer);
+            }
+}
+
+TEST_CASE(FewDrawsStayOnOneChunk)
+{
+    CommandRecordScheduler s;
+    s.Plan(100, 8, 128);
+    CHECK(s.GetChunkCount() == 1);
+
+    s.Plan(1024, 8, 128);
+    CHECK(s.GetChunkCount() == 8);
+
+    s.Plan(1024, 8, 300);
+    CHECK(s.GetChunkCount() == 3);
+}
+
+TEST_CASE(RecordSerialAndParallelKeepOrder)
+{
+    JobSystem jobs;
+    jobs.Initialize(4);
+
+    CommandRecordScheduler s;
+    for (uint32_t n : { 1u, 63u, 128u, 1000u, 9999u })
+        for (uint32_t maxChunks : { 1u, 2u, 3u, 8u })
+        {
+            s.Plan(n, maxChunks, 16);
+
+            // jobs 없음 / 워커 1..4개 활성
+            CheckRecord(s, nullptr, n);
+            for (uint32_t active : { 0u, 1u, 2u, 4u })
+            {
+                jobs.SetMaxActiveWorkers(active);
+                CheckRecord(s, &jobs, n);
+            }
+        }
+
+    jobs.Shutdown();
+}
@@ -0,0 +1,59 @@
+﻿#include "TestFramework.h"
+#include "ComponentPool.h"
+#include <vector>
+
+// ComponentPool / View: 순회 중 제거
+// - View가 순회하는 모든 pool은 Each 동안 잠김 → fn 안에서 제거해도 dense 위치가 안 바뀌어 건너뛰는 엔티티가 없어야 함
+// - const로 받은 pool(읽기 전용)이 가장 작은 pool이어도 마찬가지
+
+static EntityId Entity(uint32_t i) { return EntityId{ i, 1 }; }
+
+TEST_CASE(RemoveDuringEachVisitsEveryEntity)
+{
+    ComponentPool<int> a;
+    ComponentPool<float> b;
+    for (uint32_t i = 0; i < 10; ++i)
+        a.Emplace(Entity(i), nullptr, (int)i);
+    for (uint32_t i = 0; i < 20; ++i)
+        b.Emplace(Entity(i), nullptr, 0.0f);
+
+    std::vector<uint32_t> visited;
+    View<int, float>(a, b).Each([&](EntityId e, int&, float&) {
+        visited.push_back(e.index);
+        a.Remove(e);
+    });
+
+    CHECK(visited.size() == 10);
+    CHECK(a.Size() == 0);
+    CHECK(!a.IsLocked() && !b.IsLocked());
+}
+
+TEST_CASE(ConstSmallestPoolIsLockedToo)
+{
+    ComponentPool<int> a;
+    ComponentPool<float> b;
+    for (uint32_t i = 0; i < 10; ++i)
+        a.Emplace(Entity(i), nullptr, (int)i);
+    for (uint32_t i = 0; i < 20; ++i)
+        b.Emplace(Entity(i), nullptr, 0.0f);
+
+    // a는 읽기 전용으로 순회하지만 fn이 다른 경로(non-const 참조)로 제거
+    const ComponentPool<int>& readOnly = a;
+    std::vector<uint32_t> visited;
+    View<const int, float>(readOnly, b).Each([&](EntityId e, const int& value, float& f) {
+        CHECK(readOnly.IsLocked());
+        visited.push_back(e.index);
+        f = (float)value;
+        a.Remove(e);
+        if (e.index + 1 < 10)
+            a.Remove(Entity(9));    // 아직 안 본 엔티티도 제거 → 방문 안 됨
+    });
+
+    // 0번에서 9번이 지워짐 → 0..8만 방문, 각각 한 번
+    CHECK(visited.size() == 9);
+    for (uint32_t i = 0; i < (uint32_t)visited.size(); ++i)
+        CHECK(visited[i] == i);
+    CHECK(a.Size() == 0);
+    CHECK(!a.IsLocked());
+    CHECK(b.Get(Entity(8)) == 8.0f);
+}
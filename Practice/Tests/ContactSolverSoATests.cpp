@@ -0,0 +1,247 @@
+﻿#include "TestFramework.h"
+#include "Behaviour.h"
+#include "World.h"
+#include "PhysicsSystem.h"
+#include "ColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include "DebugDraw.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+// ContactSolverSoA vs 스칼라 solver (PhysicsSystem::SolverMode::Scalar)
+// - contact끼리 body를 공유하지 않으면 색/배치 순서가 결과에 영향이 없어야 함 → 궤적이 같아야 함
+//   (반복마다 위치를 바로 쓰는 스칼라와 모아서 쓰는 SoA의 float 순서 차이만 남음)
+// - 쌓인 더미처럼 body를 공유하면 순서가 달라 궤적은 갈라지지만, 같은 입력이면 SoA 자체는 항상 같은 결과
+
+static constexpr float Dt = 1.0f / 60.0f;
+
+static void AddGround(World& w)
+{
+    EntityId g = w.CreateEntity();
+    w.AddTransform(g);
+    w.SetLocalPosition(g, { 0.0f, -0.5f, 0.0f });
+    w.SetLocalScale(g, { 60.0f, 1.0f, 60.0f });
+
+    RigidBodyComponent rb{};
+    rb.type = BodyType::Static;
+    rb.mass = 0.0f;
+    rb.RecalcInvMass();
+    w.AddRigidBody(g, rb);
+
+    ColliderComponent col{};
+    col.shapeType = ShapeType::Box;
+    col.box.halfExtents = { 0.5f, 0.5f, 0.5f };
+    w.AddCollider(g, col);
+}
+
+static EntityId AddBody(World& w, ShapeType shape, const XMFLOAT3& pos, const XMFLOAT3& vel)
+{
+    EntityId e = w.CreateEntity();
+    w.AddTransform(e);
+    w.SetLocalPosition(e, pos);
+
+    RigidBodyComponent rb{};
+    rb.type = BodyType::Dynamic;
+    rb.mass = 1.0f;
+    rb.velocity = vel;
+    rb.RecalcInvMass();
+    w.AddRigidBody(e, rb);
+
+    ColliderComponent col{};
+    col.shapeType = shape;
+    col.sphere.radius = 0.5f;
+    col.box.halfExtents = { 0.5f, 0.5f, 0.5f };
+    col.material.restitution = 0.1f;
+    col.material.friction = 0.3f;
+    w.AddCollider(e, col);
+    return e;
+}
+
+// 떨어져 있는 body들 (서로 안 닿고 각자 바닥과 contact 1개)
+static std::vector<EntityId> BuildSeparated(World& w)
+{
+    AddGround(w);
+    std::vector<EntityId> bodies;
+    for (int i = 0; i < 16; ++i)
+    {
+        const ShapeType shape = (i % 2) ? ShapeType::Box : ShapeType::Sphere;
+        const XMFLOAT3 pos{ (i % 4) * 3.0f - 4.5f, 1.0f + 0.1f * i, (i / 4) * 3.0f - 4.5f };
+        const XMFLOAT3 vel{ 0.2f * (i % 3), 0.0f, -0.1f * (i % 5) };
+        bodies.push_back(AddBody(w, shape, pos, vel));
+    }
+    return bodies;
+}
+
+// 서로 부딪히며 쌓이는 더미 (6 x 6 한 층씩, 두 층이면 안정적으로 쌓임)
+static std::vector<EntityId> BuildPile(World& w, uint32_t count)
+{
+    AddGround(w);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> jitter(-0.02f, 0.02f);
+
+    std::vector<EntityId> bodies;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const ShapeType shape = (i % 3 == 0) ? ShapeType::Box : ShapeType::Sphere;
+        const XMFLOAT3 pos{ (i % 6) * 1.05f - 3.0f + jitter(rng), 0.6f + (i / 36) * 1.05f, ((i / 6) % 6) * 1.05f - 3.0f + jitter(rng) };
+        bodies.push_back(AddBody(w, shape, pos, { 0.0f, 0.0f, 0.0f }));
+    }
+    return bodies;
+}
+
+static void StepBoth(World& wa, PhysicsSystem& pa, World& wb, PhysicsSystem& pb)
+{
+    std::vector<CollisionEvent> events;
+    wa.BeginFrame();
+    wb.BeginFrame();
+    DebugDraw::BeginFrame();
+    pa.Step(wa, Dt);
+    pb.Step(wb, Dt);
+    wa.DrainCollisionEvents(events);
+    wb.DrainCollisionEvents(events);
+}
+
+static float MaxDiff(const XMFLOAT3& a, const XMFLOAT3& b)
+{
+    return std::max({ std::fabs(a.x - b.x), std::fabs(a.y - b.y), std::fabs(a.z - b.z) });
+}
+
+static void CheckTracksScalar(World& scalarWorld, PhysicsSystem& scalar, World& soaWorld, PhysicsSystem& soa,
+    const std::vector<EntityId>& a, const std::vector<EntityId>& b, uint32_t steps)
+{
+    // 닿기 전/첫 충돌 직후는 거의 같아야 하고, 바닥에 머무는 동안에는 slop 안의 떨림만 갈라짐
+    const float settledTolerance = 2.0f * SolverTuning::Slop;
+
+    for (uint32_t s = 0; s < steps; ++s)
+    {
+        StepBoth(scalarWorld, scalar, soaWorld, soa);
+        CHECK(scalar.GetBroadphaseStats().contactCount == soa.GetBroadphaseStats().contactCount);
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            const RigidBodyComponent& ra = scalarWorld.GetRigidBody(a[i]);
+            const RigidBodyComponent& rb = soaWorld.GetRigidBody(b[i]);
+            const XMFLOAT3 pa = scalarWorld.GetWorldPosition(a[i]);
+            const XMFLOAT3 pb = soaWorld.GetWorldPosition(b[i]);
+
+            CHECK(MaxDiff(pa, pb) <= settledTolerance);
+            CHECK(MaxDiff(ra.velocity, rb.velocity) <= 1e-3f);
+            CHECK(ra.isAwake == rb.isAwake);
+
+            // 둘 다 바닥 위 (관통은 slop 정도까지)
+            CHECK(pa.y >= 0.5f - settledTolerance);
+            CHECK(pb.y >= 0.5f - settledTolerance);
+        }
+    }
+
+    for (size_t i = 0; i < a.size(); ++i)
+        CHECK(!scalarWorld.GetRigidBody(a[i]).isAwake && !soaWorld.GetRigidBody(b[i]).isAwake);
+
+    DebugDraw::BeginFrame();
+}
+
+TEST_CASE(SingleContactMatchesScalar)
+{
+    for (ShapeType shape : { ShapeType::Sphere, ShapeType::Box })
+    {
+        World wa, wb;
+        AddGround(wa);
+        AddGround(wb);
+        const EntityId a = AddBody(wa, shape, { 0.1f, 1.5f, 0.0f }, { 1.0f, 0.0f, 0.0f });
+        const EntityId b = AddBody(wb, shape, { 0.1f, 1.5f, 0.0f }, { 1.0f, 0.0f, 0.0f });
+
+        // 첫 충돌까지는 solver가 안 끼므로 완전히 같음
+        PhysicsSystem scalar;
+        PhysicsSystem soa;
+        soa.SetSolverMode(PhysicsSystem::SolverMode::SoA);
+        while (scalar.GetBroadphaseStats().contactCount == 0)
+        {
+            StepBoth(wa, scalar, wb, soa);
+            const XMFLOAT3 pa = wa.GetWorldPosition(a);
+            const XMFLOAT3 pb = wb.GetWorldPosition(b);
+            CHECK(std::memcmp(&pa, &pb, sizeof(pa)) == 0);
+        }
+        CHECK(soa.GetBroadphaseStats().contactCount == 1);
+
+        // 첫 충돌 몇 Step은 float 순서 차이 정도
+        for (int s = 0; s < 5; ++s)
+        {
+            StepBoth(wa, scalar, wb, soa);
+            CHECK(MaxDiff(wa.GetWorldPosition(a), wb.GetWorldPosition(b)) <= 1e-4f);
+        }
+
+        CheckTracksScalar(wa, scalar, wb, soa, { a }, { b }, 120);
+    }
+}
+
+TEST_CASE(IndependentContactsMatchScalar)
+{
+    // 16개 contact가 4-lane 배치로 같이 풀려도 각자 따로 푼 스칼라와 같아야 함
+    World wa, wb;
+    const std::vector<EntityId> a = BuildSeparated(wa);
+    const std::vector<EntityId> b = BuildSeparated(wb);
+
+    PhysicsSystem scalar, soa;
+    soa.SetSolverMode(PhysicsSystem::SolverMode::SoA);
+    CheckTracksScalar(wa, scalar, wb, soa, a, b, 150);
+}
+
+TEST_CASE(SoAIsDeterministic)
+{
+    World wa, wb;
+    const std::vector<EntityId> a = BuildPile(wa, 72);
+    const std::vector<EntityId> b = BuildPile(wb, 72);
+
+    PhysicsSystem pa, pb;
+    pa.SetSolverMode(PhysicsSystem::SolverMode::SoA);
+    pb.SetSolverMode(PhysicsSystem::SolverMode::SoA);
+
+    for (int s = 0; s < 90; ++s)
+    {
+        StepBoth(wa, pa, wb, pb);
+        CHECK(pa.GetBroadphaseStats().contactCount == pb.GetBroadphaseStats().contactCount);
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            const XMFLOAT3 p = wa.GetWorldPosition(a[i]);
+            const XMFLOAT3 q = wb.GetWorldPosition(b[i]);
+            CHECK(std::memcmp(&p, &q, sizeof(p)) == 0);
+        }
+    }
+
+    // 더미라 실제로 색이 여러 개로 나뉘었는지
+    CHECK(pa.GetSoASolverStats().colorCount > 1);
+    DebugDraw::BeginFrame();
+}
+
+TEST_CASE(PileAgreesWithScalarInAggregate)
+{
+    World wa, wb;
+    const std::vector<EntityId> a = BuildPile(wa, 72);
+    const std::vector<EntityId> b = BuildPile(wb, 72);
+
+    PhysicsSystem scalar, soa;
+    soa.SetSolverMode(PhysicsSystem::SolverMode::SoA);
+
+    for (int s = 0; s < 120; ++s)
+        StepBoth(wa, scalar, wb, soa);
+
+    double sumA = 0.0, sumB = 0.0;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        const XMFLOAT3 pa = wa.GetWorldPosition(a[i]);
+        const XMFLOAT3 pb = wb.GetWorldPosition(b[i]);
+        CHECK(std::isfinite(pa.y) && std::isfinite(pb.y));
+        CHECK(pa.y >= 0.4f && pb.y >= 0.4f);
+        sumA += pa.y;
+        sumB += pb.y;
+    }
+
+    // 색 순서만 다른 같은 식 → 더미 평균 높이는 비슷해야 함
+    const double avgA = sumA / a.size();
+    const double avgB = sumB / b.size();
+    CHECK(std::fabs(avgA - avgB) <= 0.05 * avgA);
+    DebugDraw::BeginFrame();
+}
@@ -0,0 +1,179 @@
+﻿#include "TestFramework.h"
+#include "DescriptorAllocator.h"
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+// DescriptorAllocator: SRV slot 재활용 규칙
+// - reserved 구간은 절대 안 나가고 Free도 거부
+// - Free한 slot은 그 fence가 Reclaim될 때까지 다시 안 나감 (순서가 뒤바뀐 fence도)
+// - 같은 slot 두 번 Free는 거부, 가득 차면 InvalidSlot + failures 누적
+
+static constexpr uint32_t Invalid = DescriptorAllocator::InvalidSlot;
+
+TEST_CASE(ReservedSlotsAreNeverHandedOut)
+{
+    DescriptorAllocator a;
+    a.Initialize(8, 2);
+
+    // 처음 쓰는 slot은 reserved 다음부터 순서대로
+    for (uint32_t i = 0; i < 6; ++i)
+        CHECK(a.Allocate() == 2 + i);
+
+    CHECK(!a.Free(0, 1));
+    CHECK(!a.Free(1, 1));
+    CHECK(!a.IsAllocated(0));
+    CHECK(!a.IsAllocated(1));
+
+    const DescriptorAllocatorStats s = a.GetStats();
+    CHECK(s.capacity == 8);
+    CHECK(s.reserved == 2);
+    CHECK(s.used == 6);
+    CHECK(s.pending == 0);
+}
+
+TEST_CASE(ExhaustionFailsAndCounts)
+{
+    DescriptorAllocator a;
+    a.Initialize(4, 1);
+
+    uint32_t slots[3];
+    for (uint32_t& s : slots)
+        s = a.Allocate();
+
+    CHECK(a.Allocate() == Invalid);
+    CHECK(a.Allocate() == Invalid);
+    CHECK(a.GetStats().failures == 2);
+    CHECK(a.GetStats().free == 0);
+    CHECK(a.GetStats().highWater == 4);
+
+    // 풀어도 fence 전에는 여전히 가득
+    CHECK(a.Free(slots[0], 1));
+    CHECK(a.Allocate() == Invalid);
+    CHECK(a.GetStats().failures == 3);
+
+    a.Reclaim(1);
+    CHECK(a.Allocate() == slots[0]);
+}
+
+TEST_CASE(DoubleFreeAndOutOfRangeAreRejected)
+{
+    DescriptorAllocator a;
+    a.Initialize(8, 1);
+
+    const uint32_t s = a.Allocate();
+    CHECK(a.Free(s, 3));
+    CHECK(!a.Free(s, 4));                   // pending 중 다시
+    CHECK(!a.Free(100, 1));
+    CHECK(!a.Free(Invalid, 1));
+
+    const uint32_t t = a.Allocate();
+    CHECK(!a.Free(t + 1, 1));               // 한 번도 안 나간 slot
+
+    a.Reclaim(3);
+    CHECK(!a.Free(s, 5));                   // free 리스트에 있는 slot
+    CHECK(a.GetStats().pending == 0);
+    CHECK(a.GetStats().used == 1);
+}
+
+TEST_CASE(ReuseWaitsForFence)
+{
+    DescriptorAllocator a;
+    a.Initialize(8, 2);
+
+    uint32_t s[6];
+    for (uint32_t& x : s)
+        x = a.Allocate();
+
+    CHECK(a.Free(s[1], 5));
+    CHECK(a.Free(s[3], 3));
+    DescriptorAllocatorStats st = a.GetStats();
+    CHECK(st.used == 4 && st.pending == 2 && st.free == 0);
+
+    a.Reclaim(2);
+    CHECK(a.Allocate() == Invalid);
+
+    // fence 순서가 Free 순서와 달라도 끝난 것만
+    a.Reclaim(3);
+    st = a.GetStats();
+    CHECK(st.pending == 1 && st.free == 1);
+    CHECK(a.Allocate() == s[3]);
+    CHECK(a.Allocate() == Invalid);
+
+    a.Reclaim(5);
+    CHECK(a.Allocate() == s[1]);
+
+    // free 리스트는 LIFO
+    CHECK(a.Free(s[0], 6));
+    CHECK(a.Free(s[2], 6));
+    a.Reclaim(6);
+    CHECK(a.Allocate() == s[2]);
+    CHECK(a.Allocate() == s[0]);
+}
+
+TEST_CASE(RandomizedNoReuseBeforeFence)
+{
+    std::mt19937 rng(1);
+
+    DescriptorAllocator a;
+    a.Initialize(64, 1);
+
+    std::set<uint32_t> live;
+    std::vector<std::pair<uint32_t, uint64_t>> pending;   // (slot, fence)
+    uint64_t fence = 0;
+
+    for (int it = 0; it < 50000; ++it)
+    {
+        const uint32_t op = rng() % 3;
+        if (op == 0)
+        {
+            const uint32_t x = a.Allocate();
+            if (x == Invalid)
+            {
+                CHECK(live.size() + pending.size() == 63);
+                continue;
+            }
+
+            CHECK(x >= 1 && x < 64);
+            CHECK(live.count(x) == 0);
+            for (const auto& p : pending)
+                CHECK(p.first != x);
+            live.insert(x);
+        }
+        else if (op == 1 && !live.empty())
+        {
+            auto i = live.begin();
+            std::advance(i, rng() % live.size());
+            const uint32_t x = *i;
+            live.erase(i);
+
+            CHECK(a.Free(x, fence + 1));
+            CHECK(!a.Free(x, fence + 1));
+            pending.push_back({ x, fence + 1 });
+        }
+        else
+        {
+            // GPU가 한두 프레임 뒤처진 것처럼
+            ++fence;
+            if (rng() % 2)
+            {
+                const uint64_t done = fence - (rng() % 2);
+                a.Reclaim(done);
+
+                std::vector<std::pair<uint32_t, uint64_t>> keep;
+                for (const auto& p : pending)
+                {
+                    if (p.second > done)
+                        keep.push_back(p);
+                }
+                pending.swap(keep);
+            }
+        }
+    }
+
+    const DescriptorAllocatorStats st = a.GetStats();
+    CHECK(st.used == live.size());
+    CHECK(st.pending == pending.size());
+    CHECK(st.used + st.pending + st.free == 63);
+}
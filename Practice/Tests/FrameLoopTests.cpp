@@ -0,0 +1,176 @@
+﻿#include "TestFramework.h"
+#include "Behaviour.h"
+#include "FrameLoop.h"
+#include "NullRenderer.h"
+#include "MeshManager.h"
+#include <vector>
+
+// FrameLoop + NullRenderer: 창/GPU 없이 World → RenderSystem::Build → BuildFrameLights → Render를 N프레임 돌리고
+// 렌더러가 받은 item/light 수를 씬 구성과 비교
+// - 카메라: 원점에서 +Z, 세로 90도 (CameraComponent), 뷰 1:1
+// - 앞(z = 20)의 큐브만 보이고 뒤(z = -20)는 프러스텀 컬링
+
+using namespace DirectX;
+
+static MeshHandle CreateUnitCube(MeshManager& mm)
+{
+    MeshCPUData cube;
+    for (int i = 0; i < 8; ++i)
+        cube.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+
+    // 면 6개 x 삼각형 2개 (감기 순서는 검증 대상 아님)
+    const uint16_t faces[6][4] = { { 0, 1, 3, 2 }, { 4, 6, 7, 5 }, { 0, 4, 5, 1 }, { 2, 3, 7, 6 }, { 0, 2, 6, 4 }, { 1, 5, 7, 3 } };
+    for (const auto& f : faces)
+        cube.indices.insert(cube.indices.end(), { f[0], f[1], f[2], f[0], f[2], f[3] });
+    return mm.Create(cube);
+}
+
+static EntityId AddCube(World& w, MeshHandle h, const XMFLOAT3& pos)
+{
+    EntityId e = w.CreateEntity();
+    w.AddTransform(e);
+    w.SetLocalPosition(e, pos);
+    w.AddMesh(e, MeshComponent(h));
+    return e;
+}
+
+static EntityId AddLight(World& w, LightType type, const XMFLOAT3& pos, bool enabled = true, bool transform = true)
+{
+    EntityId e = w.CreateEntity();
+    if (transform)
+    {
+        w.AddTransform(e);
+        w.SetLocalPosition(e, pos);
+    }
+
+    LightComponent lc{};
+    lc.type = type;
+    lc.enabled = enabled;
+    w.AddLight(e, lc);
+    return e;
+}
+
+struct FrameLoopScene
+{
+    MeshManager meshes;
+    World world;
+    RenderSystem renderSystem;
+    NullRenderer renderer;
+    FrameLoop loop{ world, renderSystem };
+
+    std::vector<EntityId> front;
+    std::vector<EntityId> lights;
+
+    static constexpr uint32_t FrontCubes = 20;
+    static constexpr uint32_t BackCubes = 10;
+    static constexpr uint32_t EnabledLights = 6;
+
+    FrameLoopScene()
+    {
+        const MeshHandle cube = CreateUnitCube(meshes);
+
+        const EntityId cam = world.CreateEntity();
+        world.AddTransform(cam);
+        world.AddCamera(cam);
+        world.GetCamera(cam).fovYDegrees = 90.0f;
+
+        for (uint32_t i = 0; i < FrontCubes; ++i)
+            front.push_back(AddCube(world, cube, { (float)(i % 5) * 2.0f - 4.0f, (float)(i / 5) * 2.0f - 3.0f, 20.0f }));
+        for (uint32_t i = 0; i < BackCubes; ++i)
+            AddCube(world, cube, { (float)i * 2.0f - 9.0f, 0.0f, -20.0f });
+
+        // 켜진 것 6개 + 꺼진 것 1개 + Transform 없는 것 1개 (둘 다 FrameLights에 안 들어감)
+        lights.push_back(AddLight(world, LightType::Directional, { 0, 10, 0 }));
+        for (int i = 0; i < 3; ++i)
+            lights.push_back(AddLight(world, LightType::Point, { (float)i * 3.0f - 3.0f, 1.0f, 15.0f }));
+        for (int i = 0; i < 2; ++i)
+            lights.push_back(AddLight(world, LightType::Spot, { (float)i * 4.0f - 2.0f, 3.0f, 10.0f }));
+        AddLight(world, LightType::Point, { 0, 0, 5 }, false);
+        AddLight(world, LightType::Point, { 0, 0, 5 }, true, false);
+
+        renderSystem.SetMeshManager(&meshes);
+        renderer.Initialize(nullptr, 256, 256);
+        renderer.SetMeshManager(&meshes);
+        renderer.SetThrowOnError(true);
+
+        loop.SetRenderer(&renderer);
+        loop.SetViewSize(256, 256);
+    }
+};
+
+TEST_CASE(RunsFramesAndCountsItemsAndLights)
+{
+    FrameLoopScene s;
+
+    constexpr uint32_t Frames = 8;
+    for (uint32_t f = 0; f < Frames; ++f)
+    {
+        s.loop.RunFrame();
+
+        const NullRenderStats& last = s.renderer.GetLastFrameStats();
+        CHECK(last.items == FrameLoopScene::FrontCubes);
+        CHECK(last.lights == FrameLoopScene::EnabledLights);
+        CHECK(last.errors == 0);
+
+        // 같은 mesh/pipeline → 한 batch로 instancing, 큐브당 삼각형 12개
+        CHECK(last.batches == 1);
+        CHECK(last.instances == FrameLoopScene::FrontCubes);
+        CHECK(last.triangles == 12ull * FrameLoopScene::FrontCubes);
+
+        CHECK(s.loop.GetRenderItems().size() == FrameLoopScene::FrontCubes);
+        CHECK(s.loop.GetFrameLights().lights.size() == FrameLoopScene::EnabledLights);
+        CHECK(s.renderSystem.GetCullStats().entities == FrameLoopScene::FrontCubes + FrameLoopScene::BackCubes);
+        CHECK(s.renderSystem.GetCullStats().culledEntities == FrameLoopScene::BackCubes);
+    }
+
+    CHECK(s.renderer.GetFrameCount() == Frames);
+    CHECK(s.renderer.GetTotalStats().items == Frames * FrameLoopScene::FrontCubes);
+    CHECK(s.renderer.GetTotalStats().lights == Frames * FrameLoopScene::EnabledLights);
+    CHECK(s.renderer.GetTotalStats().errors == 0);
+    CHECK(s.renderer.GetErrors().empty());
+}
+
+TEST_CASE(SceneChangesReachRenderer)
+{
+    FrameLoopScene s;
+    s.loop.RunFrame();
+    CHECK(s.renderer.GetLastFrameStats().items == FrameLoopScene::FrontCubes);
+
+    // 앞 큐브 5개를 뒤로 보내고 light 하나 끔 → 다음 프레임 수에 바로 반영
+    for (uint32_t i = 0; i < 5; ++i)
+        s.world.SetLocalPosition(s.front[i], { 0.0f, 0.0f, -30.0f });
+    s.world.GetLight(s.lights[1]).enabled = false;
+
+    s.loop.RunFrame();
+    CHECK(s.renderer.GetLastFrameStats().items == FrameLoopScene::FrontCubes - 5);
+    CHECK(s.renderer.GetLastFrameStats().lights == FrameLoopScene::EnabledLights - 1);
+
+    // 엔티티 파괴도 (FlushDestroy 이후 프레임)
+    s.world.RequestDestroy(s.front[10]);
+    s.world.FlushDestroy();
+    s.loop.RunFrame();
+    CHECK(s.renderer.GetLastFrameStats().items == FrameLoopScene::FrontCubes - 6);
+    CHECK(s.renderer.GetFrameCount() == 3);
+    CHECK(s.renderer.GetTotalStats().errors == 0);
+}
+
+TEST_CASE(FallbackCameraWithoutCameraEntity)
+{
+    // 카메라 엔티티가 없으면 (0,0,-6)에서 보는 임시 카메라, 렌더러 없이도 Build는 돎
+    MeshManager meshes;
+    World world;
+    RenderSystem renderSystem;
+    renderSystem.SetMeshManager(&meshes);
+    AddCube(world, CreateUnitCube(meshes), { 0, 0, 0 });
+    AddLight(world, LightType::Point, { 0, 2, 0 });
+
+    FrameLoop loop(world, renderSystem);
+    loop.SetViewSize(0, 0);
+    CHECK(loop.GetViewWidth() == 1 && loop.GetViewHeight() == 1);
+
+    loop.RunFrame();
+    CHECK(loop.GetRenderItems().size() == 1);
+    CHECK(loop.GetFrameLights().lights.size() == 1);
+    CHECK(loop.GetCamera().positionWS.z == -6.0f);
+    CHECK(loop.GetFrameLights().cameraPosWS.z == -6.0f);
+}
@@ -0,0 +1,259 @@
+﻿#include "TestFramework.h"
+#include "InstanceBatcher.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <tuple>
+
+// InstanceBatcher: 연속 구간(run) 판정, 인스턴스 패킹 순서, maxInstances 자르기
+// - 인스턴스 color.x에 입력 item 번호를 넣어 두고 결과에서 역추적
+
+using namespace DirectX;
+
+static XMFLOAT4X4 Identity()
+{
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, XMMatrixIdentity());
+    return m;
+}
+
+static RenderItem MakeItem(uint32_t index, uint32_t meshId, float z, uint32_t startIndex = 0, uint32_t indexCount = 0)
+{
+    RenderItem it{};
+    it.mesh.id = meshId;
+    it.world = Identity();
+    it.world._43 = z;
+    it.color = { (float)index, 0, 0, 1 };
+    it.startIndex = startIndex;
+    it.indexCount = indexCount;
+    return it;
+}
+
+static uint32_t ItemOf(const InstanceData& inst) { return (uint32_t)inst.color.x; }
+
+TEST_CASE(TexturesSplitRunsWithoutBindless)
+{
+    // 같은 mesh, 텍스처 0/1 교대 → 텍스처별 batch 2개
+    std::vector<RenderItem> items;
+    std::vector<uint32_t> srv;
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        items.push_back(MakeItem(i, 1, 10.0f - i));
+        srv.push_back(i % 2);
+    }
+
+    InstanceBatcher b;
+    b.Build(items, srv, {}, Identity(), 1024);
+
+    const auto& batches = b.GetBatches();
+    CHECK(batches.size() == 2);
+    CHECK(b.GetStats().batches == 2);
+    CHECK(b.GetStats().largestBatch == 3);
+
+    for (const InstanceBatch& batch : batches)
+    {
+        CHECK(batch.instanceCount == 3);
+        for (uint32_t k = batch.firstInstance; k < batch.firstInstance + batch.instanceCount; ++k)
+        {
+            CHECK(srv[ItemOf(b.GetInstances()[k])] == batch.srvIndex);
+            CHECK(b.GetInstances()[k].textureIndex == batch.srvIndex);
+        }
+    }
+}
+
+TEST_CASE(BindlessMergesTextures)
+{
+    std::vector<RenderItem> items;
+    std::vector<uint32_t> srv;
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        items.push_back(MakeItem(i, 1, 10.0f - i));
+        srv.push_back(i % 3);
+    }
+    // 다른 mesh / 다른 submesh 범위는 bindless여도 갈라짐
+    items.push_back(MakeItem(6, 2, 1.0f));
+    srv.push_back(0);
+    items.push_back(MakeItem(7, 1, 1.0f, 36, 36));
+    srv.push_back(0);
+
+    InstanceBatcher b;
+    b.SetBindlessTextures(true);
+    b.Build(items, srv, {}, Identity(), 1024);
+
+    const auto& batches = b.GetBatches();
+    CHECK(batches.size() == 3);
+
+    uint32_t merged = 0;
+    for (const InstanceBatch& batch : batches)
+    {
+        if (batch.meshId == 1 && batch.startIndex == 0)
+        {
+            merged = batch.instanceCount;
+            // 텍스처 슬롯은 인스턴스마다 원래 값
+            for (uint32_t k = batch.firstInstance; k < batch.firstInstance + batch.instanceCount; ++k)
+                CHECK(b.GetInstances()[k].textureIndex == srv[ItemOf(b.GetInstances()[k])]);
+        }
+        else
+        {
+            CHECK(batch.instanceCount == 1);
+        }
+    }
+    CHECK(merged == 6);
+}
+
+TEST_CASE(InstancesPackedFrontToBack)
+{
+    // 카메라가 -Z를 봄 → world z가 작을수록 멀다 (view z가 커짐)
+    XMFLOAT4X4 view;
+    XMStoreFloat4x4(&view, XMMatrixLookToLH(XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 0, -1, 0), XMVectorSet(0, 1, 0, 0)));
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> z(-100.0f, -1.0f);
+
+    std::vector<RenderItem> items;
+    std::vector<uint32_t> srv;
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        items.push_back(MakeItem(i, 1 + i % 2, z(rng)));
+        srv.push_back(0);
+    }
+
+    InstanceBatcher b;
+    b.Build(items, srv, {}, view, 1024);
+
+    uint32_t expectFirst = 0;
+    for (const InstanceBatch& batch : b.GetBatches())
+    {
+        // batch는 인스턴스 배열을 빈틈없이 순서대로 나눔
+        CHECK(batch.firstInstance == expectFirst);
+        expectFirst += batch.instanceCount;
+
+        for (uint32_t k = batch.firstInstance + 1; k < batch.firstInstance + batch.instanceCount; ++k)
+        {
+            // world z 내림차순 = view z 오름차순 (앞에서 뒤로)
+            CHECK(b.GetInstances()[k - 1].world._43 >= b.GetInstances()[k].world._43);
+        }
+    }
+    CHECK(expectFirst == 200);
+    CHECK(b.GetBatches().size() == 2);
+}
+
+TEST_CASE(MaxInstancesDropsTail)
+{
+    std::vector<RenderItem> items;
+    std::vector<uint32_t> srv;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        items.push_back(MakeItem(i, 1 + i % 4, (float)(i % 7)));
+        srv.push_back(i % 3);
+    }
+
+    InstanceBatcher b;
+    b.Build(items, srv, {}, Identity(), 40);
+
+    CHECK(b.GetStats().items == 100);
+    CHECK(b.GetStats().instances == 40);
+    CHECK(b.GetStats().dropped == 60);
+    CHECK(b.GetInstances().size() == 40);
+
+    // 앞쪽 40개만, 각각 한 번씩
+    std::vector<int> seen(100, 0);
+    for (const InstanceData& inst : b.GetInstances())
+        ++seen[ItemOf(inst)];
+    for (uint32_t i = 0; i < 100; ++i)
+        CHECK(seen[i] == (i < 40 ? 1 : 0));
+
+    b.Build(items, srv, {}, Identity(), 0);
+    CHECK(b.GetBatches().empty());
+    CHECK(b.GetStats().dropped == 100);
+}
+
+// 무작위 입력: 같은 상태끼리 batch가 정확히 하나, 모든 item이 한 번씩, pipeline 오름차순
+static void CheckRandomized(bool bindless)
+{
+    std::mt19937 rng(bindless ? 8 : 7);
+
+    for (int trial = 0; trial < 100; ++trial)
+    {
+        const uint32_t n = rng() % 3000;
+        std::vector<RenderItem> items;
+        std::vector<uint32_t> srv(n);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            items.push_back(MakeItem(i, 1 + rng() % 5, 1.0f + (float)(rng() % 1000) * 0.37f, (rng() % 3) * 36, (rng() % 2) * 36));
+            srv[i] = rng() % 4;
+        }
+
+        std::vector<uint8_t> pipelines;
+        if (trial % 2)
+        {
+            pipelines.resize(n);
+            for (uint32_t i = 0; i < n; ++i)
+                pipelines[i] = (uint8_t)(items[i].mesh.id % 3);
+        }
+
+        const uint32_t cap = (trial % 3 == 0) ? n / 2 : 65536;
+        const uint32_t used = std::min(n, cap);
+
+        InstanceBatcher b;
+        b.SetBindlessTextures(bindless);
+        b.Build(items, srv, pipelines, Identity(), cap);
+
+        const auto& batches = b.GetBatches();
+        const auto& inst = b.GetInstances();
+        CHECK(inst.size() == used);
+        CHECK(b.GetStats().dropped == n - used);
+        CHECK(b.GetStats().batches == batches.size());
+
+        using Key = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t>; // pipeline, srv, mesh, start, count
+        auto keyOf = [&](uint32_t i)
+            {
+                const uint32_t p = pipelines.empty() ? 0u : pipelines[i];
+                return Key{ p, bindless ? 0u : srv[i], items[i].mesh.id, items[i].startIndex, items[i].indexCount };
+            };
+
+        std::map<Key, uint32_t> expected, got;
+        for (uint32_t i = 0; i < used; ++i)
+            ++expected[keyOf(i)];
+
+        std::vector<int> seen(used, 0);
+        uint32_t expectFirst = 0;
+        uint32_t lastPipeline = 0;
+        for (const InstanceBatch& batch : batches)
+        {
+            CHECK(batch.firstInstance == expectFirst);
+            CHECK(batch.pipeline >= lastPipeline);
+            lastPipeline = batch.pipeline;
+            expectFirst += batch.instanceCount;
+
+            const Key key{ batch.pipeline, bindless ? 0u : batch.srvIndex, batch.meshId, batch.startIndex, batch.indexCount };
+            CHECK(got.count(key) == 0); // 같은 상태가 두 batch로 쪼개지면 안 됨
+            got[key] = batch.instanceCount;
+
+            for (uint32_t k = batch.firstInstance; k < batch.firstInstance + batch.instanceCount; ++k)
+            {
+                const uint32_t i = ItemOf(inst[k]);
+                CHECK(i < used);
+                if (i >= used)
+                    continue;
+                CHECK(seen[i]++ == 0);
+                CHECK(keyOf(i) == key);
+                CHECK(inst[k].textureIndex == srv[i]);
+                if (k > batch.firstInstance)
+                    CHECK(inst[k - 1].world._43 <= inst[k].world._43);
+            }
+        }
+        CHECK(expectFirst == used);
+        CHECK(expected == got);
+    }
+}
+
+TEST_CASE(RandomizedRunsMatchReference)
+{
+    CheckRandomized(false);
+}
+
+TEST_CASE(RandomizedBindlessRunsMatchReference)
+{
+    CheckRandomized(true);
+}
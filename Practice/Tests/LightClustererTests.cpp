@@ -0,0 +1,219 @@
+﻿#include "TestFramework.h"
+#include "LightClusterer.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+
+// LightClusterer: cluster별 light 목록 vs 전수 검사
+// - 모든 (light, cluster) 쌍을 SphereIntersects로 직접 돌린 목록과 cluster 목록이 정확히 같아야 함
+// - 목록 배치: 전역(directional) 먼저, 이어서 cluster 순서로 빈틈없이, cluster 안은 light 번호 오름차순
+// - 실제로 빛이 닿는 점은 반드시 자기 cluster 목록에 그 light가 있어야 함 (구 근사는 보수적이어야 함)
+
+namespace
+{
+    struct Scene
+    {
+        RenderCamera cam{};
+        std::vector<FrameLight> lights;
+        float nearZ = 0.0f;
+        float farZ = 0.0f;
+    };
+
+    Scene MakeScene(std::mt19937& rng, uint32_t lightCount, float maxRange)
+    {
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+
+        Scene s;
+        s.nearZ = 0.1f + u(rng);
+        s.farZ = 100.0f + u(rng) * 400.0f;
+
+        const XMVECTOR eye = XMVectorSet(u(rng) * 10.0f, 5.0f, -20.0f, 1.0f);
+        const XMVECTOR at = XMVectorSet(u(rng) * 5.0f, 0.0f, 10.0f, 1.0f);
+        XMStoreFloat4x4(&s.cam.view, XMMatrixLookAtLH(eye, at, XMVectorSet(0, 1, 0, 0)));
+        XMStoreFloat4x4(&s.cam.proj, XMMatrixPerspectiveFovLH(0.6f + u(rng), 16.0f / 9.0f, s.nearZ, s.farZ));
+
+        // directional 조금 + 점/스폿 (카메라 뒤/시야 밖도 섞임)
+        s.lights.resize(lightCount);
+        for (FrameLight& l : s.lights)
+        {
+            const float t = u(rng);
+            l.type = (t < 0.02f) ? 0u : (t < 0.6f ? 1u : 2u);
+            l.positionWS = { u(rng) * 200.0f - 100.0f, u(rng) * 20.0f - 5.0f, u(rng) * 200.0f - 60.0f };
+            l.range = 0.5f + u(rng) * maxRange;
+
+            XMStoreFloat3(&l.directionWS, XMVector3Normalize(XMVectorSet(u(rng) - 0.5f, u(rng) - 0.5f, u(rng) - 0.5f, 0.0f)));
+            l.outerCos = std::cos(u(rng) * 1.6f);
+        }
+        return s;
+    }
+
+    bool ClusterHas(const LightClusterer& lc, uint32_t cluster, uint32_t light)
+    {
+        const LightClusterRange& r = lc.GetClusters()[cluster];
+        const auto begin = lc.GetLightIndices().begin() + r.offset;
+        return std::binary_search(begin, begin + r.count, light);
+    }
+}
+
+TEST_CASE(ClusterListsMatchBruteForce)
+{
+    std::mt19937 rng(7);
+
+    for (int trial = 0; trial < 6; ++trial)
+    {
+        const Scene s = MakeScene(rng, (trial < 3) ? 300u : 2000u, (trial % 2) ? 30.0f : 8.0f);
+
+        LightClusterer lc;
+        lc.Build(s.lights.data(), (uint32_t)s.lights.size(), s.cam);
+
+        const std::vector<LightClusterRange>& clusters = lc.GetClusters();
+        const std::vector<uint32_t>& indices = lc.GetLightIndices();
+        const std::vector<LightClusterBounds>& bounds = lc.GetClusterBounds();
+        CHECK(clusters.size() == LightClusterCount);
+        CHECK(bounds.size() == LightClusterCount);
+
+        // 전역 = directional 전부, 번호 순
+        uint32_t directional = 0;
+        for (const FrameLight& l : s.lights)
+            directional += (l.type == 0) ? 1u : 0u;
+        CHECK(lc.GetGlobalLightCount() == directional);
+        for (uint32_t g = 0; g < lc.GetGlobalLightCount(); ++g)
+        {
+            CHECK(s.lights[indices[g]].type == 0);
+            if (g > 0)
+                CHECK(indices[g] > indices[g - 1]);
+        }
+
+        // 전수 검사 목록
+        std::vector<std::vector<uint32_t>> expected(LightClusterCount);
+        for (uint32_t i = 0; i < (uint32_t)s.lights.size(); ++i)
+        {
+            XMFLOAT3 c;
+            float r = 0.0f;
+            if (!LightClusterer::ComputeLightSphere(s.lights[i], s.cam.view, c, r))
+                continue;
+
+            for (uint32_t ci = 0; ci < LightClusterCount; ++ci)
+            {
+                if (LightClusterer::SphereIntersects(bounds[ci], c, r))
+                    expected[ci].push_back(i);
+            }
+        }
+
+        uint32_t offset = lc.GetGlobalLightCount();
+        uint32_t total = 0;
+        uint32_t maxPer = 0;
+        for (uint32_t ci = 0; ci < LightClusterCount; ++ci)
+        {
+            const LightClusterRange& r = clusters[ci];
+            CHECK(r.offset == offset);
+            CHECK(r.count == expected[ci].size());
+            CHECK(r.offset + r.count <= indices.size());
+            if (r.count == expected[ci].size() && r.offset + r.count <= indices.size())
+                CHECK(std::equal(expected[ci].begin(), expected[ci].end(), indices.begin() + r.offset));
+
+            offset += r.count;
+            total += r.count;
+            maxPer = std::max(maxPer, r.count);
+        }
+        CHECK(offset == indices.size());
+        CHECK(lc.GetStats().indices == total);
+        CHECK(lc.GetStats().maxPerCluster == maxPer);
+    }
+}
+
+TEST_CASE(LitPointsFindTheirLight)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+
+    const Scene s = MakeScene(rng, 400, 20.0f);
+    LightClusterer lc;
+    lc.Build(s.lights.data(), (uint32_t)s.lights.size(), s.cam);
+
+    const XMMATRIX view = XMLoadFloat4x4(&s.cam.view);
+    uint32_t hits = 0;
+
+    for (int sample = 0; sample < 5000; ++sample)
+    {
+        // 시야 안 임의 점 (깊이는 슬라이스처럼 지수 분포)
+        const float nx = u(rng) * 2.0f - 1.0f;
+        const float ny = u(rng) * 2.0f - 1.0f;
+        const float z = s.nearZ * std::pow(s.farZ / s.nearZ, u(rng));
+        const XMFLOAT3 p{ nx * z / s.cam.proj._11, ny * z / s.cam.proj._22, z };
+        const uint32_t cluster = lc.FindCluster(nx, ny, z);
+
+        for (uint32_t i = 0; i < (uint32_t)s.lights.size(); ++i)
+        {
+            const FrameLight& l = s.lights[i];
+            if (l.type == 0)
+                continue;
+
+            XMFLOAT3 lp, ld;
+            XMStoreFloat3(&lp, XMVector3TransformCoord(XMLoadFloat3(&l.positionWS), view));
+            XMStoreFloat3(&ld, XMVector3TransformNormal(XMLoadFloat3(&l.directionWS), view));
+
+            const float dx = p.x - lp.x, dy = p.y - lp.y, dz = p.z - lp.z;
+            const float d = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (d >= l.range * 0.999f)
+                continue;
+            if (l.type == 2 && d > 1e-4f && (dx * ld.x + dy * ld.y + dz * ld.z) / d <= l.outerCos + 1e-4f)
+                continue;
+
+            ++hits;
+            CHECK(ClusterHas(lc, cluster, i));
+        }
+    }
+
+    // 실제로 닿는 경우가 충분히 나왔는지
+    CHECK(hits > 100);
+}
+
+TEST_CASE(LightsOutsideFrustumAreCulled)
+{
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixIdentity());
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(1.0f, 1.0f, 0.5f, 100.0f));
+
+    FrameLight l[3]{};
+    l[0].type = 1;                          // 정면
+    l[0].positionWS = { 0.0f, 0.0f, 10.0f };
+    l[0].range = 2.0f;
+    l[1].type = 1;                          // 카메라 뒤
+    l[1].positionWS = { 0.0f, 0.0f, -10.0f };
+    l[1].range = 2.0f;
+    l[2].type = 1;                          // far 너머
+    l[2].positionWS = { 0.0f, 0.0f, 150.0f };
+    l[2].range = 2.0f;
+
+    LightClusterer lc;
+    lc.Build(l, 3, cam);
+
+    CHECK(lc.GetStats().binnedLights == 1);
+    CHECK(lc.GetStats().culledLights == 2);
+    CHECK(ClusterHas(lc, lc.FindCluster(0.0f, 0.0f, 10.0f), 0));
+    for (uint32_t idx : lc.GetLightIndices())
+        CHECK(idx == 0);
+}
+
+TEST_CASE(NonPerspectiveMakesEverythingGlobal)
+{
+    // 격자를 못 만드는 projection → 전부 전역 목록
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixIdentity());
+    XMStoreFloat4x4(&cam.proj, XMMatrixIdentity());
+
+    FrameLight l[3]{};
+    l[1].type = 1;
+    l[2].type = 2;
+
+    LightClusterer lc;
+    lc.Build(l, 3, cam);
+    CHECK(lc.GetGlobalLightCount() == 3);
+    CHECK(lc.GetLightIndices().size() == 3);
+    for (const LightClusterRange& r : lc.GetClusters())
+        CHECK(r.count == 0);
+}
@@ -0,0 +1,361 @@
+﻿#include "TestFramework.h"
+#include "MeshletBuilder.h"
+#include "ClusterCuller.h"
+#include "MeshManager.h"
+#include "RenderCamera.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+// MeshletBuilder: 한도(정점/삼각형), 인덱스 버퍼 전체를 빈틈없이 덮는지, bounds/cone이 실제 삼각형을 감싸는지
+// ClusterCuller: 프러스텀/backface cone으로 버린 meshlet에 보일 수 있는 삼각형이 없었는지 삼각형 단위 brute-force로 확인
+// - 뒷면 = 삼각형 평면 기준 눈이 법선 반대쪽 (n = (p1 - p0) x (p2 - p0), dot(n, p0 - eye) > 0)
+
+using namespace DirectX;
+
+struct TestMesh
+{
+    std::vector<XMFLOAT3> positions;
+    std::vector<uint32_t> indices;
+};
+
+// 바깥을 보는 UV 구 (극점은 정점 하나, 경도 방향은 이음매 없이 공유)
+static TestMesh MakeSphere(uint32_t rings, uint32_t segments, float radius)
+{
+    TestMesh m;
+    const float pi = 3.14159265f;
+
+    m.positions.push_back({ 0, radius, 0 });
+    for (uint32_t r = 1; r < rings; ++r)
+    {
+        const float theta = pi * (float)r / (float)rings;
+        for (uint32_t s = 0; s < segments; ++s)
+        {
+            const float phi = 2.0f * pi * (float)s / (float)segments;
+            m.positions.push_back({ radius * std::sin(theta) * std::cos(phi), radius * std::cos(theta), radius * std::sin(theta) * std::sin(phi) });
+        }
+    }
+    m.positions.push_back({ 0, -radius, 0 });
+
+    const uint32_t bottom = (uint32_t)m.positions.size() - 1;
+    auto ring = [segments](uint32_t r, uint32_t s) { return 1 + (r - 1) * segments + (s % segments); };
+
+    auto addTri = [&m](uint32_t a, uint32_t b, uint32_t c)
+        {
+            // 바깥(원점 반대쪽)을 보게 감기 순서 맞춤
+            const XMVECTOR p0 = XMLoadFloat3(&m.positions[a]);
+            const XMVECTOR p1 = XMLoadFloat3(&m.positions[b]);
+            const XMVECTOR p2 = XMLoadFloat3(&m.positions[c]);
+            const XMVECTOR n = XMVector3Cross(XMVectorSubtract(p1, p0), XMVectorSubtract(p2, p0));
+            if (XMVectorGetX(XMVector3Dot(n, XMVectorAdd(XMVectorAdd(p0, p1), p2))) < 0.0f)
+                std::swap(b, c);
+            m.indices.insert(m.indices.end(), { a, b, c });
+        };
+
+    for (uint32_t s = 0; s < segments; ++s)
+    {
+        addTri(0, ring(1, s), ring(1, s + 1));
+        for (uint32_t r = 1; r + 1 < rings; ++r)
+        {
+            addTri(ring(r, s), ring(r + 1, s), ring(r + 1, s + 1));
+            addTri(ring(r, s), ring(r + 1, s + 1), ring(r, s + 1));
+        }
+        addTri(bottom, ring(rings - 1, s + 1), ring(rings - 1, s));
+    }
+    return m;
+}
+
+// +Y를 보는 평면 격자 (법선이 전부 같음 → cone이 가장 좁음)
+static TestMesh MakeGrid(uint32_t n)
+{
+    TestMesh m;
+    for (uint32_t z = 0; z <= n; ++z)
+        for (uint32_t x = 0; x <= n; ++x)
+            m.positions.push_back({ (float)x, 0.0f, (float)z });
+
+    for (uint32_t z = 0; z < n; ++z)
+    {
+        for (uint32_t x = 0; x < n; ++x)
+        {
+            const uint32_t a = z * (n + 1) + x;
+            const uint32_t b = a + 1, c = a + (n + 1), d = c + 1;
+            m.indices.insert(m.indices.end(), { a, c, d, a, d, b });  // (c - a) x (d - a) = +Y
+        }
+    }
+    return m;
+}
+
+static std::vector<Meshlet> BuildMeshlets(TestMesh& m, uint32_t baseIndex, uint32_t maxVertices = MeshletMaxVertices, uint32_t maxTriangles = MeshletMaxTriangles)
+{
+    std::vector<Meshlet> out;
+    MeshletBuilder::Build(m.indices.data(), m.indices.size(), &m.positions[0].x, sizeof(XMFLOAT3),
+        (uint32_t)m.positions.size(), baseIndex, out, maxVertices, maxTriangles);
+    return out;
+}
+
+static XMVECTOR TriangleNormal(const TestMesh& m, const uint32_t* tri)
+{
+    const XMVECTOR p0 = XMLoadFloat3(&m.positions[tri[0]]);
+    return XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&m.positions[tri[1]]), p0), XMVectorSubtract(XMLoadFloat3(&m.positions[tri[2]]), p0));
+}
+
+TEST_CASE(LimitsAndFullCoverage)
+{
+    struct Limits { uint32_t vertices, triangles; };
+    const Limits limits[] = { { MeshletMaxVertices, MeshletMaxTriangles }, { 32, 32 }, { 16, 50 }, { 3, 1 }, { 64, 8 } };
+
+    for (int shape = 0; shape < 2; ++shape)
+    {
+        for (const Limits& l : limits)
+        {
+            TestMesh m = (shape == 0) ? MakeSphere(24, 32, 1.0f) : MakeGrid(20);
+            const std::vector<uint32_t> original = m.indices;
+            const uint32_t base = 300;   // 메쉬 인덱스 버퍼 중간 구간이라고 가정
+
+            const std::vector<Meshlet> meshlets = BuildMeshlets(m, base, l.vertices, l.triangles);
+            CHECK(!meshlets.empty());
+
+            // startIndex 순으로 빈틈 없이 이어져 구간 전체를 덮음
+            uint32_t cursor = base;
+            for (const Meshlet& ml : meshlets)
+            {
+                CHECK(ml.startIndex == cursor);
+                CHECK(ml.triangleCount >= 1 && ml.triangleCount <= l.triangles);
+                CHECK(ml.vertexCount <= l.vertices);
+
+                std::set<uint32_t> unique;
+                for (uint32_t i = 0; i < ml.triangleCount * 3; ++i)
+                    unique.insert(m.indices[ml.startIndex - base + i]);
+                CHECK(unique.size() == ml.vertexCount);
+
+                cursor += ml.triangleCount * 3;
+            }
+            CHECK(cursor == base + (uint32_t)original.size());
+
+            // 삼각형을 재배치만 함 (빠지거나 중복 없음, 감기 순서 유지)
+            std::multiset<std::tuple<uint32_t, uint32_t, uint32_t>> before, after;
+            for (size_t t = 0; t < original.size(); t += 3)
+            {
+                before.insert({ original[t], original[t + 1], original[t + 2] });
+                after.insert({ m.indices[t], m.indices[t + 1], m.indices[t + 2] });
+            }
+            CHECK(before == after);
+        }
+    }
+}
+
+TEST_CASE(BoundsAndConesContainTriangles)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> eyeDist(-6.0f, 6.0f);
+
+    for (int shape = 0; shape < 2; ++shape)
+    {
+        TestMesh m = (shape == 0) ? MakeSphere(32, 48, 2.0f) : MakeGrid(24);
+        const std::vector<Meshlet> meshlets = BuildMeshlets(m, 0);
+
+        uint32_t coneCount = 0, backfaceDecisions = 0;
+        for (const Meshlet& ml : meshlets)
+        {
+            const uint32_t* tris = m.indices.data() + ml.startIndex;
+            const XMVECTOR c = XMLoadFloat3(&ml.center);
+
+            // sphere가 모든 정점을 감쌈
+            for (uint32_t i = 0; i < ml.triangleCount * 3; ++i)
+            {
+                const float d = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&m.positions[tris[i]]), c)));
+                CHECK(d <= ml.radius * 1.0001f + 1e-5f);
+            }
+
+            if (ml.coneCutoff >= 1.0f)
+                continue;
+            ++coneCount;
+
+            // cone 축은 단위 벡터, 모든 삼각형 법선이 cone 반각 안: dot(axis, n) >= sqrt(1 - cutoff^2)
+            const XMVECTOR axis = XMLoadFloat3(&ml.coneAxis);
+            CHECK(std::fabs(XMVectorGetX(XMVector3Length(axis)) - 1.0f) < 1e-4f);
+
+            const float minDot = std::sqrt(std::max(0.0f, 1.0f - ml.coneCutoff * ml.coneCutoff));
+            for (uint32_t t = 0; t < ml.triangleCount; ++t)
+            {
+                const XMVECTOR n = XMVector3Normalize(TriangleNormal(m, tris + t * 3));
+                CHECK(XMVectorGetX(XMVector3Dot(axis, n)) >= minDot - 1e-4f);
+            }
+
+            // cone 판정(ClusterCuller와 같은 식)이 "전부 뒷면"이라 하면 실제로 모든 삼각형이 뒷면
+            for (int k = 0; k < 64; ++k)
+            {
+                const XMVECTOR eye = XMVectorSet(eyeDist(rng), eyeDist(rng), eyeDist(rng), 1.0f);
+                const XMVECTOR v = XMVectorSubtract(c, eye);
+                const float dist = XMVectorGetX(XMVector3Length(v));
+                if (XMVectorGetX(XMVector3Dot(v, axis)) < ml.coneCutoff * dist + ml.radius)
+                    continue;
+
+                ++backfaceDecisions;
+                for (uint32_t t = 0; t < ml.triangleCount; ++t)
+                {
+                    const XMVECTOR p0 = XMLoadFloat3(&m.positions[tris[t * 3]]);
+                    CHECK(XMVectorGetX(XMVector3Dot(TriangleNormal(m, tris + t * 3), XMVectorSubtract(p0, eye))) >= -1e-5f);
+                }
+            }
+        }
+
+        // 매끈한 구/평면이면 거의 모든 meshlet에 cone이 있고, 뒷면 판정도 실제로 나옴
+        CHECK(coneCount * 10 >= (uint32_t)meshlets.size() * 9);
+        CHECK(backfaceDecisions > 0);
+    }
+
+    // 평면: 법선이 전부 같으므로 축 = +Y, 반각 0
+    TestMesh grid = MakeGrid(16);
+    for (const Meshlet& ml : BuildMeshlets(grid, 0))
+    {
+        CHECK(std::fabs(ml.coneAxis.y - 1.0f) < 1e-4f);
+        CHECK(ml.coneCutoff < 1e-2f);
+    }
+}
+
+// ---------------- ClusterCuller vs 삼각형 단위 brute-force ----------------
+
+static RenderCamera LookAt(const XMFLOAT3& eye, const XMFLOAT3& target)
+{
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookAtLH(XMLoadFloat3(&eye), XMLoadFloat3(&target), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 1.0f, 0.1f, 200.0f));
+    cam.positionWS = eye;
+    return cam;
+}
+
+// 보일 수 있는 삼각형: 세 정점이 한 clip 평면 바깥에 몰려 있지 않고 (backface면) 앞면
+static bool TriangleMayBeVisible(const XMFLOAT3 p[3], const XMMATRIX& viewProj, const XMFLOAT3& eye, bool backface)
+{
+    XMFLOAT4 clip[3];
+    for (int i = 0; i < 3; ++i)
+        XMStoreFloat4(&clip[i], XMVector4Transform(XMVectorSet(p[i].x, p[i].y, p[i].z, 1.0f), viewProj));
+
+    auto allOutside = [&](auto outside) { return outside(clip[0]) && outside(clip[1]) && outside(clip[2]); };
+    if (allOutside([](const XMFLOAT4& c) { return c.x < -c.w; }) || allOutside([](const XMFLOAT4& c) { return c.x > c.w; }) ||
+        allOutside([](const XMFLOAT4& c) { return c.y < -c.w; }) || allOutside([](const XMFLOAT4& c) { return c.y > c.w; }) ||
+        allOutside([](const XMFLOAT4& c) { return c.z < 0.0f; }) || allOutside([](const XMFLOAT4& c) { return c.z > c.w; }))
+        return false;
+
+    if (!backface)
+        return true;
+
+    const XMVECTOR p0 = XMLoadFloat3(&p[0]);
+    const XMVECTOR n = XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&p[1]), p0), XMVectorSubtract(XMLoadFloat3(&p[2]), p0));
+    return XMVectorGetX(XMVector3Dot(n, XMVectorSubtract(p0, XMLoadFloat3(&eye)))) < 0.0f;
+}
+
+struct CullCase
+{
+    XMFLOAT3 eye;
+    XMFLOAT3 target;
+    XMFLOAT3 position;
+    XMFLOAT3 scale;
+    bool backface;
+};
+
+// 반환: 컬러가 남긴 삼각형 수 / 보일 수 있는 삼각형 수. 보일 수 있는 삼각형이 빠지면 CHECK 실패
+static ClusterCullStats RunCullCase(const MeshManager& mm, MeshHandle h, const CullCase& cc, uint32_t& outMayBeVisible)
+{
+    const MeshCPUData& cpu = mm.Get(h);
+    const RenderCamera cam = LookAt(cc.eye, cc.target);
+    const Frustum frustum = Frustum::FromViewProj(cam.view, cam.proj);
+    const XMMATRIX viewProj = XMMatrixMultiply(XMLoadFloat4x4(&cam.view), XMLoadFloat4x4(&cam.proj));
+
+    RenderItem it{};
+    it.mesh = h;
+    const XMMATRIX W = XMMatrixMultiply(XMMatrixScaling(cc.scale.x, cc.scale.y, cc.scale.z), XMMatrixTranslation(cc.position.x, cc.position.y, cc.position.z));
+    XMStoreFloat4x4(&it.world, W);
+
+    std::vector<RenderItem> items{ it };
+    ClusterCuller culler;
+    culler.SetBackfaceCullingEnabled(cc.backface);
+    culler.Cull(mm, frustum, cc.eye, items);
+
+    // 남은 구간 → 삼각형 표시
+    const uint32_t triCount = cpu.GetIndexCount() / 3;
+    std::vector<uint8_t> kept(triCount, 0);
+    for (const RenderItem& r : items)
+    {
+        CHECK(r.indexCount % 3 == 0 && r.startIndex % 3 == 0);
+        for (uint32_t i = r.startIndex; i < r.startIndex + r.indexCount; i += 3)
+            kept[i / 3] = 1;
+    }
+
+    // 비균등 scale이면 ClusterCuller가 backface를 안 하므로 reference도 프러스텀만
+    const bool uniform = cc.scale.x == cc.scale.y && cc.scale.y == cc.scale.z;
+    outMayBeVisible = 0;
+    for (uint32_t t = 0; t < triCount; ++t)
+    {
+        XMFLOAT3 p[3];
+        for (int k = 0; k < 3; ++k)
+            XMStoreFloat3(&p[k], XMVector3TransformCoord(XMLoadFloat3(&cpu.positions[cpu.GetIndex((size_t)t * 3 + k)]), W));
+
+        if (!TriangleMayBeVisible(p, viewProj, cc.eye, cc.backface && uniform))
+            continue;
+
+        ++outMayBeVisible;
+        CHECK(kept[t]);
+    }
+    return culler.GetStats();
+}
+
+TEST_CASE(CullerKeepsEveryPossiblyVisibleTriangle)
+{
+    TestMesh sphere = MakeSphere(48, 64, 1.0f);
+    MeshCPUData cpu;
+    cpu.positions = sphere.positions;
+    cpu.meshlets = BuildMeshlets(sphere, 0);
+    cpu.indices32 = sphere.indices;
+    CHECK(cpu.meshlets.size() >= ClusterCuller::DefaultMinMeshlets);
+
+    MeshManager mm;
+    const MeshHandle h = mm.Create(cpu);
+    const uint32_t totalTris = (uint32_t)sphere.indices.size() / 3;
+
+    // 바깥에서 정면: 뒤쪽 반구는 backface로
+    uint32_t visible = 0;
+    ClusterCullStats s = RunCullCase(mm, h, { { 0, 0, -8 }, { 0, 0, 0 }, { 0, 0, 0 }, { 2, 2, 2 }, true }, visible);
+    CHECK(s.items == 1 && s.clusters == (uint32_t)cpu.meshlets.size());
+    CHECK(s.backfaceCulled > 0);
+    CHECK(s.trianglesIn == totalTris);
+    CHECK(s.trianglesOut < totalTris && s.trianglesOut >= visible);
+
+    // backface 끄면 화면 안 삼각형은 전부
+    s = RunCullCase(mm, h, { { 0, 0, -8 }, { 0, 0, 0 }, { 0, 0, 0 }, { 2, 2, 2 }, false }, visible);
+    CHECK(s.backfaceCulled == 0);
+
+    // 가까이서 한쪽 가장자리만 보이게: 프러스텀으로 대부분 버림
+    s = RunCullCase(mm, h, { { 0, 0, -3 }, { 2.5f, 0, 0 }, { 0, 0, 0 }, { 2, 2, 2 }, true }, visible);
+    CHECK(s.frustumCulled > 0);
+
+    // 비균등 scale: backface 생략, 프러스텀만
+    s = RunCullCase(mm, h, { { 0, 0, -10 }, { 0, 0, 0 }, { 0, 0, 0 }, { 3, 1, 2 }, true }, visible);
+    CHECK(s.backfaceCulled == 0);
+
+    // 완전히 화면 밖: item이 통째로 빠짐
+    s = RunCullCase(mm, h, { { 0, 0, -8 }, { 0, 0, -20 }, { 0, 0, 0 }, { 1, 1, 1 }, true }, visible);
+    CHECK(visible == 0);
+    CHECK(s.frustumCulled == s.clusters && s.trianglesOut == 0);
+
+    // 무작위 카메라/배치
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 4.0f);
+    for (int i = 0; i < 200; ++i)
+    {
+        const float sc = scale(rng);
+        const XMFLOAT3 pos{ u(rng) * 5.0f, u(rng) * 5.0f, u(rng) * 5.0f };
+        XMFLOAT3 eye{ u(rng) * 15.0f, u(rng) * 15.0f, u(rng) * 15.0f };
+        if (std::fabs(eye.x - pos.x) + std::fabs(eye.y - pos.y) + std::fabs(eye.z - pos.z) < sc * 2.5f)
+            eye.z = pos.z - sc * 3.0f;   // 구 안이나 표면에 붙은 눈은 제외
+        const XMFLOAT3 target{ pos.x + u(rng) * 4.0f, pos.y + u(rng) * 4.0f, pos.z + u(rng) * 4.0f };
+        const bool nonUniform = (i % 5) == 0;
+
+        RunCullCase(mm, h, { eye, target, pos, nonUniform ? XMFLOAT3{ sc, sc * 0.5f, sc } : XMFLOAT3{ sc, sc, sc }, (i % 4) != 0 }, visible);
+    }
+}
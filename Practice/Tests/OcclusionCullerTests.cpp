@@ -0,0 +1,310 @@
+﻿#include "TestFramework.h"
+#include "OcclusionCuller.h"
+#include "MeshManager.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// OcclusionCuller: 소프트웨어 래스터 + Hi-Z 판정
+// - 카메라: view = 단위 행렬(원점에서 +Z), 세로 1 rad, aspect 2, near 0.5 / far 200 → viewProj = proj
+// - 래스터 깊이 버퍼를 픽셀 중심 레이 vs 가리개 삼각형 전수 교차(레퍼런스)와 비교 (가장자리 픽셀만 어긋남 허용)
+// - IsOccluded가 true면 그 화면 사각형의 모든 레퍼런스 깊이가 박스보다 앞이어야 함 (Hi-Z가 보수적인지)
+// - 명확한 경우: 완전히 가려짐 / 일부 보임 / near에 걸침 / 화면 밖
+
+using namespace DirectX;
+
+static constexpr float NearZ = 0.5f;
+static constexpr float FarZ = 200.0f;
+
+static MeshHandle CreateUnitBox(MeshManager& mm)
+{
+    MeshCPUData box;
+    for (int i = 0; i < 8; ++i)
+        box.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    box.SetIndices({ 0, 2, 1, 1, 2, 3,  4, 5, 6, 5, 7, 6,  0, 1, 4, 1, 5, 4,  2, 6, 3, 3, 6, 7,  0, 4, 2, 2, 4, 6,  1, 3, 5, 3, 7, 5 });
+    return mm.Create(box);
+}
+
+static XMFLOAT4X4 MakeViewProj()
+{
+    XMFLOAT4X4 vp;
+    XMStoreFloat4x4(&vp, XMMatrixPerspectiveFovLH(1.0f, 2.0f, NearZ, FarZ));
+    return vp;
+}
+
+static XMFLOAT4X4 ScaleTranslate(const XMFLOAT3& s, const XMFLOAT3& t)
+{
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, XMMatrixMultiply(XMMatrixScaling(s.x, s.y, s.z), XMMatrixTranslation(t.x, t.y, t.z)));
+    return m;
+}
+
+static RenderItem MakeItem(MeshHandle mesh, const XMFLOAT3& s, const XMFLOAT3& t)
+{
+    RenderItem it{};
+    it.mesh = mesh;
+    it.world = ScaleTranslate(s, t);
+    return it;
+}
+
+namespace
+{
+    struct Triangle
+    {
+        XMFLOAT3 p[3];
+    };
+
+    // 원점에서 d 방향 레이 (Moller-Trumbore). 맞으면 t > 0
+    bool RayHit(const XMFLOAT3& d, const Triangle& tri, float& t)
+    {
+        const XMFLOAT3& p0 = tri.p[0];
+        const float e1[3] = { tri.p[1].x - p0.x, tri.p[1].y - p0.y, tri.p[1].z - p0.z };
+        const float e2[3] = { tri.p[2].x - p0.x, tri.p[2].y - p0.y, tri.p[2].z - p0.z };
+        const float h[3] = { d.y * e2[2] - d.z * e2[1], d.z * e2[0] - d.x * e2[2], d.x * e2[1] - d.y * e2[0] };
+        const float a = e1[0] * h[0] + e1[1] * h[1] + e1[2] * h[2];
+        if (std::fabs(a) < 1e-9f)
+            return false;
+
+        const float f = 1.0f / a;
+        const float s[3] = { -p0.x, -p0.y, -p0.z };
+        const float u = f * (s[0] * h[0] + s[1] * h[1] + s[2] * h[2]);
+        if (u < 0.0f || u > 1.0f)
+            return false;
+
+        const float q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+        const float v = f * (d.x * q[0] + d.y * q[1] + d.z * q[2]);
+        if (v < 0.0f || u + v > 1.0f)
+            return false;
+
+        t = f * (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]);
+        return t > 0.0f;
+    }
+
+    // 픽셀 중심마다 가장 가까운 가리개 NDC 깊이 (없으면 1)
+    std::vector<float> ReferenceDepth(const MeshManager& mm, const std::vector<OccluderInstance>& occluders,
+        const XMFLOAT4X4& P, uint32_t width, uint32_t height)
+    {
+        std::vector<Triangle> tris;
+        for (const OccluderInstance& o : occluders)
+        {
+            const MeshCPUData& m = mm.Get(o.mesh);
+            const XMMATRIX W = XMLoadFloat4x4(&o.world);
+            for (uint32_t i = 0; i + 2 < m.GetIndexCount(); i += 3)
+            {
+                Triangle t;
+                for (int k = 0; k < 3; ++k)
+                    XMStoreFloat3(&t.p[k], XMVector3TransformCoord(XMLoadFloat3(&m.positions[m.GetIndex(i + k)]), W));
+                tris.push_back(t);
+            }
+        }
+
+        std::vector<float> ref((size_t)width * height, 1.0f);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const float nx = ((x + 0.5f) / width) * 2.0f - 1.0f;
+                const float ny = 1.0f - ((y + 0.5f) / height) * 2.0f;
+                const XMFLOAT3 d{ nx / P._11, ny / P._22, 1.0f };
+
+                float best = 1e30f;
+                for (const Triangle& t : tris)
+                {
+                    float hit = 0.0f;
+                    if (RayHit(d, t, hit) && hit >= NearZ)
+                        best = std::min(best, hit);
+                }
+                if (best < 1e29f)
+                    ref[(size_t)y * width + x] = P._33 + P._43 / best;
+            }
+        }
+        return ref;
+    }
+}
+
+TEST_CASE(RasterMatchesRayReferenceAndHiZIsConservative)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+    const XMFLOAT4X4 P = MakeViewProj();
+
+    uint32_t culled = 0;
+    for (int trial = 0; trial < 12; ++trial)
+    {
+        // 얇은 판/박스 몇 개 (가끔 near를 지나가는 것 포함)
+        std::vector<OccluderInstance> occluders;
+        const int count = 1 + trial % 6;
+        for (int k = 0; k < count; ++k)
+        {
+            const XMFLOAT3 s{ 2.0f + u(rng) * 20.0f, 2.0f + u(rng) * 10.0f, 0.5f + u(rng) * 3.0f };
+            const float z = (trial % 5 == 0 && k == 0) ? 0.0f : 5.0f + u(rng) * 40.0f;
+            occluders.push_back({ box, ScaleTranslate(s, { u(rng) * 30.0f - 15.0f, u(rng) * 10.0f - 5.0f, z }) });
+        }
+
+        OcclusionCuller oc;
+        oc.Render(mm, occluders, P);
+        const uint32_t w = oc.GetWidth();
+        const uint32_t h = oc.GetHeight();
+        const std::vector<float> ref = ReferenceDepth(mm, occluders, P, w, h);
+
+        // 삼각형 가장자리 픽셀만 어긋날 수 있음 (2% 이하)
+        uint32_t mismatched = 0;
+        for (size_t i = 0; i < ref.size(); ++i)
+            mismatched += (std::fabs(oc.GetDepth()[i] - ref[i]) > 1e-3f) ? 1u : 0u;
+        CHECK(mismatched <= w * h / 50);
+
+        for (int s = 0; s < 300; ++s)
+        {
+            MeshBounds b;
+            b.center = { u(rng) * 40.0f - 20.0f, u(rng) * 20.0f - 10.0f, 2.0f + u(rng) * 80.0f };
+            b.extents = { 0.2f + u(rng) * 2.0f, 0.2f + u(rng) * 2.0f, 0.2f + u(rng) * 2.0f };
+            if (!oc.IsOccluded(b))
+                continue;
+            ++culled;
+
+            // 모서리 8개의 화면 사각형 + 가장 가까운 깊이
+            float minX = 1e9f, minY = 1e9f, maxX = -1e9f, maxY = -1e9f, minZ = 1e9f;
+            for (int i = 0; i < 8; ++i)
+            {
+                const float px = b.center.x + ((i & 1) ? b.extents.x : -b.extents.x);
+                const float py = b.center.y + ((i & 2) ? b.extents.y : -b.extents.y);
+                const float pz = b.center.z + ((i & 4) ? b.extents.z : -b.extents.z);
+                const float sx = (px * P._11 / pz * 0.5f + 0.5f) * w;
+                const float sy = (0.5f - py * P._22 / pz * 0.5f) * h;
+                minX = std::min(minX, sx); maxX = std::max(maxX, sx);
+                minY = std::min(minY, sy); maxY = std::max(maxY, sy);
+                minZ = std::min(minZ, P._33 + P._43 / pz);
+            }
+
+            // 사각형 안 픽셀 중심은 전부 박스보다 앞에 가리개가 있어야 함
+            bool hidden = true;
+            const int y0 = std::max(0, (int)std::ceil(minY - 0.5f));
+            const int y1 = std::min((int)h - 1, (int)std::floor(maxY - 0.5f));
+            const int x0 = std::max(0, (int)std::ceil(minX - 0.5f));
+            const int x1 = std::min((int)w - 1, (int)std::floor(maxX - 0.5f));
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x)
+                    hidden = hidden && ref[(size_t)y * w + x] < minZ + 1e-4f;
+            CHECK(hidden);
+        }
+    }
+
+    // 실제로 가려진 경우가 충분히 나왔는지
+    CHECK(culled > 50);
+}
+
+TEST_CASE(FullyOccludedBoxIsCulled)
+{
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+
+    // z = 20 벽 (x ±20, y ±10)
+    OcclusionCuller oc;
+    oc.Render(mm, { { box, ScaleTranslate({ 40, 20, 1 }, { 0, 0, 20 }) } }, MakeViewProj());
+    CHECK(oc.GetStats().occluders == 1);
+    CHECK(oc.GetStats().triangles == 12);
+
+    CHECK(oc.IsOccluded({ { 0, 0, 40 }, { 1, 1, 1 } }));
+    CHECK(oc.IsOccluded({ { 5, -3, 150 }, { 4, 4, 4 } }));
+    CHECK(!oc.IsOccluded({ { 0, 0, 10 }, { 1, 1, 1 } }));      // 벽 앞
+    CHECK(!oc.IsOccluded({ { 0, 0, 19 }, { 1, 1, 1 } }));      // 벽을 뚫고 나옴
+
+    // Cull: 가려진 것만 빠지고 나머지 순서 유지
+    std::vector<RenderItem> items;
+    items.push_back(MakeItem(box, { 2, 2, 2 }, { 0, 0, 40 }));
+    items.push_back(MakeItem(box, { 2, 2, 2 }, { 0, 0, 10 }));
+    items.push_back(MakeItem(box, { 2, 2, 2 }, { 3, 1, 60 }));
+    items.push_back(MakeItem(box, { 2, 2, 2 }, { -1, 0, 12 }));
+    oc.Cull(mm, items);
+
+    CHECK(items.size() == 2);
+    if (items.size() == 2)
+    {
+        CHECK(items[0].world._43 == 10.0f);
+        CHECK(items[1].world._43 == 12.0f);
+    }
+    CHECK(oc.GetStats().itemsTested == 4);
+    CHECK(oc.GetStats().itemsCulled == 2);
+}
+
+TEST_CASE(PartiallyVisibleBoxIsKept)
+{
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+
+    // 화면 왼쪽 절반만 가리는 낮은 벽 (x -20 ~ 0, y ±5, z = 20)
+    OcclusionCuller oc;
+    oc.Render(mm, { { box, ScaleTranslate({ 20, 10, 1 }, { -10, 0, 20 }) } }, MakeViewProj());
+
+    CHECK(oc.IsOccluded({ { -10, 0, 40 }, { 1, 1, 1 } }));     // 벽 그림자 안
+    CHECK(!oc.IsOccluded({ { 0, 0, 40 }, { 2, 2, 2 } }));      // 벽 가장자리에 걸침 → 오른쪽 반이 보임
+    CHECK(!oc.IsOccluded({ { -10, 10, 40 }, { 2, 2, 2 } }));   // 벽 위로 삐져나옴
+    CHECK(!oc.IsOccluded({ { 10, 0, 40 }, { 1, 1, 1 } }));     // 벽 없는 쪽
+
+    std::vector<RenderItem> items;
+    items.push_back(MakeItem(box, { 4, 4, 4 }, { 0, 0, 40 }));
+    oc.Cull(mm, items);
+    CHECK(items.size() == 1);
+}
+
+TEST_CASE(NearPlaneCrossingIsConservative)
+{
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+
+    // 화면 전체를 덮는 벽
+    OcclusionCuller oc;
+    oc.Render(mm, { { box, ScaleTranslate({ 200, 200, 1 }, { 0, 0, 10 }) } }, MakeViewProj());
+
+    // 벽 뒤까지 길게 뻗었지만 near(0.5)에 걸친 item → 판정 불가, 통과
+    CHECK(!oc.IsOccluded({ { 0, 0, 20 }, { 1, 1, 20 } }));
+    std::vector<RenderItem> items;
+    items.push_back(MakeItem(box, { 2, 2, 40 }, { 0, 0, 20 }));
+    oc.Cull(mm, items);
+    CHECK(items.size() == 1);
+
+    // 카메라가 가리개 속에 있으면 가리개 삼각형을 near로 잘라서 그림 → 뒤쪽은 여전히 가려짐
+    OcclusionCuller inside;
+    inside.Render(mm, { { box, ScaleTranslate({ 200, 200, 1 }, { 0, 0, 10 }) }, { box, ScaleTranslate({ 1, 40, 100 }, { -3, 0, 0 }) } }, MakeViewProj());
+    CHECK(inside.GetStats().nearClipped > 0);
+    CHECK(inside.IsOccluded({ { 0, 0, 50 }, { 2, 2, 2 } }));
+}
+
+TEST_CASE(OffScreenItemIsKept)
+{
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+
+    OcclusionCuller oc;
+    oc.Render(mm, { { box, ScaleTranslate({ 200, 200, 1 }, { 0, 0, 10 }) } }, MakeViewProj());
+
+    // 화면 밖은 깊이 정보가 없음 → 버리지 않음 (프러스텀 컬링 몫)
+    CHECK(!oc.IsOccluded({ { 200, 0, 40 }, { 1, 1, 1 } }));
+    CHECK(!oc.IsOccluded({ { 0, -100, 40 }, { 1, 1, 1 } }));
+    CHECK(oc.IsOccluded({ { 0, 0, 40 }, { 1, 1, 1 } }));
+
+    std::vector<RenderItem> items;
+    items.push_back(MakeItem(box, { 2, 2, 2 }, { 200, 0, 40 }));
+    oc.Cull(mm, items);
+    CHECK(items.size() == 1);
+}
+
+TEST_CASE(NoOccludersKeepsEverything)
+{
+    MeshManager mm;
+    const MeshHandle box = CreateUnitBox(mm);
+
+    OcclusionCuller oc;
+    oc.Render(mm, {}, MakeViewProj());
+    CHECK(!oc.IsOccluded({ { 0, 0, 40 }, { 1, 1, 1 } }));
+
+    std::vector<RenderItem> items;
+    items.push_back(MakeItem(box, { 1, 1, 1 }, { 0, 0, 40 }));
+    items.push_back(MakeItem(box, { 1, 1, 1 }, { 0, 0, 80 }));
+    oc.Cull(mm, items);
+    CHECK(items.size() == 2);
+}
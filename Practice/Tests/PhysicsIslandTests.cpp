@@ -0,0 +1,175 @@
+﻿#include "TestFramework.h"
+#include "Behaviour.h"
+#include "World.h"
+#include "PhysicsSystem.h"
+#include "ColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include "DebugDraw.h"
+#include "JobSystem.h"
+#include <cstring>
+
+// 스칼라 solver: 순차 경로와 JobSystem 섬 병렬 경로가 비트 단위로 같은지
+// - 둘 다 BuildIslands를 거치므로 잠든 섬도 똑같이 건너뛰어야 함 (섬 수/잠든 섬 수까지 같음)
+// - SoA solver도 깨어있는 섬의 contact만 받음
+
+static constexpr float Dt = 1.0f / 60.0f;
+
+static void AddGround(World& w)
+{
+    EntityId g = w.CreateEntity();
+    w.AddTransform(g);
+    w.SetLocalPosition(g, { 0.0f, -0.5f, 0.0f });
+    w.SetLocalScale(g, { 80.0f, 1.0f, 80.0f });
+
+    RigidBodyComponent rb{};
+    rb.type = BodyType::Static;
+    rb.mass = 0.0f;
+    rb.RecalcInvMass();
+    w.AddRigidBody(g, rb);
+
+    ColliderComponent col{};
+    col.shapeType = ShapeType::Box;
+    col.box.halfExtents = { 0.5f, 0.5f, 0.5f };
+    w.AddCollider(g, col);
+}
+
+// 8 x 8개 덩어리(구 3 x 3, 서로 살짝 겹침), 덩어리끼리는 떨어져 있어 덩어리 = 섬
+// 짝수 덩어리는 바닥 위에서 시작(금방 잠듦), 홀수 덩어리는 위에서 떨어짐 → 잠든 섬/깨어있는 섬이 섞임
+static std::vector<EntityId> BuildClusters(World& w)
+{
+    AddGround(w);
+
+    std::vector<EntityId> bodies;
+    for (int cz = 0; cz < 8; ++cz)
+    {
+        for (int cx = 0; cx < 8; ++cx)
+        {
+            const bool falling = ((cx + cz) % 2) != 0;
+            for (int i = 0; i < 9; ++i)
+            {
+                EntityId e = w.CreateEntity();
+                w.AddTransform(e);
+                w.SetLocalPosition(e, { cx * 4.0f - 14.0f + (i % 3) * 0.98f, falling ? 2.0f + 0.5f * cx : 0.5f, cz * 4.0f - 14.0f + (i / 3) * 0.98f });
+
+                RigidBodyComponent rb{};
+                rb.type = BodyType::Dynamic;
+                rb.mass = 1.0f;
+                rb.RecalcInvMass();
+                w.AddRigidBody(e, rb);
+
+                ColliderComponent col{};
+                col.shapeType = ShapeType::Sphere;
+                col.sphere.radius = 0.5f;
+                col.material.restitution = 0.1f;
+                col.material.friction = 0.3f;
+                w.AddCollider(e, col);
+                bodies.push_back(e);
+            }
+        }
+    }
+    return bodies;
+}
+
+static void StepOne(World& w, PhysicsSystem& p)
+{
+    std::vector<CollisionEvent> events;
+    w.BeginFrame();
+    DebugDraw::BeginFrame();
+    p.Step(w, Dt);
+    w.DrainCollisionEvents(events);
+}
+
+TEST_CASE(SerialAndParallelIslandsMatch)
+{
+    JobSystem jobs;
+    jobs.Initialize(3);
+
+    World ws, wp;
+    const std::vector<EntityId> a = BuildClusters(ws);
+    const std::vector<EntityId> b = BuildClusters(wp);
+
+    PhysicsSystem serial;
+    PhysicsSystem parallel;
+    parallel.SetJobSystem(&jobs);
+
+    bool sawMixed = false;
+    bool sawParallel = false;
+    for (int s = 0; s < 240; ++s)
+    {
+        StepOne(ws, serial);
+        StepOne(wp, parallel);
+
+        const PhysicsSystem::StepStats& ss = serial.GetStepStats();
+        const PhysicsSystem::StepStats& ps = parallel.GetStepStats();
+        CHECK(ss.islandCount == ps.islandCount);
+        CHECK(ss.sleepingIslands == ps.sleepingIslands);
+        CHECK(ss.largestIsland == ps.largestIsland);
+
+        sawMixed |= ps.sleepingIslands > 0 && ps.sleepingIslands < ps.islandCount;
+        sawParallel |= ps.threadCount > 1 && serial.GetBroadphaseStats().contactCount >= 256;
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            const XMFLOAT3 p = ws.GetWorldPosition(a[i]);
+            const XMFLOAT3 q = wp.GetWorldPosition(b[i]);
+            CHECK(std::memcmp(&p, &q, sizeof(p)) == 0);
+            CHECK(ws.GetRigidBody(a[i]).isAwake == wp.GetRigidBody(b[i]).isAwake);
+        }
+    }
+
+    // 실제로 병렬 경로를 탔고, 잠든 섬과 깨어있는 섬이 섞인 Step이 있었는지
+    CHECK(sawParallel);
+    CHECK(sawMixed);
+
+    DebugDraw::BeginFrame();
+    jobs.Shutdown();
+}
+
+TEST_CASE(SleepingIslandsAreSkipped)
+{
+    // 전부 바닥 위에서 시작 → 잠든 뒤에는 순차 스칼라/SoA 모두 모든 섬을 건너뜀
+    for (PhysicsSystem::SolverMode mode : { PhysicsSystem::SolverMode::Scalar, PhysicsSystem::SolverMode::SoA })
+    {
+        World w;
+        AddGround(w);
+        std::vector<EntityId> bodies;
+        for (int i = 0; i < 16; ++i)
+        {
+            EntityId e = w.CreateEntity();
+            w.AddTransform(e);
+            w.SetLocalPosition(e, { (i % 4) * 3.0f, 0.5f, (i / 4) * 3.0f });
+
+            RigidBodyComponent rb{};
+            rb.type = BodyType::Dynamic;
+            rb.mass = 1.0f;
+            rb.RecalcInvMass();
+            w.AddRigidBody(e, rb);
+
+            ColliderComponent col{};
+            col.shapeType = ShapeType::Sphere;
+            col.sphere.radius = 0.5f;
+            w.AddCollider(e, col);
+            bodies.push_back(e);
+        }
+
+        PhysicsSystem physics;
+        physics.SetSolverMode(mode);
+        for (int s = 0; s < 240; ++s)
+            StepOne(w, physics);
+
+        // 잠든 body에는 warm start도 안 들어감 → 속도가 쌓이지 않음
+        for (EntityId e : bodies)
+        {
+            const RigidBodyComponent& rb = w.GetRigidBody(e);
+            CHECK(!rb.isAwake);
+            CHECK(rb.velocity.x == 0.0f && rb.velocity.y == 0.0f && rb.velocity.z == 0.0f);
+        }
+
+        const PhysicsSystem::StepStats& st = physics.GetStepStats();
+        CHECK(st.islandCount == 16);
+        CHECK(st.sleepingIslands == st.islandCount);
+        if (mode == PhysicsSystem::SolverMode::SoA)
+            CHECK(physics.GetSoASolverStats().contactCount == 0);
+        DebugDraw::BeginFrame();
+    }
+}
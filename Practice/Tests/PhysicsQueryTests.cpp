@@ -0,0 +1,170 @@
+﻿#include "TestFramework.h"
+#include "Behaviour.h"
+#include "World.h"
+#include "PhysicsSystem.h"
+#include "ColliderComponent.h"
+#include "RigidBodyComponent.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Scene query: DynamicTree(트리/BVH 가속) 결과가 BroadphaseMode::BruteForce(선형 스캔)와 같은지
+// - 같은 World를 두 PhysicsSystem이 봄. Step은 트리 쪽으로만
+// - Step 이후 추가/이동/파괴된 collider도 트리 쪽이 바로 봐야 함 (쿼리 전 Sync)
+
+using namespace DirectX;
+
+static constexpr float Dt = 1.0f / 60.0f;
+static constexpr float Extent = 40.0f;
+
+static EntityId AddBody(World& w, std::mt19937& rng, bool dynamic)
+{
+    std::uniform_real_distribution<float> pos(-Extent, Extent);
+    std::uniform_real_distribution<float> size(0.3f, 2.0f);
+    std::uniform_int_distribution<int> coin(0, 1);
+    std::uniform_int_distribution<int> layer(0, 3);
+
+    EntityId e = w.CreateEntity();
+    w.AddTransform(e);
+    w.SetLocalPosition(e, { pos(rng), pos(rng) * 0.25f, pos(rng) });
+
+    RigidBodyComponent rb{};
+    rb.type = dynamic ? BodyType::Dynamic : BodyType::Static;
+    rb.mass = dynamic ? 1.0f : 0.0f;
+    rb.useGravity = false;
+    rb.RecalcInvMass();
+    w.AddRigidBody(e, rb);
+
+    ColliderComponent col{};
+    col.shapeType = coin(rng) ? ShapeType::Sphere : ShapeType::Box;
+    col.sphere.radius = size(rng);
+    col.box.halfExtents = { size(rng), size(rng), size(rng) };
+    col.layer = (uint32_t)layer(rng);
+    col.isTrigger = (rng() % 8) == 0;
+    w.AddCollider(e, col);
+    return e;
+}
+
+static bool Near(float a, float b) { return std::fabs(a - b) <= 1e-4f * std::max(1.0f, std::fabs(a)); }
+
+// 레이/구 쿼리를 무작위로 돌려 두 시스템 결과 비교. 반환값 = 트리 쪽 hit 수 (테스트가 빈 씬을 보고 있지 않은지)
+static int CompareQueries(const World& w, const PhysicsSystem& tree, const PhysicsSystem& brute, std::mt19937& rng, int count)
+{
+    std::uniform_real_distribution<float> pos(-Extent, Extent);
+    std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> radius(0.5f, 6.0f);
+
+    int hits = 0;
+    std::vector<PhysicsSystem::RayQuery> rays;
+    for (int i = 0; i < count; ++i)
+    {
+        XMFLOAT3 o{ pos(rng), pos(rng) * 0.25f, pos(rng) };
+        XMFLOAT3 d{ dir(rng), dir(rng) * 0.25f, dir(rng) };
+        const float len = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+        if (len < 1e-3f) continue;
+        d = { d.x / len, d.y / len, d.z / len };
+
+        const uint32_t mask = (i % 3 == 0) ? 0x5u : ~0u;
+        const bool triggers = (i % 2) == 0;
+
+        PhysicsSystem::RaycastHit a{}, b{};
+        const bool ha = tree.Raycast(w, o, d, 60.0f, a, mask, triggers);
+        const bool hb = brute.Raycast(w, o, d, 60.0f, b, mask, triggers);
+        CHECK(ha == hb);
+        if (ha && hb)
+        {
+            // 거리가 같으면 어느 쪽을 골라도 됨
+            CHECK(Near(a.t, b.t));
+            CHECK(a.entity == b.entity || Near(a.t, b.t));
+        }
+        hits += ha ? 1 : 0;
+
+        CHECK(tree.RaycastAny(w, o, d, 60.0f, mask, triggers) == brute.RaycastAny(w, o, d, 60.0f, mask, triggers));
+        rays.push_back({ o, d, 60.0f });
+
+        std::vector<EntityId> oa, ob;
+        const float r = radius(rng);
+        CHECK(tree.OverlapSphere(w, o, r, oa, mask, triggers) == brute.OverlapSphere(w, o, r, ob, mask, triggers));
+        auto byIndex = [](EntityId x, EntityId y) { return x.index < y.index; };
+        std::sort(oa.begin(), oa.end(), byIndex);
+        std::sort(ob.begin(), ob.end(), byIndex);
+        CHECK(oa == ob);
+    }
+
+    std::vector<PhysicsSystem::RaycastHit> ba, bb;
+    CHECK(tree.RaycastBatch(w, rays, ba) == brute.RaycastBatch(w, rays, bb));
+    for (size_t i = 0; i < ba.size(); ++i)
+        CHECK(ba[i].entity.IsValid() == bb[i].entity.IsValid());
+
+    return hits;
+}
+
+TEST_CASE(TreeQueriesMatchBruteForce)
+{
+    std::mt19937 rng(1234);
+    World w;
+    std::vector<EntityId> bodies;
+    for (int i = 0; i < 600; ++i)
+        bodies.push_back(AddBody(w, rng, i % 3 == 0));
+    w.UpdateTransforms();
+
+    PhysicsSystem tree;
+    PhysicsSystem brute;
+    brute.SetBroadphaseMode(PhysicsSystem::BroadphaseMode::BruteForce);
+
+    // 첫 Step 전에도 (쿼리가 트리를 만듦)
+    CHECK(CompareQueries(w, tree, brute, rng, 300) > 0);
+
+    // Step 이후
+    tree.SetGravityEnabled(false);
+    for (int s = 0; s < 3; ++s)
+        tree.Step(w, Dt);
+    CHECK(CompareQueries(w, tree, brute, rng, 300) > 0);
+}
+
+TEST_CASE(QueriesSeeChangesSinceLastStep)
+{
+    std::mt19937 rng(99);
+    World w;
+    std::vector<EntityId> bodies;
+    for (int i = 0; i < 300; ++i)
+        bodies.push_back(AddBody(w, rng, i % 2 == 0));
+    w.UpdateTransforms();
+
+    PhysicsSystem tree;
+    tree.SetGravityEnabled(false);
+    tree.Step(w, Dt);
+
+    PhysicsSystem brute;
+    brute.SetBroadphaseMode(PhysicsSystem::BroadphaseMode::BruteForce);
+
+    // Step 없이: static/dynamic 둘 다 크게 옮기고, 새로 추가하고, 일부 파괴
+    std::uniform_real_distribution<float> pos(-Extent, Extent);
+    for (size_t i = 0; i < bodies.size(); i += 4)
+        w.SetLocalPosition(bodies[i], { pos(rng), pos(rng) * 0.25f, pos(rng) });
+    for (int i = 0; i < 50; ++i)
+        bodies.push_back(AddBody(w, rng, i % 2 == 0));
+    for (size_t i = 1; i < 60; i += 6)
+        w.RequestDestroy(bodies[i]);
+    w.FlushDestroy();
+    w.UpdateTransforms();
+
+    CHECK(CompareQueries(w, tree, brute, rng, 300) > 0);
+
+    // 옮긴 자리에 정확히 쏜 레이는 반드시 맞아야 함 (트리가 옛 자리만 알면 놓침)
+    const EntityId moved = bodies[0];
+    w.SetLocalPosition(moved, { 200.0f, 0.0f, 0.0f });
+    w.UpdateTransforms();
+
+    PhysicsSystem::RaycastHit hit{};
+    CHECK(tree.Raycast(w, { 200.0f, 50.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, 100.0f, hit, ~0u, true));
+    CHECK(hit.entity == moved);
+
+    std::vector<EntityId> over;
+    CHECK(tree.OverlapSphere(w, { 200.0f, 0.0f, 0.0f }, 0.1f, over) == 1);
+
+    // 콜라이더 제거도 바로
+    w.RemoveCollider(moved);
+    CHECK(!tree.RaycastAny(w, { 200.0f, 50.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, 100.0f, ~0u, true));
+}
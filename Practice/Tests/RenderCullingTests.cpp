@@ -0,0 +1,273 @@
+﻿#include "TestFramework.h"
+#include "Behaviour.h"
+#include "World.h"
+#include "RenderSystem.h"
+#include "MeshManager.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+// RenderSystem::Build 프러스텀 컬링: 합성 씬의 보이는 엔티티 수를 평면별 brute-force와 비교
+// - 카메라: 원점에서 +Z, 세로 90도, aspect 1, near 0.1 / far 100 → 평면 x = ±z, y = ±z, z = near/far
+// - Frustum::IntersectsAABB와 같은 규칙(어느 한 평면의 완전히 바깥일 때만 버림)을 코너 8개로 직접 계산
+
+using namespace DirectX;
+
+static constexpr float NearZ = 0.1f;
+static constexpr float FarZ = 100.0f;
+
+static MeshHandle CreateUnitCube(MeshManager& mm)
+{
+    MeshCPUData cube;
+    for (int i = 0; i < 8; ++i)
+        cube.positions.push_back({ (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f });
+    return mm.Create(cube);
+}
+
+static RenderCamera MakeCamera()
+{
+    RenderCamera cam{};
+    XMStoreFloat4x4(&cam.view, XMMatrixLookToLH(XMVectorSet(0, 0, 0, 1), XMVectorSet(0, 0, 1, 0), XMVectorSet(0, 1, 0, 0)));
+    XMStoreFloat4x4(&cam.proj, XMMatrixPerspectiveFovLH(XMConvertToRadians(90.0f), 1.0f, NearZ, FarZ));
+    return cam;
+}
+
+// 월드 AABB(center, half) → 6개 평면 각각에 대해 가장 안쪽 코너가 바깥이면 안 보임
+static bool ExpectVisible(const XMFLOAT3& c, const XMFLOAT3& h)
+{
+    const float planes[6][4] = {
+        { 1, 0, 1, 0 }, { -1, 0, 1, 0 },    // left/right: z + x >= 0, z - x >= 0
+        { 0, 1, 1, 0 }, { 0, -1, 1, 0 },    // bottom/top
+        { 0, 0, 1, -NearZ }, { 0, 0, -1, FarZ },
+    };
+
+    for (const auto& p : planes)
+    {
+        float best = -1e30f;
+        for (int i = 0; i < 8; ++i)
+        {
+            const float x = c.x + ((i & 1) ? h.x : -h.x);
+            const float y = c.y + ((i & 2) ? h.y : -h.y);
+            const float z = c.z + ((i & 4) ? h.z : -h.z);
+            best = std::max(best, p[0] * x + p[1] * y + p[2] * z + p[3]);
+        }
+        if (best < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+static EntityId AddCube(World& w, MeshHandle h, const XMFLOAT3& pos, const XMFLOAT3& scale = { 1, 1, 1 })
+{
+    EntityId e = w.CreateEntity();
+    w.AddTransform(e);
+    w.SetLocalPosition(e, pos);
+    w.SetLocalScale(e, scale);
+    w.AddMesh(e, MeshComponent(h));
+    return e;
+}
+
+static uint32_t BuildVisible(RenderSystem& rs, World& w, std::vector<RenderItem>& items)
+{
+    w.BeginFrame();
+    w.UpdateTransforms();
+    rs.Build(w, MakeCamera(), items);
+    return (uint32_t)items.size();
+}
+
+TEST_CASE(SingleCubeCases)
+{
+    MeshManager mm;
+    const MeshHandle h = CreateUnitCube(mm);
+
+    struct Case { XMFLOAT3 pos; bool visible; };
+    const Case cases[] = {
+        { { 0, 0, 5 }, true },          // 정면
+        { { 0, 0, -5 }, false },        // 뒤
+        { { 0, 0, 150 }, false },       // far 밖
+        { { 0, 0, 99.8f }, true },      // far 걸침
+        { { 7, 0, 5 }, false },         // 오른쪽 밖
+        { { 5.4f, 0, 5 }, true },       // 오른쪽 평면 걸침
+        { { 0, 0, 0 }, true },          // 카메라를 감쌈
+        { { 0, -7, 5 }, false },        // 아래 밖
+        { { 0, 5.4f, 5 }, true },       // 위 평면 걸침
+    };
+
+    RenderSystem rs;
+    rs.SetMeshManager(&mm);
+    for (const Case& c : cases)
+    {
+        World w;
+        AddCube(w, h, c.pos);
+
+        std::vector<RenderItem> items;
+        CHECK((BuildVisible(rs, w, items) == 1) == c.visible);
+        CHECK(ExpectVisible(c.pos, { 0.5f, 0.5f, 0.5f }) == c.visible);
+        CHECK(rs.GetCullStats().entities == 1);
+        CHECK(rs.GetCullStats().culledEntities == (c.visible ? 0u : 1u));
+    }
+}
+
+TEST_CASE(GridMatchesBruteForce)
+{
+    MeshManager mm;
+    const MeshHandle h = CreateUnitCube(mm);
+
+    // 101 x 101 격자 + 랜덤 크기/위치 상자
+    World w;
+    uint32_t expected = 0;
+    for (int x = -50; x <= 50; ++x)
+    {
+        for (int z = -50; z <= 50; ++z)
+        {
+            const XMFLOAT3 p{ x * 2.0f, 0.0f, z * 2.0f };
+            AddCube(w, h, p);
+            expected += ExpectVisible(p, { 0.5f, 0.5f, 0.5f }) ? 1 : 0;
+        }
+    }
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> pos(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> size(0.2f, 6.0f);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const XMFLOAT3 p{ pos(rng), pos(rng) * 0.3f, pos(rng) };
+        const XMFLOAT3 s{ size(rng), size(rng), size(rng) };
+        AddCube(w, h, p, s);
+        expected += ExpectVisible(p, { s.x * 0.5f, s.y * 0.5f, s.z * 0.5f }) ? 1 : 0;
+    }
+
+    RenderSystem rs;
+    rs.SetMeshManager(&mm);
+    std::vector<RenderItem> items;
+    CHECK(BuildVisible(rs, w, items) == expected);
+
+    const RenderCullStats& st = rs.GetCullStats();
+    CHECK(st.entities == 101u * 101u + 2000u);
+    CHECK(st.culledEntities == st.entities - expected);
+    CHECK(st.drawsVisible == expected);
+    CHECK(st.unbounded == 0);
+
+    // 평면 사이에 끼어 실제로는 밖인 것(보수적 판정) 외에는 대부분 버려져야 함
+    CHECK(expected < st.entities / 3);
+
+    // 컬링 끄면 전부
+    rs.SetFrustumCullingEnabled(false);
+    CHECK(BuildVisible(rs, w, items) == st.entities);
+}
+
+TEST_CASE(RotatedAndUnboundedItems)
+{
+    MeshManager mm;
+    const MeshHandle h = CreateUnitCube(mm);
+
+    World w;
+    // 중심은 카메라 뒤지만 z로 길게 늘려 앞까지 걸침
+    AddCube(w, h, { 0, 0, -3 }, { 1, 1, 10 });
+
+    // 뒤쪽에서 45도 돌린 긴 막대: 회전 AABB가 앞으로 넘어옴
+    const EntityId rotated = AddCube(w, h, { 0, 0, -2 }, { 1, 1, 8 });
+    XMFLOAT4 q;
+    XMStoreFloat4(&q, XMQuaternionRotationRollPitchYaw(0.0f, XMConvertToRadians(45.0f), 0.0f));
+    w.SetLocalRotation(rotated, q);
+
+    // bounds 없는 메쉬는 항상 그림
+    AddCube(w, MeshHandle{ 999 }, { 0, 0, -30 });
+
+    // 확실히 밖
+    AddCube(w, h, { 0, 0, -30 });
+
+    RenderSystem rs;
+    rs.SetMeshManager(&mm);
+    std::vector<RenderItem> items;
+    CHECK(BuildVisible(rs, w, items) == 3);
+    CHECK(rs.GetCullStats().unbounded == 1);
+    CHECK(rs.GetCullStats().culledEntities == 1);
+}
+
+TEST_CASE(StaticBVHAndParallelMatchLinear)
+{
+    MeshManager mm;
+    const MeshHandle h = CreateUnitCube(mm);
+
+    World w;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> pos(-120.0f, 120.0f);
+    uint32_t expected = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const XMFLOAT3 p{ pos(rng), pos(rng) * 0.2f, pos(rng) };
+        const EntityId e = AddCube(w, h, p);
+        if (i % 5)
+            w.SetStatic(e, true);
+        expected += ExpectVisible(p, { 0.5f, 0.5f, 0.5f }) ? 1 : 0;
+    }
+
+    JobSystem jobs;
+    jobs.Initialize(3);
+
+    RenderSystem linear, bvh, parallel;
+    linear.SetMeshManager(&mm);
+    linear.SetStaticBVHEnabled(false);
+    bvh.SetMeshManager(&mm);
+    parallel.SetMeshManager(&mm);
+    parallel.SetJobSystem(&jobs);
+
+    std::vector<RenderItem> a, b, c;
+    CHECK(BuildVisible(linear, w, a) == expected);
+    CHECK(BuildVisible(bvh, w, b) == expected);
+    CHECK(BuildVisible(parallel, w, c) == expected);
+
+    CHECK(bvh.GetCullStats().staticItems == 16000);
+    CHECK(bvh.GetCullStats().culledEntities == linear.GetCullStats().culledEntities);
+    CHECK(parallel.GetCullStats().buildChunks > 0);
+    CHECK(parallel.GetCullStats().culledEntities == linear.GetCullStats().culledEntities);
+
+    jobs.Shutdown();
+}
+
+TEST_CASE(ReadingComponentsDoesNotMarkRenderChanges)
+{
+    // retained 씬: 읽기만 하면 변경 로그가 비어 있어야 하고, 실제로 고친 뒤 MarkRenderChanged한 것만 갱신
+    MeshManager mm;
+    const MeshHandle h = CreateUnitCube(mm);
+
+    World w;
+    std::vector<EntityId> cubes;
+    for (int i = 0; i < 50; ++i)
+    {
+        const EntityId e = AddCube(w, h, { (float)(i % 10) - 5.0f, (float)(i / 10) - 2.0f, 20.0f });
+        w.AddMaterial(e, MaterialComponent({ 1, 1, 1, 1 }, TextureHandle{}));
+        cubes.push_back(e);
+    }
+
+    RenderSystem rs;
+    rs.SetMeshManager(&mm);
+    std::vector<RenderItem> items;
+    BuildVisible(rs, w, items);
+    CHECK(rs.GetScene().GetStats().rebuilt);
+
+    // non-const World로 읽기만 (RenderSystem 내부 조회도 같은 경로)
+    float sum = 0.0f;
+    for (EntityId e : cubes)
+        sum += w.GetMaterial(e).Primary().color.x + (float)w.GetMesh(e).draws.size();
+    CHECK(sum == 100.0f);
+
+    BuildVisible(rs, w, items);
+    CHECK(!rs.GetScene().GetStats().rebuilt);
+    CHECK(rs.GetScene().GetStats().changes == 0);
+    CHECK(rs.GetScene().GetStats().materialUpdates == 0);
+
+    // 실제로 고치고 알림 → 그 엔티티만
+    w.GetMaterial(cubes[3]).Primary().color = { 1, 0, 0, 1 };
+    w.MarkRenderChanged(cubes[3], RenderChangeFlags::Material);
+    BuildVisible(rs, w, items);
+    CHECK(rs.GetScene().GetStats().changes == 1);
+    CHECK(rs.GetScene().GetStats().materialUpdates == 1);
+
+    bool sawRed = false;
+    for (const RenderItem& it : items)
+        sawRed = sawRed || (it.color.x == 1.0f && it.color.y == 0.0f);
+    CHECK(sawRed);
+}
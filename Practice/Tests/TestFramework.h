@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <vector>
+
+// Engine 단위 테스트용 최소 러너 (외부 프레임워크 없음)
+// - TEST_CASE(name) { ... } 로 등록 → TestMain.cpp의 main이 등록 순서대로 실행
+// - CHECK 실패는 위치만 남기고 계속 진행, 하나라도 실패하면 종료 코드 1 (ctest가 실패로 봄)
+// - 실행 인자로 이름 일부를 주면 그 테스트만
+struct TestCase
+{
+    const char* name = nullptr;
+    void (*fn)() = nullptr;
+};
+
+std::vector<TestCase>& TestRegistry();
+
+void ReportCheckFailure(const char* file, int line, const char* expr);
+
+struct TestRegistrar
+{
+    TestRegistrar(const char* name, void (*fn)()) { TestRegistry().push_back({ name, fn }); }
+};
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static TestRegistrar name##_registrar(#name, &name); \
+    static void name()
+
+#define CHECK(expr) \
+    do { if (!(expr)) ReportCheckFailure(__FILE__, __LINE__, #expr); } while (0)
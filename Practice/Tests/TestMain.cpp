@@ -0,0 +1,49 @@
+﻿#include "TestFramework.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+static uint32_t s_caseFailures = 0;
+
+std::vector<TestCase>& TestRegistry()
+{
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+void ReportCheckFailure(const char* file, int line, const char* expr)
+{
+    // 랜덤 루프 안에서 터지면 같은 줄이 수천 번 나오므로 테스트당 앞쪽 몇 개만 출력
+    if (++s_caseFailures <= 10)
+        std::fprintf(stderr, "  %s:%d: CHECK(%s) failed\n", file, line, expr);
+}
+
+int main(int argc, char** argv)
+{
+    const char* filter = (argc > 1) ? argv[1] : nullptr;
+
+    uint32_t run = 0;
+    uint32_t failed = 0;
+    for (const TestCase& tc : TestRegistry())
+    {
+        if (filter && !std::strstr(tc.name, filter))
+            continue;
+
+        s_caseFailures = 0;
+        tc.fn();
+        ++run;
+
+        if (s_caseFailures == 0)
+        {
+            std::printf("[ OK ] %s\n", tc.name);
+        }
+        else
+        {
+            std::printf("[FAIL] %s (%u checks)\n", tc.name, s_caseFailures);
+            ++failed;
+        }
+    }
+
+    std::printf("%u/%u passed\n", run - failed, run);
+    return (failed == 0 && run > 0) ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+﻿#include "TestFramework.h"
+#include "TlsfAllocator.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// TlsfAllocator: 랜덤 Allocate / Free / Grow
+// - 매 몇 step마다 Validate() (블록 체인 / 빈 리스트 / 비트맵 일치)
+// - 살아 있는 할당끼리 범위가 겹치지 않음 (단위마다 소유 표시)
+// - 전부 Free하면 빈 블록 하나로 합쳐져 capacity 전체가 돼야 함
+
+namespace
+{
+    struct Owners
+    {
+        std::vector<uint8_t> used;
+
+        // 겹치면 false
+        bool Mark(const TlsfAllocation& a, uint8_t value)
+        {
+            if (used.size() < a.offset + a.size)
+                used.resize(a.offset + a.size, 0);
+
+            bool ok = true;
+            for (uint32_t i = a.offset; i < a.offset + a.size; ++i)
+            {
+                if (value && used[i])
+                    ok = false;
+                used[i] = value;
+            }
+            return ok;
+        }
+    };
+
+    void CheckFullyCoalesced(const TlsfAllocator& a)
+    {
+        const TlsfStats s = a.GetStats();
+        CHECK(a.Validate());
+        CHECK(s.used == 0);
+        CHECK(s.allocations == 0);
+        CHECK(s.freeBlocks == 1);
+        CHECK(s.largestFree == a.GetCapacity());
+    }
+}
+
+TEST_CASE(ExactFillAndGrow)
+{
+    TlsfAllocator a;
+    a.Initialize(100);
+
+    const TlsfAllocation x = a.Allocate(100);
+    CHECK(x.IsValid() && x.offset == 0 && x.size == 100);
+    CHECK(!a.Allocate(1).IsValid());
+
+    // 끝 블록이 사용 중일 때 Grow → 새 빈 블록
+    a.Grow(200);
+    const TlsfAllocation y = a.Allocate(100);
+    CHECK(y.IsValid() && y.offset == 100);
+    CHECK(!a.Allocate(1).IsValid());
+    CHECK(a.Validate());
+
+    a.Free(x);
+    a.Free(y);
+    CheckFullyCoalesced(a);
+
+    // 끝 블록이 비어 있을 때 Grow → 그 블록과 합쳐짐
+    a.Grow(300);
+    CheckFullyCoalesced(a);
+    const TlsfAllocation z = a.Allocate(300);
+    CHECK(z.IsValid() && z.offset == 0);
+    a.Free(z);
+    CheckFullyCoalesced(a);
+}
+
+TEST_CASE(FreeCoalescesBothNeighbours)
+{
+    TlsfAllocator a;
+    a.Initialize(64);
+
+    const TlsfAllocation p = a.Allocate(16);
+    const TlsfAllocation q = a.Allocate(16);
+    const TlsfAllocation r = a.Allocate(16);
+    CHECK(p.IsValid() && q.IsValid() && r.IsValid());
+
+    // 양옆이 빈 상태에서 가운데를 풀면 세 블록 + 끝 빈 블록이 하나로
+    a.Free(p);
+    a.Free(r);
+    CHECK(a.GetStats().freeBlocks == 2);
+    a.Free(q);
+    CheckFullyCoalesced(a);
+}
+
+TEST_CASE(RandomizedAllocateFreeGrow)
+{
+    std::mt19937 rng(5);
+
+    for (int trial = 0; trial < 40; ++trial)
+    {
+        TlsfAllocator a;
+        a.Initialize(1000 + rng() % 200000);
+
+        Owners owners;
+        std::vector<TlsfAllocation> live;
+
+        for (int step = 0; step < 4000; ++step)
+        {
+            const uint32_t op = rng() % 10;
+            if (op < 5)
+            {
+                // 작은 것 위주 + 가끔 큰 것
+                const uint32_t size = (rng() % 4 == 0) ? 1 + rng() % 5000 : 1 + rng() % 64;
+                const TlsfAllocation x = a.Allocate(size);
+                if (x.IsValid())
+                {
+                    CHECK(x.size == size);
+                    CHECK(x.offset + x.size <= a.GetCapacity());
+                    CHECK(owners.Mark(x, 1));
+                    live.push_back(x);
+                }
+                else
+                {
+                    // 등급 검색이 실패해도 정확 검색으로 한 번 더 찾으므로, 실패면 정말 size 이상 빈 블록이 없음
+                    CHECK(a.GetStats().largestFree < size);
+                }
+            }
+            else if (op < 9 && !live.empty())
+            {
+                const size_t i = rng() % live.size();
+                owners.Mark(live[i], 0);
+                a.Free(live[i]);
+                live[i] = live.back();
+                live.pop_back();
+            }
+            else if (op == 9)
+            {
+                a.Grow(a.GetCapacity() + rng() % 5000);
+            }
+
+            if (step % 97 == 0)
+                CHECK(a.Validate());
+        }
+
+        uint32_t used = 0;
+        for (const TlsfAllocation& x : live)
+            used += x.size;
+        CHECK(a.GetUsed() == used);
+        CHECK(a.GetStats().allocations == live.size());
+
+        // 역순이 아닌 섞인 순서로 풀어도 전부 합쳐져야 함
+        std::shuffle(live.begin(), live.end(), rng);
+        for (const TlsfAllocation& x : live)
+            a.Free(x);
+        CheckFullyCoalesced(a);
+    }
+}
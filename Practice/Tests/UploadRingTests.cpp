@@ -0,0 +1,253 @@
+﻿#include "TestFramework.h"
+#include "UploadRing.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// UploadRing: 가짜 page 메모리 + 가짜 fence로 page 재활용 / 겹침 / 정렬 / 전용 page 확인
+
+namespace
+{
+    // page마다 실제 바이트 배열, GPU 주소는 page 번호로 구분되게
+    struct FakePages
+    {
+        std::vector<std::vector<uint8_t>> mem;
+        uint32_t destroyed = 0;
+        bool failCreate = false;
+
+        static uint64_t GpuBase(uint32_t page) { return 0x100000ull * (page + 1); }
+
+        void Attach(UploadRing& ring, uint64_t pageSize)
+        {
+            ring.Initialize(pageSize,
+                [this](uint32_t page, uint64_t size, UploadPage& out)
+                {
+                    if (failCreate || page != mem.size())
+                        return false;
+                    mem.emplace_back(size);
+                    out.cpu = mem.back().data();
+                    out.gpu = GpuBase(page);
+                    out.size = size;
+                    return true;
+                },
+                [this](uint32_t) { ++destroyed; });
+        }
+    };
+
+    struct Range
+    {
+        uint32_t page;
+        uint64_t offset, size, fence;
+    };
+
+    bool Overlaps(const Range& r, const UploadAllocation& a)
+    {
+        return r.page == a.page && a.offset < r.offset + r.size && r.offset < a.offset + a.size;
+    }
+}
+
+TEST_CASE(PageRetiresOnlyAfterFence)
+{
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 256);
+
+    // 프레임 1: page 0을 채우고 page 1로 넘어감 → page 0은 fence 1로 닫힘
+    ring.BeginFrame(0);
+    const UploadAllocation a = ring.Allocate(200, 1);
+    const UploadAllocation b = ring.Allocate(200, 1);
+    CHECK(a.page == 0 && b.page == 1);
+    ring.EndFrame(1);
+    CHECK(ring.GetStats().pagesInFlight == 1);
+
+    // GPU가 아직 fence 1 전 → page 0 재사용 불가, page 1도 꽉 차서 새 page
+    ring.BeginFrame(0);
+    CHECK(ring.GetStats().pagesFree == 0);
+    const UploadAllocation c = ring.Allocate(200, 1);
+    CHECK(c.page == 2);
+    ring.EndFrame(2);
+
+    // fence 1 완료 → page 0만 돌아옴 (page 1은 fence 2)
+    ring.BeginFrame(1);
+    CHECK(ring.GetStats().pagesFree == 1);
+    const UploadAllocation d = ring.Allocate(200, 1);
+    CHECK(d.page == 0);
+    CHECK(ring.GetStats().pagesCreated == 0);
+    ring.EndFrame(3);
+
+    CHECK(ring.GetStats().pages == 3);
+    CHECK(fake.mem.size() == 3);
+
+    ring.Shutdown();
+    CHECK(fake.destroyed == 3);
+}
+
+TEST_CASE(PartialPageCarriesOverAndRetiresWithClosingFrame)
+{
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 1024);
+
+    // 프레임 1에서 반만 쓴 page는 프레임 2에서 이어 씀
+    ring.BeginFrame(0);
+    const UploadAllocation a = ring.Allocate(400, 1);
+    ring.EndFrame(1);
+    CHECK(ring.GetStats().pagesInFlight == 0);
+
+    ring.BeginFrame(1);
+    const UploadAllocation b = ring.Allocate(400, 1);
+    CHECK(b.page == a.page && b.offset == 400);
+
+    // 프레임 2에서 닫힘 → 프레임 1 데이터가 있어도 fence 2까지 살아 있어야 함
+    const UploadAllocation c = ring.Allocate(400, 1);
+    CHECK(c.page != a.page);
+    ring.EndFrame(2);
+
+    ring.BeginFrame(1);
+    CHECK(ring.GetStats().pagesFree == 0);
+    ring.EndFrame(3);
+
+    ring.BeginFrame(2);
+    CHECK(ring.GetStats().pagesFree == 1);
+    ring.EndFrame(4);
+}
+
+TEST_CASE(AllocationsAreAligned)
+{
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 4096);
+
+    ring.BeginFrame(0);
+    for (uint64_t align = 1; align <= 1024; align <<= 1)
+    {
+        // 일부러 홀수 크기로 offset을 어긋나게
+        ring.Allocate(3, 1);
+        const UploadAllocation a = ring.Allocate(17, align);
+        CHECK(a.cpu != nullptr);
+        CHECK(a.offset % align == 0);
+        CHECK(a.gpu % align == 0);
+        CHECK(a.gpu == FakePages::GpuBase(a.page) + a.offset);
+        CHECK(a.cpu == fake.mem[a.page].data() + a.offset);
+    }
+    ring.EndFrame(1);
+
+    CHECK(ring.Allocate(0, 16).cpu == nullptr);
+}
+
+TEST_CASE(OversizedRequestGetsDedicatedPage)
+{
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 1024);
+
+    ring.BeginFrame(0);
+    const UploadAllocation small1 = ring.Allocate(100, 1);
+
+    const UploadAllocation big = ring.Allocate(3000, 256);
+    CHECK(big.cpu != nullptr);
+    CHECK(big.page != small1.page);
+    CHECK(big.offset == 0);
+    CHECK(fake.mem[big.page].size() >= 3000);
+    CHECK(fake.mem[big.page].size() % 1024 == 0);
+
+    // 전용 page가 현재 page를 끊지 않음
+    const UploadAllocation small2 = ring.Allocate(100, 1);
+    CHECK(small2.page == small1.page && small2.offset == 100);
+    ring.EndFrame(1);
+
+    // 전용 page는 바로 닫혀 fence 1로 retire → 다음 큰 요청에 재사용, 작은 page 요청은 못 씀
+    ring.BeginFrame(1);
+    CHECK(ring.GetStats().pagesFree == 1);
+    const UploadAllocation big2 = ring.Allocate(2500, 1);
+    CHECK(big2.page == big.page);
+    CHECK(ring.GetStats().pagesCreated == 0);
+
+    // free page보다 큰 요청 → 새로 만듦
+    const UploadAllocation big3 = ring.Allocate(5000, 1);
+    CHECK(big3.page != big.page);
+    CHECK(fake.mem[big3.page].size() >= 5000);
+    ring.EndFrame(2);
+}
+
+TEST_CASE(CreateFailureReturnsNull)
+{
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 256);
+    fake.failCreate = true;
+
+    ring.BeginFrame(0);
+    CHECK(ring.Allocate(16, 1).cpu == nullptr);
+    CHECK(ring.Allocate(1000, 1).cpu == nullptr);
+
+    fake.failCreate = false;
+    CHECK(ring.Allocate(16, 1).cpu != nullptr);
+    ring.EndFrame(1);
+}
+
+TEST_CASE(RandomizedNoOverlapWithInFlight)
+{
+    // 가짜 GPU가 2~3 프레임 늦게 fence 완료, 가끔 할당 스파이크와 page보다 큰 요청
+    std::mt19937 rng(3);
+    FakePages fake;
+    UploadRing ring;
+    fake.Attach(ring, 4096);
+
+    std::vector<Range> live;
+    std::vector<uint64_t> submitted;
+    uint64_t completed = 0;
+    uint64_t nextFence = 1;
+
+    for (int frame = 0; frame < 3000; ++frame)
+    {
+        while (submitted.size() > 2u + (rng() % 3 == 0 ? 1u : 0u))
+        {
+            completed = submitted.front();
+            submitted.erase(submitted.begin());
+        }
+
+        ring.BeginFrame(completed);
+        std::erase_if(live, [&](const Range& r) { return r.fence <= completed; });
+
+        const int count = (frame % 500 < 50) ? 200 : (int)(rng() % 20);
+        std::vector<Range> mine;
+        for (int i = 0; i < count; ++i)
+        {
+            const uint64_t size = (rng() % 50 == 0) ? 5000 + rng() % 9000 : 1 + rng() % 700;
+            const uint64_t align = 1ull << (rng() % 9);
+
+            const UploadAllocation a = ring.Allocate(size, align);
+            CHECK(a.cpu != nullptr);
+            if (!a.cpu)
+                continue;
+
+            CHECK(a.offset % align == 0);
+            CHECK(a.offset + a.size <= fake.mem[a.page].size());
+            CHECK(a.cpu == fake.mem[a.page].data() + a.offset);
+
+            // GPU가 아직 읽을 수 있는 범위 / 이번 프레임에 이미 준 범위와 겹치면 안 됨
+            for (const Range& r : live)
+                CHECK(!Overlaps(r, a));
+            for (const Range& r : mine)
+                CHECK(!Overlaps(r, a));
+
+            mine.push_back({ a.page, a.offset, a.size, 0 });
+        }
+
+        const uint64_t fence = nextFence++;
+        for (Range& r : mine)
+        {
+            r.fence = fence;
+            live.push_back(r);
+        }
+        ring.EndFrame(fence);
+        submitted.push_back(fence);
+    }
+
+    // page 재활용이 실제로 일어나서 page 수가 유한하게 머묾
+    CHECK(ring.GetStats().pages < 200);
+
+    ring.Shutdown();
+    CHECK(fake.destroyed == fake.mem.size());
+}
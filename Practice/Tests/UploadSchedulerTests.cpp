@@ -0,0 +1,330 @@
+﻿#include "TestFramework.h"
+#include "UploadScheduler.h"
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+// UploadScheduler: 가짜 업로드 큐로 예산 / 취소 / Flush 확인
+// - FakeQueue는 제출마다 녹화된 요청 목록을 남기고 fence를 1씩 올림 (완료는 테스트가 직접 진행)
+// - 완료 콜백은 (요청, fence) 기록 → 취소된 요청은 안 와야 하고, fence가 끝나기 전에도 안 와야 함
+
+namespace
+{
+    struct FakeQueue final : IUploadQueue
+    {
+        uint64_t next = 0;
+        uint64_t completed = 0;
+        std::vector<std::vector<UploadRequest>> submits;
+        std::vector<UploadRequest> open;
+        int failAfter = -1;         // 녹화 n개 이후로는 실패 (-1 = 안 함)
+        int recorded = 0;
+
+        bool RecordUpload(const UploadRequest& r) override
+        {
+            if (failAfter >= 0 && recorded >= failAfter)
+                return false;
+            ++recorded;
+            open.push_back(r);
+            return true;
+        }
+
+        uint64_t SubmitUploads() override
+        {
+            submits.push_back(open);
+            open.clear();
+            return ++next;
+        }
+
+        uint64_t GetCompletedUploadFence() const override { return completed; }
+
+        void WaitUploadFence(uint64_t fenceValue) override
+        {
+            if (completed < fenceValue)
+                completed = fenceValue;
+        }
+
+        void CompleteAll() { completed = next; }
+    };
+
+    using Completed = std::vector<std::pair<UploadRequest, uint64_t>>;
+
+    UploadScheduler::CompleteFn Record(Completed& out)
+    {
+        return [&out](const UploadRequest& r, uint64_t fence) { out.push_back({ r, fence }); };
+    }
+}
+
+TEST_CASE(DuplicateRequestsAreIgnored)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(8, 1 << 20, 1 << 20, Record(done));
+
+    CHECK(s.Request(UploadKind::Mesh, 1, 100));
+    CHECK(!s.Request(UploadKind::Mesh, 1, 100));
+    CHECK(s.Request(UploadKind::Texture, 1, 100));     // 종류가 다르면 다른 에셋
+    CHECK(s.GetStats().queued == 2);
+
+    FakeQueue q;
+    s.BeginFrame(0);
+    s.Pump(q);
+    CHECK(!s.Request(UploadKind::Mesh, 1, 100));       // 진행 중에도 무시
+    CHECK(s.IsPending(UploadKind::Mesh, 1));
+
+    q.CompleteAll();
+    s.BeginFrame(q.completed);
+    CHECK(done.size() == 2);
+    CHECK(!s.IsPending(UploadKind::Mesh, 1));
+    CHECK(s.Request(UploadKind::Mesh, 1, 100));        // 끝난 뒤에는 다시 요청 가능
+}
+
+TEST_CASE(PerSubmitCountLimit)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(3, 1 << 20, 1 << 20, Record(done));
+    for (uint32_t i = 1; i <= 7; ++i)
+        s.Request(UploadKind::Mesh, i, 100);
+
+    FakeQueue q;
+    s.BeginFrame(0);
+    s.Pump(q);
+
+    // 7개, 제출당 3개 → 3 + 3 + 1
+    CHECK(q.submits.size() == 3);
+    if (q.submits.size() == 3)
+        CHECK(q.submits[0].size() == 3 && q.submits[1].size() == 3 && q.submits[2].size() == 1);
+    CHECK(s.GetStats().submitsThisFrame == 3);
+    CHECK(s.GetStats().inFlight == 7);
+    CHECK(s.GetStats().queued == 0);
+
+    // fence 2까지 끝 → 앞 두 제출(6개)만 완료, 요청 순서대로
+    q.completed = 2;
+    s.BeginFrame(q.completed);
+    CHECK(done.size() == 6);
+    CHECK(s.GetStats().completedThisFrame == 6);
+    CHECK(done.front().first.id == 1 && done.front().second == 1);
+    CHECK(done.back().first.id == 6 && done.back().second == 2);
+    CHECK(s.GetStats().inFlight == 1);
+}
+
+TEST_CASE(PerSubmitAndPerFrameByteBudgets)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(8, 1000, 2500, Record(done));
+    for (uint32_t i = 0; i < 10; ++i)
+        s.Request(UploadKind::Texture, i, 600);
+
+    FakeQueue q;
+    s.BeginFrame(0);
+    s.Pump(q);
+
+    // 제출당 1000 → 600짜리는 하나씩, 프레임 2500 → 4개(2400)에서 멈춤
+    CHECK(s.GetStats().recordedThisFrame == 4);
+    CHECK(s.GetStats().bytesThisFrame == 2400);
+    CHECK(q.submits.size() == 4);
+    for (const auto& sub : q.submits)
+        CHECK(sub.size() == 1);
+    CHECK(s.GetStats().queued == 6);
+
+    // 다음 프레임에 이어서
+    s.BeginFrame(q.completed);
+    s.Pump(q);
+    CHECK(s.GetStats().recordedThisFrame == 4);
+    CHECK(s.GetStats().queued == 2);
+
+    // 작은 것들은 한 제출에 바이트 상한까지 모임
+    UploadScheduler small;
+    small.Initialize(8, 1000, 1 << 20, nullptr);
+    for (uint32_t i = 0; i < 6; ++i)
+        small.Request(UploadKind::Mesh, i, 300);
+    FakeQueue q2;
+    small.BeginFrame(0);
+    small.Pump(q2);
+    CHECK(q2.submits.size() == 2);
+    if (q2.submits.size() == 2)
+        CHECK(q2.submits[0].size() == 3 && q2.submits[1].size() == 3);
+}
+
+TEST_CASE(OversizedAssetStillMovesOnePerFrame)
+{
+    UploadScheduler s;
+    s.Initialize(8, 100, 100, nullptr);
+    s.Request(UploadKind::Texture, 1, 5000);
+    s.Request(UploadKind::Texture, 2, 10);
+
+    FakeQueue q;
+    s.BeginFrame(0);
+    s.Pump(q);
+    CHECK(q.submits.size() == 1);
+    if (q.submits.size() == 1)
+        CHECK(q.submits[0].size() == 1 && q.submits[0][0].id == 1);
+    CHECK(s.GetStats().queued == 1);
+
+    s.BeginFrame(q.completed);
+    s.Pump(q);
+    CHECK(s.GetStats().queued == 0);
+}
+
+TEST_CASE(CancelWhileQueued)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(8, 1 << 20, 1 << 20, Record(done));
+    s.Request(UploadKind::Mesh, 10, 10);
+    s.Request(UploadKind::Mesh, 11, 10);
+    s.Cancel(UploadKind::Mesh, 10);
+
+    CHECK(!s.IsPending(UploadKind::Mesh, 10));
+    CHECK(s.GetStats().queued == 1);
+
+    FakeQueue q;
+    s.Pump(q);
+    CHECK(q.submits.size() == 1);
+    if (q.submits.size() == 1)
+        CHECK(q.submits[0].size() == 1 && q.submits[0][0].id == 11);
+
+    q.CompleteAll();
+    s.BeginFrame(q.completed);
+    CHECK(done.size() == 1 && done[0].first.id == 11);
+}
+
+TEST_CASE(CancelInFlightSkipsCallback)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(8, 1 << 20, 1 << 20, Record(done));
+    s.Request(UploadKind::Mesh, 6, 100);
+    s.Request(UploadKind::Mesh, 7, 100);
+
+    FakeQueue q;
+    s.Pump(q);
+    s.Cancel(UploadKind::Mesh, 6);
+    CHECK(!s.IsPending(UploadKind::Mesh, 6));
+
+    q.CompleteAll();
+    s.BeginFrame(q.completed);
+    CHECK(done.size() == 1 && done[0].first.id == 7);
+    CHECK(s.GetStats().inFlight == 0);
+}
+
+TEST_CASE(ReRequestAfterCancel)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(8, 1 << 20, 1 << 20, Record(done));
+    FakeQueue q;
+
+    // 대기 중 취소 → 다시 요청: 한 번만 녹화
+    s.Request(UploadKind::Mesh, 20, 10);
+    s.Cancel(UploadKind::Mesh, 20);
+    CHECK(s.Request(UploadKind::Mesh, 20, 10));
+    s.Pump(q);
+    CHECK(q.submits.size() == 1);
+    if (q.submits.size() == 1)
+        CHECK(q.submits[0].size() == 1);
+
+    // 진행 중 취소 → 다시 요청: 옛 제출 완료는 무시, 새 제출이 끝나야 콜백
+    s.Cancel(UploadKind::Mesh, 20);
+    CHECK(s.Request(UploadKind::Mesh, 20, 10));
+    q.CompleteAll();
+    s.BeginFrame(q.completed);
+    CHECK(done.empty());
+    CHECK(s.IsPending(UploadKind::Mesh, 20));
+
+    s.Pump(q);
+    CHECK(done.empty());
+    q.CompleteAll();
+    s.BeginFrame(q.completed);
+    CHECK(done.size() == 1 && done[0].first.id == 20 && done[0].second == q.next);
+    CHECK(!s.IsPending(UploadKind::Mesh, 20));
+}
+
+TEST_CASE(RecordFailureStaysQueued)
+{
+    UploadScheduler s;
+    s.Initialize(8, 1 << 20, 1 << 20, nullptr);
+    for (uint32_t i = 0; i < 5; ++i)
+        s.Request(UploadKind::Mesh, i, 1);
+
+    FakeQueue q;
+    q.failAfter = 2;
+    s.Pump(q);
+    CHECK(s.GetStats().queued == 3);
+    CHECK(s.GetStats().inFlight == 2);
+    CHECK(q.submits.size() == 1);
+
+    q.failAfter = -1;
+    s.Flush(q);
+    CHECK(s.GetStats().queued == 0);
+    CHECK(s.GetStats().inFlight == 0);
+    CHECK(s.GetStats().totalCompleted == 5);
+}
+
+TEST_CASE(FlushIgnoresBudgetAndCompletes)
+{
+    Completed done;
+    UploadScheduler s;
+    s.Initialize(2, 100, 100, Record(done));
+    for (uint32_t i = 0; i < 10; ++i)
+        s.Request(UploadKind::Texture, i, 600);
+
+    FakeQueue q;
+    s.Flush(q);
+    CHECK(s.GetStats().queued == 0);
+    CHECK(s.GetStats().inFlight == 0);
+    CHECK(done.size() == 10);
+    CHECK(q.completed == q.next);
+    for (uint32_t i = 0; i < (uint32_t)done.size(); ++i)
+        CHECK(done[i].first.id == i && done[i].second <= q.completed);
+}
+
+TEST_CASE(RandomizedEveryLiveRequestCompletesOnce)
+{
+    std::mt19937 rng(7);
+    FakeQueue q;
+    std::set<uint32_t> live;
+    bool lateOrUnknown = false;
+
+    UploadScheduler s;
+    s.Initialize(4, 500, 1500, [&](const UploadRequest& r, uint64_t fence) {
+        if (fence > q.completed || live.count(r.id) == 0)
+            lateOrUnknown = true;
+        live.erase(r.id);
+    });
+
+    for (int it = 0; it < 50000; ++it)
+    {
+        const uint32_t op = rng() % 5;
+        const uint32_t id = rng() % 200;
+        if (op == 0)
+        {
+            if (s.Request(UploadKind::Mesh, id, rng() % 300))
+                live.insert(id);
+            else
+                CHECK(live.count(id) == 1);
+        }
+        else if (op == 1)
+        {
+            s.Cancel(UploadKind::Mesh, id);
+            live.erase(id);
+        }
+        else if (op == 2)
+        {
+            s.Pump(q);
+        }
+        else if (op == 3)
+        {
+            if (q.completed < q.next)
+                q.completed += 1 + rng() % (q.next - q.completed);
+            s.BeginFrame(q.completed);
+        }
+    }
+
+    s.Flush(q);
+    CHECK(!lateOrUnknown);
+    CHECK(live.empty());
+    CHECK(s.GetStats().queued == 0 && s.GetStats().inFlight == 0);
+}